@@ -82,6 +82,80 @@ THE SOFTWARE.
  */
 extern "C" RocalContext ROCAL_API_CALL rocalCreate(size_t batch_size, RocalProcessMode affinity, int gpu_id = 0, size_t cpu_thread_count = 1, size_t prefetch_queue_depth = 3, RocalTensorOutputType output_tensor_data_type = RocalTensorOutputType::ROCAL_FP32);
 
+/*!
+ * \brief  rocalSetSharedDataService attaches the pipeline to a process-wide data service shared with other pipelines. The image loaders created afterwards read and decode through the shared service, so each sample is decoded once and fanned out to every attached pipeline, which then runs its own augmentations on it.
+ * \ingroup group_rocal
+ * \note All the pipelines attached to a service must use the same reader and decoder configuration and output size. Each pipeline reads the shared batches at its own pace and resets on its own, a pipeline that falls too far behind decodes its batches itself until it catches up. Only the single shard image loaders with the TurboJPEG/OpenCV decoders are supported.
+ * \param [in] context the rocal context
+ * \param [in] service_name name identifying the shared data service in the process
+ * \param [in] num_pipelines number of pipelines expected to attach to the service, loading starts once all of them are built
+ * \return A \ref RocalStatus - A status code indicating the success or failure
+ */
+extern "C" RocalStatus ROCAL_API_CALL rocalSetSharedDataService(RocalContext context, const char* service_name, unsigned num_pipelines);
+
+/*!
+ * \brief  rocalSetQuarantineFile persists the samples quarantined by the image loaders to a file. Samples listed in the file are left out of the reader's index and new failing samples are appended to it, so they are skipped in later runs.
+ * \ingroup group_rocal
+ * \note Must be called before the loaders are created. Without it the quarantine is kept in memory for the lifetime of the pipeline.
+ * \param [in] context the rocal context
+ * \param [in] file_path path of the quarantine file, created if it doesn't exist
+ * \return A \ref RocalStatus - A status code indicating the success or failure
+ */
+extern "C" RocalStatus ROCAL_API_CALL rocalSetQuarantineFile(RocalContext context, const char* file_path);
+
+/*!
+ * \brief  rocalSetContinuousEpochs makes the image loaders run the epochs back to back. At the end of an epoch each loader rewinds and reshuffles its reader on its own and keeps prefetching, so the pipeline never runs out of data and rocalResetLoaders is not needed between epochs.
+ * \ingroup group_rocal
+ * \note Must be called before the loaders are created. The epoch of each batch is reported by rocalGetBatchEpoch() and rocalIsLastBatchOfEpoch(). rocalGetRemainingImages() counts the images left in the epoch of the last returned batch and starts over with the next epoch after its last batch. Not supported with the shared data service.
+ * \param [in] context the rocal context
+ * \param [in] enable true to run the epochs back to back
+ * \return A \ref RocalStatus - A status code indicating the success or failure
+ */
+extern "C" RocalStatus ROCAL_API_CALL rocalSetContinuousEpochs(RocalContext context, bool enable);
+
+/*!
+ * \brief  rocalSetFileScanOptions function sets how the file readers list the dataset files
+ * \ingroup group_rocal
+ * \note Must be called before the readers are added to the pipeline
+ * \param [in] context the rocal context
+ * \param [in] manifest_dir folder the file listings are cached in, keyed by the folder modification times, empty to list the files every time
+ * \param [in] trust_file_list true to take the files of a file list as given without checking that they exist
+ * \return A \ref RocalStatus - A status code indicating the success or failure
+ */
+extern "C" RocalStatus ROCAL_API_CALL rocalSetFileScanOptions(RocalContext context, const char *manifest_dir, bool trust_file_list);
+
+/*!
+ * \brief  rocalSetHostMemoryOptions function sets how the host memory of the output ring buffer and the loader buffers is mapped
+ * \ingroup group_rocal
+ * \note Must be called before the readers are added to the pipeline, the memory is allocated once and kept until the context is released. Without this call the host buffers are allocated from the heap, and the pinned ones with hipHostMalloc.
+ * \param [in] context the rocal context
+ * \param [in] huge_pages the \ref RocalHugePageMode the host buffers use
+ * \param [in] prefault true to touch the pages when they are mapped, which moves the page faults to the pipeline build
+ * \param [in] numa_node the NUMA node the host buffers are bound to, -1 to leave the placement to the kernel
+ * \return A \ref RocalStatus - A status code indicating the success or failure
+ */
+extern "C" RocalStatus ROCAL_API_CALL rocalSetHostMemoryOptions(RocalContext context, RocalHugePageMode huge_pages, bool prefault, int numa_node);
+
+/*!
+ * \brief  rocalSetRecordCheckPolicy function makes the readers of record files verify every record they read. The TFRecord readers check the CRC32C of the record length and data, the MXNet RecordIO readers, whose records carry no checksum, check the record magic and length.
+ * \ingroup group_rocal
+ * \note Must be called before the readers are added to the pipeline. The counters of the checked and corrupted records are reported by rocalGetRecordCheckStats().
+ * \param [in] context the rocal context
+ * \param [in] policy the \ref RocalRecordCheckPolicy applied to the corrupted records, ROCAL_RECORD_CHECK_OFF to not check the records
+ * \return A \ref RocalStatus - A status code indicating the success or failure
+ */
+extern "C" RocalStatus ROCAL_API_CALL rocalSetRecordCheckPolicy(RocalContext context, RocalRecordCheckPolicy policy);
+
+/*!
+ * \brief  rocalSetGraphOptimization function enables or disables the rewrites of the augmentation graph done when the pipeline is built. Copy and Nop nodes are dropped, Crop and Resize nodes followed by a Flip are fused and the nodes no output depends on are removed. The outputs are the same either way.
+ * \ingroup group_rocal
+ * \note Must be called before rocalVerify(). The graph is optimized by default.
+ * \param [in] context the rocal context
+ * \param [in] enable false to add the nodes to the graph as they were created
+ * \return A \ref RocalStatus - A status code indicating the success or failure
+ */
+extern "C" RocalStatus ROCAL_API_CALL rocalSetGraphOptimization(RocalContext context, bool enable);
+
 /*!
  * \brief  rocalVerify function to verify the graph for all the inputs and outputs
  * \ingroup group_rocal
@@ -100,6 +174,36 @@ extern "C" RocalStatus ROCAL_API_CALL rocalVerify(RocalContext context);
  */
 extern "C" RocalStatus ROCAL_API_CALL rocalRun(RocalContext context);
 
+/*!
+ * \brief  rocalGetStateSize returns the number of bytes rocalGetState() writes.
+ * \ingroup group_rocal
+ *
+ * \param [in] context the rocal context
+ * \return Size of the serialized pipeline state in bytes, 0 if the state can't be saved
+ */
+extern "C" size_t ROCAL_API_CALL rocalGetStateSize(RocalContext context);
+
+/*!
+ * \brief  rocalGetState serializes the position of the readers and the random parameters right after the batch returned by the last rocalRun() call. Restoring it with rocalSetState() resumes the pipeline at the next sample without reading through the data set.
+ * \ingroup group_rocal
+ * \note Supported by the image, numpy and video loaders, without the shared data service or an external source. Crops drawn by the loaders themselves (fused crop decoding, random bbox crop) are not part of the state.
+ * \param [in] context the rocal context
+ * \param [out] state buffer of at least rocalGetStateSize() bytes
+ * \return A \ref RocalStatus - A status code indicating the success or failure
+ */
+extern "C" RocalStatus ROCAL_API_CALL rocalGetState(RocalContext context, void* state);
+
+/*!
+ * \brief  rocalSetState resumes the pipeline from a state saved by rocalGetState(). The prefetched batches are dropped and the next rocalRun() returns the batch following the saved one.
+ * \ingroup group_rocal
+ * \note Must be called after rocalVerify() on a pipeline built the same way, with the same seed, as the one the state was saved from. The readers can't be rewound to an earlier epoch than the one they are reading.
+ * \param [in] context the rocal context
+ * \param [in] state buffer filled by rocalGetState()
+ * \param [in] size size of the buffer in bytes
+ * \return A \ref RocalStatus - A status code indicating the success or failure
+ */
+extern "C" RocalStatus ROCAL_API_CALL rocalSetState(RocalContext context, const void* state, size_t size);
+
 /*!
  * \brief  rocalRelease function to free all the resources allocated during the graph creation process.
  * \ingroup group_rocal
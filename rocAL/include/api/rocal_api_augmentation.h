@@ -46,6 +46,21 @@ extern "C" RocalTensor ROCAL_API_CALL rocalSequenceRearrange(RocalContext p_cont
                                                              std::vector<unsigned int> &new_order,
                                                              bool is_output);
 
+/*!
+ * \brief Creates num_views views of every sample decoded by a loader, without decoding the samples again. The output is a [N, V, H, W, C] (NFHWC) or [N, V, C, H, W] (NFCHW) tensor where each of the V views holds a copy of the decoded sample.
+ * \ingroup group_rocal_augmentations
+ * \note The augmentations applied on the output process N * V samples, the random parameters are generated per sample and hence each view gets its own random values, renewed on every batch. The augmented views are stored contiguously in a single output tensor.
+ * \note Accepts U8 and RGB24 input. The input must be the output of a loader.
+ * \note The labels are repeated for every view, so a batch holds N * V labels in the order of the views. Pipelines reading other metadata (boxes, masks, keypoints) are rejected when they are built.
+ * \param [in] p_context context for the pipeline.
+ * \param [in] p_input Input Rocal Tensor, output of a loader in NHWC or NCHW layout
+ * \param [in] num_views number of views to be created for each sample
+ * \param [in] is_output True: the output image is needed by user and will be copied to output buffers using the data transfer API calls. False: the output image is just an intermediate image, user is not interested in using it directly. This option allows certain optimizations to be achieved.
+ * \return RocalTensor
+ */
+extern "C" RocalTensor ROCAL_API_CALL rocalMultiView(RocalContext p_context, RocalTensor p_input,
+                                                     unsigned num_views, bool is_output);
+
 /*! \brief Resize images.
  * \note Accepts U8 and RGB24 input.
  * \ingroup group_rocal_augmentations
@@ -631,6 +631,8 @@ extern "C" RocalTensor ROCAL_API_CALL rocalRawTFRecordSourceSingleShard(RocalCon
  * \param [in] loop Determines if the user wants to indefinitely loop through images or not.
  * \param [in] seed Determines the seed used by RNG for shuffling data between shards.
  * \param [in] rocal_sharding_info The members of RocalShardingInfo determines how the data is distributed among the shards and how the last batch is processed by the pipeline.
+ * \param [in] roi_start Start of the region of every numpy array to read, per dimension. Missing dimensions start at 0.
+ * \param [in] roi_shape Shape of the region of every numpy array to read, per dimension. Missing dimensions and negative values read up to the end of the dimension.
  * \return Reference to the output tensor
  */
 extern "C" RocalTensor ROCAL_API_CALL rocalNumpyFileSource(RocalContext context,
@@ -642,7 +644,9 @@ extern "C" RocalTensor ROCAL_API_CALL rocalNumpyFileSource(RocalContext context,
                                                            bool shuffle = false,
                                                            bool loop = false,
                                                            unsigned seed = 0,
-                                                           RocalShardingInfo rocal_sharding_info = RocalShardingInfo());
+                                                           RocalShardingInfo rocal_sharding_info = RocalShardingInfo(),
+                                                           std::vector<int> roi_start = {},
+                                                           std::vector<int> roi_shape = {});
 
 /*! \brief Creates Numpy raw data reader and loader. It allocates the resources and objects required to read raw data stored on the numpy arrays.
  * \ingroup group_rocal_data_loaders
@@ -657,6 +661,8 @@ extern "C" RocalTensor ROCAL_API_CALL rocalNumpyFileSource(RocalContext context,
  * \param [in] shard_count Total shard count
  * \param [in] seed Determines the seed used by RNG for shuffling data between shards.
  * \param [in] rocal_sharding_info The members of RocalShardingInfo determines how the data is distributed among the shards and how the last batch is processed by the pipeline.
+ * \param [in] roi_start Start of the region of every numpy array to read, per dimension. Missing dimensions start at 0.
+ * \param [in] roi_shape Shape of the region of every numpy array to read, per dimension. Missing dimensions and negative values read up to the end of the dimension.
  * \return Reference to the output tensor
  */
 extern "C" RocalTensor rocalNumpyFileSourceSingleShard(RocalContext context,
@@ -669,7 +675,9 @@ extern "C" RocalTensor rocalNumpyFileSourceSingleShard(RocalContext context,
                                                        unsigned shard_id = 0,
                                                        unsigned shard_count = 1,
                                                        unsigned seed = 0,
-                                                       RocalShardingInfo rocal_sharding_info = RocalShardingInfo());
+                                                       RocalShardingInfo rocal_sharding_info = RocalShardingInfo(),
+                                                       std::vector<int> roi_start = {},
+                                                       std::vector<int> roi_shape = {});
 
 /*!
  * \brief Creates a video reader and decoder as a source. It allocates the resources and objects required to read and decode mp4 videos stored on the file systems.
@@ -835,7 +843,8 @@ extern "C" RocalTensor ROCAL_API_CALL rocalVideoFileResizeSingleShard(RocalConte
  * \param [in] out_width output width
  * \param [in] out_height output_height
  * \param [in] filename_prefix if set loader will only load files with the given prefix name
- * \param [in] rocal_sharding_info The members of RocalShardingInfo determines how the data is distributed among the shards and how the last batch is processed by the pipeline.
+ * \param [in] loop Determines if the user wants to indefinitely loops through images or not.
+ * \param [in] memory_resident If set the data files are mapped into memory once and the records are copied from there instead of being read from the files
  * \return Reference to the output tensor
  */
 extern "C" RocalTensor ROCAL_API_CALL rocalRawCIFAR10Source(RocalContext context,
@@ -843,7 +852,7 @@ extern "C" RocalTensor ROCAL_API_CALL rocalRawCIFAR10Source(RocalContext context
                                                             RocalImageColor color_format,
                                                             bool is_output,
                                                             unsigned out_width, unsigned out_height, const char* filename_prefix = "",
-                                                            bool loop = false);
+                                                            bool loop = false, bool memory_resident = false);
 
 /*! \brief Creates CIFAR10 raw data reader and loader. It allocates the resources and objects required to read raw data stored on the file systems. It accepts external sharding information to load a singe shard only.
  * \ingroup group_rocal_data_loaders
@@ -859,6 +868,7 @@ extern "C" RocalTensor ROCAL_API_CALL rocalRawCIFAR10Source(RocalContext context
  * \param [in] out_height output_height
  * \param [in] filename_prefix if set loader will only load files with the given prefix name
  * \param [in] rocal_sharding_info The members of RocalShardingInfo determines how the data is distributed among the shards and how the last batch is processed by the pipeline.
+ * \param [in] memory_resident If set the data files are mapped into memory once and the records are copied from there instead of being read from the files
  * \return Reference to the output tensor
  */
 extern "C" RocalTensor ROCAL_API_CALL rocalRawCIFAR10SourceSingleShard(RocalContext context,
@@ -870,7 +880,8 @@ extern "C" RocalTensor ROCAL_API_CALL rocalRawCIFAR10SourceSingleShard(RocalCont
                                                                        bool shuffle,
                                                                        bool loop,
                                                                        unsigned out_width, unsigned out_height, const char* filename_prefix = "",
-                                                                       RocalShardingInfo rocal_sharding_info = RocalShardingInfo());                                                            
+                                                                       RocalShardingInfo rocal_sharding_info = RocalShardingInfo(),
+                                                                       bool memory_resident = false);
 
 /*! \brief reset Loaders
  * \ingroup group_rocal_data_loaders
@@ -82,6 +82,24 @@ extern "C" void ROCAL_API_CALL rocalSetOutputs(RocalContext p_context, unsigned
  */
 extern "C" RocalTensorList ROCAL_API_CALL rocalGetOutputTensors(RocalContext p_context);
 
+/*!
+ * \brief leases the output tensors of the current batch instead of copying them
+ * \ingroup group_rocal_data_transfer
+ * \note Only host outputs can be leased. The pipeline does not write to the leased buffers until they are released with rocalReleaseOutput() and keeps producing batches in other buffers meanwhile
+ * \param [in] p_context Rocal Context
+ * \return A RocalTensorList pointing at the leased buffers, nullptr on failure
+ */
+extern "C" RocalTensorList ROCAL_API_CALL rocalAcquireOutput(RocalContext p_context);
+
+/*!
+ * \brief returns the buffers of an output tensor list leased with rocalAcquireOutput() to the pipeline
+ * \ingroup group_rocal_data_transfer
+ * \param [in] p_context Rocal Context
+ * \param [in] output the tensor list returned by rocalAcquireOutput(), it is not valid after the call
+ * \return A \ref RocalStatus - A status code indicating the success or failure
+ */
+extern "C" RocalStatus ROCAL_API_CALL rocalReleaseOutput(RocalContext p_context, RocalTensorList output);
+
 /*!
  * \brief Creates ExternalSourceFeedInput for data transfer
  * \ingroup group_rocal_data_transfer
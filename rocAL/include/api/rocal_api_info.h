@@ -60,7 +60,7 @@ extern "C" int ROCAL_API_CALL rocalGetOutputColorFormat(RocalContext rocal_conte
  * \brief Retrieves the number of remaining images.
  * \ingroup group_rocal_info
  * \param [in] rocal_context The RocalContext.
- * \return The number of remaining images yet to be processed.
+ * \return The number of remaining images yet to be processed. With rocalSetContinuousEpochs() the images left in the epoch of the last returned batch.
  */
 
 extern "C" size_t ROCAL_API_CALL rocalGetRemainingImages(RocalContext rocal_context);
@@ -113,4 +113,89 @@ extern "C" TimingInfo ROCAL_API_CALL rocalGetTimingInfo(RocalContext rocal_conte
  */
 extern "C" size_t ROCAL_API_CALL rocalGetLastBatchPaddedSize(RocalContext rocal_context);
 
+/*!
+ * \brief Retrieves the memory held by the pipeline.
+ * \ingroup group_rocal_info
+ * \param [in] rocal_context The RocalContext
+ * \return The bytes held for the intermediate tensors, the output ring buffer and the loader buffers, 0 before rocalVerify is called.
+ */
+extern "C" size_t ROCAL_API_CALL rocalGetPeakMemorySize(RocalContext rocal_context);
+
+/*!
+ * \brief Retrieves the statistics of the host memory the pipeline maps for the output ring buffer and the loader buffers.
+ * \ingroup group_rocal_info
+ * \param [in] rocal_context The RocalContext
+ * \return The \ref RocalHostMemoryStats of the pipeline, all zero unless rocalSetHostMemoryOptions() was called.
+ */
+extern "C" RocalHostMemoryStats ROCAL_API_CALL rocalGetHostMemoryStats(RocalContext rocal_context);
+
+/*!
+ * \brief Retrieves the counters of the decoded frame cache the sequence reader shares between overlapping sequences.
+ * \ingroup group_rocal_info
+ * \param [in] rocal_context The RocalContext
+ * \return The \ref RocalFrameCacheStats of the pipeline, all zero unless the sequence reader decodes with TurboJPEG.
+ */
+extern "C" RocalFrameCacheStats ROCAL_API_CALL rocalGetFrameCacheStats(RocalContext rocal_context);
+
+/*!
+ * \brief Retrieves the epoch of the current output batch.
+ * \ingroup group_rocal_info
+ * \param [in] rocal_context The RocalContext
+ * \return The index of the epoch the batch returned by the last rocalRun() call was read in, counted from 0. Always 0 unless rocalSetContinuousEpochs() is enabled.
+ */
+extern "C" size_t ROCAL_API_CALL rocalGetBatchEpoch(RocalContext rocal_context);
+
+/*!
+ * \brief Tells if the current output batch closes its epoch.
+ * \ingroup group_rocal_info
+ * \param [in] rocal_context The RocalContext
+ * \return true if the batch returned by the last rocalRun() call is the last one of its epoch, only reported when rocalSetContinuousEpochs() is enabled.
+ */
+extern "C" bool ROCAL_API_CALL rocalIsLastBatchOfEpoch(RocalContext rocal_context);
+
+/*!
+ * \brief Retrieves the number of quarantined samples.
+ * \ingroup group_rocal_info
+ * \param [in] rocal_context The RocalContext
+ * \return The number of samples that failed decoding and are skipped by the loaders, including the ones loaded from the quarantine file.
+ */
+extern "C" size_t ROCAL_API_CALL rocalGetQuarantinedSampleCount(RocalContext rocal_context);
+
+/*!
+ * \brief Retrieves the lengths of the quarantined sample names.
+ * \ingroup group_rocal_info
+ * \note Samples keep being quarantined while the pipeline runs, only the first count samples are reported so the buffers sized for count stay valid.
+ * \param [in] rocal_context The RocalContext
+ * \param [out] buf user buffer of count elements to be filled with the length of each quarantined sample name
+ * \param [in] count number of quarantined samples to report, as returned by rocalGetQuarantinedSampleCount()
+ * \return The size of the buffer needs to be provided by user to get the quarantined sample names
+ */
+extern "C" size_t ROCAL_API_CALL rocalGetQuarantinedSampleNamesLen(RocalContext rocal_context, int* buf, size_t count);
+
+/*!
+ * \brief Retrieves the quarantined sample names, the file path or record id of each sample.
+ * \ingroup group_rocal_info
+ * \param [in] rocal_context The RocalContext
+ * \param [out] buf user buffer to be filled with the concatenated names of the first count quarantined samples
+ * \param [in] count number of quarantined samples to report, as passed to rocalGetQuarantinedSampleNamesLen()
+ */
+extern "C" void ROCAL_API_CALL rocalGetQuarantinedSampleNames(RocalContext rocal_context, char* buf, size_t count);
+
+/*!
+ * \brief Retrieves the number of shards the record check has counters for.
+ * \ingroup group_rocal_info
+ * \param [in] rocal_context The RocalContext
+ * \return The number of shards records were checked for, 0 unless rocalSetRecordCheckPolicy() enabled the check.
+ */
+extern "C" size_t ROCAL_API_CALL rocalGetRecordCheckShardCount(RocalContext rocal_context);
+
+/*!
+ * \brief Retrieves the counters of the checked and corrupted records of each shard.
+ * \ingroup group_rocal_info
+ * \param [in] rocal_context The RocalContext
+ * \param [out] stats user buffer of count elements to be filled with the counters of the shards, by increasing shard id
+ * \param [in] count number of shards to report, as returned by rocalGetRecordCheckShardCount()
+ */
+extern "C" void ROCAL_API_CALL rocalGetRecordCheckStats(RocalContext rocal_context, RocalRecordCheckStats* stats, size_t count);
+
 #endif  // MIVISIONX_ROCAL_API_INFO_H
@@ -242,6 +242,31 @@ extern "C" RocalMetaData ROCAL_API_CALL rocalCreateTextCifar10LabelReader(RocalC
  */
 extern "C" void ROCAL_API_CALL rocalGetOneHotImageLabels(RocalContext rocal_context, void* buf, int numOfClasses, RocalOutputMemType output_mem_type);
 
+/*! \brief copies the image labels of the output batch to a user buffer in the requested data type
+ * \ingroup group_rocal_meta_data
+ * \note The labels are converted while they are written, a sample without a label gets -1
+ * \param [in] rocal_context rocal context
+ * \param [out] buf user's buffer that will be filled with labels. It needs to hold batch_size labels of label_type
+ * \param [in] label_type the data type of the labels written to buf
+ * \param [in] output_mem_type whether buf is in host or device memory
+ * \return A \ref RocalStatus - A status code indicating the success or failure
+ */
+extern "C" RocalStatus ROCAL_API_CALL rocalCopyImageLabels(RocalContext rocal_context, void* buf, RocalLabelType label_type, RocalOutputMemType output_mem_type = ROCAL_MEMCPY_HOST);
+
+/*! \brief copies the one hot encoded image labels of the output batch to a user buffer in the requested data type
+ * \ingroup group_rocal_meta_data
+ * \note The labels are encoded straight into host buffers, large batches are encoded in parallel. Device buffers are written from a host buffer kept by the pipeline
+ * \param [in] rocal_context rocal context
+ * \param [out] buf user's buffer that will be filled with labels. It needs to hold batch_size * num_of_classes values of label_type
+ * \param [in] num_of_classes the number of classes for a image dataset
+ * \param [in] label_type the data type of the encoded labels
+ * \param [in] label_smoothing share of the probability spread evenly over all the classes, only supported for ROCAL_LABEL_FP32
+ * \param [in] output_mem_type whether buf is in host or device memory
+ * \return A \ref RocalStatus - A status code indicating the success or failure
+ */
+extern "C" RocalStatus ROCAL_API_CALL rocalCopyOneHotImageLabels(RocalContext rocal_context, void* buf, unsigned num_of_classes, RocalLabelType label_type,
+                                                                 float label_smoothing = 0.0f, RocalOutputMemType output_mem_type = ROCAL_MEMCPY_HOST);
+
 extern "C" void ROCAL_API_CALL rocalRandomBBoxCrop(RocalContext p_context, bool all_boxes_overlap, bool no_crop, RocalFloatParam aspect_ratio = NULL, bool has_shape = false, int crop_width = 0, int crop_height = 0, int num_attempts = 1, RocalFloatParam scaling = NULL, int total_num_attempts = 0, int64_t seed = 0);
 
 /*! \brief get sequence starting frame number
@@ -317,6 +342,51 @@ extern "C" void ROCAL_API_CALL rocalBoxIouMatcher(RocalContext p_context, std::v
  */
 extern "C" RocalTensorList ROCAL_API_CALL rocalGetMatchedIndices(RocalContext p_context);
 
+/*! \brief API to rasterize the polygon masks of the COCO reader into uint8 masks at the end of the pipeline
+ * \ingroup group_rocal_meta_data
+ * \note The polygons are drawn after the crop, resize and flip augmentations moved them, so mask_width and mask_height are normally the output image size
+ * \param [in] p_context rocAL context
+ * \param [in] mask_width width of the masks
+ * \param [in] mask_height height of the masks
+ * \param [in] mask_type instance masks set the pixels of each object to 1 in a plane of its own, semantic masks set the pixels of each object to its label in a single plane
+ * \param [in] max_instances the most objects of an image that get an instance mask
+ * \return A \ref RocalStatus - A status code indicating the success or failure
+ */
+extern "C" RocalStatus ROCAL_API_CALL rocalPolygonMaskRasterizer(RocalContext p_context, unsigned mask_width, unsigned mask_height,
+                                                                 RocalMaskType mask_type = ROCAL_INSTANCE_MASKS, unsigned max_instances = 100);
+
+/*! \brief API to return the rasterized masks of the output batch
+ * \ingroup group_rocal_meta_data
+ * \param [in] p_context rocAL context
+ * \return RocalTensorList of uint8 masks, of dims {instances, mask_height, mask_width} for instance masks and {mask_height, mask_width} for semantic masks
+ */
+extern "C" RocalTensorList ROCAL_API_CALL rocalGetRasterizedMasks(RocalContext p_context);
+
+/*! \brief API to generate HRNet style Gaussian target heatmaps and target weights from the joints of the COCO key points reader
+ * \ingroup group_rocal_meta_data
+ * \note The joints are taken in the coordinates of the output images, of the pose_output_width x pose_output_height given to rocalCreateCOCOReaderKeyPoints()
+ * \param [in] p_context rocAL context
+ * \param [in] heatmap_width width of the heatmaps
+ * \param [in] heatmap_height height of the heatmaps
+ * \param [in] sigma standard deviation of the Gaussians in heatmap cells, 0 uses the sigma given to rocalCreateCOCOReaderKeyPoints()
+ * \return A \ref RocalStatus - A status code indicating the success or failure
+ */
+extern "C" RocalStatus ROCAL_API_CALL rocalKeypointHeatmaps(RocalContext p_context, unsigned heatmap_width, unsigned heatmap_height, float sigma = 0.0);
+
+/*! \brief API to return the key point heatmaps of the output batch
+ * \ingroup group_rocal_meta_data
+ * \param [in] p_context rocAL context
+ * \return RocalTensorList of float heatmaps of dims {joints, heatmap_height, heatmap_width}
+ */
+extern "C" RocalTensorList ROCAL_API_CALL rocalGetKeypointHeatmaps(RocalContext p_context);
+
+/*! \brief API to return the key point target weights of the output batch
+ * \ingroup group_rocal_meta_data
+ * \param [in] p_context rocAL context
+ * \return RocalTensorList of float target weights of dims {joints, 1}, the visibility of each joint or 0 when its Gaussian misses the heatmap
+ */
+extern "C" RocalTensorList ROCAL_API_CALL rocalGetKeypointTargetWeights(RocalContext p_context);
+
 /*! \brief creates webdataset reader
  * \ingroup group_rocal_meta_data
  * \param [in] p_context rocal context
@@ -41,6 +41,8 @@ class rocalTensor {
     virtual void* buffer() = 0;
     virtual unsigned copy_data(void* user_buffer, RocalOutputMemType external_mem_type = ROCAL_MEMCPY_HOST) = 0;
     virtual unsigned copy_data(void* user_buffer, uint x_offset, uint y_offset, uint max_cols, uint max_rows) = 0; // Copy only the ROI to the user_buffer [The padded region is not copied]
+    virtual size_t packed_data_size() = 0; // Size of the buffer needed by copy_data_packed
+    virtual unsigned copy_data_packed(void* user_buffer, std::vector<size_t>& sample_offsets) = 0; // Copy the ROI of every sample back to back to the user_buffer, sample_offsets gets the offset of each sample and the total size
     virtual unsigned num_of_dims() = 0;
     virtual unsigned batch_size() = 0;
     virtual std::vector<size_t> dims() = 0;
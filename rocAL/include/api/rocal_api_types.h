@@ -509,6 +509,98 @@ enum RocalMissingComponentsBehaviour {
     ROCAL_MISSING_COMPONENT_EMPTY = 2
 };
 
+/*! \brief Huge page use of the pipeline host memory
+ *  \ingroup group_rocal_types
+ */
+enum RocalHugePageMode {
+    /*! \brief ROCAL_HUGE_PAGES_NONE - The host buffers use regular pages
+     */
+    ROCAL_HUGE_PAGES_NONE = 0,
+    /*! \brief ROCAL_HUGE_PAGES_TRANSPARENT - The host buffers are aligned to the huge page size and advised for transparent huge pages
+     */
+    ROCAL_HUGE_PAGES_TRANSPARENT = 1,
+    /*! \brief ROCAL_HUGE_PAGES_EXPLICIT - The host buffers are taken from the preallocated huge page pool, transparent huge pages are used when the pool is exhausted
+     */
+    ROCAL_HUGE_PAGES_EXPLICIT = 2
+};
+
+/*! \brief Host memory statistics of the pipeline, covering the output ring buffer and the loader buffers
+ *  \ingroup group_rocal_types
+ */
+struct RocalHostMemoryStats {
+    size_t mapped_bytes;       //!< Bytes mapped for the host buffers, held until the pipeline is released
+    size_t huge_page_bytes;    //!< Mapped bytes backed by or advised for huge pages
+    size_t pinned_bytes;       //!< Mapped bytes page locked for the device
+    size_t in_use_bytes;       //!< Bytes of the buffers currently allocated
+    size_t peak_in_use_bytes;  //!< Largest number of bytes allocated at once
+    size_t allocation_count;   //!< Number of buffers allocated
+    size_t reuse_count;        //!< Number of buffers allocated from memory released by an earlier buffer
+};
+
+/*! \brief Counters of the decoded frame cache of the sequence reader
+ *  \ingroup group_rocal_types
+ */
+struct RocalFrameCacheStats {
+    long long unsigned hits;    //!< Frames of overlapping sequences reused decoded instead of being read and decoded again
+    long long unsigned misses;  //!< Frames of sequences read and decoded
+};
+
+/*! \brief What the readers of record files (TFRecord, MXNet RecordIO) do with a record failing its integrity check
+ *  \ingroup group_rocal_types
+ */
+enum RocalRecordCheckPolicy {
+    /*! \brief ROCAL_RECORD_CHECK_OFF - The records are not checked
+     */
+    ROCAL_RECORD_CHECK_OFF = 0,
+    /*! \brief ROCAL_RECORD_CHECK_SKIP - The record is left out and the next record is read in its place
+     */
+    ROCAL_RECORD_CHECK_SKIP = 1,
+    /*! \brief ROCAL_RECORD_CHECK_SUBSTITUTE - The record is replaced with the previous sample of the batch, or skipped if it comes first in the batch
+     */
+    ROCAL_RECORD_CHECK_SUBSTITUTE = 2,
+    /*! \brief ROCAL_RECORD_CHECK_FAIL - Reading the record fails
+     */
+    ROCAL_RECORD_CHECK_FAIL = 3
+};
+
+/*! \brief Record integrity counters of a shard
+ *  \ingroup group_rocal_types
+ */
+struct RocalRecordCheckStats {
+    size_t shard_id;           //!< Shard the records were read from
+    size_t checked_records;    //!< Records verified
+    size_t corrupted_records;  //!< Records that failed the verification
+};
+
+/*! \brief Data type the image labels are written in
+ *  \ingroup group_rocal_types
+ */
+enum RocalLabelType {
+    /*! \brief ROCAL_LABEL_INT32
+     */
+    ROCAL_LABEL_INT32 = 0,
+    /*! \brief ROCAL_LABEL_INT64
+     */
+    ROCAL_LABEL_INT64 = 1,
+    /*! \brief ROCAL_LABEL_FP32
+     */
+    ROCAL_LABEL_FP32 = 2
+};
+
+/*! \brief Kind of masks drawn from the polygon masks
+ *  \ingroup group_rocal_types
+ */
+enum RocalMaskType {
+    /*! \brief ROCAL_INSTANCE_MASKS
+     * One binary mask per object
+     */
+    ROCAL_INSTANCE_MASKS = 0,
+    /*! \brief ROCAL_SEMANTIC_MASKS
+     * One mask per image holding the label of the object covering each pixel
+     */
+    ROCAL_SEMANTIC_MASKS = 1
+};
+
 struct CameraMatrix {
     float fx;
     float cx;
@@ -32,6 +32,7 @@ class CropMirrorNormalizeNode : public CropNode {
                             const std::vector<Tensor *> &outputs);
     CropMirrorNormalizeNode() = delete;
     void init(int crop_h, int crop_w, float start_x, float start_y, std::vector<float> &mean, std::vector<float> &std_dev, IntParam *mirror);
+    void init(int crop_h, int crop_w, float start_x, float start_y, std::vector<float> &mean, std::vector<float> &std_dev, Parameter<int> *mirror);
     vx_array return_mirror() { return _mirror.default_array(); }
     std::shared_ptr<RocalCropParam> return_crop_param() { return _crop_param; }
 
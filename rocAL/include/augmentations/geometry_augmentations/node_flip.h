@@ -33,6 +33,8 @@ class FlipNode : public Node {
     void init(IntParam *h_flag_param, IntParam *v_flag_param);
     vx_array get_horizontal_flip() { return _horizontal.default_array(); }
     vx_array get_vertical_flip() { return _vertical.default_array(); }
+    Parameter<int> *get_horizontal_param() { return _horizontal.get_param(); }
+    Parameter<int> *get_vertical_param() { return _vertical.get_param(); }
 
    protected:
     void create_node() override;
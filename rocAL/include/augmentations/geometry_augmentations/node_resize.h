@@ -31,6 +31,11 @@ public:
     void init(unsigned dest_width, unsigned dest_height, RocalResizeScalingMode scaling_mode,
               const std::vector<unsigned>& max_size, RocalResizeInterpolationType interpolation_type);
     void adjust_out_roi_size();
+    unsigned get_dest_width() { return _out_width; }
+    unsigned get_dest_height() { return _out_height; }
+    RocalResizeScalingMode get_scaling_mode() { return _scaling_mode; }
+    std::vector<unsigned> get_max_size() { return {_max_width, _max_height}; }
+    RocalResizeInterpolationType get_interpolation_type() { return static_cast<RocalResizeInterpolationType>(_interpolation_type); }
 protected:
     void create_node() override;
     void update_node() override;
@@ -31,6 +31,8 @@ class ResizeMirrorNormalizeNode : public Node {
     ResizeMirrorNormalizeNode() = delete;
     void init(unsigned dest_width, unsigned dest_height, RocalResizeScalingMode scaling_mode, std::vector<unsigned> max_size,
               RocalResizeInterpolationType interpolation_type, std::vector<float> &mean, std::vector<float> &std_dev, IntParam *mirror);
+    void init(unsigned dest_width, unsigned dest_height, RocalResizeScalingMode scaling_mode, std::vector<unsigned> max_size,
+              RocalResizeInterpolationType interpolation_type, std::vector<float> &mean, std::vector<float> &std_dev, Parameter<int> *mirror);
     void adjust_out_roi_size();
     vx_array get_mirror() { return _mirror.default_array(); }
 
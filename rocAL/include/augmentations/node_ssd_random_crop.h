@@ -20,44 +20,13 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 THE SOFTWARE.
 */
 #pragma once
+#include <memory>
+
 #include "augmentations/geometry_augmentations/node_crop.h"
+#include "augmentations/ssd_crop_sampler.h"
 #include "parameters/parameter_crop_factory.h"
 #include "parameters/parameter_factory.h"
 
-// todo:: move this to common header
-template <typename T = std::mt19937, std::size_t state_size = T::state_size>
-class SeededRNG {
-    /*
-     * @param batch_size How many RNGs to store
-     * @param state_size How many seed are used to initialize one RNG. Used to lower probablity of
-     * collisions between seeds used to initialize RNGs in different operators.
-     */
-   public:
-    SeededRNG(int batch_size = 128) {
-        std::random_device source;
-        _batch_size = batch_size;
-        std::size_t _random_data_size = state_size * batch_size;
-        std::vector<std::random_device::result_type> random_data(_random_data_size);
-        std::generate(random_data.begin(), random_data.end(), std::ref(source));
-        _rngs.reserve(batch_size);
-        for (int i = 0; i < (int)(_batch_size * state_size); i += state_size) {
-            std::seed_seq seeds(std::begin(random_data) + i, std::begin(random_data) + i + state_size);
-            _rngs.emplace_back(T(seeds));
-        }
-    }
-
-    /**
-     * Returns engine corresponding to given sample ID
-     */
-    T &operator[](int sample) noexcept {
-        return _rngs[sample % _batch_size];
-    }
-
-   private:
-    std::vector<T> _rngs;
-    int _batch_size;
-};
-
 class SSDRandomCropNode : public CropNode {
    public:
     SSDRandomCropNode(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs);
@@ -68,6 +37,7 @@ class SSDRandomCropNode : public CropNode {
     std::shared_ptr<RocalRandomCropParam> get_crop_param() { return _crop_param; }
     float get_threshold() { return _threshold; }
     std::vector<std::pair<float, float>> get_iou_range() { return _iou_range; }
+    const std::vector<BoundingBoxCord> &get_crop_boxes() { return _crop_boxes; }
     bool is_entire_iou() { return _entire_iou; }
     void set_meta_data_batch() {}
 
@@ -82,8 +52,10 @@ class SSDRandomCropNode : public CropNode {
     size_t _dest_height;
     float _threshold = 0.05;
     std::vector<std::pair<float, float>> _iou_range;
+    std::vector<BoundingBoxCord> _crop_boxes;  //!< Crop of each sample of the last batch, normalized to its image
     int _num_of_attempts = 20;
-    bool _entire_iou = false;
+    bool _entire_iou = true;  //!< Crops are scored with the IoU over the union, not the share of the box kept
     std::shared_ptr<RocalRandomCropParam> _crop_param;
-    SeededRNG<std::mt19937, 4> _rngs;  // setting the state_size to 4 for 4 random parameters.
+    std::unique_ptr<SSDCropSampler> _sampler;
+    uint64_t _iteration = 0;  //!< Batches cropped so far, the counter of the random streams of the samples
 };
@@ -0,0 +1,62 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include <utility>
+#include <vector>
+
+#include "meta_data/meta_data.h"
+#include "parameters/philox.h"
+
+//! Crop picked for one sample, in coordinates normalized to the input image
+struct SSDCrop {
+    BoundingBoxCord box;
+    std::pair<float, float> iou_range;  //!< IoU bounds every ground truth box met against the crop
+    bool fallback;                      //!< Set when no crop was accepted within the trial budget and the whole image was kept
+};
+
+/*! \brief Samples the SSD random crops, the crop of a sample is a pure function of the key, the iteration and the sample index
+ *
+ * Each trial picks one of the SSD minimum IoU options, then draws up to num_attempts windows of 0.3 to 1 times the
+ * image size with an aspect ratio within [0.5, 2]. A window is accepted when the IoU of every box with it is within
+ * the option's range and the center of at least one box falls inside it. The no crop option accepts the whole image.
+ */
+class SSDCropSampler {
+   public:
+    SSDCropSampler(Philox4x32::Key key, unsigned num_attempts) : _key(key), _num_attempts(num_attempts) {}
+    //! boxes are ltrb in pixels of an image of image_width x image_height, or normalized when the size is 0
+    SSDCrop sample(const BoundingBoxCords &boxes, unsigned image_width, unsigned image_height, uint64_t iteration, uint32_t sample_idx) const;
+    /*! Checks a window against boxes held as separate l, t, r, b and area arrays of count normalized boxes
+     *  \return true if every IoU is within [min_iou, max_iou] and at least one box center is inside the window
+     */
+    static bool accepts(const float *l, const float *t, const float *r, const float *b, const float *area, size_t count,
+                        const BoundingBoxCord &window, float min_iou, float max_iou);
+    /*! Trials before falling back to the whole image. A trial draws the no crop option with probability 1 / 7 and that
+     *  option always accepts, so the fallback is reached with probability (6 / 7)^64 < 6e-5, which bounds how far the
+     *  distribution of the crops moves from the unbounded rejection loop
+     */
+    static constexpr unsigned MAX_TRIALS = 64;
+
+   private:
+    const Philox4x32::Key _key;
+    const unsigned _num_attempts;
+};
@@ -50,6 +50,14 @@ enum class DecoderType {
     ROCJPEG_DEC = 7             //!< rocJpeg hardware decoder for decoding jpeg files
 };
 
+//! Describes how the graph reads a decoded image, so the decoder can skip work whose result is never read
+struct DecodeHint {
+    unsigned width = 0, height = 0;                  //!< Smallest decoded size the downstream resize still samples without upscaling, 0 when unknown
+    bool fixed_crop = false;                         //!< True when only the anchored crop window below is read downstream
+    unsigned crop_width = 0, crop_height = 0;        //!< Crop size in pixels of the full resolution image, 0 takes the full dimension
+    float crop_anchor_x = 0.5f, crop_anchor_y = 0.5f;  //!< Normalized crop anchor as used by the fixed crop parameter
+};
+
 class DecoderConfig {
    public:
     DecoderConfig() {}
@@ -64,6 +72,8 @@ class DecoderConfig {
     unsigned get_num_attempts() { return _num_attempts; }
     void set_seed(int seed) { _seed = seed; }
     int get_seed() { return _seed; }
+    void set_decode_hint(const DecodeHint &hint) { _decode_hint = hint; }
+    const DecodeHint &get_decode_hint() const { return _decode_hint; }
 #if ENABLE_HIP
     hipStream_t &get_hip_stream() { return _hip_stream; }
     void set_hip_stream(hipStream_t &stream) { _hip_stream = stream; }
@@ -73,6 +83,7 @@ class DecoderConfig {
     std::vector<float> _random_area, _random_aspect_ratio;
     unsigned _num_attempts = 10;
     int _seed = std::time(0);  // seed for decoder random crop
+    DecodeHint _decode_hint;
 #if ENABLE_HIP
     hipStream_t _hip_stream;
 #endif
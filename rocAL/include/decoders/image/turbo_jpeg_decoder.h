@@ -63,6 +63,9 @@ class TJDecoder : public Decoder {
     std::vector<float> get_bbox_coords() override { return _bbox_coord; }
 
    private:
+    //! Returns the index of the smallest scaling factor whose output still covers the hinted size and fits the max decoded size, -1 if there is none
+    int hinted_scaling_factor(const DecodeHint &hint, size_t original_image_width, size_t original_image_height,
+                              size_t max_decoded_width, size_t max_decoded_height);
     tjhandle m_jpegDecompressor;
     tjscalingfactor *_scaling_factors = nullptr;
     int _num_scaling_factors = 0;
@@ -72,4 +72,24 @@ int tjDecompress2_partial_scale(tjhandle handle, const unsigned char *jpegBuf,
                             unsigned long jpegSize, unsigned char *dstBuf,
                             int width, int pitch, int height, int pixelFormat,
                             int flags, unsigned int crop_width, unsigned int crop_height);
-}
\ No newline at end of file
+
+//! * Decompress a subregion of JPEG image to an RGB, grayscale, or CMYK image.
+//! * The region is written at its own position in the full size output, pixels outside of it are left untouched
+//! * This function doesn't scale the decoded image
+/*!
+  \param handle  TJPeg handle
+  \param jpegBuf compressed jpeg image buffer
+  \param jpegSize Size of the compressed data provided in the input_buffer
+  \param dstBuf user provided output buffer, large enough for the full size image
+  \param pitch  stride of the allocated buffer
+  \param flags  TJPEG flags
+  \param pixelFormat  pixel format of the image
+  \param crop_x, crop_y, crop_width, crop_height requested crop window, decoding is widened to the MCU columns covering it
+*/
+
+int tjDecompress2_partial_window(tjhandle handle, const unsigned char *jpegBuf,
+                                 unsigned long jpegSize, unsigned char *dstBuf,
+                                 int pitch, int pixelFormat, int flags,
+                                 unsigned int crop_x, unsigned int crop_y,
+                                 unsigned int crop_width, unsigned int crop_height);
+}
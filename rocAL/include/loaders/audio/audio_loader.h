@@ -49,6 +49,7 @@ class AudioLoader : public LoaderModule {
     std::vector<std::string> get_id() override;
     DecodedDataInfo get_decode_data_info() override;
     void set_prefetch_queue_depth(size_t prefetch_queue_depth) override;
+    void set_host_memory_arena(std::shared_ptr<HostMemoryArena> arena) override { _circ_buff.set_host_memory_arena(arena); }
     void set_gpu_device_id(int device_id);
     void shut_down() override;
     void feed_external_input(const std::vector<std::string>& input_images_names, const std::vector<unsigned char*>& input_buffer,
@@ -41,6 +41,7 @@ class AudioLoaderSharded : public LoaderModule {
     DecodedDataInfo get_decode_data_info() override;
     Timing timing() override;
     void set_prefetch_queue_depth(size_t prefetch_queue_depth) override;
+    void set_host_memory_arena(std::shared_ptr<HostMemoryArena> arena) override { _host_arena = arena; }
     void shut_down() override;
     void feed_external_input(const std::vector<std::string>& input_images_names, const std::vector<unsigned char*>& input_buffer,
                              const std::vector<ROIxywh>& roi_xywh, unsigned int max_width, unsigned int max_height, unsigned int channels, 
@@ -56,6 +57,7 @@ class AudioLoaderSharded : public LoaderModule {
     size_t _loader_idx;
     size_t _shard_count = 1;
     size_t _prefetch_queue_depth = 0;
+    std::shared_ptr<HostMemoryArena> _host_arena;
     Tensor* _output_tensor = nullptr;
 };
 #endif
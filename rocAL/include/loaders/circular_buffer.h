@@ -29,6 +29,8 @@ THE SOFTWARE.
 #include <queue>
 
 #include "pipeline/commons.h"
+#include "pipeline/host_memory_arena.h"
+#include "pipeline/pipeline_state.h"
 #include "device/device_manager.h"
 #include "device/device_manager_hip.h"
 struct DecodedDataInfo {
@@ -40,6 +42,9 @@ struct DecodedDataInfo {
     std::vector<uint32_t> _audio_samples; //! Amplitude of an audio signal at a specific point in time
     std::vector<uint32_t> _audio_channels; //! Number of audio channels in an audio signal
     std::vector<float> _audio_sample_rates; //! The number of samples of audio carried per second
+    EpochInfo _epoch_info; //! Epoch the batch belongs to
+    ReaderState _reader_state; //! Position of the reader right after the batch was read
+    size_t _skipped_count = 0; //! Reader items skipped while reading the batch, quarantined or failing decode
 };
 
 struct CropImageInfo {
@@ -52,6 +57,7 @@ class CircularBuffer {
     ~CircularBuffer();
     void init(RocalMemType output_mem_type, size_t output_mem_size, size_t buff_depth, bool use_hip_memory = false);
     void release();         // release resources
+    void set_host_memory_arena(std::shared_ptr<HostMemoryArena> arena) { _host_arena = arena; }  // Must be called before init, the host slots are allocated from the heap without it
     void sync();            // Syncs device buffers with host
     void unblock_reader();  // Unblocks the thread currently waiting on a call to get_read_buffer
     void unblock_writer();  // Unblocks the thread currently waiting on get_write_buffer
@@ -73,6 +79,8 @@ class CircularBuffer {
    private:
     void increment_read_ptr();
     void increment_write_ptr();
+    unsigned char* allocate_host_buffer(bool pinned = false);
+    void release_host_buffer(unsigned char* buffer);
     bool full();
     bool empty();
     size_t _buff_depth;
@@ -102,4 +110,5 @@ class CircularBuffer {
     size_t _read_ptr;
     size_t _level;
     bool _use_pinned_memory = true;
+    std::shared_ptr<HostMemoryArena> _host_arena;  //!< Memory of the host slots, kept by the pipeline across loader re-initializations
 };
\ No newline at end of file
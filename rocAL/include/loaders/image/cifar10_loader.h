@@ -45,6 +45,7 @@ class CIFAR10Loader : public LoaderModule {
     CropImageInfo get_crop_image_info() override;
     Timing timing() override;
     void set_prefetch_queue_depth(size_t prefetch_queue_depth) override;
+    void set_host_memory_arena(std::shared_ptr<HostMemoryArena> arena) override { _circ_buff.set_host_memory_arena(arena); }
     void shut_down() override;
     std::vector<std::vector<float>> &get_batch_random_bbox_crop_coords();
     void set_batch_random_bbox_crop_coords(std::vector<std::vector<float>> batch_crop_coords);
@@ -61,6 +62,7 @@ class CIFAR10Loader : public LoaderModule {
     void stop_internal_thread();
     LoaderModuleStatus update_output_image();
     LoaderModuleStatus load_routine();
+    void copy_record(const unsigned char *record, unsigned char *dst);
     std::shared_ptr<Reader> _reader;
     void *_dev_resources;
     bool _initialized = false;
@@ -72,6 +74,9 @@ class CIFAR10Loader : public LoaderModule {
     std::thread _load_thread;
     std::vector<unsigned char *> _load_buff;
     std::vector<size_t> _actual_read_size;
+    std::vector<unsigned char> _record_buff;  //!< Holds a record read from the file until it is copied into the output layout
+    bool _interleave_output = false;           //!< The output takes the channels pixel by pixel while the records hold them plane by plane
+    bool _bgr_output = false;                  //!< The interleaved output takes the blue channel first
     std::vector<std::string> _output_names;
     CircularBuffer _circ_buff;
     size_t _prefetch_queue_depth;
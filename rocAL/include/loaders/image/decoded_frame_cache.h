@@ -0,0 +1,60 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//
+// DecodedFrameCache holds the decoded frames of overlapping sequences between the batches that read them. A frame is
+// kept only while its next read in the frame order of the epoch is less than window positions ahead of the reader,
+// so at most window frames are held, and a frame read by the next sequences of a sliding window is decoded once.
+class DecodedFrameCache {
+   public:
+    struct Frame {
+        std::vector<unsigned char> pixels;  //!< Decoded rows of width * planes bytes, without the padding of the output
+        size_t width = 0, height = 0;
+        size_t original_width = 0, original_height = 0;
+        size_t next_use = 0;  //!< Position of the next read of the frame
+    };
+    explicit DecodedFrameCache(size_t window) : _window(window) {}
+    //! Returns the frame cached for path, nullptr if it is not cached
+    const Frame *find(const std::string &path) const;
+    //! Returns true if a frame next read at next_use is worth keeping when the reader is at position
+    bool in_window(size_t next_use, size_t position) const { return next_use >= position && next_use - position < _window; }
+    /*! Keeps the frame decoded for path in the rows of src, src_stride bytes apart
+     *  \return false if next_use is not in the window, the frame is then not cached
+     */
+    bool insert(const std::string &path, const unsigned char *src, size_t src_stride, size_t width, size_t height, unsigned planes,
+                size_t original_width, size_t original_height, size_t next_use, size_t position);
+    //! Moves the next read of a cached frame to next_use, dropping the frame when it is not in the window
+    void update(const std::string &path, size_t next_use, size_t position);
+    //! Drops the frames whose next read the reader has passed, e.g. because the frame was quarantined in between
+    void drop_passed(size_t position);
+    void clear() { _frames.clear(); }
+    size_t size() const { return _frames.size(); }
+
+   private:
+    const size_t _window;
+    std::unordered_map<std::string, Frame> _frames;
+};
@@ -29,6 +29,7 @@ THE SOFTWARE.
 #include "loaders/circular_buffer.h"
 #include "pipeline/commons.h"
 #include "image_read_and_decode.h"
+#include "loaders/image/shared_image_source.h"
 #include "meta_data/meta_data_reader.h"
 //
 // ImageLoader runs an internal thread for loading an decoding of images asynchronously
@@ -50,10 +51,20 @@ class ImageLoader : public LoaderModule {
     DecodedDataInfo get_decode_data_info() override;
     CropImageInfo get_crop_image_info() override;
     void set_prefetch_queue_depth(size_t prefetch_queue_depth) override;
+    void set_host_memory_arena(std::shared_ptr<HostMemoryArena> arena) override { _host_arena = arena; }
     void shut_down() override;
     void feed_external_input(const std::vector<std::string>& input_images_names, const std::vector<unsigned char*>& input_buffer,
                              const std::vector<ROIxywh>& roi_xywh, unsigned int max_width, unsigned int max_height, unsigned int channels, ExternalSourceFileMode mode, bool eos) override;
     size_t last_batch_padded_size() override;
+    void set_decode_hint(const DecodeHint& hint) override;
+    void set_sample_quarantine(std::shared_ptr<SampleQuarantine> sample_quarantine) override { _sample_quarantine = sample_quarantine; }
+    void set_continuous_epochs(bool continuous_epochs) override { _continuous_epochs = continuous_epochs; }
+    void set_file_scan_options(const FileScanOptions &options) override { _file_scan_options = options; }
+    void set_record_check(std::shared_ptr<RecordCheck> record_check) override { _record_check = record_check; }
+    LoaderState get_state() override;
+    void set_state(const LoaderState& state) override;
+    //! Attaches the loader to the process-wide shared data service instead of reading and decoding on its own, must be called before initialize()
+    void set_shared_data_service(const std::string& service_name, unsigned consumer_count);
 
    private:
     bool is_out_of_data();
@@ -61,6 +72,8 @@ class ImageLoader : public LoaderModule {
     void stop_internal_thread();
     std::shared_ptr<ImageReadAndDecode> _image_loader;
     LoaderModuleStatus update_output_image();
+    LoaderModuleStatus update_shared_output_image();  // Hands out the batch of this consumer from the shared data service
+    void consume_remaining(size_t skipped_count);  // Takes the output batch and the samples skipped while reading it off the remaining count
     LoaderModuleStatus load_routine();
 
     std::shared_ptr<RandomBBoxCrop_MetaDataReader> _randombboxcrop_meta_data_reader = nullptr;
@@ -81,12 +94,24 @@ class ImageLoader : public LoaderModule {
     bool _loop;                     //<! If true the reader will wrap around at the end of the media (files/images/...) and wouldn't stop
     size_t _prefetch_queue_depth;   // Used for circular buffer's internal buffer
     size_t _image_counter = 0;      //!< How many images have been loaded already
-    size_t _remaining_image_count;  //!< How many images are there yet to be loaded
+    size_t _remaining_image_count;  //!< How many images are there yet to be loaded, with continuous epochs how many are left in the epoch of the output batch
     bool _decoder_keep_original = false;
     int _device_id;
     size_t _max_tensor_width, _max_tensor_height;
     bool _external_source_reader = false;  //!< Set to true if external source reader
     bool _external_input_eos = false;      //!< Set to true for last batch for the sequence
+    std::string _shared_service_name;                          //!< Name of the shared data service, empty if the loader reads and decodes on its own
+    unsigned _shared_consumer_count = 0;
+    std::shared_ptr<SharedImageSource> _shared_source = nullptr;
+    unsigned _shared_consumer_id = 0;
+    std::shared_ptr<SampleQuarantine> _sample_quarantine = nullptr;
+    bool _continuous_epochs = false;  //!< If true the loader thread rewinds the reader itself at the end of each epoch and keeps prefetching
+    FileScanOptions _file_scan_options;
+    std::shared_ptr<RecordCheck> _record_check = nullptr;
+    std::shared_ptr<HostMemoryArena> _host_arena;  //!< Memory of the circular buffer slots and the compressed sample buffers
+    size_t _epoch = 0;                //!< Epoch the loader thread is reading
+    ReaderState _output_reader_state;  //!< Reader position following the last batch handed out
+    size_t _output_epoch = 0;          //!< Epoch of the last batch handed out
 #if ENABLE_HIP
     hipStream_t _hip_stream = nullptr;
 #endif
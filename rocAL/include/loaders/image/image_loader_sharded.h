@@ -44,10 +44,18 @@ class ImageLoaderSharded : public LoaderModule {
     CropImageInfo get_crop_image_info() override;
     Timing timing() override;
     void set_prefetch_queue_depth(size_t prefetch_queue_depth) override;
+    void set_host_memory_arena(std::shared_ptr<HostMemoryArena> arena) override { _host_arena = arena; }
     void shut_down() override;
     void feed_external_input(const std::vector<std::string>& input_images_names, const std::vector<unsigned char *>& input_buffer,
                              const std::vector<ROIxywh>& roi_xywh, unsigned int max_width, unsigned int max_height, unsigned int channels, ExternalSourceFileMode mode, bool eos) override;
    size_t last_batch_padded_size() override;
+    void set_decode_hint(const DecodeHint &hint) override;
+    void set_sample_quarantine(std::shared_ptr<SampleQuarantine> sample_quarantine) override { _sample_quarantine = sample_quarantine; }
+    void set_continuous_epochs(bool continuous_epochs) override { _continuous_epochs = continuous_epochs; }
+    void set_file_scan_options(const FileScanOptions &options) override { _file_scan_options = options; }
+    void set_record_check(std::shared_ptr<RecordCheck> record_check) override { _record_check = record_check; }
+    LoaderState get_state() override;
+    void set_state(const LoaderState &state) override;
 
    private:
     void increment_loader_idx();
@@ -58,7 +66,12 @@ class ImageLoaderSharded : public LoaderModule {
     size_t _shard_count = 1;
     void fast_forward_through_empty_loaders();
     size_t _prefetch_queue_depth;
+    std::shared_ptr<HostMemoryArena> _host_arena;
 
     Tensor *_output_tensor;
     std::shared_ptr<RandomBBoxCrop_MetaDataReader> _randombboxcrop_meta_data_reader = nullptr;
+    std::shared_ptr<SampleQuarantine> _sample_quarantine = nullptr;
+    bool _continuous_epochs = false;
+    FileScanOptions _file_scan_options;
+    std::shared_ptr<RecordCheck> _record_check = nullptr;
 };
\ No newline at end of file
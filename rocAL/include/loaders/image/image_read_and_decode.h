@@ -24,12 +24,15 @@ THE SOFTWARE.
 #include <dirent.h>
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "pipeline/commons.h"
 #include "loaders/loader_module.h"
+#include "loaders/image/decoded_frame_cache.h"
 #include "parameters/parameter_random_crop_decoder.h"
 #include "readers/image/reader_factory.h"
+#include "readers/video/sequence_file_source_reader.h"
 #include "pipeline/timing_debug.h"
 #include "decoders/image/turbo_jpeg_decoder.h"
 
@@ -39,14 +42,21 @@ class ImageReadAndDecode {
     ImageReadAndDecode();
     ~ImageReadAndDecode();
     size_t count();
+    //! Reader items the last load() went past without loading them, such as quarantined samples and samples failing decode
+    size_t skipped_count() { return _skipped_count; }
     void reset();
+    ReaderState get_reader_state() { return _reader->get_state(); }
+    void set_reader_state(const ReaderState &state);
     void create(ReaderConfig reader_config, DecoderConfig decoder_config, int batch_size, int device_id = 0);
     void set_bbox_vector(std::vector<std::vector<float>> bbox_coords) { _bbox_coords = bbox_coords; };
     void set_random_bbox_data_reader(std::shared_ptr<RandomBBoxCrop_MetaDataReader> randombboxcrop_meta_data_reader);
+    void set_host_memory_arena(std::shared_ptr<HostMemoryArena> arena) { _host_arena = arena; }  //!< Must be called before create, the compressed samples are read to the heap without it
     std::vector<std::vector<float>> &get_batch_random_bbox_crop_coords();
     void set_batch_random_bbox_crop_coords(std::vector<std::vector<float>> batch_crop_coords);
     void feed_external_input(const std::vector<std::string>& input_images_names, const std::vector<unsigned char *>& input_buffer,
                              const std::vector<ROIxywh>& roi_xywh, unsigned int max_width, unsigned int max_height, unsigned int channels, ExternalSourceFileMode mode, bool eos);
+    //! Sets the decode hint applied to the decoders from the next loaded batch on, can be called while the loader thread is running
+    void set_decode_hint(const DecodeHint &hint);
     //! Loads a decompressed batch of images into the buffer indicated by buff
     /// \param buff User's buffer provided to be filled with decoded image data
     /// \param names User's buffer provided to be filled with name of the images decoded
@@ -72,12 +82,32 @@ class ImageReadAndDecode {
     size_t last_batch_padded_size();
 
    private:
+    //! Reads the next sample of the stream that is not quarantined into the batch slot idx, returns false once the reader is out of samples
+    //! A record rejected by the record check is skipped, or replaced with the sample of the slot idx - 1 under the SUBSTITUTE policy
+    bool read_next_sample(size_t idx);
+    bool decode_header(size_t idx);  // Decodes the header of the sample in slot idx and sets its original dims
+    void copy_sample(size_t dst_idx, size_t src_idx);
+    void complete_batch(size_t loaded_count);  // Fills the slots left empty when the stream runs out of samples
+    //! Decodes the headers of the batch, the samples failing it are quarantined and replaced with the next samples of the stream
+    void validate_headers();
+    //! Decodes the sample in slot idx, whose header is decoded, into its output slot and sets its decoded dims
+    bool decode_sample(size_t idx, size_t max_decoded_width, size_t max_decoded_height, Decoder::ColorFormat color_format, bool keep_original);
+    //! Quarantines the samples failing the content decode and replaces them with the next samples of the stream, decoding them in turn
+    void replace_undecoded_samples(std::vector<int> &content_decoded, size_t max_decoded_width, size_t max_decoded_height,
+                                   Decoder::ColorFormat color_format, unsigned planes, bool keep_original);
+    //! Reads the frames of a batch of sequences, a frame decoded for an earlier slot or batch is not read again
+    size_t read_sequence_frames();
+    void share_frame(size_t dst_idx, size_t src_idx);  // Makes slot dst_idx take the frame of slot src_idx once it is decoded
+    //! Copies the frames taken from the cache or from an earlier slot into their slots, then keeps the frames read again soon
+    void fill_shared_frames(size_t max_decoded_width, unsigned planes);
     std::vector<std::shared_ptr<Decoder>> _decoder;
     std::shared_ptr<Decoder> _rocjpeg_decoder;
     std::shared_ptr<Reader> _reader;
-    std::vector<std::vector<unsigned char>> _compressed_buff;
+    std::vector<HostArenaBuffer> _compressed_buff;
+    std::shared_ptr<HostMemoryArena> _host_arena;
     std::vector<size_t> _actual_read_size;
     std::vector<std::string> _image_names;
+    std::vector<std::string> _sample_keys;   //!< Quarantine key of the sample in each batch slot
     std::vector<size_t> _compressed_image_size;
     std::vector<unsigned char *> _decompressed_buff_ptrs;
     std::vector<size_t> _actual_decoded_width;
@@ -88,11 +118,25 @@ class ImageReadAndDecode {
     TimingDbg _file_load_time, _decode_time;
     size_t _batch_size, _num_threads;
     DecoderConfig _decoder_config;
+    DecodeHint _pending_decode_hint;   //!< Hint set by the graph, moved into _decoder_config at the start of the next load
+    bool _decode_hint_changed = false;
+    std::mutex _decode_hint_lock;
     std::vector<std::vector<float>> _bbox_coords, _crop_coords_batch;
     std::shared_ptr<RandomBBoxCrop_MetaDataReader> _randombboxcrop_meta_data_reader = nullptr;
     pCropCord _CropCord;
     RocalRandomCropDecParam *_random_crop_dec_param = nullptr;
     bool _is_external_source = false;
+    std::shared_ptr<SampleQuarantine> _sample_quarantine = nullptr;
+    size_t _skipped_count = 0;  //!< Reader items skipped by the last load(), the loader takes them off its remaining count
+    std::shared_ptr<RecordCheck> _record_check = nullptr;  //!< Record check of the reader, a rejected record reads as 0 bytes
     int _device_id = 0;
     bool _set_device_id = false;
+    std::shared_ptr<SequenceFileSourceReader> _sequence_reader;
+    std::unique_ptr<DecodedFrameCache> _frame_cache;  //!< Set for the sequence reader, whose overlapping sequences read the same frames
+    static constexpr int FRAME_DECODED = -1, FRAME_CACHED = -2, FRAME_FAILED = -3;
+    std::vector<int> _frame_source;  //!< One of the FRAME_ values or the slot whose frame a slot repeats, for each slot
+    std::vector<size_t> _frame_position;  //!< Position of the frame of each slot in the frame order of the reader
+    std::vector<const DecodedFrameCache::Frame *> _cached_frames;
+    size_t _frame_cache_position = 0;  //!< Reader position after the last batch
+    long long unsigned _frame_cache_hits = 0, _frame_cache_misses = 0;
 };
@@ -41,6 +41,7 @@ class ImageLoaderSingleShardNode : public Node {
               const std::map<std::string, std::string> feature_key_map = std::map<std::string, std::string>(), unsigned sequence_length = 0, unsigned step = 0, unsigned stride = 0, ExternalSourceFileMode external_file_mode = ExternalSourceFileMode::NONE, const std::string &index_path = "");
 
     std::shared_ptr<LoaderModule> get_loader_module();
+    void set_shared_data_service(const std::string &service_name, unsigned consumer_count);
 
    protected:
     void create_node() override{};
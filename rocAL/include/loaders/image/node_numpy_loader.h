@@ -31,6 +31,7 @@ class NumpyLoaderNode : public Node {
     NumpyLoaderNode() = delete;
 
     /// \param internal_shard_count Defines the amount of parallelism user wants for the load and decode process to be handled internally.
+    /// \param cpu_num_threads Number of threads copying the numpy arrays of a batch into the output.
     /// \param source_path Defines the path that includes the numpy files on disk
     /// \param files Contains a list of file paths to read the data from.
     /// \param storage_type Determines the storage type
@@ -41,8 +42,10 @@ class NumpyLoaderNode : public Node {
     /// \param mem_type Memory type, host or device
     /// \param seed Determines the seed used by RNG for shuffling data between shards.
     /// \param sharding_info The members of RocalShardingInfo determines how the data is distributed among the shards and how the last batch is processed by the pipeline.
-    void init(unsigned internal_shard_count, const std::string &source_path, const std::vector<std::string> &files, StorageType storage_type, DecoderType decoder_type, bool shuffle, bool loop,
-              size_t load_batch_count, RocalMemType mem_type, unsigned seed = 0, const ShardingInfo& sharding_info = ShardingInfo());
+    /// \param roi_start, roi_shape Region of every numpy array to read, per dimension. Empty to read the whole arrays, a negative shape reads up to the end of the dimension.
+    void init(unsigned internal_shard_count, unsigned cpu_num_threads, const std::string &source_path, const std::vector<std::string> &files, StorageType storage_type, DecoderType decoder_type, bool shuffle, bool loop,
+              size_t load_batch_count, RocalMemType mem_type, unsigned seed = 0, const ShardingInfo& sharding_info = ShardingInfo(),
+              const std::vector<int> &roi_start = {}, const std::vector<int> &roi_shape = {});
     std::shared_ptr<LoaderModule> get_loader_module();
 
    protected:
@@ -31,6 +31,7 @@ class NumpyLoaderSingleShardNode : public Node {
 
     /// \param shard_id shard id from user
     /// \param shard_count shard count from user
+    /// \param cpu_num_threads Number of threads copying the numpy arrays of a batch into the output.
     /// \param source_path Defines the path that includes the numpy dataset
     /// \param files Contains a list of file paths to read the data from.
     /// \param storage_type Determines the storage type
@@ -41,9 +42,11 @@ class NumpyLoaderSingleShardNode : public Node {
     /// \param mem_type Memory type, host or device
     /// \param seed Determines the seed used by RNG for shuffling data between shards.
     /// \param sharding_info The members of RocalShardingInfo determines how the data is distributed among the shards and how the last batch is processed by the pipeline.
-    void init(unsigned shard_id, unsigned shard_count, const std::string &source_path, const std::vector<std::string> &files,
+    /// \param roi_start, roi_shape Region of every numpy array to read, per dimension. Empty to read the whole arrays, a negative shape reads up to the end of the dimension.
+    void init(unsigned shard_id, unsigned shard_count, unsigned cpu_num_threads, const std::string &source_path, const std::vector<std::string> &files,
               StorageType storage_type, DecoderType decoder_type, bool shuffle, bool loop,
-              size_t load_batch_count, RocalMemType mem_type, unsigned seed = 0, const ShardingInfo& sharding_info = ShardingInfo());
+              size_t load_batch_count, RocalMemType mem_type, unsigned seed = 0, const ShardingInfo& sharding_info = ShardingInfo(),
+              const std::vector<int> &roi_start = {}, const std::vector<int> &roi_shape = {});
     std::shared_ptr<LoaderModule> get_loader_module();
 
    protected:
@@ -29,6 +29,7 @@ THE SOFTWARE.
 #include "image_read_and_decode.h"
 #include "loaders/circular_buffer.h"
 #include "pipeline/commons.h"
+#include "readers/image/numpy_data_reader.h"
 
 // NumpyLoader runs an internal thread for loading numpy arrays asynchronously
 // it uses a circular buffer to store decoded numpy arrays for the user
@@ -47,12 +48,15 @@ class NumpyLoader : public LoaderModule {
     std::vector<std::string> get_id() override;
     DecodedDataInfo get_decode_data_info() override;
     void set_prefetch_queue_depth(size_t prefetch_queue_depth) override;
+    void set_host_memory_arena(std::shared_ptr<HostMemoryArena> arena) override { _circ_buff.set_host_memory_arena(arena); }
     void shut_down() override;
     void feed_external_input(const std::vector<std::string>& input_images_names, const std::vector<unsigned char*>& input_buffer,
                              const std::vector<ROIxywh>& roi_xywh, unsigned int max_width, unsigned int max_height, unsigned int channels, ExternalSourceFileMode mode, bool eos) override {
         THROW("external source reader is not supported for numpy loader")
     };
     size_t last_batch_padded_size() override;
+    LoaderState get_state() override;
+    void set_state(const LoaderState& state) override;
 
    private:
     bool is_out_of_data();
@@ -61,6 +65,9 @@ class NumpyLoader : public LoaderModule {
     LoaderModuleStatus update_output_tensor();
     LoaderModuleStatus load_routine();
     std::shared_ptr<Reader> _reader;
+    std::shared_ptr<NumpyDataReader> _numpy_reader;  //!< Same as _reader, used to hand the mapped arrays over to the copy threads
+    std::vector<NumpySample> _samples;              //!< Arrays opened for the batch being loaded
+    size_t _num_threads = 1;                        //!< Number of threads copying the arrays of a batch into the circular buffer
     Tensor* _output_tensor;
     std::vector<std::string> _output_names;  //!< numpy file name/ids that are stores in the _output_tensor
     size_t _output_mem_size;
@@ -81,4 +88,5 @@ class NumpyLoader : public LoaderModule {
     size_t _remaining_file_count;  //!< How many numpy files are there yet to be loaded
     int _device_id;
     std::vector<std::vector<unsigned>> _tensor_roi;
+    ReaderState _output_reader_state;  //!< Reader position following the last batch handed out
 };
@@ -42,12 +42,15 @@ class NumpyLoaderSharded : public LoaderModule {
     DecodedDataInfo get_decode_data_info() override;
     Timing timing() override;
     void set_prefetch_queue_depth(size_t prefetch_queue_depth) override;
+    void set_host_memory_arena(std::shared_ptr<HostMemoryArena> arena) override { _host_arena = arena; }
     void shut_down() override;
     void feed_external_input(const std::vector<std::string> &input_images_names, const std::vector<unsigned char *> &input_buffer,
                              const std::vector<ROIxywh> &roi_xywh, unsigned int max_width, unsigned int max_height, unsigned int channels, ExternalSourceFileMode mode, bool eos) override {
         THROW("external source reader is not supported for numpy loader")
     };
     size_t last_batch_padded_size() override;
+    LoaderState get_state() override;
+    void set_state(const LoaderState &state) override;
 
    private:
     void increment_loader_idx();
@@ -58,5 +61,6 @@ class NumpyLoaderSharded : public LoaderModule {
     size_t _shard_count = 1;
     void fast_forward_through_empty_loaders();
     size_t _prefetch_queue_depth;
+    std::shared_ptr<HostMemoryArena> _host_arena;
     Tensor *_output_tensor;
 };
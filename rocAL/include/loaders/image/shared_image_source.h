@@ -0,0 +1,140 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "loaders/circular_buffer.h"
+#include "loaders/image/image_read_and_decode.h"
+
+//
+// SharedImageSource reads and decodes a stream of images once for all the loaders attached to it. Multiple pipelines
+// (MasterGraphs) in the same process reading the same data (e.g. several views of the same samples) can attach to one
+// source so that each sample is read and decoded only once. The decoded batches are kept in a window of slots shared by
+// all the consumers, a slot counts the consumers that still have to read it or are holding it and is recycled once none
+// does, so the consumers read the decoded batch in place. Every consumer has its own cursor in the stream and its own
+// reset. The decode thread runs ahead of the consumers as long as the window has room; when a consumer waits at the
+// head of the stream and the window is full, the oldest batch nobody holds is dropped. A consumer whose batch was dropped,
+// or that runs ahead of the decode thread while the window is full, decodes on its own until the stream reaches its cursor.
+class SharedImageSource {
+   public:
+    SharedImageSource(const std::string &service_name, unsigned consumer_count);
+    ~SharedImageSource();
+    //! Attaches a consumer to the source, the first consumer creates the reader and decoder, later ones must match its configuration
+    /// \param window_depth number of batches the decode thread can run ahead of the consumers, the window holds one more slot per consumer
+    /// \return the consumer id to be used in the rest of the calls
+    unsigned attach(ReaderConfig reader_cfg, DecoderConfig decoder_cfg, unsigned batch_size, size_t output_mem_size,
+                    size_t max_width, size_t max_height, RocalColorFormat color_format, bool decoder_keep_original, size_t window_depth);
+    void detach(unsigned consumer_id);
+    void start(unsigned consumer_id);  // Starts the decode thread once all the expected consumers are attached
+    void reset(unsigned consumer_id);  // Moves the consumer to the start of the next pass over the data, the other consumers keep their position
+    //! Returns the next batch of the consumer, blocks until it is decoded
+    /// \param info names and sizes of the samples of the batch
+    /// \return the decoded batch, valid until the next call to next_batch(), reset() or detach() for the consumer; nullptr once the source is stopped
+    unsigned char *next_batch(unsigned consumer_id, DecodedDataInfo &info);
+    size_t count();  // Number of items of one pass over the data
+    size_t last_batch_padded_size();
+    Timing timing();
+    const std::string &name() { return _service_name; }
+
+   private:
+    typedef std::pair<uint64_t, uint64_t> StreamPosition;  //!< Pass over the data and batch in the pass
+    struct Slot {
+        unsigned char *data = nullptr;
+        DecodedDataInfo info;
+        StreamPosition position;
+        bool valid = false;  //!< Holds the decoded batch at position
+        unsigned refs = 0;   //!< Consumers that still have to read the batch or are holding it
+    };
+    struct Consumer {
+        StreamPosition cursor;                                  //!< Position of the next batch of the consumer
+        int held_slot = -1;                                     //!< Slot handed out last, kept until the consumer asks for another batch
+        bool waiting = false;                                   //!< Waits for the decode thread to reach its cursor
+        std::shared_ptr<ImageReadAndDecode> private_loader;     //!< Decodes the batches of the consumer while the window does not have them
+        unsigned char *private_buffer = nullptr;
+        DecodedDataInfo private_info;
+    };
+    void load_routine();
+    void start_internal_thread();
+    void stop_internal_thread(std::unique_lock<std::mutex> &lock);
+    int find_slot(const StreamPosition &position);
+    int free_slot();
+    int evict_slot();
+    bool head_waiter();
+    void release_held(Consumer &consumer);
+    void move_cursor(Consumer &consumer, const StreamPosition &cursor);
+    void end_pass();
+    void drop_pass_states();
+    unsigned char *decode_private(Consumer &consumer, DecodedDataInfo &info, std::unique_lock<std::mutex> &lock);
+    std::shared_ptr<ImageReadAndDecode> create_loader();
+    void init_data_info(DecodedDataInfo &info);
+    unsigned char *allocate_buffer();
+    std::string make_config_key(ReaderConfig &reader_cfg, DecoderConfig &decoder_cfg, unsigned batch_size, size_t output_mem_size,
+                                size_t max_width, size_t max_height, RocalColorFormat color_format, bool decoder_keep_original);
+    const std::string _service_name;
+    unsigned _expected_consumers;                    //!< Number of pipelines expected to attach before the decode thread starts
+    std::map<unsigned, Consumer> _consumers;
+    unsigned _next_consumer_id = 0;
+    std::string _config_key;                        //!< Describes the reader/decoder configuration all the consumers must share
+    std::shared_ptr<ReaderConfig> _reader_cfg;      //!< Configuration shared by the consumers, creates the private loaders
+    DecoderConfig _decoder_cfg;
+    unsigned _batch_size = 0;
+    std::shared_ptr<ImageReadAndDecode> _image_loader = nullptr;
+    DecodedDataInfo _decoded_data_info;
+    size_t _items_per_pass = 0;
+    size_t _output_mem_size = 0;
+    size_t _max_width = 0, _max_height = 0;
+    RocalColorFormat _color_format;
+    bool _decoder_keep_original = false;
+    size_t _window_depth = 0;
+    std::vector<Slot> _slots;
+    StreamPosition _head;                                    //!< Position of the next batch of the decode thread
+    std::map<uint64_t, std::vector<ReaderState>> _pass_states;  //!< Reader state before each decoded batch of a pass, positions the private loaders
+    bool _internal_thread_running = false;
+    bool _started = false;
+    std::thread _load_thread;
+    std::mutex _lock;
+    std::condition_variable _batch_ready;  //!< Signalled by the decode thread when a batch is in the window
+    std::condition_variable _slot_freed;   //!< Signalled by the consumers when a slot can be recycled or a consumer waits at the head
+};
+
+//
+// SharedDataService keeps the process-wide registry of SharedImageSource instances by name, the source is released
+// when the last pipeline attached to it is destroyed
+class SharedDataService {
+   public:
+    static SharedDataService *instance();
+    std::shared_ptr<SharedImageSource> acquire(const std::string &service_name, unsigned consumer_count);
+
+   private:
+    SharedDataService() = default;
+    std::map<std::string, std::weak_ptr<SharedImageSource>> _sources;
+    std::mutex _lock;
+    static SharedDataService *_instance;
+    static std::mutex _instance_mutex;
+};
@@ -25,6 +25,7 @@ THE SOFTWARE.
 
 #include "readers/image/image_reader.h"
 #include "circular_buffer.h"
+#include "pipeline/host_memory_arena.h"
 #include "pipeline/commons.h"
 #include "decoders/image/decoder.h"
 #include "meta_data/meta_data_graph.h"
@@ -52,7 +53,7 @@ class LoaderModule {
     virtual ~LoaderModule() = default;
     virtual Timing timing() = 0;                    // Returns timing info
     virtual std::vector<std::string> get_id() = 0;  // returns the id of the last batch of images/frames loaded
-    virtual void start_loading() = 0;               // starts internal loading thread
+    virtual void start_loading() = 0;               // starts internal loading thread, called once the pipeline is built
     virtual DecodedDataInfo get_decode_data_info() = 0;
     virtual CropImageInfo get_crop_image_info() { return {}; }
     virtual void set_prefetch_queue_depth(size_t prefetch_queue_depth) = 0;
@@ -66,6 +67,14 @@ class LoaderModule {
                                      const std::vector<ROIxywh>& roi_xywh, unsigned int max_width, unsigned int max_height,
                                      unsigned int channels, ExternalSourceFileMode mode, bool eos) = 0;
     virtual size_t last_batch_padded_size() { return 0; }
+    virtual void set_decode_hint(const DecodeHint& hint) {}  // Lets the loader decode only what the graph reads, ignored by loaders that cannot use it. Called before start_loading
+    virtual void set_sample_quarantine(std::shared_ptr<SampleQuarantine> sample_quarantine) {}  // Must be called before initialize, ignored by loaders that cannot skip samples
+    virtual void set_continuous_epochs(bool continuous_epochs) {}  // Must be called before initialize, ignored by loaders that are reset between epochs
+    virtual void set_file_scan_options(const FileScanOptions &options) {}  // Must be called before initialize, ignored by loaders that do not list files
+    virtual void set_record_check(std::shared_ptr<RecordCheck> record_check) {}  // Must be called before initialize, ignored by loaders that do not read record files
+    virtual void set_host_memory_arena(std::shared_ptr<HostMemoryArena> arena) {}  // Must be called before initialize, the loader buffers are allocated from the heap without it
+    virtual LoaderState get_state() { return {}; }  // Returns the position following the last batch handed out by load_next(), without readers if the loader can't be resumed
+    virtual void set_state(const LoaderState& state) { THROW("Restoring the state is not supported by this loader") }  // Drops the prefetched batches and resumes loading from the given position
    protected:
     DecodedDataInfo _decoded_data_info, _output_decoded_data_info;  // Stores the decoded data info
 };
@@ -50,11 +50,14 @@ class VideoLoader : public LoaderModule {
     std::vector<std::string> get_id() override;
     DecodedDataInfo get_decode_data_info() override;
     void set_prefetch_queue_depth(size_t prefetch_queue_depth) override;
+    void set_host_memory_arena(std::shared_ptr<HostMemoryArena> arena) override { _circ_buff.set_host_memory_arena(arena); }
     CropImageInfo get_crop_image_info() override { return _crop_img_info; }
     void set_random_bbox_data_reader(std::shared_ptr<RandomBBoxCrop_MetaDataReader> randombboxcrop_meta_data_reader) override{};
     std::vector<size_t> get_sequence_start_frame_number() override;
     std::vector<std::vector<float>> get_sequence_frame_timestamps() override;
     void shut_down() override;
+    LoaderState get_state() override;
+    void set_state(const LoaderState& state) override;
     void feed_external_input(const std::vector<std::string>& input_images_names, const std::vector<unsigned char*>& input_buffer,
                              const std::vector<ROIxywh>& roi_xywh, unsigned int max_width, unsigned int max_height, unsigned int channels, ExternalSourceFileMode mode, bool eos) override {}
 
@@ -87,6 +90,7 @@ class VideoLoader : public LoaderModule {
     std::vector<std::vector<std::vector<float>>> _sequence_frame_timestamps_vec;
     CropImageInfo _crop_img_info;
     size_t _max_tensor_width, _max_tensor_height;
+    ReaderState _output_reader_state;  //!< Reader position following the last batch handed out
 #if ENABLE_HIP
     hipStream_t _hip_stream = nullptr;
 #endif
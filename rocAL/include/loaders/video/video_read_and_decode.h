@@ -48,6 +48,8 @@ class VideoReadAndDecode {
     ~VideoReadAndDecode();
     size_t count();
     void reset();
+    ReaderState get_reader_state() { return _video_reader->get_state(); }
+    void set_reader_state(const ReaderState &state) { _video_reader->set_state(state); }
     void create(ReaderConfig reader_config, DecoderConfig decoder_config, int batch_size, int device_id = 0);
     void set_video_process_count(size_t video_count) {
         _video_process_count = (video_count <= _max_video_count) ? video_count : _max_video_count;
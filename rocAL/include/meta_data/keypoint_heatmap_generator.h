@@ -0,0 +1,59 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include <vector>
+
+#include "meta_data/meta_data.h"
+
+/*! \brief Draws HRNet style Gaussian target heatmaps and target weights from the joints of a key points batch
+ *
+ * Runs on the output meta data of the pipeline, so the joints are in the coordinates of the output images of
+ * image_width x image_height. Each joint is splatted as a Gaussian of sigma at its heatmap cell, only over the
+ * window of 3 * sigma around it, and gets a target weight of its visibility, or 0 when the window misses the heatmap.
+ */
+class KeypointHeatmapGenerator {
+   public:
+    KeypointHeatmapGenerator(unsigned image_width, unsigned image_height, unsigned heatmap_width, unsigned heatmap_height, float sigma, unsigned num_joints = NUMBER_OF_JOINTS);
+    size_t plane_size() const { return static_cast<size_t>(_heatmap_width) * _heatmap_height; }
+    //! Number of heatmap floats of one sample, the samples are written this far apart
+    size_t sample_size() const { return _num_joints * plane_size(); }
+    unsigned heatmap_width() const { return _heatmap_width; }
+    unsigned heatmap_height() const { return _heatmap_height; }
+    unsigned num_joints() const { return _num_joints; }
+    float sigma() const { return _sigma; }
+    //! Writes num_joints heatmaps and num_joints target weights of each sample
+    void generate(pMetaDataBatch meta_data, float *heatmaps, float *target_weights) const;
+
+   private:
+    //! Returns the target weight of the joint and splats its Gaussian into the zeroed heatmap when it is visible
+    float splat_joint(const Joint &joint, float visibility, float *heatmap) const;
+    unsigned _image_width;
+    unsigned _image_height;
+    unsigned _heatmap_width;
+    unsigned _heatmap_height;
+    float _sigma;
+    unsigned _num_joints;
+    float _stride_x;           //!< Output image pixels per heatmap cell along x
+    float _stride_y;           //!< Output image pixels per heatmap cell along y
+    float _window_radius;      //!< The Gaussian is truncated at this many cells from its center
+};
@@ -297,6 +297,7 @@ class AsciiValueBatch : public MetaDataBatch {
             return std::make_shared<AsciiValueBatch>(*this);
         } else {
             std::shared_ptr<MetaDataBatch> ascii_value_batch_instance = std::make_shared<AsciiValueBatch>();
+            ascii_value_batch_instance->set_metadata_type(_type);
             ascii_value_batch_instance->resize(this->size());
             ascii_value_batch_instance->get_info_batch() = this->get_info_batch();
             return ascii_value_batch_instance;
@@ -370,6 +371,7 @@ class LabelBatch : public MetaDataBatch {
             return std::make_shared<LabelBatch>(*this);  // Copy the entire metadata batch with all the metadata values and info
         } else {
             std::shared_ptr<MetaDataBatch> label_batch_instance = std::make_shared<LabelBatch>();
+            label_batch_instance->set_metadata_type(_type);
             label_batch_instance->resize(this->size());
             label_batch_instance->get_info_batch() = this->get_info_batch();  // Copy only info to newly created instance excluding the metadata values
             return label_batch_instance;
@@ -430,6 +432,7 @@ class BoundingBoxBatch : public LabelBatch {
             return std::make_shared<BoundingBoxBatch>(*this);  // Copy the entire metadata batch with all the metadata values and info
         } else {
             std::shared_ptr<MetaDataBatch> bbox_batch_instance = std::make_shared<BoundingBoxBatch>();
+            bbox_batch_instance->set_metadata_type(_type);
             bbox_batch_instance->resize(this->size());
             bbox_batch_instance->get_info_batch() = this->get_info_batch();  // Copy only info to newly created instance excluding the metadata values
             return bbox_batch_instance;
@@ -510,6 +513,7 @@ struct PolygonMaskBatch : public BoundingBoxBatch {
             return std::make_shared<PolygonMaskBatch>(*this);  // Copy the entire metadata batch with all the metadata values and info
         } else {
             std::shared_ptr<MetaDataBatch> mask_batch_instance = std::make_shared<PolygonMaskBatch>();
+            mask_batch_instance->set_metadata_type(_type);
             mask_batch_instance->resize(this->size());
             mask_batch_instance->get_info_batch() = this->get_info_batch();  // Copy only info to newly created instance excluding the metadata values
             return mask_batch_instance;
@@ -592,6 +596,7 @@ class KeyPointBatch : public BoundingBoxBatch {
             return std::make_shared<KeyPointBatch>(*this);  // Copy the entire metadata batch with all the metadata values and info
         } else {
             std::shared_ptr<MetaDataBatch> joints_batch_instance = std::make_shared<KeyPointBatch>();
+            joints_batch_instance->set_metadata_type(_type);
             joints_batch_instance->resize(this->size());
             joints_batch_instance->get_info_batch() = this->get_info_batch();  // Copy only info to newly created instance excluding the metadata values
             return joints_batch_instance;
@@ -26,6 +26,7 @@ THE SOFTWARE.
 
 #include "meta_data/meta_data.h"
 #include "meta_data/meta_data_graph.h"
+#include "meta_data/meta_transform.h"
 #include "pipeline/node.h"
 #include "parameters/parameter_factory.h"
 
@@ -33,12 +34,23 @@ class MetaNode {
    public:
     MetaNode() {}
     virtual ~MetaNode(){};
-    virtual void update_parameters(pMetaDataBatch input_meta_data, pMetaDataBatch output_meta_data) = 0;
+    //! Runs the node on its own, nodes that cannot be composed override it
+    virtual void update_parameters(pMetaDataBatch input_meta_data, pMetaDataBatch output_meta_data);
+    //! Adds the node's axis aligned transform to the chain, returns false if the node cannot be expressed as one
+    virtual bool compose(MetaTransform &transform) { return false; }
     double BBoxIntersectionOverUnion(const BoundingBoxCord &box1, const BoundingBoxCord &box2, bool is_iou) const;
     int _batch_size;
     float _iou_threshold = 0.25;
 };
 
+inline void MetaNode::update_parameters(pMetaDataBatch input_meta_data, pMetaDataBatch output_meta_data) {
+    MetaTransform transform;
+    transform.reset(input_meta_data->size());
+    if (!compose(transform))
+        THROW("Meta node does not implement update_parameters")
+    transform.apply(input_meta_data, output_meta_data);
+}
+
 inline double MetaNode::BBoxIntersectionOverUnion(const BoundingBoxCord &box1, const BoundingBoxCord &box2, bool is_iou = false) const {
     double iou;
     float xA = std::max(box1.l, box2.l);
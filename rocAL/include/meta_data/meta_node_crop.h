@@ -32,7 +32,7 @@ THE SOFTWARE.
 class CropMetaNode : public MetaNode {
    public:
     CropMetaNode(){};
-    void update_parameters(pMetaDataBatch input_meta_data, pMetaDataBatch output_meta_data) override;
+    bool compose(MetaTransform &transform) override;
     std::shared_ptr<CropNode> _node = nullptr;
 
    private:
@@ -32,7 +32,7 @@ THE SOFTWARE.
 class CropMirrorNormalizeMetaNode : public MetaNode {
    public:
     CropMirrorNormalizeMetaNode(){};
-    void update_parameters(pMetaDataBatch input_meta_data, pMetaDataBatch output_meta_data) override;
+    bool compose(MetaTransform &transform) override;
     std::shared_ptr<CropMirrorNormalizeNode> _node = nullptr;
 
    private:
@@ -32,7 +32,7 @@ THE SOFTWARE.
 class CropResizeMetaNode : public MetaNode {
    public:
     CropResizeMetaNode(){};
-    void update_parameters(pMetaDataBatch input_meta_data, pMetaDataBatch output_meta_data) override;
+    bool compose(MetaTransform &transform) override;
     std::shared_ptr<CropResizeNode> _node = nullptr;
 
    private:
@@ -34,7 +34,7 @@ THE SOFTWARE.
 class FlipMetaNode : public MetaNode {
    public:
     FlipMetaNode(){};
-    void update_parameters(pMetaDataBatch input_meta_data, pMetaDataBatch output_meta_data) override;
+    bool compose(MetaTransform &transform) override;
     std::shared_ptr<FlipNode> _node = nullptr;
 
    private:
@@ -33,7 +33,7 @@ THE SOFTWARE.
 class ResizeMetaNode : public MetaNode {
    public:
     ResizeMetaNode(){};
-    void update_parameters(pMetaDataBatch input_meta_data, pMetaDataBatch output_meta_data) override;
+    bool compose(MetaTransform &transform) override;
     std::shared_ptr<ResizeNode> _node = nullptr;
 
    private:
@@ -32,7 +32,7 @@ THE SOFTWARE.
 class ResizeCropMirrorMetaNode : public MetaNode {
    public:
     ResizeCropMirrorMetaNode(){};
-    void update_parameters(pMetaDataBatch input_meta_data, pMetaDataBatch output_meta_data) override;
+    bool compose(MetaTransform &transform) override;
     std::shared_ptr<ResizeCropMirrorNode> _node = nullptr;
 
    private:
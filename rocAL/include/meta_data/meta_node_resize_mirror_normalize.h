@@ -33,7 +33,7 @@ THE SOFTWARE.
 class ResizeMirrorNormalizeMetaNode : public MetaNode {
    public:
     ResizeMirrorNormalizeMetaNode(){};
-    void update_parameters(pMetaDataBatch input_meta_data, pMetaDataBatch output_meta_data) override;
+    bool compose(MetaTransform &transform) override;
     std::shared_ptr<ResizeMirrorNormalizeNode> _node = nullptr;
 
    private:
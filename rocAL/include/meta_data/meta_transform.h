@@ -0,0 +1,64 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include <vector>
+
+#include "meta_data/meta_data.h"
+
+// Crop window met while composing the meta nodes, kept in the output space of the chain
+typedef struct {
+    BoundingBoxCord box;
+    float iou_threshold;
+} MetaClipWindow;
+
+/*! \brief Per sample transform composed across a chain of axis aligned meta nodes
+ *
+ * Every node contributes an affine x' = sx * x + tx, y' = sy * y + ty and optionally a crop window.
+ * Windows are carried along through the affines that follow them, so the whole chain is applied
+ * once on the final coordinates: the IoU ratio used for filtering is invariant to axis aligned
+ * scaling and mirroring, which makes the deferred clip equivalent to clipping node by node.
+ */
+class MetaTransform {
+   public:
+    void reset(int batch_size);
+    int size() const { return _samples.size(); }
+    void affine(int idx, float sx, float tx, float sy, float ty);
+    //! Drops the boxes whose IoU with the window is below the threshold, clips the rest and moves the origin to the window's top left corner
+    void clip(int idx, const BoundingBoxCord &window, float iou_threshold);
+    void set_roi_size(int idx, int width, int height);
+    //! Appends an unlabeled zero box to samples left without boxes, as done by the resize meta node
+    void set_pad_empty(bool pad_empty) { _pad_empty = pad_empty; }
+    //! Writes the transformed boxes, labels, polygon vertices and keypoints of input_meta_data into output_meta_data
+    void apply(pMetaDataBatch input_meta_data, pMetaDataBatch output_meta_data) const;
+
+   private:
+    struct SampleTransform {
+        float sx = 1, tx = 0, sy = 1, ty = 0;
+        std::vector<MetaClipWindow> windows;
+        bool update_roi = false;
+        ImgSize roi_size = {};
+    };
+    void apply_boxes(const SampleTransform &transform, BoundingBoxCords &boxes, Labels &labels) const;
+    std::vector<SampleTransform> _samples;  //!< Transform of each sample in the batch
+    bool _pad_empty = false;                //!< Set when the last composed node pads empty samples with a zero box
+};
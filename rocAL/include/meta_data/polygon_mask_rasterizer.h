@@ -0,0 +1,64 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "meta_data/meta_data.h"
+
+enum class MaskType {
+    INSTANCE = 0,  //!< One binary plane per object, the pixels covered by its polygons are set to 1
+    SEMANTIC       //!< One plane per sample, the pixels covered by an object are set to its label, later objects are drawn over earlier ones
+};
+
+/*! \brief Scan-converts the polygon masks of a meta data batch into uint8 masks
+ *
+ * Runs on the output meta data of the pipeline, after the meta nodes moved the polygon vertices along with the
+ * crop, resize and flip augmentations, so the masks line up with the output images. A pixel is covered when its
+ * center is inside a polygon under the even-odd rule, the polygons of an object are merged.
+ */
+class PolygonMaskRasterizer {
+   public:
+    PolygonMaskRasterizer(unsigned width, unsigned height, MaskType mask_type, unsigned max_instances);
+    //! Bytes of the masks of one sample, the samples are written this far apart
+    size_t sample_size() const { return (_mask_type == MaskType::SEMANTIC ? 1 : _max_instances) * plane_size(); }
+    size_t plane_size() const { return static_cast<size_t>(_width) * _height; }
+    unsigned width() const { return _width; }
+    unsigned height() const { return _height; }
+    MaskType mask_type() const { return _mask_type; }
+    unsigned max_instances() const { return _max_instances; }
+    //! Number of objects of the sample that get an instance mask
+    unsigned instance_count(pMetaDataBatch meta_data, int sample) const;
+    void rasterize(pMetaDataBatch meta_data, uint8_t *buffer) const;
+    //! Sets the pixels of mask covered by the polygon of vertex_count (x, y) pairs to value
+    static void fill_polygon(const float *vertices, int vertex_count, unsigned width, unsigned height, uint8_t value, uint8_t *mask);
+
+   private:
+    //! Draws the polygons of an object, first_vertex is the offset of its first coordinate in the sample's mask coordinates
+    void fill_object(pMetaDataBatch meta_data, int sample, int object, size_t first_vertex, uint8_t value, uint8_t *mask) const;
+    std::vector<size_t> object_offsets(pMetaDataBatch meta_data, int sample) const;
+    unsigned _width;
+    unsigned _height;
+    MaskType _mask_type;
+    unsigned _max_instances;
+};
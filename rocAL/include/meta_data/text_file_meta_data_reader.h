@@ -22,6 +22,7 @@ THE SOFTWARE.
 
 #pragma once
 #include <map>
+#include <string_view>
 
 #include "pipeline/commons.h"
 #include "meta_data/meta_data.h"
@@ -35,16 +36,32 @@ class TextFileMetaDataReader : public MetaDataReader {
     void release() override;
     bool set_timestamp_mode() override { return false; }
 
-    const std::map<std::string, std::shared_ptr<MetaData>>& get_map_content() override { return _map_content; }
-    std::vector<std::string> get_relative_file_path() override { return _relative_file_path; }
+    const std::map<std::string, std::shared_ptr<MetaData>>& get_map_content() override;
+    std::vector<std::string> get_relative_file_path() override;
     TextFileMetaDataReader();
+    ~TextFileMetaDataReader() override;
 
    private:
+    //! A file name and label line of the text file, the path is kept in the mapped file
+    struct Entry {
+        size_t path_offset;
+        uint32_t path_size;
+        uint32_t name_start;  //!< Offset of the file name within the path, past the last slash
+        uint32_t hash_tag;    //!< High bits of the name hash, compared before the names
+        int label;
+    };
     pMetaDataBatch _output;
     void read_files(const std::string& _path);
     bool exists(const std::string& image_name) override;
-    void add(std::string image_name, int label);
-    std::map<std::string, std::shared_ptr<MetaData>> _map_content;
+    static void parse_lines(const char* data, size_t begin, size_t end, std::vector<Entry>& entries);
+    void build_index();
+    size_t find_slot(std::string_view image_name) const;
+    std::string_view entry_name(const Entry& entry) const { return std::string_view(_file_data + entry.path_offset + entry.name_start, entry.path_size - entry.name_start); }
+    void unmap();
+    std::map<std::string, std::shared_ptr<MetaData>> _map_content;  //!< Filled from the index on the first get_map_content() call
     std::string _path;
-    std::vector<std::string> _relative_file_path {};
+    const char* _file_data = nullptr;  //!< The mapped text file the entries point into
+    size_t _file_size = 0;
+    std::vector<Entry> _entries;   //!< Every parsed line in the order of the file
+    std::vector<uint32_t> _index;  //!< Open addressing table of the first entry of each name, by the low bits of the name hash
 };
@@ -21,6 +21,8 @@ THE SOFTWARE.
 */
 
 #pragma once
+#include <cstdint>
+#include <vector>
 
 template <typename T>
 class Parameter {
@@ -39,6 +41,10 @@ class Parameter {
     /// used to fetch the updated param values
     virtual std::vector<T> get_array() { return {}; };
 
+    /// number of renewals so far, saving and restoring it resumes the random sequence (for random parameters)
+    virtual uint64_t iteration() const { return 0; }
+    virtual void set_iteration(uint64_t iteration){};
+
     virtual ~Parameter() {}
     ///
     /// \return returns if this parameter takes a single value (vs a range of values or many values)
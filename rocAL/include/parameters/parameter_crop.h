@@ -71,6 +71,9 @@ class CropParam {
     void array_init();
     void create_array(std::shared_ptr<Graph> graph);
     virtual void update_array(){};
+    bool is_fixed_crop() { return _is_fixed_crop; }
+    float get_crop_anchor_x() { return _crop_anchor[0]; }
+    float get_crop_anchor_y() { return _crop_anchor[1]; }
     Parameter<float> *get_x_drift_factor() { return x_drift_factor; }
     Parameter<float> *get_y_drift_factor() { return y_drift_factor; }
     std::vector<uint32_t> get_x1_arr_val() { return x1_arr_val; }
@@ -21,9 +21,10 @@ THE SOFTWARE.
 */
 
 #pragma once
+#include <algorithm>
+#include <map>
 #include <memory>
 #include <mutex>
-#include <set>
 #include <thread>
 
 #include "parameters/parameter_random.h"
@@ -70,7 +71,12 @@ class ParameterFactory {
    public:
     static ParameterFactory* instance();
     ~ParameterFactory();
-    void renew_parameters();
+    //! Renews the parameters of one pipeline, and the ones created before any pipeline
+    void renew_parameters(const void* owner);
+    //! The parameters created from now on belong to the pipeline owner, until another pipeline takes over
+    void set_owner(const void* owner) { _owner = owner; }
+    //! Drops the parameters of a released pipeline from the renewal and the state of the others
+    void release_owner(const void* owner);
     void set_seed(unsigned seed);
     unsigned get_seed();
     void generate_seed();
@@ -78,35 +84,65 @@ class ParameterFactory {
 
     template <typename T>
     Parameter<T>* create_uniform_rand_param(T start, T end) {
-        auto gen = new UniformRand<T>(start, end, _seed);
-        _parameters.insert(gen);
+        auto gen = new UniformRand<T>(start, end, _seed, next_stream());
+        add_param(gen);
         return gen;
     }
     template <typename T>
     Parameter<T>* create_single_value_param(T value) {
         auto gen = new SimpleParameter<T>(value);
-        _parameters.insert(gen);
+        add_param(gen);
         return gen;
     }
     template <typename T>
     void destroy_param(Parameter<T>* param) {
+        std::lock_guard<std::mutex> lock(_params_lock);
         if (_parameters.find(param) != _parameters.end())
             _parameters.erase(param);
+        _creation_order.erase(std::remove(_creation_order.begin(), _creation_order.end(), pParamCore(param)), _creation_order.end());
         delete param;
     }
+    //! Destroys a default parameter replaced by one given by the user, which then belongs to the pipeline of the default
+    template <typename T>
+    void replace_param(Parameter<T>* replaced, Parameter<T>* param) {
+        {
+            std::lock_guard<std::mutex> lock(_params_lock);
+            auto it = _parameters.find(replaced);
+            if (it != _parameters.end() && _parameters.find(param) != _parameters.end())
+                _parameters[param] = it->second;
+        }
+        destroy_param(replaced);
+    }
     IntParam* create_uniform_int_rand_param(int start, int end);
     FloatParam* create_uniform_float_rand_param(float start, float end);
     IntParam* create_custom_int_rand_param(const int* value, const double* frequencies, size_t size);
     FloatParam* create_custom_float_rand_param(const float* value, const double* frequencies, size_t size);
     IntParam* create_single_value_int_param(int value);
     FloatParam* create_single_value_float_param(float value);
+    //! Returns a (seed, stream) key of its own for a node that draws its random values itself, derived from the pipeline seed like the parameters
+    Philox4x32::Key create_random_stream_key() { return {static_cast<uint32_t>(get_seed_from_seedsequence()), next_stream()}; }
+    //! Returns the renewal count of every parameter of the pipeline owner in creation order, a pipeline built the same way can resume its random sequences with set_state()
+    std::vector<uint64_t> get_state(const void* owner);
+    void set_state(const void* owner, const std::vector<uint64_t>& iterations);
 
    private:
     long long unsigned _seed;
-    std::set<pParamCore> _parameters;  //<! Keeps the random generators used to randomized the augmentation parameters
+    std::map<pParamCore, const void*> _parameters;  //<! Keeps the random generators used to randomized the augmentation parameters, with the pipeline each one belongs to
+    std::vector<pParamCore> _creation_order;  //<! Same parameters in the order they were created, which is stable across processes unlike the pointer order of the map
+    std::vector<pParamCore> _released;  //<! Parameters of released pipelines, deleted with the factory since their nodes may still point to them
+    const void* _owner = nullptr;  //<! Pipeline the parameters are being created for
+    std::mutex _params_lock;
+    void add_param(pParamCore param) {
+        std::lock_guard<std::mutex> lock(_params_lock);
+        _parameters[param] = _owner;
+        _creation_order.push_back(param);
+    }
+    std::vector<pParamCore> owned_params(const void* owner);
     static ParameterFactory* _instance;
     static std::mutex _mutex;
     ParameterFactory();
     std::vector<int64_t> _seed_vector;
     int _seed_sequence_idx = 0;
+    unsigned _stream_count = 0;  //!< Gives every random parameter its own Philox stream, even if two share a seed
+    unsigned next_stream() { return _stream_count++; }
 };
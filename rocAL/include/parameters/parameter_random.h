@@ -22,6 +22,8 @@ THE SOFTWARE.
 
 #pragma once
 #include <algorithm>  // std::remove_if
+#include <atomic>
+#include <cstdint>
 #include <cstdlib>
 #include <ctime>
 #include <memory>
@@ -34,15 +36,16 @@ THE SOFTWARE.
 
 #include "pipeline/log.h"
 #include "parameters/parameter.h"
+#include "parameters/philox.h"
 template <typename T>
 class UniformRand : public Parameter<T> {
    public:
-    UniformRand(T start, T end, unsigned seed = 0) : _generator(seed) {
+    UniformRand(T start, T end, unsigned seed = 0, unsigned stream = 0) : _key({seed, stream}) {
         update(start, end);
         renew();
     }
 
-    explicit UniformRand(T start, unsigned seed = 0) : UniformRand(start, start, seed) {}
+    explicit UniformRand(T start, unsigned seed = 0, unsigned stream = 0) : UniformRand(start, start, seed, stream) {}
 
     T default_value() const override {
         return static_cast<T>((_start + _end) / static_cast<T>(2));
@@ -57,24 +60,15 @@ class UniformRand : public Parameter<T> {
     }
 
     void renew_value() {
-        std::unique_lock<std::mutex> lock(_lock);
-        auto val = _generator();
-
-        if (single_value()) {
-            // If there is only a single value possible for the random variable
-            // don't waste time on calling the rand function , just return it.
-            _updated_val = _start;
-        } else {
-            _updated_val = static_cast<T>(
-                ((double)val / (double)_generator.max()) * ((double)_end - (double)_start) + (double)_start);
-        }
+        _updated_val = value(_iteration++, 0);
     }
 
     void renew_array() {
-        for (uint i = 0; i < _size; i++) {
-            renew_value();
-            _param_values[i] = _updated_val;
-        }
+        // Every element is drawn from its own counter, the values don't depend on the order they are computed in
+        const uint64_t iteration = _iteration++;
+        for (uint i = 0; i < _size; i++)
+            _param_values[i] = value(iteration, i);
+        _updated_val = _param_values[_size - 1];
     }
 
     void renew() override {
@@ -85,7 +79,6 @@ class UniformRand : public Parameter<T> {
         }
     }
     int update(T start, T end) {
-        std::unique_lock<std::mutex> lock(_lock);
         if (end < start)
             end = start;
 
@@ -105,13 +98,27 @@ class UniformRand : public Parameter<T> {
         return (_start == _end);
     }
 
+    uint64_t iteration() const override { return _iteration; }
+
+    void set_iteration(uint64_t iteration) override { _iteration = iteration; }
+
    private:
-    T _start;
-    T _end;
+    T value(uint64_t iteration, uint32_t index) const {
+        const T start = _start, end = _end;
+        // If there is only a single value possible for the random variable
+        // don't waste time on calling the rand function , just return it.
+        if (start == end)
+            return start;
+        auto val = Philox4x32::generate(_key, iteration, index);
+        return static_cast<T>(
+            ((double)val / (double)UINT32_MAX) * ((double)end - (double)start) + (double)start);
+    }
+    std::atomic<T> _start;
+    std::atomic<T> _end;
     T _updated_val;
     std::vector<T> _param_values;
-    std::mt19937 _generator;
-    std::mutex _lock;
+    const Philox4x32::Key _key;             //!< (seed, stream) the values of this parameter are drawn with
+    std::atomic<uint64_t> _iteration = 0;   //!< Counts the renewals, every renewal draws from a new counter
     unsigned _size;
 };
 
@@ -120,7 +127,7 @@ struct CustomRand : public Parameter<T> {
     CustomRand(
         const T values[],
         const double frequencies[],
-        size_t size, unsigned seed = 0) : _generator(seed) {
+        size_t size, unsigned seed = 0, unsigned stream = 0) : _key({seed, stream}) {
         update(values, frequencies, size);
         renew();
     }
@@ -175,29 +182,16 @@ struct CustomRand : public Parameter<T> {
 
     void renew_value() {
         std::unique_lock<std::mutex> lock(_lock);
-        if (single_value()) {
-            // If there is only a single value possible for the random variable
-            // don't waste time on calling the rand function , just return it.
-            _updated_val = _values[0];
-        } else {
-            // Generate a value between [0 1]
-            double rand_val = (double)_generator() / (double)_generator.max();
-
-            // Find the iterators pointing to the first element bigger than idx
-            auto it = std::upper_bound(_comltv_dist.begin(), _comltv_dist.end(), rand_val);
-
-            // Get the index and return the associated value
-            unsigned idx = std::distance(_comltv_dist.begin(), it);
-
-            _updated_val = _values[idx];
-        }
+        _updated_val = value(_iteration++, 0);
     }
 
     void renew_array() {
-        for (uint i = 0; i < _size; i++) {
-            renew_value();
-            _param_values[i] = _updated_val;
-        }
+        // The lock only guards the distribution against update(), it is taken once per renewal
+        std::unique_lock<std::mutex> lock(_lock);
+        const uint64_t iteration = _iteration++;
+        for (uint i = 0; i < _size; i++)
+            _param_values[i] = value(iteration, i);
+        _updated_val = _param_values[_size - 1];
     }
 
     void renew() override {
@@ -226,14 +220,37 @@ struct CustomRand : public Parameter<T> {
         return (_values.size() == 1);
     }
 
+    uint64_t iteration() const override { return _iteration; }
+
+    void set_iteration(uint64_t iteration) override {
+        std::unique_lock<std::mutex> lock(_lock);
+        _iteration = iteration;
+    }
+
    private:
+    T value(uint64_t iteration, uint32_t index) const {
+        // If there is only a single value possible for the random variable
+        // don't waste time on calling the rand function , just return it.
+        if (single_value())
+            return _values[0];
+        // Generate a value between [0 1]
+        double rand_val = (double)Philox4x32::generate(_key, iteration, index) / (double)UINT32_MAX;
+
+        // Find the iterators pointing to the first element bigger than idx
+        auto it = std::upper_bound(_comltv_dist.begin(), _comltv_dist.end(), rand_val);
+
+        // Get the index and return the associated value
+        unsigned idx = std::distance(_comltv_dist.begin(), it);
+        return _values[std::min<size_t>(idx, _values.size() - 1)];
+    }
     std::vector<T> _values;            //!< Values
     std::vector<double> _frequencies;  //!< Probabilities
     std::vector<double> _comltv_dist;  //!< commulative probabilities
     double _mean;
     T _updated_val;
     std::vector<T> _param_values;  //!< The values will be used in parameter_vx.h file after renewing
-    std::mt19937 _generator;
+    const Philox4x32::Key _key;    //!< (seed, stream) the values of this parameter are drawn with
+    uint64_t _iteration = 0;       //!< Counts the renewals, every renewal draws from a new counter
     std::mutex _lock;
     unsigned _size;
 };
\ No newline at end of file
@@ -64,7 +64,7 @@ class ParameterVX {
         if (!param)
             return;
 
-        ParameterFactory::instance()->destroy_param(_param);
+        ParameterFactory::instance()->replace_param(_param, param);
         _param = param;
     }
     void set_param(T val) {
@@ -77,6 +77,9 @@ class ParameterVX {
     vx_array default_array() {
         return _array;
     }
+    Parameter<T>* get_param() {
+        return _param;
+    }
     vx_scalar default_scalar(std::shared_ptr<Graph> _graph, vx_enum data_type) {
         _scalar = vxCreateScalar(vxGetContext((vx_reference)_graph->get()), data_type, &_val);
         return _scalar;
@@ -0,0 +1,64 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include <array>
+#include <cstdint>
+
+//
+// Philox4x32-10 counter based random number generator (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3", SC'11).
+// The output is a pure function of the key and the counter, so a value can be drawn for any (parameter, iteration, sample)
+// in any order and from any thread without sharing generator state, and the sequence does not depend on how the work is split.
+class Philox4x32 {
+   public:
+    using Counter = std::array<uint32_t, 4>;
+    using Key = std::array<uint32_t, 2>;
+
+    static Counter generate(Counter counter, Key key) {
+        for (int round = 0; round < ROUNDS; round++) {
+            counter = single_round(counter, key);
+            key[0] += WEYL_0;
+            key[1] += WEYL_1;
+        }
+        return counter;
+    }
+
+    //! Returns the first 32 bit word drawn for the (stream, iteration, index) triple of the key
+    static uint32_t generate(Key key, uint64_t iteration, uint32_t index, uint32_t stream = 0) {
+        Counter counter = {index, static_cast<uint32_t>(iteration), static_cast<uint32_t>(iteration >> 32), stream};
+        return generate(counter, key)[0];
+    }
+
+   private:
+    static constexpr int ROUNDS = 10;
+    static constexpr uint32_t MULTIPLIER_0 = 0xD2511F53;
+    static constexpr uint32_t MULTIPLIER_1 = 0xCD9E8D57;
+    static constexpr uint32_t WEYL_0 = 0x9E3779B9;  // golden ratio
+    static constexpr uint32_t WEYL_1 = 0xBB67AE85;  // sqrt(3) - 1
+
+    static Counter single_round(const Counter &counter, const Key &key) {
+        uint64_t product_0 = static_cast<uint64_t>(MULTIPLIER_0) * counter[0];
+        uint64_t product_1 = static_cast<uint64_t>(MULTIPLIER_1) * counter[2];
+        return {static_cast<uint32_t>(product_1 >> 32) ^ counter[1] ^ key[0], static_cast<uint32_t>(product_1),
+                static_cast<uint32_t>(product_0 >> 32) ^ counter[3] ^ key[1], static_cast<uint32_t>(product_0)};
+    }
+};
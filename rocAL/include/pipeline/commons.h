@@ -160,6 +160,18 @@ struct Timing {
     long long unsigned video_read_time= 0;
     long long unsigned video_decode_time= 0;
     long long unsigned video_process_time= 0;
+    long long unsigned frame_cache_hits = 0;    // Sequence frames taken decoded from an earlier read instead of being read and decoded again
+    long long unsigned frame_cache_misses = 0;  // Sequence frames read and decoded
+};
+
+/*! \brief Epoch marker of a batch
+ *
+ * Travels with each batch from the loaders to the output when the loaders run the epochs back to back
+ */
+struct EpochInfo {
+    size_t epoch = 0;         // Index of the epoch the batch was read in
+    bool last_batch = false;  // True if the batch is the last one of its epoch
+    size_t remaining_count = 0;  // Samples left in the epoch after the batch, the whole next epoch after its last batch
 };
 
 /*! \brief Tensor Last Batch Policy Type enum
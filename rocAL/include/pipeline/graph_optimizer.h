@@ -0,0 +1,65 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include <list>
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "pipeline/node.h"
+
+/*! \brief Rewrites the nodes of a pipeline before they are added to the OpenVX graph
+ *
+ * Copy and Nop nodes nothing outside the graph reads are dropped, chains of nodes that have a fused kernel are replaced with
+ * the fused node and the nodes no output depends on are removed. Rewrites are only done when the result is identical, the
+ * loaders and the other nodes reading no other node are never removed.
+ */
+class GraphOptimizer {
+   public:
+    GraphOptimizer(std::list<std::shared_ptr<Node>> &nodes, std::map<Tensor *, std::shared_ptr<Node>> &tensor_map);
+    //! Tensors read outside of the graph, such as the pipeline outputs, are never removed
+    void keep_tensor(Tensor *tensor) { _kept_tensors.insert(tensor); }
+    //! Nodes whose state is used outside of the graph, such as by meta data nodes, are never rewritten or removed
+    void keep_node(const std::shared_ptr<Node> &node) { _kept_nodes.insert(node.get()); }
+    //! Runs all the passes and returns the tensors no node reads or writes anymore, the caller owns them
+    std::vector<Tensor *> run();
+
+   private:
+    unsigned remove_copies();
+    unsigned fuse_crop_flip();
+    unsigned fuse_resize_flip();
+    unsigned remove_dead_nodes();
+    std::vector<std::shared_ptr<Node>> consumers(Tensor *tensor);
+    bool is_intermediate(Tensor *tensor);
+    bool is_kept(const std::shared_ptr<Node> &node) { return _kept_nodes.find(node.get()) != _kept_nodes.end(); }
+    bool is_source(const std::shared_ptr<Node> &node);
+    void link(const std::shared_ptr<Node> &parent, const std::shared_ptr<Node> &child);
+    void unlink(const std::shared_ptr<Node> &node);
+    void replace(const std::shared_ptr<Node> &head, const std::shared_ptr<Node> &tail, const std::shared_ptr<Node> &fused);
+    std::list<std::shared_ptr<Node>> &_nodes;
+    std::map<Tensor *, std::shared_ptr<Node>> &_tensor_map;
+    std::set<Tensor *> _kept_tensors;
+    std::set<Node *> _kept_nodes;
+    std::vector<Tensor *> _removed_tensors;  //!< Tensors of the removed nodes, they are released with the pipeline
+};
@@ -0,0 +1,127 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+//! How the host memory arena uses huge pages
+enum class HugePageMode {
+    NONE,         //!< Regular pages
+    TRANSPARENT,  //!< Mappings are aligned to the huge page size and advised for transparent huge pages
+    EXPLICIT      //!< Mappings come from the preallocated huge page pool, transparent huge pages are used when the pool is exhausted
+};
+
+struct HostArenaOptions {
+    HugePageMode huge_pages = HugePageMode::NONE;
+    bool prefault = false;  //!< Touch the pages when they are mapped, so the first batches don't pay for the page faults
+    int numa_node = -1;     //!< NUMA node the mappings are bound to, -1 leaves the placement to the kernel
+};
+
+struct HostArenaStats {
+    size_t mapped_bytes = 0;       //!< Bytes mapped by the arena, returned to the system when the arena is destroyed
+    size_t huge_page_bytes = 0;    //!< Mapped bytes backed by or advised for huge pages
+    size_t pinned_bytes = 0;       //!< Mapped bytes page locked for the device
+    size_t in_use_bytes = 0;       //!< Bytes of the blocks currently handed out
+    size_t peak_in_use_bytes = 0;
+    size_t mapping_count = 0;
+    size_t allocation_count = 0;
+    size_t reuse_count = 0;        //!< Allocations served by a block released earlier
+};
+
+/*! \brief Host memory of a pipeline for its large, long lived buffers
+ *
+ * Blocks are carved from anonymous mappings, which can be backed by huge pages, pre-faulted and bound to a NUMA node.
+ * Released blocks are kept and handed out again for requests of a similar size, the mappings are only unmapped when the
+ * arena is destroyed, so the buffers are allocated once for the lifetime of the pipeline.
+ */
+class HostMemoryArena {
+   public:
+    HostMemoryArena() = default;
+    ~HostMemoryArena();
+    HostMemoryArena(const HostMemoryArena &) = delete;
+    HostMemoryArena &operator=(const HostMemoryArena &) = delete;
+    void set_options(const HostArenaOptions &options);  //!< Must be called before the first allocation
+    const HostArenaOptions &options() const { return _options; }
+    //! Returns a block of at least size bytes aligned to MEM_ALIGNMENT, page locked for the device if pinned is set
+    void *allocate(size_t size, bool pinned = false);
+    void deallocate(void *ptr);
+    HostArenaStats stats();
+    static const size_t MEM_ALIGNMENT = 256;
+
+   private:
+    struct Block {
+        size_t size;
+        bool pinned;
+    };
+    struct Mapping {
+        void *address;
+        size_t size;
+        bool pinned;
+    };
+    void *map(size_t size, bool pinned, size_t &mapped_size);
+    void *carve(size_t size);
+    std::mutex _lock;
+    HostArenaOptions _options;
+    std::vector<Mapping> _mappings;
+    std::map<void *, Block> _blocks;                //!< Blocks handed out
+    std::multimap<size_t, void *> _free_blocks[2];  //!< Released blocks by size, indexed by the pinned flag
+    unsigned char *_chunk = nullptr;                //!< Mapping the small blocks are carved from
+    size_t _chunk_left = 0;
+    bool _huge_page_pool_warned = false;
+    HostArenaStats _stats;
+};
+
+//! Standard allocator drawing from a HostMemoryArena, or from the heap if no arena is set
+template <typename T>
+class HostArenaAllocator {
+   public:
+    using value_type = T;
+    HostArenaAllocator() = default;
+    explicit HostArenaAllocator(std::shared_ptr<HostMemoryArena> arena) : _arena(std::move(arena)) {}
+    template <typename U>
+    HostArenaAllocator(const HostArenaAllocator<U> &other) : _arena(other.arena()) {}
+    T *allocate(size_t n) {
+        if (_arena)
+            return static_cast<T *>(_arena->allocate(n * sizeof(T)));
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *ptr, size_t n) {
+        if (_arena)
+            _arena->deallocate(ptr);
+        else
+            std::allocator<T>().deallocate(ptr, n);
+    }
+    const std::shared_ptr<HostMemoryArena> &arena() const { return _arena; }
+    template <typename U>
+    bool operator==(const HostArenaAllocator<U> &other) const { return _arena == other.arena(); }
+    template <typename U>
+    bool operator!=(const HostArenaAllocator<U> &other) const { return _arena != other.arena(); }
+
+   private:
+    std::shared_ptr<HostMemoryArena> _arena;
+};
+
+using HostArenaBuffer = std::vector<unsigned char, HostArenaAllocator<unsigned char>>;
@@ -21,14 +21,17 @@ THE SOFTWARE.
 */
 
 #pragma once
+#include <atomic>
 #include <list>
 #include <map>
 #include <memory>
 #include <variant>
 
 #include "pipeline/graph.h"
+#include "meta_data/keypoint_heatmap_generator.h"
 #include "meta_data/meta_data_graph.h"
 #include "meta_data/meta_data_reader.h"
+#include "meta_data/polygon_mask_rasterizer.h"
 #include "pipeline/node.h"
 #include "loaders/image/node_cifar10_loader.h"
 #include "loaders/image/node_cifar10_loader_single_shard.h"
@@ -44,6 +47,8 @@ THE SOFTWARE.
 #include "loaders/audio/node_audio_loader.h"
 #include "loaders/audio/node_audio_loader_single_shard.h"
 #endif
+#include "pipeline/memory_planner.h"
+#include "pipeline/host_memory_arena.h"
 #include "pipeline/ring_buffer.h"
 #include "pipeline/timing_debug.h"
 #if ENABLE_HIP
@@ -96,6 +101,8 @@ class MasterGraph {
     Status copy_out_tensor_planar(void *out_ptr, RocalTensorlayout format, float multiplier0, float multiplier1, float multiplier2,
                                   float offset0, float offset1, float offset2, bool reverse_channels, RocalTensorDataType output_data_type);
     TensorList *get_output_tensors();
+    TensorList *acquire_output();                //!< Leases the output buffers of the current batch, the pipeline writes to other buffers until release_output() is called
+    void release_output(TensorList *output);
     size_t output_width();
     size_t output_height();
     void sequence_start_frame_number(std::vector<size_t> &sequence_start_framenum);             // Returns the starting frame number of the sequences
@@ -105,6 +112,7 @@ class MasterGraph {
     Status build();
     Status run();
     Timing timing();
+    size_t peak_memory_size() { return _peak_memory_size; }  //!< Bytes held for the intermediate tensors, output ring buffer and loader buffers, known after build()
     RocalMemType mem_type();
     size_t last_batch_padded_size();
     void release();
@@ -115,6 +123,8 @@ class MasterGraph {
     std::shared_ptr<T> meta_add_node(std::shared_ptr<M> node);
     Tensor *create_tensor(const TensorInfo &info, bool is_output);
     Tensor *create_loader_output_tensor(const TensorInfo &info);
+    Tensor *create_loader_output_alias(Tensor *loader_output, const TensorInfo &alias_info);
+    void set_multi_view(unsigned num_views);
     TensorListVector * create_label_reader(const char *source_path, MetaDataReaderType reader_type);
     TensorListVector * create_video_label_reader(const char *source_path, MetaDataReaderType reader_type, unsigned sequence_length, unsigned frame_step, unsigned frame_stride, bool file_list_frame_num = true);
     TensorListVector * create_coco_meta_data_reader(const char *source_path, bool is_output, MetaDataReaderType reader_type, MetaDataType label_type, bool ltrb_bbox = true, bool is_box_encoder = false,
@@ -127,13 +137,20 @@ class MasterGraph {
     TensorListVector * create_webdataset_reader(const char *source_path, const char* index_path, std::vector<std::set<std::string>> extensions , MetaDataReaderType reader_type, MissingComponentsBehaviour missing_component_behaviour);
     void box_encoder(std::vector<float> &anchors, float criteria, const std::vector<float> &means, const std::vector<float> &stds, bool offset, float scale);
     void box_iou_matcher(std::vector<float> &anchors, float high_threshold, float low_threshold, bool allow_low_quality_matches);
+    void polygon_mask_rasterizer(unsigned mask_width, unsigned mask_height, MaskType mask_type, unsigned max_instances);
+    void keypoint_heatmaps(unsigned heatmap_width, unsigned heatmap_height, float sigma);
     void create_randombboxcrop_reader(RandomBBoxCrop_MetaDataReaderType reader_type, RandomBBoxCrop_MetaDataType label_type, bool all_boxes_overlap, bool no_crop, FloatParam *aspect_ratio, bool has_shape, int crop_width, int crop_height, int num_attempts, FloatParam *scaling, int total_num_attempts, int64_t seed = 0);
     const std::pair<ImageNameBatch, pMetaDataBatch> &meta_data();
     TensorList *labels_meta_data();
     TensorList *bbox_meta_data();
     TensorList *mask_meta_data();
     TensorList *matched_index_meta_data();
+    TensorList *rasterized_mask_meta_data();
+    TensorList *keypoint_heatmap_meta_data();
+    TensorList *keypoint_target_weight_meta_data();
     TensorListVector * ascii_values_meta_data(); // Gets the pointer to a batch of ASCII values of all samples in the batch
+    void copy_labels(void *buf, RocalLabelType label_type, RocalOutputMemType output_mem_type);  //!< Writes the label of every sample of the current batch to buf as label_type
+    void copy_one_hot_labels(void *buf, unsigned num_of_classes, RocalLabelType label_type, float label_smoothing, RocalOutputMemType output_mem_type);  //!< Writes the one hot encoded labels of the current batch to buf, label_smoothing moves that share of the probability evenly to all the classes
     void set_loop(bool val) { _loop = val; }
     void set_output(Tensor *output_tensor);
     size_t calculate_cpu_num_threads(size_t shard_count);
@@ -150,12 +167,26 @@ class MasterGraph {
                              const std::vector<ROIxywh>& roi_xywh, unsigned int max_width, unsigned int max_height, unsigned int channels, ExternalSourceFileMode mode,
                              RocalTensorlayout layout, bool eos);
     void set_external_source_reader_flag() { _external_source_reader = true; }
+    void set_shared_data_service(const std::string &service_name, unsigned consumer_count);
+    void set_sample_quarantine_file(const std::string &file_path);
+    std::shared_ptr<SampleQuarantine> sample_quarantine() { return _sample_quarantine; }
+    void set_continuous_epochs(bool continuous_epochs);
+    void set_file_scan_options(const FileScanOptions &options);
+    void set_record_check_policy(RecordCheckPolicy policy);
+    void set_graph_optimization(bool enable);
+    std::shared_ptr<RecordCheck> record_check() { return _record_check; }  //!< Counters of the record check, null when the records are not checked
+    void set_host_memory_options(const HostArenaOptions &options);
+    HostArenaStats host_memory_stats() { return _host_arena ? _host_arena->stats() : HostArenaStats(); }  //!< Memory of the ring buffer and loader buffers drawn from the host arena, none without it
+    EpochInfo batch_epoch_info() { return _ring_buffer.get_epoch_info(); }  //!< Epoch of the batch last returned by run()
+    PipelineState get_state();  //!< State to resume from right after the batch last returned by run()
+    void set_state(const PipelineState &state);
     size_t bounding_box_batch_count(pMetaDataBatch meta_data_batch);
 #if ENABLE_OPENCL
     cl_command_queue get_ocl_cmd_q() { return _device.resources()->cmd_queue; }
 #endif
    private:
     Status update_node_parameters();
+    void create_intermediate_tensors();
     void create_single_graph();
     void create_multiple_graphs();
     void start_processing();
@@ -163,28 +194,43 @@ class MasterGraph {
     void output_routine();
     void output_routine_multiple_loaders();
     void decrease_image_count();
+    void skip_image_count(size_t skipped_count);  //!< Takes the samples skipped by the loaders off the remaining count, called by the output routine
+    PipelineState capture_state();  //!< Snapshot of the loaders and random parameters after the batch being processed
+    void update_loader_output_aliases();
+    void repeat_labels_per_view(pMetaDataBatch meta_data);
+    void optimize_graph();  //!< Fuses, drops and removes nodes before they are added to the OpenVX graph
+    void set_loader_decode_hints();  //!< Passes to each loader how its output is read by the graph so it can skip decoding unused data
     /// notify_user_thread() is called when the internal processing thread is done with processing all available tensors
     void notify_user_thread();
     /// no_more_processed_data() is logically linked to the notify_user_thread() and is used to tell the user they've already consumed all the processed tensors
     bool no_more_processed_data();
     // is_out_of_data() is called to check the remaining batch count from each loader module, if any of the loader module has consumed all the batches it returns true.
     bool is_out_of_data();
+    void *label_host_buffer(void *buf, size_t size, RocalOutputMemType output_mem_type);  //!< The buffer the labels are written to, buf itself unless it is in device memory
+    void upload_labels(void *buf, size_t size, RocalOutputMemType output_mem_type);
     RingBuffer _ring_buffer;                                                      //!< The queue that keeps the tensors that have benn processed by the internal thread (_output_thread) asynchronous to the user's thread
     pMetaDataBatch _augmented_meta_data = nullptr;                                //!< The output of the meta_data_graph,
     std::shared_ptr<CropCordBatch> _random_bbox_crop_cords_data = nullptr;
     std::thread _output_thread;
     TensorList _internal_tensor_list;                                             //!< Keeps a list of ovx tensors that are used to store the augmented outputs (there is an augmentation output batch per element in the list)
     TensorList _output_tensor_list;                                               //!< Keeps a list of ovx tensors(augmented outputs) that are to be passed to the user (there is an augmentation output batch per element in the list)
+    std::map<TensorList *, size_t> _output_leases;                                //!< Output tensor lists handed out by acquire_output() and the ring buffer lease they hold
+    std::mutex _output_lease_lock;
     std::list<Tensor *> _internal_tensors;                                        //!< Keeps all the ovx tensors (virtual/non-virtual) either intermediate tensors, or input tensors that feed the graph
     std::list<std::shared_ptr<Node>> _nodes;                                      //!< List of all the nodes
     std::list<std::shared_ptr<Node>> _root_nodes;                                 //!< List of all root nodes (image/video loaders)
     std::list<std::shared_ptr<Node>> _meta_data_nodes;                            //!< List of nodes where meta data has to be updated after augmentation
     std::map<Tensor *, std::shared_ptr<Node>> _tensor_map;                        //!< key: tensor, value : Parent node
+    std::unique_ptr<TensorMemoryPlanner> _memory_planner;                         //!< Holds the arenas the intermediate tensors are placed in
+    size_t _peak_memory_size = 0;
+    std::vector<std::pair<Tensor *, Tensor *>> _loader_output_aliases;            //!< Tensors sharing a loader output's buffer with different dims (alias, loader output), updated on every load
+    unsigned _multi_view_count = 0;                                               //!< Views of each sample made by rocalMultiView, the labels are repeated for every view
     void *_output_tensor_buffer = nullptr;                                        //!< In the GPU processing case , is used to convert the U8 samples to float32 before they are being transfered back to host
     TensorListVector _metadata_output_tensor_list;                                //!< Keeps a list of all the Metadata output TensorList
     TensorListVector _bbox_encoded_output;                                        //!< Keeps a list of label and bounding box metadata TensorList for box encoder
     TensorListVector _webdataset_output_tensor_list;                              //!< Keeps a list of ascii metadata TensorList for the Webdataset reader
     TensorList _labels_tensor_list;
+    std::vector<unsigned char> _label_staging_buffer;                             //!< Host side of the labels written to device buffers, reused across batches
     std::vector<TensorList> _ascii_tensor_list; // TensorList to store the ASCII values of all samples in a batch
     TensorList _bbox_tensor_list;
     TensorList _mask_tensor_list;
@@ -213,7 +259,7 @@ class MasterGraph {
     bool _first_run = true;
     bool _processing;                                                             //!< Indicates if internal processing thread should keep processing or not
     const static unsigned SAMPLE_SIZE = sizeof(unsigned char);
-    int _remaining_count;                                                         //!< Keeps the count of remaining tensors yet to be processed for the user,
+    std::atomic<int> _remaining_count;                                            //!< Keeps the count of remaining tensors yet to be processed for the user,
     bool _loop;                                                                   //!< Indicates if user wants to indefinitely loops through tensors or not
     size_t _prefetch_queue_depth;
     bool _output_routine_finished_processing = false;
@@ -236,6 +282,24 @@ class MasterGraph {
     // box IoU matcher variables
     bool _is_box_iou_matcher = false;                                             // bool variable to set the box iou matcher
     BoxIouMatcherInfo _iou_matcher_info;
+    std::unique_ptr<PolygonMaskRasterizer> _mask_rasterizer;                      //!< Draws the polygon masks of each output batch, null unless polygon_mask_rasterizer() was called
+    unsigned _rasterized_mask_buffer_idx = 0;                                     //!< Index of the ring buffer metadata sub buffer holding the rasterized masks
+    TensorList _rasterized_mask_tensor_list;
+    float _pose_sigma = 0;                                                        //!< Sigma given to the key points reader, the default sigma of the heatmaps
+    unsigned _pose_output_width = 0, _pose_output_height = 0;                     //!< Output image size given to the key points reader
+    std::unique_ptr<KeypointHeatmapGenerator> _heatmap_generator;                 //!< Draws the key point heatmaps of each output batch, null unless keypoint_heatmaps() was called
+    unsigned _heatmap_buffer_idx = 0, _target_weight_buffer_idx = 0;              //!< Indices of the ring buffer metadata sub buffers holding the heatmaps and target weights
+    TensorList _heatmap_tensor_list;
+    TensorList _target_weight_tensor_list;
+    std::string _shared_service_name;                                             //!< Name of the process-wide shared data service the image loaders attach to, empty if not shared
+    unsigned _shared_service_consumer_count = 0;                                  //!< Number of pipelines expected to attach to the shared data service
+    std::shared_ptr<SampleQuarantine> _sample_quarantine = std::make_shared<SampleQuarantine>();  //!< Samples that failed to decode, skipped by the image loaders
+    bool _continuous_epochs = false;                                              //!< The image loaders run the epochs back to back instead of waiting for reset()
+    FileScanOptions _file_scan_options;                                           //!< How the file readers list the dataset files
+    std::shared_ptr<RecordCheck> _record_check = nullptr;                         //!< Verifies the records read from record files, null if they are not checked
+    bool _optimize_graph = true;                                                  //!< The nodes are rewritten by the GraphOptimizer before they are added to the graph
+    std::shared_ptr<HostMemoryArena> _host_arena;  //!< Host memory of the ring buffer and the loader buffers once set_host_memory_options() is called, held for the lifetime of the pipeline
+    PipelineState _start_state;                                                   //!< State when processing starts, returned until the first run()
 #if ENABLE_HIP
     BoxEncoderGpu *_box_encoder_gpu = nullptr;
 #endif
@@ -244,6 +308,8 @@ class MasterGraph {
 
 template <typename T>
 std::shared_ptr<T> MasterGraph::add_node(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) {
+    // The default parameters of the node, and the ones given to it afterwards, belong to this pipeline
+    ParameterFactory::instance()->set_owner(this);
     auto node = std::make_shared<T>(inputs, outputs);
     _nodes.push_back(node);
 
@@ -268,6 +334,7 @@ std::shared_ptr<T> MasterGraph::meta_add_node(std::shared_ptr<M> node) {
     _meta_data_graph->_meta_nodes.push_back(meta_node);
     meta_node->_node = node;
     meta_node->_batch_size = _user_batch_size;
+    _meta_data_nodes.push_back(node);
     _augmentation_metanode = true;
     return meta_node;
 }
@@ -283,7 +350,12 @@ inline std::shared_ptr<ImageLoaderNode> MasterGraph::add_node(const std::vector<
     auto node = std::make_shared<ImageLoaderNode>(outputs[0], nullptr);
 #endif
     auto loader_module = node->get_loader_module();
+    loader_module->set_sample_quarantine(_sample_quarantine);
+    loader_module->set_continuous_epochs(_continuous_epochs);
+    loader_module->set_file_scan_options(_file_scan_options);
+    loader_module->set_record_check(_record_check);
     loader_module->set_prefetch_queue_depth(_prefetch_queue_depth);
+    loader_module->set_host_memory_arena(_host_arena);
     _loader_modules.emplace_back(loader_module);
     node->set_graph_id(_loaders_count++);
     _root_nodes.push_back(node);
@@ -300,8 +372,15 @@ inline std::shared_ptr<ImageLoaderSingleShardNode> MasterGraph::add_node(const s
 #else
     auto node = std::make_shared<ImageLoaderSingleShardNode>(outputs[0], nullptr);
 #endif
+    if (!_shared_service_name.empty())
+        node->set_shared_data_service(_shared_service_name, _shared_service_consumer_count);
     auto loader_module = node->get_loader_module();
+    loader_module->set_sample_quarantine(_sample_quarantine);
+    loader_module->set_continuous_epochs(_continuous_epochs);
+    loader_module->set_file_scan_options(_file_scan_options);
+    loader_module->set_record_check(_record_check);
     loader_module->set_prefetch_queue_depth(_prefetch_queue_depth);
+    loader_module->set_host_memory_arena(_host_arena);
     _loader_modules.emplace_back(loader_module);
     node->set_graph_id(_loaders_count++);
     _root_nodes.push_back(node);
@@ -319,7 +398,12 @@ inline std::shared_ptr<FusedJpegCropNode> MasterGraph::add_node(const std::vecto
     auto node = std::make_shared<FusedJpegCropNode>(outputs[0], nullptr);
 #endif
     auto loader_module = node->get_loader_module();
+    loader_module->set_sample_quarantine(_sample_quarantine);
+    loader_module->set_continuous_epochs(_continuous_epochs);
+    loader_module->set_file_scan_options(_file_scan_options);
+    loader_module->set_record_check(_record_check);
     loader_module->set_prefetch_queue_depth(_prefetch_queue_depth);
+    loader_module->set_host_memory_arena(_host_arena);
     loader_module->set_random_bbox_data_reader(_randombboxcrop_meta_data_reader);
     _loader_modules.emplace_back(loader_module);
     node->set_graph_id(_loaders_count++);
@@ -338,7 +422,12 @@ inline std::shared_ptr<FusedJpegCropSingleShardNode> MasterGraph::add_node(const
     auto node = std::make_shared<FusedJpegCropSingleShardNode>(outputs[0], nullptr);
 #endif
     auto loader_module = node->get_loader_module();
+    loader_module->set_sample_quarantine(_sample_quarantine);
+    loader_module->set_continuous_epochs(_continuous_epochs);
+    loader_module->set_file_scan_options(_file_scan_options);
+    loader_module->set_record_check(_record_check);
     loader_module->set_prefetch_queue_depth(_prefetch_queue_depth);
+    loader_module->set_host_memory_arena(_host_arena);
     loader_module->set_random_bbox_data_reader(_randombboxcrop_meta_data_reader);
     _loader_modules.emplace_back(loader_module);
     node->set_graph_id(_loaders_count++);
@@ -361,6 +450,7 @@ inline std::shared_ptr<Cifar10LoaderNode> MasterGraph::add_node(const std::vecto
 #endif
     auto loader_module = node->get_loader_module();
     loader_module->set_prefetch_queue_depth(_prefetch_queue_depth);
+    loader_module->set_host_memory_arena(_host_arena);
     _loader_modules.emplace_back(loader_module);
     node->set_graph_id(_loaders_count++);
     _root_nodes.push_back(node);
@@ -380,6 +470,7 @@ template<> inline std::shared_ptr<CIFAR10LoaderSingleShardNode> MasterGraph::add
 #endif
     auto loader_module = node->get_loader_module();
     loader_module->set_prefetch_queue_depth(_prefetch_queue_depth);
+    loader_module->set_host_memory_arena(_host_arena);
     _loader_modules.emplace_back(loader_module);
     node->set_graph_id(_loaders_count++);
     _root_nodes.push_back(node);
@@ -402,6 +493,7 @@ inline std::shared_ptr<VideoLoaderNode> MasterGraph::add_node(const std::vector<
 #endif
     auto loader_module = node->get_loader_module();
     loader_module->set_prefetch_queue_depth(_prefetch_queue_depth);
+    loader_module->set_host_memory_arena(_host_arena);
     _loader_modules.emplace_back(loader_module);
     node->set_graph_id(_loaders_count++);
     _root_nodes.push_back(node);
@@ -420,6 +512,7 @@ inline std::shared_ptr<VideoLoaderSingleShardNode> MasterGraph::add_node(const s
 #endif
     auto loader_module = node->get_loader_module();
     loader_module->set_prefetch_queue_depth(_prefetch_queue_depth);
+    loader_module->set_host_memory_arena(_host_arena);
     _loader_modules.emplace_back(loader_module);
     node->set_graph_id(_loaders_count++);
     _root_nodes.push_back(node);
@@ -442,6 +535,7 @@ template<> inline std::shared_ptr<AudioLoaderNode> MasterGraph::add_node(const s
 #endif
     auto loader_module = node->GetLoaderModule();
     loader_module->set_prefetch_queue_depth(_prefetch_queue_depth);
+    loader_module->set_host_memory_arena(_host_arena);
     _loader_modules.emplace_back(loader_module);
     node->set_graph_id(_loaders_count++);
     _root_nodes.push_back(node);
@@ -459,6 +553,7 @@ template<> inline std::shared_ptr<AudioLoaderSingleShardNode> MasterGraph::add_n
 #endif
     auto loader_module = node->GetLoaderModule();
     loader_module->set_prefetch_queue_depth(_prefetch_queue_depth);
+    loader_module->set_host_memory_arena(_host_arena);
     _loader_modules.emplace_back(loader_module);
     node->set_graph_id(_loaders_count++);
     _root_nodes.push_back(node);
@@ -481,6 +576,7 @@ inline std::shared_ptr<NumpyLoaderNode> MasterGraph::add_node(const std::vector<
 #endif
     auto loader_module = node->get_loader_module();
     loader_module->set_prefetch_queue_depth(_prefetch_queue_depth);
+    loader_module->set_host_memory_arena(_host_arena);
     _loader_modules.emplace_back(loader_module);
     node->set_graph_id(_loaders_count++);
     _root_nodes.push_back(node);
@@ -499,6 +595,7 @@ inline std::shared_ptr<NumpyLoaderSingleShardNode> MasterGraph::add_node(const s
 #endif
     auto loader_module = node->get_loader_module();
     loader_module->set_prefetch_queue_depth(_prefetch_queue_depth);
+    loader_module->set_host_memory_arena(_host_arena);
     _loader_modules.emplace_back(loader_module);
     node->set_graph_id(_loaders_count++);
     _root_nodes.push_back(node);
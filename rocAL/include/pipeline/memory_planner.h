@@ -0,0 +1,68 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include <list>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "pipeline/node.h"
+#include "pipeline/tensor.h"
+
+/*! \brief Plans the memory of the intermediate tensors of a graph
+ *
+ * Tensors are assigned to a small pool of arenas. A tensor reuses an arena once every node reading the arena's previous
+ * tensor is an ancestor of the node writing it, so the reuse is safe in any order the graph may execute its nodes in.
+ */
+class TensorMemoryPlanner {
+   public:
+    //! \param nodes The nodes of the pipeline in the order they were added, every node comes after the nodes it reads from
+    explicit TensorMemoryPlanner(const std::list<std::shared_ptr<Node>> &nodes);
+    ~TensorMemoryPlanner();
+    //! Assigns the tensors to arenas, every tensor has to be the output of one of the nodes
+    void plan(const std::vector<Tensor *> &tensors);
+    //! Allocates the arenas and swaps the handles of the planned tensors to them, the tensors have to be created from handle
+    void allocate();
+    void release();
+    size_t planned_size() const;    //!< Bytes held by the arenas
+    size_t unplanned_size() const;  //!< Bytes the planned tensors would take with a buffer each
+    size_t arena_count() const { return _arenas.size(); }
+
+   private:
+    struct Arena {
+        RocalMemType mem_type;
+        size_t size = 0;
+        Tensor *last_tensor = nullptr;  //!< The tensor assigned last, the next one has to be written after all its readers ran
+        std::vector<Tensor *> tensors;
+        void *buffer = nullptr;
+    };
+    bool is_ancestor(Node *ancestor, Node *node);
+    bool can_reuse(const Arena &arena, Node *producer);
+    std::map<Node *, size_t> _node_index;                //!< Position of the nodes in the execution order
+    std::vector<std::vector<bool>> _ancestors;           //!< _ancestors[i][j] is set when node j has to run before node i
+    std::map<Tensor *, Node *> _producers;
+    std::map<Tensor *, std::vector<Node *>> _consumers;
+    std::vector<Arena> _arenas;
+    size_t _unplanned_size = 0;
+    const size_t MEM_ALIGNMENT = 256;
+};
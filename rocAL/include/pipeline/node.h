@@ -39,6 +39,10 @@ class Node {
     std::vector<Tensor *> output() { return _outputs; };
     void add_next(const std::shared_ptr<Node> &node);   // Adds the Node next to the current Node
     void add_previous(const std::shared_ptr<Node> &node);   // Adds the Node preceding the current Node
+    void remove_next(const std::shared_ptr<Node> &node);   // Removes the Node from the Nodes next to the current Node
+    void remove_previous(const std::shared_ptr<Node> &node);   // Removes the Node from the Nodes preceding the current Node
+    std::vector<std::shared_ptr<Node>> next() { return _next; }
+    std::vector<std::shared_ptr<Node>> previous() { return _prev; }
     void release();
     std::shared_ptr<Graph> graph() { return _graph; }
     void set_meta_data(pMetaDataBatch meta_data_info) { _meta_data_info = meta_data_info; }
@@ -47,11 +51,12 @@ class Node {
     const Roi2DCords *get_dst_roi() { return _outputs[0]->info().roi().get_2D_roi(); }
     void set_graph_id(int id) { _graph_id = id; }
     int get_graph_id() { return _graph_id; }
+    void replace_input(Tensor *input, Tensor *replacement);   // Makes the Node read replacement instead of input, only valid before the Node is created
 
    protected:
     virtual void create_node() = 0;
     virtual void update_node() = 0;
-    const std::vector<Tensor *> _inputs;
+    std::vector<Tensor *> _inputs;
     const std::vector<Tensor *> _outputs;
     std::shared_ptr<Graph> _graph = nullptr;
     vx_node _node = nullptr;
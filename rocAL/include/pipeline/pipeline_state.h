@@ -0,0 +1,54 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*! \brief Position of a reader in its data set
+ *
+ * The shuffled order is not stored, the readers shuffle with a seeded generator so replaying epoch resets from a freshly initialized reader rebuilds it
+ */
+struct ReaderState {
+    uint64_t epoch = 0;          //!< Number of times the reader was reset since it was initialized
+    uint64_t curr_file_idx = 0;  //!< Index of the next item to be read
+    int64_t read_counter = 0;    //!< Items read in the current epoch
+    uint64_t shard_id = 0;       //!< Shard the reader is reading from
+};
+
+/*! \brief State of a loader module right after the last batch it handed out */
+struct LoaderState {
+    std::vector<ReaderState> readers;  //!< One per shard
+    std::vector<uint64_t> epochs;      //!< Epoch of the loader of each shard when it runs continuous epochs
+    uint64_t loader_idx = 0;           //!< Shard the last batch was taken from
+};
+
+/*! \brief Everything needed to resume a pipeline at the sample following a given output batch */
+struct PipelineState {
+    uint64_t seed = 0;                 //!< Seed the random parameters were created with
+    std::vector<LoaderState> loaders;  //!< One per loader module, in the order they were added to the graph
+    std::vector<uint64_t> parameters;  //!< Renewal count of each random parameter, in creation order
+};
+
+std::vector<uint8_t> serialize_pipeline_state(const PipelineState &state);
+PipelineState deserialize_pipeline_state(const uint8_t *data, size_t size);
@@ -27,14 +27,25 @@ THE SOFTWARE.
 #if ENABLE_OPENCL
 #include <CL/cl.h>
 #endif
+#include <map>
 #include <queue>
 
 #include "pipeline/commons.h"
+#include "pipeline/host_memory_arena.h"
 #include "device/device_manager.h"
 #include "device/device_manager_hip.h"
 #include "meta_data/meta_data.h"
+#include "pipeline/pipeline_state.h"
 
 using MetaDataNamePair = std::pair<ImageNameBatch, pMetaDataBatch>;
+
+//! Output buffers of a batch lent to the user, the ring buffer writes to other buffers until the lease is released
+struct OutputLease {
+    size_t id = 0;
+    std::vector<void *> buffers;
+    std::vector<unsigned *> roi_buffers;
+};
+
 class RingBuffer {
    public:
     explicit RingBuffer(unsigned buffer_depth);
@@ -48,7 +59,9 @@ class RingBuffer {
     void init(RocalMemType mem_type, void *dev, std::vector<size_t> &sub_buffer_size, std::vector<size_t> &roi_buffer_size);
     void initBoxEncoderMetaData(RocalMemType mem_type, size_t encoded_bbox_size, size_t encoded_labels_size);
     void init_metadata(RocalMemType mem_type, std::vector<size_t> &sub_buffer_size);
+    unsigned add_metadata_sub_buffer(size_t size);  //!< Adds a host sub buffer of size bytes at every depth after the ones of init_metadata, returns its index
     void release_gpu_res();
+    void set_host_memory_arena(std::shared_ptr<HostMemoryArena> arena) { _host_arena = arena; }  //!< Must be called before init, the host sub buffers are allocated from the heap without it
     std::pair<std::vector<void *>, std::vector<unsigned *>> get_read_buffers();
     std::pair<std::vector<void *>, std::vector<unsigned *>> get_write_buffers();
     std::pair<void *, void *> get_box_encode_write_buffers();
@@ -57,6 +70,10 @@ class RingBuffer {
     std::vector<void *> get_meta_read_buffers();
     std::vector<void *> get_meta_write_buffers();
     void set_meta_data(ImageNameBatch names, pMetaDataBatch meta_data);
+    void set_epoch_info(const EpochInfo &epoch_info) { _last_epoch_info = epoch_info; }
+    EpochInfo get_epoch_info();
+    void set_pipeline_state(const PipelineState &state) { _last_pipeline_state = state; }
+    PipelineState get_pipeline_state();
     void rellocate_meta_data_buffer(void *buffer, size_t buffer_size, unsigned buff_idx);
     void reset();
     void pop();
@@ -68,13 +85,24 @@ class RingBuffer {
     void block_if_empty();
     void block_if_full();
     void release_if_empty();
+    //! Leases the buffers of the batch at the read position, they are swapped out of the ring when the batch is popped
+    OutputLease lease_read_buffers();
+    void release_lease(size_t lease_id);
 
    private:
     std::queue<MetaDataNamePair> _meta_ring_buffer;
     MetaDataNamePair _last_image_meta_data;
+    std::queue<EpochInfo> _epoch_ring_buffer;  //!< Epoch of each batch stored, kept in step with _meta_ring_buffer
+    EpochInfo _last_epoch_info;
+    std::queue<PipelineState> _state_ring_buffer;  //!< State to resume from after each batch stored, kept in step with _meta_ring_buffer
+    PipelineState _last_pipeline_state;
     void increment_read_ptr();
     void increment_write_ptr();
     bool full();
+    void *allocate_host_sub_buffer(size_t size);
+    void free_host_sub_buffer(void *buffer);
+    OutputLease take_spare_buffers();
+    void detach_slot_lease(size_t slot);
     const unsigned BUFF_DEPTH;
     std::vector<size_t> _sub_buffer_size;
     std::vector<std::vector<size_t>> _meta_data_sub_buffer_size;
@@ -98,4 +126,11 @@ class RingBuffer {
     std::mutex _names_buff_lock;
     const size_t MEM_ALIGNMENT = 256;
     bool _box_encoder = false;
+    std::shared_ptr<HostMemoryArena> _host_arena;
+    std::vector<size_t> _roi_buffer_size;
+    std::mutex _lease_lock;
+    std::map<size_t, OutputLease> _leases;     //!< Leases handed out and not released yet
+    std::vector<size_t> _slot_leases;          //!< Lease of the batch held in each slot, 0 if the slot is not leased
+    std::vector<OutputLease> _spare_buffers;   //!< Buffers of released leases, swapped into the slots of leased batches
+    size_t _next_lease_id = 1;
 };
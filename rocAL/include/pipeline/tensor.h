@@ -309,6 +309,20 @@ class TensorInfo {
 };
 
 bool operator==(const TensorInfo& rhs, const TensorInfo& lhs);
+
+/*! \brief The valid region of one sample, seen as rows of contiguous bytes
+ *
+ * The dimensions the region covers completely are folded into the rows, the remaining outer dimensions are walked
+ * with their strides in the padded buffer
+ */
+struct PackedSampleRegion {
+    const unsigned char* src = nullptr;  //!< First byte of the region in the padded buffer
+    size_t dst_offset = 0;               //!< Offset of the sample in the packed buffer
+    size_t row_bytes = 0;
+    size_t num_rows = 0;
+    std::vector<size_t> outer_extents;   //!< Extents of the dimensions above the rows
+    std::vector<size_t> outer_strides;   //!< Strides in bytes of the dimensions above the rows
+};
 /*! \brief Holds an OpenVX tensor and it's info
  * Keeps the information about the tensor that can be queried using OVX API as
  * well, but for simplicity and ease of use, they are kept in separate fields
@@ -339,6 +353,10 @@ class Tensor : public rocalTensor {
     unsigned copy_data(void* user_buffer, RocalOutputMemType external_mem_type) override;
     //! Copying the output buffer with specified max_cols and max_rows values for the 2D buffer of size batch_size
     unsigned copy_data(void* user_buffer, uint x_offset, uint y_offset, uint max_rows, uint max_cols) override;
+    //! Number of bytes copied by copy_data_packed(), the size of the valid regions of all the samples
+    size_t packed_data_size() override;
+    //! Copies only the valid region of every sample, back to back, sample_offsets gets the offset of every sample followed by the total size
+    unsigned copy_data_packed(void* user_buffer, std::vector<size_t>& sample_offsets) override;
     //! Default destructor
     /*! Releases the OpenVX Tensor object */
     ~Tensor();
@@ -380,6 +398,7 @@ class Tensor : public rocalTensor {
     uint64_t data_type_size() override { return _info.data_type_size(); }
 
    private:
+    std::vector<PackedSampleRegion> packed_regions();
     vx_tensor _vx_handle = nullptr;  //!< The OpenVX tensor
     void* _mem_handle = nullptr;     //!< Pointer to the tensor's internal buffer (opencl or host)
     TensorInfo _info;                //!< The structure holding the info related to the stored OpenVX tensor
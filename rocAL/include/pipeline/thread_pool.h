@@ -0,0 +1,69 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*! \brief A fixed set of worker threads for data parallel loops
+ *
+ * The workers are created once and sleep between the loops, so short loops don't pay for creating threads.
+ * The calling thread takes part in every loop. Loops submitted from several threads are run one after the other.
+ */
+class ThreadPool {
+   public:
+    //! Creates num_threads - 1 workers, the calling thread is the last one
+    explicit ThreadPool(unsigned num_threads);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+    //! Runs work(i) for every i in [0, count) and returns once all of them are done, the first exception thrown by work is rethrown
+    void parallel_for(size_t count, const std::function<void(size_t)> &work);
+    unsigned num_threads() const { return _workers.size() + 1; }
+
+   private:
+    void worker_routine();
+    void run_tasks();
+    std::vector<std::thread> _workers;
+    std::mutex _job_lock;  //!< Serializes the loops submitted from different threads
+    std::mutex _lock;
+    std::condition_variable _start_cv;
+    std::condition_variable _done_cv;
+    const std::function<void(size_t)> *_work = nullptr;
+    size_t _count = 0;
+    std::atomic<size_t> _next_index = {0};
+    size_t _generation = 0;      //!< Incremented for every loop, wakes up the workers
+    unsigned _busy_workers = 0;  //!< Workers still running the current loop
+    std::exception_ptr _error;
+    bool _stop = false;
+};
+
+/*! \brief The pool shared by the host side copies of the outputs and the meta data
+ *
+ * The threads are created on first use and live until the process exits
+ */
+ThreadPool &host_copy_thread_pool();
@@ -0,0 +1,39 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+//
+// CRC32C (Castagnoli) as used by the TFRecord format. On x86 with SSE4.2 and on ARMv8 with the CRC extension the
+// checksum runs on the CRC32C instructions, interleaved over three independent streams so that the latency of the
+// instruction is hidden, otherwise a table driven implementation is used.
+
+//! Extends the CRC32C crc of a message with the size bytes at data, crc is 0 for an empty message
+uint32_t crc32c_extend(uint32_t crc, const void *data, size_t size);
+//! Returns the CRC32C of the size bytes at data
+inline uint32_t crc32c(const void *data, size_t size) { return crc32c_extend(0, data, size); }
+//! Returns the masked CRC32C stored in the TFRecord files, masking keeps a CRC over data holding CRCs meaningful
+inline uint32_t crc32c_mask(uint32_t crc) { return ((crc >> 15) | (crc << 17)) + 0xa282ead8u; }
+//! Returns true when the CRC32C instructions are used
+bool crc32c_hardware_accelerated();
@@ -0,0 +1,66 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+//! Options of the dataset scan done by the file reader when it is initialized
+struct FileScanOptions {
+    std::string manifest_dir;      //!< Folder caching the scan results as binary manifests shared by runs and ranks, empty to scan every time
+    bool trust_file_list = false;  //!< If true the entries of a file list are used without checking that they exist on the disk
+};
+
+//
+// DirectoryScanner lists the files of a dataset folder or file list. The folder entries are typed from the
+// readdir() entry type so that no stat is needed on file systems which report it, and the subfolders are walked
+// concurrently. When a manifest folder is given, the result is saved as a binary manifest keyed by the
+// modification time of the scanned folders (or of the file list), and later scans load it instead of walking the disk.
+// The files of a file list are still checked after the manifest is loaded, unless the file list is trusted.
+class DirectoryScanner {
+   public:
+    //! Returns true for the file names to keep when scanning folders
+    using FileFilter = std::function<bool(const std::string &file_name)>;
+    DirectoryScanner(const FileScanOptions &options, FileFilter filter);
+    //! Lists the files of the root folder if it has any, otherwise the files of its subfolders, each in sorted order
+    std::vector<std::string> scan_folder(const std::string &root_path);
+    //! Lists the existing paths of a file list, the first field of each line, relative paths being taken from root_path
+    std::vector<std::string> read_file_list(const std::string &file_list_path, const std::string &root_path);
+    //! Returns the paths that are regular files, in the same order, checking them in parallel unless the file list is trusted
+    std::vector<std::string> existing_files(const std::vector<std::string> &file_paths);
+
+   private:
+    struct ScannedFolder {
+        std::string path;
+        int64_t modification_time;
+    };
+    std::vector<std::string> list_files(const std::string &folder_path);
+    std::string manifest_path(const std::string &key);
+    bool load_manifest(const std::string &key, std::vector<std::string> &file_paths);
+    void save_manifest(const std::string &key, const std::vector<ScannedFolder> &folders, const std::vector<std::string> &file_paths);
+    static int64_t modification_time(const std::string &path);
+    static unsigned num_threads(size_t work_count);
+    FileScanOptions _options;
+    FileFilter _filter;
+};
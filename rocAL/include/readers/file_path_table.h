@@ -0,0 +1,58 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+//
+// FilePathTable keeps the file paths of a dataset in a compact form: every directory is stored once and
+// the file names are packed back to back in a single arena. A path is referred to by its 32 bit sample id,
+// and the full path string is only built when it is asked for.
+class FilePathTable {
+   public:
+    using SampleId = uint32_t;
+    //! Adds the path to the table and returns its sample id
+    SampleId add(const std::string &file_path);
+    size_t size() const { return _directory_of.size(); }
+    bool empty() const { return _directory_of.empty(); }
+    //! Returns the file name of the sample, without the directory
+    std::string_view name(SampleId id) const;
+    //! Returns the directory of the sample, with its trailing separator
+    const std::string &directory(SampleId id) const { return _directories[_directory_of[id]]; }
+    //! Returns the full path of the sample
+    std::string path(SampleId id) const;
+    //! Writes the full path of the sample into out, reusing its storage
+    void path(SampleId id, std::string &out) const;
+    //! Releases the spare capacity left from building the table
+    void shrink_to_fit();
+
+   private:
+    std::vector<std::string> _directories;
+    std::unordered_map<std::string, uint32_t> _directory_ids;
+    std::vector<uint32_t> _directory_of;  // Directory index of every sample
+    std::vector<uint64_t> _name_offsets = {0};  // Start of the name of every sample in the arena, followed by the end of the arena
+    std::string _name_arena;
+};
@@ -21,14 +21,13 @@ THE SOFTWARE.
 */
 
 #pragma once
-#include <dirent.h>
-
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "pipeline/commons.h"
 #include "pipeline/timing_debug.h"
+#include "readers/file_path_table.h"
 #include "readers/image/image_reader.h"
 
 class FileSourceReader : public Reader {
@@ -59,6 +58,9 @@ class FileSourceReader : public Reader {
     //! Returns the name of the latest file_path opened
     const std::string file_path() override { return _last_file_path; }
 
+    //! File names repeat across class folders, the full path is used as the quarantine key
+    std::string quarantine_key() override { return _last_file_path; }
+
     ~FileSourceReader() override;
 
     int close() override;
@@ -69,15 +71,12 @@ class FileSourceReader : public Reader {
 
     std::vector<std::string> get_file_paths_from_meta_data_reader() override;  // Returns the relative file path from the meta-data reader
    private:
-    //! opens the folder containing the images
-    Reader::Status open_folder();
     Reader::Status subfolder_reading();
     std::string _folder_path;
     std::string _file_list_path;
-    DIR *_src_dir;
-    DIR *_sub_dir;
-    struct dirent *_entity;
-    std::vector<std::string> _file_names;
+    FileScanOptions _file_scan_options;
+    FilePathTable _file_table;                        // Paths of all the files found, stored once
+    std::vector<FilePathTable::SampleId> _file_ids;   // Files to read in order, padding included
     FILE *_current_fPtr;
     unsigned _current_file_size;
     std::string _last_id;
@@ -86,6 +85,8 @@ class FileSourceReader : public Reader {
     void incremenet_read_ptr();
     int release();
     std::shared_ptr<MetaDataReader> _meta_data_reader = nullptr;
+    std::shared_ptr<SampleQuarantine> _sample_quarantine = nullptr;
     //! Pair containing the last batch policy and pad_last_batch_repeated values for deciding what to do with last batch
-    Reader::Status generate_file_names();         // Function that would generate _file_names containing all the samples in the dataset
+    Reader::Status generate_file_names();         // Function that would generate _file_ids containing all the samples in the dataset
+    void remove_quarantined_files();              // Leaves the quarantined samples out of _file_ids
 };
@@ -23,6 +23,7 @@ THE SOFTWARE.
 #pragma once
 #include <dirent.h>
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -62,10 +63,14 @@ class CIFAR10DataReader : public Reader {
 
     unsigned get_file_index() { return _last_file_idx; }
 
+    //! Returns the image bytes of the record last opened, pointing into the mapped data files, null unless the reader is memory resident
+    const unsigned char *record_view() { return _record_view; }
+
    private:
     //! opens the folder containing the images
     Reader::Status open_folder();
     Reader::Status subfolder_reading();
+    void map_files();
     std::string _folder_path;
     DIR *_src_dir;
     DIR *_sub_dir;
@@ -84,6 +89,9 @@ class CIFAR10DataReader : public Reader {
     //!< _raw_file_size of each file to read
     const size_t _raw_file_size = (32 * 32 * 3 + 1);  // todo:: need to add an option in reader config to take this.
     size_t _total_file_size;
+    bool _memory_resident = false;  //!< The data files are mapped once and the records are served from memory
+    std::map<std::string, std::pair<unsigned char *, size_t>> _mapped_files;  //!< Address and size of each mapped data file
+    const unsigned char *_record_view = nullptr;
     void incremenet_read_ptr();
     int release();
 };
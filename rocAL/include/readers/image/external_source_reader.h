@@ -55,6 +55,9 @@ class ExternalSourceReader : public Reader, public ExternalSourceImageReader {
     //! Resets the object's state to read from the first file in the list
     void reset() override;
 
+    //! The samples are pushed by the application, they can't be replayed from a saved position
+    void set_state(const ReaderState &state) override { THROW("Restoring the reader state is not supported for external source") }
+
     //! Returns the name of the latest file opened
     std::string id() override { return _last_id; }
 
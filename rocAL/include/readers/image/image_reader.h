@@ -22,6 +22,7 @@ THE SOFTWARE.
 
 #pragma once
 #include <map>
+#include <random>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -29,7 +30,12 @@ THE SOFTWARE.
 #include <lmdb.h>
 #include "meta_data/meta_data_reader.h"
 #include "readers/video/video_properties.h"
+#include "pipeline/pipeline_state.h"
 #include "pipeline/tensor.h"
+#include "readers/directory_scanner.h"
+#include "readers/record_check.h"
+#include "readers/sample_quarantine.h"
+#include "readers/shuffle_sampler.h"
 
 #define CHECK_LMDB_RETURN_STATUS(status)                                                          \
     do {                                                                                          \
@@ -109,7 +115,16 @@ struct ReaderConfig {
         _sharding_info = sharding_info;
     }
     void set_files_list(const std::vector<std::string> &files) { _file_names = files; }
+    /// \param roi_start, roi_shape Region of every numpy array to read, per dimension. Missing trailing dimensions and negative shapes extend to the end of the array
+    void set_numpy_roi(const std::vector<int> &roi_start, const std::vector<int> &roi_shape) {
+        _numpy_roi_start = roi_start;
+        _numpy_roi_shape = roi_shape;
+    }
     void set_seed(unsigned seed) { _seed = seed; }
+    void set_sample_quarantine(std::shared_ptr<SampleQuarantine> sample_quarantine) { _sample_quarantine = sample_quarantine; }
+    void set_file_scan_options(const FileScanOptions &file_scan_options) { _file_scan_options = file_scan_options; }
+    void set_record_check(std::shared_ptr<RecordCheck> record_check) { _record_check = record_check; }
+    void set_memory_resident(bool memory_resident) { _memory_resident = memory_resident; }
     size_t get_shard_count() { return _shard_count; }
     size_t get_shard_id() { return _shard_id; }
     size_t get_cpu_num_threads() { return _cpu_num_threads; }
@@ -118,6 +133,8 @@ struct ReaderConfig {
     size_t get_frame_step() { return _sequence_frame_step; }
     size_t get_frame_stride() { return _sequence_frame_stride; }
     std::vector<std::string> get_files() { return _file_names; }
+    std::vector<int> numpy_roi_start() { return _numpy_roi_start; }
+    std::vector<int> numpy_roi_shape() { return _numpy_roi_shape; }
     std::string path() { return _path; }
     unsigned seed() { return _seed; }
 #ifdef ROCAL_VIDEO
@@ -134,6 +151,10 @@ struct ReaderConfig {
     std::shared_ptr<MetaDataReader> meta_data_reader() { return _meta_data_reader; }
     ExternalSourceFileMode mode() { return _file_mode; }
     const ShardingInfo& get_sharding_info() { return _sharding_info; }
+    std::shared_ptr<SampleQuarantine> sample_quarantine() { return _sample_quarantine; }
+    const FileScanOptions &file_scan_options() { return _file_scan_options; }
+    std::shared_ptr<RecordCheck> record_check() { return _record_check; }
+    bool memory_resident() { return _memory_resident; }
 
    private:
     StorageType _type = StorageType::FILE_SYSTEM;
@@ -155,7 +176,12 @@ struct ReaderConfig {
     ExternalSourceFileMode _file_mode = ExternalSourceFileMode::NONE;
     ShardingInfo _sharding_info;
     std::vector<std::string> _file_names;
+    std::vector<int> _numpy_roi_start, _numpy_roi_shape;  //!< Region of the numpy arrays to read, empty to read them whole
     unsigned _seed = 0;
+    std::shared_ptr<SampleQuarantine> _sample_quarantine = nullptr;  //!< Samples left out of the index and skipped in the stream
+    FileScanOptions _file_scan_options;  //!< How the file reader lists the dataset files
+    std::shared_ptr<RecordCheck> _record_check = nullptr;  //!< Verifies the records of the record files, not checked if null
+    bool _memory_resident = false;  //!< The reader maps the data files once and serves the samples from memory, supported by the CIFAR10 reader
 #ifdef ROCAL_VIDEO
     VideoProperties _video_prop;
 #endif
@@ -293,6 +319,9 @@ class Reader {
      //! Returns the path of the last item opened in this resource
     virtual const std::string file_path() { THROW("File path is not set by the reader") }
 
+    //! Returns the key the last item opened is quarantined under, unique within the dataset
+    virtual std::string quarantine_key() { return id(); }
+
     virtual unsigned count_items();
 
     virtual ~Reader() = default;
@@ -304,6 +333,12 @@ class Reader {
     //! Returns the number of images in the last batch
     size_t last_batch_padded_size() { return _last_batch_padded_size; }
 
+    //! Returns the epoch and the position of the next item to be opened
+    virtual ReaderState get_state();
+
+    //! Repositions the reader at a state returned by get_state(), replaying the seeded shuffles of the epochs in between
+    virtual void set_state(const ReaderState &state);
+
    protected:
     ShardingInfo _sharding_info = ShardingInfo();  // The members of ShardingInfo determines how the data is distributed among the shards and how the last batch is processed by the pipeline.
     std::vector<unsigned> _shard_start_idx_vector, _shard_end_idx_vector;   // Holds the start and end idx of the file names vector for each shard
@@ -319,6 +354,10 @@ class Reader {
     bool _loop;
     bool _shuffle;
     int _read_counter = 0;
+    size_t _epoch = 0;  // Number of times the reader has been reset
+    std::mt19937 _shuffle_rng;  // Seeded from the reader config so that the shuffle order of every epoch can be reproduced
+    ShuffleSampler _sampler;    // Global permutation of the dataset, drawn again from the seed for every epoch
+    size_t _padded_file_count = 0;  // Number of files added to the file names vector to pad the shards
 
     //! Modified the file idx, and sets the current file idx to be processed
     void increment_curr_file_idx(size_t dataset_size);
@@ -338,6 +377,13 @@ class Reader {
     //! Returns the maximum size of the current shard
     size_t get_max_size_of_shard(size_t batch_size, bool loop);
 
-    //! Modifies the file names vector with files to be padded
-    void update_filenames_with_padding(std::vector<std::string> &file_names, size_t batch_size);
+    //! Modifies the file names (or sample ids) vector with files to be padded
+    template <typename T>
+    void update_filenames_with_padding(std::vector<T> &file_names, size_t batch_size);
+
+    //! Sets up the global shuffle of the dataset, to be called once the shards are computed
+    void init_shuffle(unsigned seed);
+
+    //! Returns the index in the file names vector of the file read at position file_idx in the current epoch
+    size_t shuffled_file_idx(size_t file_idx);
 };
@@ -82,7 +82,10 @@ class MXNetRecordIOReader : public Reader {
     //!< _file_count_all_shards total_number of files in to figure out the max_batch_size (usually needed for distributed training).
     void incremenet_read_ptr();
     int release();
-    void read_image(unsigned char* buff, int64_t seek_position, int64_t data_size);
+    //! Reads the image of the record into buff, returns false if the record fails the record check
+    bool read_image(unsigned char* buff, int64_t seek_position, int64_t data_size);
+    //! Returns the image size of the record read, -1 if its magic or its length do not fit the span the index gives it
+    int64_t record_image_size(const uint8_t* data, int64_t data_size);
     void read_image_names();
     uint32_t DecodeFlag(uint32_t rec) { return (rec >> 29U) & 7U; };
     uint32_t DecodeLength(uint32_t rec) { return rec & ((1U << 29U) - 1U); };
@@ -91,4 +94,5 @@ class MXNetRecordIOReader : public Reader {
     const uint32_t _kMagic = 0xced7230a;
     int64_t _seek_pos, _data_size_to_read;
     ImageRecordIOHeader _hdr;
+    std::shared_ptr<RecordCheck> _record_check = nullptr;  //!< Verifies the structure of the records read, RecordIO carries no checksum
 };
@@ -23,6 +23,7 @@ THE SOFTWARE.
 #pragma once
 #include <dirent.h>
 
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -33,6 +34,40 @@ THE SOFTWARE.
 #include "pipeline/timing_debug.h"
 #include "readers/image/image_reader.h"
 
+//! Read-only mapping of a numpy file, the pages are only read from the disk when they are copied
+class NumpyMappedFile {
+   public:
+    //! Maps the file, returns nullptr if it can't be opened or mapped
+    static std::shared_ptr<NumpyMappedFile> open(const std::string &file_path);
+    ~NumpyMappedFile();
+    const unsigned char *data() const { return _data; }
+    size_t size() const { return _size; }
+    int64_t modification_time() const { return _modification_time; }
+    //! Asks the kernel to start reading the given byte range ahead of the copy
+    void prefetch(size_t offset, size_t size) const;
+
+   private:
+    NumpyMappedFile() = default;
+    unsigned char *_data = nullptr;
+    size_t _size = 0;
+    int64_t _modification_time = 0;  //!< In nanoseconds, used to tell if a cached header is still valid
+};
+
+//! A numpy array opened by the reader. It keeps the file mapped, so it can be copied out from any thread after the reader moved on to the next file
+struct NumpySample {
+    std::shared_ptr<NumpyMappedFile> file;
+    NumpyHeaderData header;           //!< Header of the whole array
+    std::vector<unsigned> roi_start;  //!< First element of the region to copy, per dimension
+    std::vector<unsigned> roi_shape;  //!< Extent of the region to copy, per dimension
+};
+
+//! Copies the region of interest of a sample into a tensor of the given max shape strides, transposing fortran ordered arrays
+/*!
+ \param strides_in_dims Strides of the output tensor in elements, strides_in_dims[d + 1] being the stride of dimension d
+ \return Number of bytes copied
+*/
+size_t copy_numpy_sample(const NumpySample &sample, unsigned char *dst, const std::vector<unsigned> &strides_in_dims);
+
 class NumpyDataReader : public Reader {
    public:
     //! Looks up the folder which contains the files, and loads the numpy files
@@ -54,10 +89,13 @@ class NumpyDataReader : public Reader {
 
     //! Returns the numpy header data 
     /*!
-     \return The numpy header data of the current file
+     \return The numpy header data of the current file, with the shape of the region of interest that is read
     */
     const NumpyHeaderData get_numpy_header_data() override;
 
+    //! Returns the array opened by the last open() call, it stays valid after close()
+    const NumpySample& current_sample() { return _curr_sample; }
+
     //! Reads the next numpy file
     /*!
      \param buf User's provided buffer to receive the loaded numpy data
@@ -94,16 +132,22 @@ class NumpyDataReader : public Reader {
     DIR *_src_dir = nullptr;
     DIR *_sub_dir = nullptr;
     struct dirent *_entity = nullptr;
-    FILE *_current_file_ptr = nullptr;
     std::vector<std::string> _file_names;
     std::vector<std::string> _files;
-    std::vector<NumpyHeaderData> _file_headers;
-    NumpyHeaderData _curr_file_header;
+    NumpySample _curr_sample;
+    size_t _curr_read_offset = 0;  //!< Offset of the next read_data() call in the current file
+    std::vector<int> _roi_start, _roi_shape;
     std::string _last_id;
     std::string _last_file_name, _last_file_path, _absolute_file_path;
     unsigned _seed = 0;
-    std::mutex _cache_mutex;
-    std::map<std::string, NumpyHeaderData> _header_cache;
+    //! Header parsed from a file, valid as long as the file keeps the same size and modification time
+    struct CachedHeader {
+        NumpyHeaderData header;
+        size_t file_size;
+        int64_t modification_time;
+    };
+    static std::mutex _cache_mutex;
+    static std::map<std::string, CachedHeader> _header_cache;  //!< Shared by all the numpy readers, so the headers parsed by the source evaluator are reused by the loaders
     std::shared_ptr<MetaDataReader> _meta_data_reader = nullptr;
     bool _header_parsing_failed = false;
     std::unordered_map<std::string, RocalTensorDataType> _numpy_str_to_rocal_dtype =
@@ -134,14 +178,14 @@ class NumpyDataReader : public Reader {
     T parse_int(const char*& ptr);
     //! Parses the numpy header string to fetch the data type and endianness
     std::string parse_string(const char*& input, char delim_start = '\'', char delim_end = '\'');
-    //! Reads the npy file, parses the numpy header data and stores the metadata info
-    void parse_header(NumpyHeaderData& parsed_header, std::string file_path);
-    //! Reads the numpy data present in the npy array and stores the data in the circular buffer
-    size_t parse_numpy_data(unsigned char* buf, std::vector<unsigned>& strides, std::vector<unsigned>& shapes, size_t dtype_size, unsigned dim = 0);
-    //! Fetches cached header data if its already parsed before
-    bool get_header_from_cache(const std::string& file_name, NumpyHeaderData& target);
+    //! Parses the numpy header at the start of the mapped npy file and stores the metadata info
+    void parse_header(NumpyHeaderData& parsed_header, const NumpyMappedFile& file, const std::string& file_path);
+    //! Fetches cached header data if its already parsed before and the file didn't change since
+    bool get_header_from_cache(const std::string& file_name, const NumpyMappedFile& file, NumpyHeaderData& target);
     //! Stores parsed header data for a specific npy file
-    void update_header_cache(const std::string& file_name, const NumpyHeaderData& value);
+    void update_header_cache(const std::string& file_name, const NumpyMappedFile& file, const NumpyHeaderData& value);
+    //! Computes the region of the current array to read from the requested roi
+    void set_sample_roi(NumpySample& sample);
     void incremenet_read_ptr();
     int release();
     Reader::Status generate_file_names();            // Function that would generate _file_names containing all the samples in the dataset
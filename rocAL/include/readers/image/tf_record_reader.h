@@ -94,7 +94,10 @@ class TFRecordReader : public Reader {
     rocal::tensorflow::Feature _single_feature;
     void incremenet_read_ptr();
     int release();
-    Reader::Status read_image(unsigned char *buff, std::string record_file_name, uint file_size);
+    //! Reads the encoded feature of the record into buff, returns false if the record fails the record check
+    bool read_image(unsigned char *buff, std::string record_file_name, uint file_size);
     Reader::Status read_image_names(std::ifstream &file_contents, uint file_size);
     std::map<std::string, uint> _image_record_starting;
+    std::shared_ptr<RecordCheck> _record_check = nullptr;  //!< Verifies the CRC32C of the records read, not checked if null
+    static constexpr size_t RECORD_READ_CHUNK = 64 * 1024;  //!< Bytes read at once from a checked record, the CRC of a chunk is computed while it is in cache
 };
@@ -0,0 +1,60 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+
+//! What the readers do with a record that fails its integrity check
+enum class RecordCheckPolicy {
+    OFF = 0,     //!< Records are not checked
+    SKIP,        //!< The record is left out and the next one is read in its place
+    SUBSTITUTE,  //!< The record is replaced with the previous sample of the batch, or skipped when it is the first one
+    FAIL         //!< Reading throws
+};
+
+//
+// RecordCheck is shared by the readers of record files (TFRecord, MXNet RecordIO) which verify every record they read:
+// the CRC32C of the TFRecord length and data, the magic and the length of the RecordIO records. It counts the checked
+// and the corrupted records of every shard. A rejected record is reported by the reader as a read of size 0.
+class RecordCheck {
+   public:
+    struct Counters {
+        size_t checked = 0;    //!< Records verified
+        size_t corrupted = 0;  //!< Records that failed the verification
+    };
+    explicit RecordCheck(RecordCheckPolicy policy) : _policy(policy) {}
+    RecordCheckPolicy policy() const { return _policy; }
+    //! Counts a record of the shard, throws for a corrupted record under the FAIL policy
+    /*!
+     \return intact
+    */
+    bool count(size_t shard_id, bool intact, const std::string &record_id);
+    std::map<size_t, Counters> counters();  // Returns the counters of the shards read so far, by shard id
+
+   private:
+    const RecordCheckPolicy _policy;
+    std::mutex _lock;
+    std::map<size_t, Counters> _counters;
+};
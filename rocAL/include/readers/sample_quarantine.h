@@ -0,0 +1,49 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+//
+// SampleQuarantine keeps the samples (file path or record id) that failed to be read or decoded.
+// Readers leave the quarantined samples out of their index and the loaders skip them when they are met in the stream,
+// so a bad sample costs its read and header decode only once. When a file path is given the list is loaded from it
+// and every new entry is appended to it, carrying the quarantine over to later runs.
+class SampleQuarantine {
+   public:
+    explicit SampleQuarantine(const std::string &file_path = "");
+    bool contains(const std::string &key);
+    //! Quarantines the sample, returns false if it already was
+    bool add(const std::string &key, const std::string &reason);
+    std::vector<std::string> keys();  // Returns the quarantined samples in the order they were added
+    size_t count();
+    const std::string &file_path() const { return _file_path; }
+
+   private:
+    std::mutex _lock;
+    std::string _file_path;
+    std::unordered_set<std::string> _key_set;
+    std::vector<std::string> _keys;
+};
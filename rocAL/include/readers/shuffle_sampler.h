@@ -0,0 +1,51 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+//
+// ShuffleSampler draws a permutation of [0, size) for every (seed, epoch) pair without storing it.
+// The index is sent through a keyed Feistel network over the smallest power of two domain covering the size,
+// and walked again while it falls out of range, which keeps the mapping a bijection of [0, size).
+// Readers lay the permuted positions out in contiguous shard slices, so all the shards of a pipeline
+// share one global order and the order of any epoch can be rebuilt from the seed.
+class ShuffleSampler {
+   public:
+    void init(uint64_t seed, size_t size);
+    void set_epoch(uint64_t epoch);
+    uint64_t epoch() const { return _epoch; }
+    size_t size() const { return _size; }
+    //! Returns the sample at position idx of the current epoch's permutation
+    size_t sample(size_t idx) const;
+
+   private:
+    static constexpr unsigned ROUNDS = 4;
+    uint64_t permute(uint64_t value) const;
+    uint64_t _seed = 0;
+    uint64_t _epoch = 0;
+    size_t _size = 0;
+    unsigned _half_bits = 1;    // Bits in each half of the Feistel domain
+    uint64_t _half_mask = 1;
+    uint64_t _round_keys[ROUNDS] = {};
+};
@@ -64,6 +64,18 @@ class SequenceFileSourceReader : public Reader {
 
     SequenceFileSourceReader();
 
+    //! Position in the frame order of the epoch of the frame the next open() reads
+    size_t next_position() { return _curr_file_idx; }
+    //! Position of the frame last opened or skipped
+    size_t last_position() { return _last_position; }
+    //! Path of the frame at position
+    const std::string &frame_path(size_t position) { return _frame_names[position]; }
+    //! Position the frame at position is read again in this epoch, NO_NEXT_USE if it is not
+    size_t next_use(size_t position) { return _next_use[position]; }
+    //! Moves past the next frame without opening it, for a frame the loader already holds decoded
+    void skip();
+    static constexpr size_t NO_NEXT_USE = SIZE_MAX;
+
    private:
     //! opens the folder containnig the images
     Reader::Status open_folder();
@@ -77,6 +89,8 @@ class SequenceFileSourceReader : public Reader {
     std::vector<std::string> _frame_names;
     std::vector<std::vector<std::string>> _folder_file_names;
     std::vector<std::vector<std::string>> _sequence_frame_names;
+    std::vector<size_t> _next_use;  //!< Position of the next read of the frame at each position of _frame_names
+    size_t _last_position = 0;
     unsigned _curr_file_idx;
     FILE *_current_fPtr;
     unsigned _current_file_size;
@@ -100,6 +114,8 @@ class SequenceFileSourceReader : public Reader {
     //!< _sequence_count_all_shards total_number of sequences in to figure out the max_batch_size (usually needed for distributed training).
     size_t _sequence_count_all_shards;
     void incremenet_read_ptr();
+    void set_last_id(const std::string &file_path);
+    void build_frame_order();  //!< Flattens the sequences into _frame_names and finds the next read of every frame
     int release();
     size_t get_sequence_shard_id();
     void incremenet_sequence_id() { _sequence_id++; }
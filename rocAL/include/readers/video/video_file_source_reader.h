@@ -22,6 +22,7 @@ THE SOFTWARE.
 
 #pragma once
 #include <memory>
+#include <random>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -49,6 +50,10 @@ class VideoFileSourceReader : public VideoReader {
 
     unsigned count_items() override;
 
+    ReaderState get_state() override;
+
+    void set_state(const ReaderState &state) override;
+
     ~VideoFileSourceReader() override;
 
     VideoFileSourceReader();
@@ -79,6 +84,8 @@ class VideoFileSourceReader : public VideoReader {
     bool _loop;
     bool _shuffle;
     int _read_counter = 0;
+    size_t _epoch = 0;
+    std::mt19937 _shuffle_rng;
     //!< _sequence_count_all_shards total_number of sequences to figure out the max_batch_size (usually needed for distributed training).
     size_t _sequence_count_all_shards;
     void incremenet_read_ptr();
@@ -27,6 +27,7 @@ THE SOFTWARE.
 #include <vector>
 
 #include "pipeline/commons.h"
+#include "pipeline/pipeline_state.h"
 #include "meta_data/meta_data_reader.h"
 #include "readers/image/image_reader.h"
 #include "readers/video/video_properties.h"
@@ -60,6 +61,12 @@ class VideoReader {
     //! Returns the number of items remained in this resource
     virtual unsigned count_items() = 0;
 
+    //! Returns the epoch and the position of the next sequence to be read
+    virtual ReaderState get_state() { THROW("Saving the reader state is not supported") }
+
+    //! Repositions the reader at a state returned by get_state()
+    virtual void set_state(const ReaderState &state) { THROW("Restoring the reader state is not supported") }
+
     virtual ~VideoReader() = default;
 };
 #endif
@@ -22,11 +22,13 @@ THE SOFTWARE.
 
 #include "rocal_api.h"
 
+#include <cstring>
 #include <exception>
 #include <string>
 
 #include "pipeline/commons.h"
 #include "pipeline/context.h"
+#include "pipeline/pipeline_state.h"
 
 RocalStatus ROCAL_API_CALL
 rocalRelease(RocalContext p_context) {
@@ -93,6 +95,184 @@ rocalRun(RocalContext p_context) {
     return ROCAL_OK;
 }
 
+size_t ROCAL_API_CALL
+rocalGetStateSize(RocalContext p_context) {
+    ROCAL_INVALID_CONTEXT_ERR(p_context, 0);
+    auto context = static_cast<Context*>(p_context);
+    try {
+        return serialize_pipeline_state(context->master_graph->get_state()).size();
+    } catch (const std::exception& e) {
+        context->capture_error(e.what());
+        ERR(e.what())
+    }
+    return 0;
+}
+
+RocalStatus ROCAL_API_CALL
+rocalGetState(RocalContext p_context, void* state) {
+    ROCAL_INVALID_CONTEXT_ERR(p_context, ROCAL_CONTEXT_INVALID);
+    auto context = static_cast<Context*>(p_context);
+    try {
+        if (!state)
+            THROW("Null buffer passed to rocalGetState")
+        auto data = serialize_pipeline_state(context->master_graph->get_state());
+        memcpy(state, data.data(), data.size());
+    } catch (const std::exception& e) {
+        context->capture_error(e.what());
+        ERR(e.what())
+        return ROCAL_RUNTIME_ERROR;
+    }
+    return ROCAL_OK;
+}
+
+RocalStatus ROCAL_API_CALL
+rocalSetState(RocalContext p_context, const void* state, size_t size) {
+    ROCAL_INVALID_CONTEXT_ERR(p_context, ROCAL_CONTEXT_INVALID);
+    auto context = static_cast<Context*>(p_context);
+    try {
+        context->master_graph->set_state(deserialize_pipeline_state(static_cast<const uint8_t*>(state), size));
+    } catch (const std::exception& e) {
+        context->capture_error(e.what());
+        ERR(e.what())
+        return ROCAL_RUNTIME_ERROR;
+    }
+    return ROCAL_OK;
+}
+
+RocalStatus ROCAL_API_CALL
+rocalSetSharedDataService(RocalContext p_context, const char* service_name, unsigned num_pipelines) {
+    ROCAL_INVALID_CONTEXT_ERR(p_context, ROCAL_CONTEXT_INVALID);
+    auto context = static_cast<Context*>(p_context);
+    try {
+        context->master_graph->set_shared_data_service(service_name ? service_name : "", num_pipelines);
+    } catch (const std::exception& e) {
+        context->capture_error(e.what());
+        ERR(e.what())
+        return ROCAL_RUNTIME_ERROR;
+    }
+    return ROCAL_OK;
+}
+
+RocalStatus ROCAL_API_CALL
+rocalSetQuarantineFile(RocalContext p_context, const char* file_path) {
+    ROCAL_INVALID_CONTEXT_ERR(p_context, ROCAL_CONTEXT_INVALID);
+    auto context = static_cast<Context*>(p_context);
+    try {
+        if (!file_path)
+            THROW("Invalid quarantine file path")
+        context->master_graph->set_sample_quarantine_file(file_path);
+    } catch (const std::exception& e) {
+        context->capture_error(e.what());
+        ERR(e.what())
+        return ROCAL_RUNTIME_ERROR;
+    }
+    return ROCAL_OK;
+}
+
+RocalStatus ROCAL_API_CALL
+rocalSetContinuousEpochs(RocalContext p_context, bool enable) {
+    ROCAL_INVALID_CONTEXT_ERR(p_context, ROCAL_CONTEXT_INVALID);
+    auto context = static_cast<Context*>(p_context);
+    try {
+        context->master_graph->set_continuous_epochs(enable);
+    } catch (const std::exception& e) {
+        context->capture_error(e.what());
+        ERR(e.what())
+        return ROCAL_RUNTIME_ERROR;
+    }
+    return ROCAL_OK;
+}
+
+RocalStatus ROCAL_API_CALL
+rocalSetFileScanOptions(RocalContext p_context, const char *manifest_dir, bool trust_file_list) {
+    ROCAL_INVALID_CONTEXT_ERR(p_context, ROCAL_CONTEXT_INVALID);
+    auto context = static_cast<Context*>(p_context);
+    try {
+        FileScanOptions options;
+        options.manifest_dir = manifest_dir ? manifest_dir : "";
+        options.trust_file_list = trust_file_list;
+        context->master_graph->set_file_scan_options(options);
+    } catch (const std::exception& e) {
+        context->capture_error(e.what());
+        ERR(e.what())
+        return ROCAL_RUNTIME_ERROR;
+    }
+    return ROCAL_OK;
+}
+
+RocalStatus ROCAL_API_CALL
+rocalSetHostMemoryOptions(RocalContext p_context, RocalHugePageMode huge_pages, bool prefault, int numa_node) {
+    ROCAL_INVALID_CONTEXT_ERR(p_context, ROCAL_CONTEXT_INVALID);
+    auto context = static_cast<Context*>(p_context);
+    try {
+        HostArenaOptions options;
+        switch (huge_pages) {
+            case ROCAL_HUGE_PAGES_NONE:
+                options.huge_pages = HugePageMode::NONE;
+                break;
+            case ROCAL_HUGE_PAGES_TRANSPARENT:
+                options.huge_pages = HugePageMode::TRANSPARENT;
+                break;
+            case ROCAL_HUGE_PAGES_EXPLICIT:
+                options.huge_pages = HugePageMode::EXPLICIT;
+                break;
+            default:
+                THROW("Unsupported huge page mode " + TOSTR(huge_pages))
+        }
+        options.prefault = prefault;
+        options.numa_node = numa_node;
+        context->master_graph->set_host_memory_options(options);
+    } catch (const std::exception& e) {
+        context->capture_error(e.what());
+        ERR(e.what())
+        return ROCAL_RUNTIME_ERROR;
+    }
+    return ROCAL_OK;
+}
+
+RocalStatus ROCAL_API_CALL
+rocalSetRecordCheckPolicy(RocalContext p_context, RocalRecordCheckPolicy policy) {
+    ROCAL_INVALID_CONTEXT_ERR(p_context, ROCAL_CONTEXT_INVALID);
+    auto context = static_cast<Context*>(p_context);
+    try {
+        switch (policy) {
+            case ROCAL_RECORD_CHECK_OFF:
+                context->master_graph->set_record_check_policy(RecordCheckPolicy::OFF);
+                break;
+            case ROCAL_RECORD_CHECK_SKIP:
+                context->master_graph->set_record_check_policy(RecordCheckPolicy::SKIP);
+                break;
+            case ROCAL_RECORD_CHECK_SUBSTITUTE:
+                context->master_graph->set_record_check_policy(RecordCheckPolicy::SUBSTITUTE);
+                break;
+            case ROCAL_RECORD_CHECK_FAIL:
+                context->master_graph->set_record_check_policy(RecordCheckPolicy::FAIL);
+                break;
+            default:
+                THROW("Unsupported record check policy " + TOSTR(policy))
+        }
+    } catch (const std::exception& e) {
+        context->capture_error(e.what());
+        ERR(e.what())
+        return ROCAL_RUNTIME_ERROR;
+    }
+    return ROCAL_OK;
+}
+
+RocalStatus ROCAL_API_CALL
+rocalSetGraphOptimization(RocalContext p_context, bool enable) {
+    ROCAL_INVALID_CONTEXT_ERR(p_context, ROCAL_CONTEXT_INVALID);
+    auto context = static_cast<Context*>(p_context);
+    try {
+        context->master_graph->set_graph_optimization(enable);
+    } catch (const std::exception& e) {
+        context->capture_error(e.what());
+        ERR(e.what())
+        return ROCAL_RUNTIME_ERROR;
+    }
+    return ROCAL_OK;
+}
+
 RocalStatus ROCAL_API_CALL
 rocalVerify(RocalContext p_context) {
     auto context = static_cast<Context*>(p_context);
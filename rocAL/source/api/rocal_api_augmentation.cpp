@@ -55,6 +55,46 @@ rocalSequenceRearrange(RocalContext p_context,
     return output;
 }
 
+RocalTensor ROCAL_API_CALL
+rocalMultiView(RocalContext p_context,
+               RocalTensor p_input,
+               unsigned num_views,
+               bool is_output) {
+    Tensor* output = nullptr;
+    ROCAL_INVALID_CONTEXT_ERR(p_context, output);
+    ROCAL_INVALID_INPUT_ERR(p_input, output);
+    auto input = static_cast<Tensor*>(p_input);
+    auto context = static_cast<Context*>(p_context);
+    try {
+        if (num_views == 0)
+            THROW("The number of views passed should be greater than 0")
+        RocalTensorlayout view_layout;
+        if (input->info().layout() == RocalTensorlayout::NHWC)
+            view_layout = RocalTensorlayout::NFHWC;
+        else if (input->info().layout() == RocalTensorlayout::NCHW)
+            view_layout = RocalTensorlayout::NFCHW;
+        else
+            THROW("Multi view is supported only for NHWC and NCHW inputs")
+
+        // The loader output is seen as sequences of a single frame, which are then repeated num_views times
+        std::vector<size_t> view_dims = input->info().dims();
+        view_dims.insert(view_dims.begin() + 1, 1);
+        TensorInfo alias_info = TensorInfo(view_dims, input->info().mem_type(), input->info().data_type(), view_layout, input->info().color_format());
+        auto alias = context->master_graph->create_loader_output_alias(input, alias_info);
+
+        view_dims[1] = num_views;
+        TensorInfo output_info = TensorInfo(view_dims, input->info().mem_type(), input->info().data_type(), view_layout, input->info().color_format());
+        output_info.set_sequence_batch_size(num_views);
+        output = context->master_graph->create_tensor(output_info, is_output);
+        std::vector<unsigned int> view_order(num_views, 0);
+        context->master_graph->add_node<SequenceRearrangeNode>({alias}, {output})->init(view_order);
+        context->master_graph->set_multi_view(num_views);
+    } catch (const std::exception& e) {
+        ROCAL_PRINT_EXCEPTION(context, e);
+    }
+    return output;
+}
+
 RocalTensor ROCAL_API_CALL
 rocalRotate(
     RocalContext p_context,
@@ -95,11 +95,13 @@ evaluate_image_data_set(RocalImageSizeEvaluationPolicy decode_size_policy, Stora
 };
 
 std::tuple<std::vector<size_t>, RocalTensorDataType>
-evaluate_numpy_data_set(StorageType storage_type, const std::string& source_path, const std::vector<std::string>& files) {
+evaluate_numpy_data_set(StorageType storage_type, const std::string& source_path, const std::vector<std::string>& files,
+                        const std::vector<int>& roi_start, const std::vector<int>& roi_shape) {
     NumpySourceEvaluator source_evaluator;
     auto reader_cfg = ReaderConfig(storage_type, source_path);
     if (!files.empty())
         reader_cfg.set_files_list(files);
+    reader_cfg.set_numpy_roi(roi_start, roi_shape);
     source_evaluator.create(reader_cfg);
     auto max_dims = source_evaluator.max_numpy_dims();
     auto data_type = source_evaluator.get_numpy_dtype();
@@ -1620,11 +1622,13 @@ rocalNumpyFileSource(
     bool shuffle,
     bool loop,
     unsigned seed,
-    RocalShardingInfo rocal_sharding_info) {
+    RocalShardingInfo rocal_sharding_info,
+    std::vector<int> roi_start,
+    std::vector<int> roi_shape) {
     Tensor* output = nullptr;
     auto context = static_cast<Context*>(p_context);
     try {
-        auto [max_dimensions, tensor_data_type] = evaluate_numpy_data_set(StorageType::NUMPY_DATA, source_path, files);
+        auto [max_dimensions, tensor_data_type] = evaluate_numpy_data_set(StorageType::NUMPY_DATA, source_path, files, roi_start, roi_shape);
 
         RocalTensorlayout op_tensor_layout = static_cast<RocalTensorlayout>(output_layout);
         std::vector<size_t> dims(max_dimensions.size() + 1);
@@ -1637,7 +1641,8 @@ rocalNumpyFileSource(
         output = context->master_graph->create_loader_output_tensor(info);
 
         ShardingInfo sharding_info(convert_last_batch_policy(rocal_sharding_info.last_batch_policy), rocal_sharding_info.pad_last_batch_repeated, rocal_sharding_info.stick_to_shard, rocal_sharding_info.shard_size);
-        context->master_graph->add_node<NumpyLoaderNode>({}, {output})->init(shard_count, source_path, files, StorageType::NUMPY_DATA, DecoderType::SKIP_DECODE, shuffle, loop, context->user_batch_size(), context->master_graph->mem_type(), seed, sharding_info);
+        auto cpu_num_threads = context->master_graph->calculate_cpu_num_threads(1);
+        context->master_graph->add_node<NumpyLoaderNode>({}, {output})->init(shard_count, cpu_num_threads, source_path, files, StorageType::NUMPY_DATA, DecoderType::SKIP_DECODE, shuffle, loop, context->user_batch_size(), context->master_graph->mem_type(), seed, sharding_info, roi_start, roi_shape);
         context->master_graph->set_loop(loop);
 
         if (is_output) {
@@ -1663,7 +1668,9 @@ rocalNumpyFileSourceSingleShard(
     unsigned shard_id,
     unsigned shard_count,
     unsigned seed,
-    RocalShardingInfo rocal_sharding_info) {
+    RocalShardingInfo rocal_sharding_info,
+    std::vector<int> roi_start,
+    std::vector<int> roi_shape) {
     Tensor* output = nullptr;
     auto context = static_cast<Context*>(p_context);
     try {
@@ -1673,7 +1680,7 @@ rocalNumpyFileSourceSingleShard(
         if (shard_id >= shard_count)
             THROW("Shard id should be smaller than shard count")
 
-        auto [max_dimensions, tensor_data_type] = evaluate_numpy_data_set(StorageType::NUMPY_DATA, source_path, files);
+        auto [max_dimensions, tensor_data_type] = evaluate_numpy_data_set(StorageType::NUMPY_DATA, source_path, files, roi_start, roi_shape);
 
         RocalTensorlayout op_tensor_layout = static_cast<RocalTensorlayout>(output_layout);
         std::vector<size_t> dims(max_dimensions.size() + 1);
@@ -1686,7 +1693,8 @@ rocalNumpyFileSourceSingleShard(
         output = context->master_graph->create_loader_output_tensor(info);
 
         ShardingInfo sharding_info(convert_last_batch_policy(rocal_sharding_info.last_batch_policy), rocal_sharding_info.pad_last_batch_repeated, rocal_sharding_info.stick_to_shard, rocal_sharding_info.shard_size);
-        context->master_graph->add_node<NumpyLoaderSingleShardNode>({}, {output})->init(shard_id, shard_count, source_path, files, StorageType::NUMPY_DATA, DecoderType::SKIP_DECODE, shuffle, loop, context->user_batch_size(), context->master_graph->mem_type(), seed, sharding_info);
+        auto cpu_num_threads = context->master_graph->calculate_cpu_num_threads(shard_count);
+        context->master_graph->add_node<NumpyLoaderSingleShardNode>({}, {output})->init(shard_id, shard_count, cpu_num_threads, source_path, files, StorageType::NUMPY_DATA, DecoderType::SKIP_DECODE, shuffle, loop, context->user_batch_size(), context->master_graph->mem_type(), seed, sharding_info, roi_start, roi_shape);
         context->master_graph->set_loop(loop);
 
         if (is_output) {
@@ -2068,7 +2076,8 @@ rocalRawCIFAR10Source(
     unsigned out_width,
     unsigned out_height,
     const char* filename_prefix,
-    bool loop) {
+    bool loop,
+    bool memory_resident) {
     Tensor* output = nullptr;
     auto context = static_cast<Context*>(p_context);
     try {
@@ -2089,7 +2098,7 @@ rocalRawCIFAR10Source(
                                color_format);
         output = context->master_graph->create_loader_output_tensor(info);
 
-        context->master_graph->add_node<Cifar10LoaderNode>({}, {output})->init(source_path, "", StorageType::UNCOMPRESSED_BINARY_DATA, loop, context->user_batch_size(), context->master_graph->mem_type(), filename_prefix);
+        context->master_graph->add_node<Cifar10LoaderNode>({}, {output})->init(source_path, "", StorageType::UNCOMPRESSED_BINARY_DATA, loop, context->user_batch_size(), context->master_graph->mem_type(), filename_prefix, memory_resident);
         context->master_graph->set_loop(loop);
 
         if (is_output) {
@@ -2116,7 +2125,8 @@ rocalRawCIFAR10SourceSingleShard(
     unsigned out_width,
     unsigned out_height,
     const char* filename_prefix,
-    RocalShardingInfo rocal_sharding_info) {
+    RocalShardingInfo rocal_sharding_info,
+    bool memory_resident) {
     Tensor* output = nullptr;
     auto context = static_cast<Context*>(p_context);
     try {
@@ -2140,7 +2150,7 @@ rocalRawCIFAR10SourceSingleShard(
                                color_format);
         output = context->master_graph->create_loader_output_tensor(info);
 
-        context->master_graph->add_node<CIFAR10LoaderSingleShardNode>({}, {output})->init(shard_id, shard_count, source_path, StorageType::UNCOMPRESSED_BINARY_DATA, shuffle, loop, context->user_batch_size(), context->master_graph->mem_type(), filename_prefix, sharding_info);
+        context->master_graph->add_node<CIFAR10LoaderSingleShardNode>({}, {output})->init(shard_id, shard_count, source_path, StorageType::UNCOMPRESSED_BINARY_DATA, shuffle, loop, context->user_batch_size(), context->master_graph->mem_type(), filename_prefix, sharding_info, memory_resident);
         context->master_graph->set_loop(loop);
 
         if (is_output) {
@@ -119,3 +119,28 @@ rocalGetOutputTensors(RocalContext p_context) {
     }
     return nullptr;
 }
+
+RocalTensorList ROCAL_API_CALL
+rocalAcquireOutput(RocalContext p_context) {
+    auto context = static_cast<Context*>(p_context);
+    try {
+        return context->master_graph->acquire_output();
+    } catch (const std::exception& e) {
+        context->capture_error(e.what());
+        ERR(e.what())
+    }
+    return nullptr;
+}
+
+RocalStatus ROCAL_API_CALL
+rocalReleaseOutput(RocalContext p_context, RocalTensorList output) {
+    auto context = static_cast<Context*>(p_context);
+    try {
+        context->master_graph->release_output(static_cast<TensorList*>(output));
+    } catch (const std::exception& e) {
+        context->capture_error(e.what());
+        ERR(e.what())
+        return ROCAL_RUNTIME_ERROR;
+    }
+    return ROCAL_OK;
+}
@@ -20,6 +20,7 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 THE SOFTWARE.
 */
 
+#include <cstring>
 #include "pipeline/commons.h"
 #include "pipeline/context.h"
 #include "rocal_api.h"
@@ -161,3 +162,97 @@ rocalGetLastBatchPaddedSize(RocalContext p_context) {
     }
     return count;
 }
+
+size_t ROCAL_API_CALL
+rocalGetPeakMemorySize(RocalContext p_context) {
+    ROCAL_INVALID_CONTEXT_EXCEPTION(p_context);
+    auto context = static_cast<Context *>(p_context);
+    return context->master_graph->peak_memory_size();
+}
+
+RocalHostMemoryStats ROCAL_API_CALL
+rocalGetHostMemoryStats(RocalContext p_context) {
+    ROCAL_INVALID_CONTEXT_EXCEPTION(p_context);
+    auto context = static_cast<Context *>(p_context);
+    auto stats = context->master_graph->host_memory_stats();
+    return {stats.mapped_bytes, stats.huge_page_bytes, stats.pinned_bytes, stats.in_use_bytes, stats.peak_in_use_bytes,
+            stats.allocation_count, stats.reuse_count};
+}
+
+RocalFrameCacheStats ROCAL_API_CALL
+rocalGetFrameCacheStats(RocalContext p_context) {
+    ROCAL_INVALID_CONTEXT_EXCEPTION(p_context);
+    auto context = static_cast<Context *>(p_context);
+    auto info = context->timing();
+    return {info.frame_cache_hits, info.frame_cache_misses};
+}
+
+size_t ROCAL_API_CALL
+rocalGetBatchEpoch(RocalContext p_context) {
+    ROCAL_INVALID_CONTEXT_EXCEPTION(p_context);
+    auto context = static_cast<Context *>(p_context);
+    return context->master_graph->batch_epoch_info().epoch;
+}
+
+bool ROCAL_API_CALL
+rocalIsLastBatchOfEpoch(RocalContext p_context) {
+    ROCAL_INVALID_CONTEXT_EXCEPTION(p_context);
+    auto context = static_cast<Context *>(p_context);
+    return context->master_graph->batch_epoch_info().last_batch;
+}
+
+size_t ROCAL_API_CALL
+rocalGetQuarantinedSampleCount(RocalContext p_context) {
+    ROCAL_INVALID_CONTEXT_EXCEPTION(p_context);
+    auto context = static_cast<Context *>(p_context);
+    return context->master_graph->sample_quarantine()->count();
+}
+
+size_t ROCAL_API_CALL
+rocalGetQuarantinedSampleNamesLen(RocalContext p_context, int *buf, size_t count) {
+    ROCAL_INVALID_CONTEXT_EXCEPTION(p_context);
+    auto context = static_cast<Context *>(p_context);
+    auto names = context->master_graph->sample_quarantine()->keys();
+    if (count > names.size())
+        THROW("Requested " + TOSTR(count) + " quarantined samples, only " + TOSTR(names.size()) + " are quarantined")
+    size_t size = 0;
+    for (size_t i = 0; i < count; i++) {
+        buf[i] = names[i].size();
+        size += buf[i];
+    }
+    return size;
+}
+
+void ROCAL_API_CALL
+rocalGetQuarantinedSampleNames(RocalContext p_context, char *buf, size_t count) {
+    ROCAL_INVALID_CONTEXT_EXCEPTION(p_context);
+    auto context = static_cast<Context *>(p_context);
+    auto names = context->master_graph->sample_quarantine()->keys();
+    if (count > names.size())
+        THROW("Requested " + TOSTR(count) + " quarantined samples, only " + TOSTR(names.size()) + " are quarantined")
+    for (size_t i = 0; i < count; i++) {
+        memcpy(buf, names[i].c_str(), names[i].size());
+        buf += names[i].size();
+    }
+}
+
+size_t ROCAL_API_CALL
+rocalGetRecordCheckShardCount(RocalContext p_context) {
+    ROCAL_INVALID_CONTEXT_EXCEPTION(p_context);
+    auto context = static_cast<Context *>(p_context);
+    auto record_check = context->master_graph->record_check();
+    return record_check ? record_check->counters().size() : 0;
+}
+
+void ROCAL_API_CALL
+rocalGetRecordCheckStats(RocalContext p_context, RocalRecordCheckStats *stats, size_t count) {
+    ROCAL_INVALID_CONTEXT_EXCEPTION(p_context);
+    auto context = static_cast<Context *>(p_context);
+    auto record_check = context->master_graph->record_check();
+    auto counters = record_check ? record_check->counters() : std::map<size_t, RecordCheck::Counters>();
+    if (count > counters.size())
+        THROW("Requested the record check counters of " + TOSTR(count) + " shards, records were checked for " + TOSTR(counters.size()))
+    auto shard = counters.begin();
+    for (size_t i = 0; i < count; i++, shard++)
+        stats[i] = {shard->first, shard->second.checked, shard->second.corrupted};
+}
@@ -229,7 +229,7 @@ void
     rocalGetOneHotImageLabels(RocalContext p_context, void* buf, int num_of_classes, RocalOutputMemType output_mem_type) {
     ROCAL_INVALID_CONTEXT_EXCEPTION(p_context);
     auto context = static_cast<Context*>(p_context);
-    auto meta_data = context->master_graph->meta_data();
+    auto& meta_data = context->master_graph->meta_data();
     if (!meta_data.second) {
         WRN("No label has been loaded for this output image")
         return;
@@ -238,29 +238,37 @@ void
     if (context->user_batch_size() != meta_data_batch_size)
         THROW("meta data batch size is wrong " + TOSTR(meta_data_batch_size) + " != " + TOSTR(context->user_batch_size()))
 
-    std::vector<int> one_hot_encoded(meta_data_batch_size * num_of_classes, 0);
-    auto labels = meta_data.second->get_labels_batch();
-    for (uint i = 0; i < meta_data_batch_size; i++) {
-        int label_index = labels[i][0];
-        if (label_index > 0 && label_index <= num_of_classes) {
-            one_hot_encoded[(i * num_of_classes) + label_index - 1] = 1;
-        } else if (!label_index) {
-            one_hot_encoded[(i * num_of_classes) + num_of_classes - 1] = 1;
-        }
+    context->master_graph->copy_one_hot_labels(buf, num_of_classes, ROCAL_LABEL_INT32, 0.0f, output_mem_type);
+}
+
+RocalStatus
+    ROCAL_API_CALL
+    rocalCopyImageLabels(RocalContext p_context, void* buf, RocalLabelType label_type, RocalOutputMemType output_mem_type) {
+    ROCAL_INVALID_CONTEXT_EXCEPTION(p_context);
+    auto context = static_cast<Context*>(p_context);
+    try {
+        context->master_graph->copy_labels(buf, label_type, output_mem_type);
+    } catch (const std::exception& e) {
+        context->capture_error(e.what());
+        ERR(e.what())
+        return ROCAL_RUNTIME_ERROR;
     }
-    if (output_mem_type == RocalOutputMemType::ROCAL_MEMCPY_HOST)
-        memcpy(buf, one_hot_encoded.data(), sizeof(int) * meta_data_batch_size * num_of_classes);
-    else {
-#if ENABLE_HIP
-        hipError_t err = hipMemcpy(buf, one_hot_encoded.data(), sizeof(int) * meta_data_batch_size * num_of_classes, hipMemcpyHostToDevice);
-        if (err != hipSuccess)
-            THROW("Invalid Data Pointer: Error copying to device memory")
-#elif ENABLE_OPENCL
-        if (clEnqueueWriteBuffer(context->master_graph->get_ocl_cmd_q(), (cl_mem)buf, CL_TRUE, 0, sizeof(int) * meta_data_batch_size * num_of_classes, one_hot_encoded, 0, NULL, NULL) != CL_SUCCESS)
-            THROW("Invalid Data Pointer: Error copying to device memory")
+    return ROCAL_OK;
+}
 
-#endif
+RocalStatus
+    ROCAL_API_CALL
+    rocalCopyOneHotImageLabels(RocalContext p_context, void* buf, unsigned num_of_classes, RocalLabelType label_type, float label_smoothing, RocalOutputMemType output_mem_type) {
+    ROCAL_INVALID_CONTEXT_EXCEPTION(p_context);
+    auto context = static_cast<Context*>(p_context);
+    try {
+        context->master_graph->copy_one_hot_labels(buf, num_of_classes, label_type, label_smoothing, output_mem_type);
+    } catch (const std::exception& e) {
+        context->capture_error(e.what());
+        ERR(e.what())
+        return ROCAL_RUNTIME_ERROR;
     }
+    return ROCAL_OK;
 }
 
 RocalTensorList
@@ -501,3 +509,57 @@ RocalTensorList
     auto context = static_cast<Context*>(p_context);
     return context->master_graph->matched_index_meta_data();
 }
+
+RocalStatus
+    ROCAL_API_CALL
+    rocalPolygonMaskRasterizer(RocalContext p_context, unsigned mask_width, unsigned mask_height, RocalMaskType mask_type, unsigned max_instances) {
+    ROCAL_INVALID_CONTEXT_EXCEPTION(p_context);
+    auto context = static_cast<Context*>(p_context);
+    try {
+        context->master_graph->polygon_mask_rasterizer(mask_width, mask_height, static_cast<MaskType>(mask_type), max_instances);
+    } catch (const std::exception& e) {
+        context->capture_error(e.what());
+        ERR(e.what())
+        return ROCAL_RUNTIME_ERROR;
+    }
+    return ROCAL_OK;
+}
+
+RocalTensorList
+    ROCAL_API_CALL
+    rocalGetRasterizedMasks(RocalContext p_context) {
+    ROCAL_INVALID_CONTEXT_EXCEPTION(p_context);
+    auto context = static_cast<Context*>(p_context);
+    return context->master_graph->rasterized_mask_meta_data();
+}
+
+RocalStatus
+    ROCAL_API_CALL
+    rocalKeypointHeatmaps(RocalContext p_context, unsigned heatmap_width, unsigned heatmap_height, float sigma) {
+    ROCAL_INVALID_CONTEXT_EXCEPTION(p_context);
+    auto context = static_cast<Context*>(p_context);
+    try {
+        context->master_graph->keypoint_heatmaps(heatmap_width, heatmap_height, sigma);
+    } catch (const std::exception& e) {
+        context->capture_error(e.what());
+        ERR(e.what())
+        return ROCAL_RUNTIME_ERROR;
+    }
+    return ROCAL_OK;
+}
+
+RocalTensorList
+    ROCAL_API_CALL
+    rocalGetKeypointHeatmaps(RocalContext p_context) {
+    ROCAL_INVALID_CONTEXT_EXCEPTION(p_context);
+    auto context = static_cast<Context*>(p_context);
+    return context->master_graph->keypoint_heatmap_meta_data();
+}
+
+RocalTensorList
+    ROCAL_API_CALL
+    rocalGetKeypointTargetWeights(RocalContext p_context) {
+    ROCAL_INVALID_CONTEXT_EXCEPTION(p_context);
+    auto context = static_cast<Context*>(p_context);
+    return context->master_graph->keypoint_target_weight_meta_data();
+}
@@ -111,6 +111,10 @@ void CropMirrorNormalizeNode::update_node() {
 }
 
 void CropMirrorNormalizeNode::init(int crop_h, int crop_w, float anchor_x, float anchor_y, std::vector<float> &mean, std::vector<float> &std_dev, IntParam *mirror) {
+    init(crop_h, crop_w, anchor_x, anchor_y, mean, std_dev, core(mirror));
+}
+
+void CropMirrorNormalizeNode::init(int crop_h, int crop_w, float anchor_x, float anchor_y, std::vector<float> &mean, std::vector<float> &std_dev, Parameter<int> *mirror) {
     // current implementation does a fixed crop with specified dims and anchor
     _crop_param->x1 = 0;
     _crop_param->y1 = 0;
@@ -119,5 +123,5 @@ void CropMirrorNormalizeNode::init(int crop_h, int crop_w, float anchor_x, float
     _crop_param->set_fixed_crop(anchor_x, anchor_y);
     _mean = mean;
     _std_dev = std_dev;
-    _mirror.set_param(core(mirror));
+    _mirror.set_param(mirror);
 }
\ No newline at end of file
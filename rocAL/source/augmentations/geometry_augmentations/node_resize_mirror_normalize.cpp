@@ -119,6 +119,11 @@ void ResizeMirrorNormalizeNode::update_node() {
 }
 void ResizeMirrorNormalizeNode::init(unsigned dest_width, unsigned dest_height, RocalResizeScalingMode scaling_mode, std::vector<unsigned> max_size,
                                      RocalResizeInterpolationType interpolation_type, std::vector<float> &mean, std::vector<float> &std_dev, IntParam *mirror) {
+    init(dest_width, dest_height, scaling_mode, max_size, interpolation_type, mean, std_dev, core(mirror));
+}
+
+void ResizeMirrorNormalizeNode::init(unsigned dest_width, unsigned dest_height, RocalResizeScalingMode scaling_mode, std::vector<unsigned> max_size,
+                                     RocalResizeInterpolationType interpolation_type, std::vector<float> &mean, std::vector<float> &std_dev, Parameter<int> *mirror) {
     _interpolation_type = static_cast<int>(interpolation_type);
     _scaling_mode = scaling_mode;
     _out_width = dest_width;
@@ -129,7 +134,7 @@ void ResizeMirrorNormalizeNode::init(unsigned dest_width, unsigned dest_height,
     }
     _mean = mean;
     _std_dev = std_dev;
-    _mirror.set_param(core(mirror));
+    _mirror.set_param(mirror);
 }
 
 void ResizeMirrorNormalizeNode::adjust_out_roi_size() {
@@ -40,6 +40,7 @@ void SSDRandomCropNode::create_node() {
     _x1_val.resize(_batch_size);
     _y1_val.resize(_batch_size);
     _iou_range.resize(_batch_size);
+    _crop_boxes.resize(_batch_size);
     if (_node)
         return;
 
@@ -61,133 +62,40 @@ void SSDRandomCropNode::create_node() {
         THROW("Error adding the crop resize node (vxExtrppNode_ResizeCropbatchPD) failed: " + TOSTR(status))
 }
 
-inline double ssd_BBoxIntersectionOverUnion(const BoundingBoxCord &box1, const BoundingBoxCord &box2, bool is_iou = false) {
-    double iou;
-    float xA = std::max(box1.l, box2.l);
-    float yA = std::max(box1.t, box2.t);
-    float xB = std::min(box1.r, box2.r);
-    float yB = std::min(box1.b, box2.b);
-    float intersection_area = std::max((float)0.0, xB - xA) * std::max((float)0.0, yB - yA);
-    float box1_h, box1_w, box2_h, box2_w;
-    box1_w = box1.r - box1.l;
-    box2_w = box2.r - box2.l;
-    box1_h = box1.b - box1.t;
-    box2_h = box2.b - box2.t;
-    float box1_area = box1_h * box1_w;
-    float box2_area = box2_h * box2_w;
-    if (is_iou)
-        iou = intersection_area / float(box1_area + box2_area - intersection_area);
-    else
-        iou = intersection_area / float(box1_area);
-
-    return iou;
-}
-
 void SSDRandomCropNode::update_node() {
     _crop_param->set_image_dimensions(_inputs[0]->info().roi().get_2D_roi());
-    _crop_param->update_array();
     Roi2DCords *crop_dims = static_cast<Roi2DCords *>(_crop_coordinates);  // ROI to be cropped from source
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> dis(0, 6);
-    const std::vector<std::pair<float, float>> IOU = {std::make_pair(0.0f, 1.0f), std::make_pair(0.1f, 1.0f), std::make_pair(0.3f, 1.0f),
-                                                      std::make_pair(0.5f, 1.0f), std::make_pair(0.45f, 1.0f), std::make_pair(0.35f, 1.0f), std::make_pair(0.0f, 1.0f)};
-    int sample_option;
-    std::pair<float, float> iou;
-    float min_iou, max_iou;
-    float w_factor = 0.0f, h_factor = 0.0f;
-    auto input_roi = _crop_param->in_roi;
-    bool invalid_bboxes = true;
-    _entire_iou = true;
-    BoundingBoxCord crop_box;
-    _x1_val = _crop_param->get_x1_arr_val();
-    _y1_val = _crop_param->get_y1_arr_val();
-    _crop_width_val = _crop_param->get_cropw_arr_val();
-    _crop_height_val = _crop_param->get_croph_arr_val();
-    std::uniform_real_distribution<float> _float_dis(0.3, 1.0);
-    size_t sample = 0;
+    const auto input_roi = _crop_param->in_roi;
+    const bool is_ltrb = _inputs[0]->info().roi_type() == RocalROIType::LTRB;
+    const uint64_t iteration = _iteration++;
+    // Boxes of the batch are in pixels of the decoded images, without meta data every sample is cropped as an image without boxes
+    const BoundingBoxCords no_boxes;
+    const bool has_boxes = _meta_data_info && _meta_data_info->get_bb_cords_batch().size() >= _batch_size;
+    const bool has_sizes = has_boxes && _meta_data_info->get_img_sizes_batch().size() >= _batch_size;
+
+    // Every sample draws from its own counter stream, so the crops do not depend on the thread that picks them
+#pragma omp parallel for
     for (uint i = 0; i < _batch_size; i++) {
-        int bb_count = _meta_data_info->get_labels_batch()[i].size();
-        std::vector<int> labels_buf = _meta_data_info->get_labels_batch()[i];
-        BoundingBoxCords coords_buf = _meta_data_info->get_bb_cords_batch()[i];
-
-        crop_box.b = _y1_val[i] + _crop_height_val[i];
-        crop_box.r = _x1_val[i] + _crop_width_val[i];
-        crop_box.l = _x1_val[i];
-        crop_box.t = _y1_val[i];
-        while (true) {
-            sample_option = dis(gen);
-            iou = IOU[sample_option];
-            _iou_range[i] = iou;
-            min_iou = iou.first;
-            max_iou = iou.second;
-            // sample_option = 0;
-            if (!sample_option) {
-                crop_box.l = 0;
-                crop_box.t = 0;
-                crop_box.r = 1;
-                crop_box.b = 1;
-                break;
-            }
-            float aspect_ratio = 0.0f;
-            for (int j = 0; j < _num_of_attempts; j++) {
-                // Setting width and height factor btw 0.3 and 1.0";
-                float w_factor = _float_dis(_rngs[sample]);
-                float h_factor = _float_dis(_rngs[sample]);
-                // aspect ratio check
-                aspect_ratio = w_factor / h_factor;
-                if ((aspect_ratio < 0.5) || (aspect_ratio > 2.))
-                    continue;
-            }
-            if ((aspect_ratio < 0.5) || (aspect_ratio > 2.))
-                continue;
-
-            // Setting width factor btw 0 and 1 - width_factor and height factor btw 0 and 1 - height_factor
-            std::uniform_real_distribution<float> l_dis(0.0, 1.0 - w_factor), t_dis(0.0, 1.0 - h_factor);
-            float x_factor = l_dis(_rngs[sample]);
-            float y_factor = t_dis(_rngs[sample]);
-            // Got the crop
-            crop_box.l = x_factor;
-            crop_box.t = y_factor;
-            crop_box.r = crop_box.l + w_factor;
-            crop_box.b = crop_box.t + h_factor;
-
-            invalid_bboxes = false;
-
-            for (int j = 0; j < bb_count; j++) {
-                float bb_iou = ssd_BBoxIntersectionOverUnion(coords_buf[j], crop_box, _entire_iou);
-                if (bb_iou < min_iou || bb_iou > max_iou) {
-                    invalid_bboxes = true;
-                    break;
-                }
-            }
-
-            if (invalid_bboxes)
-                continue;
-            int valid_bbox_count = 0;
-            auto left = crop_box.l, top = crop_box.t, right = crop_box.r, bottom = crop_box.b;
-            for (int j = 0; j < bb_count; j++) {
-                auto x_c = 0.5f * (2 * coords_buf[j].l + coords_buf[j].r);
-                auto y_c = 0.5f * (2 * coords_buf[j].t + coords_buf[j].b);
-                if ((x_c >= left) && (x_c <= right) && (y_c >= top) && (y_c <= bottom))
-                    valid_bbox_count++;
-            }
-            if (valid_bbox_count == 0)
-                continue;
-            break;
-        }  // while loop
-
-        if (_inputs[0]->info().roi_type() == RocalROIType::XYWH) {
-            crop_dims[i].xywh.x = (crop_box.l) * input_roi[i].xywh.w;
-            crop_dims[i].xywh.y = (crop_box.t) * input_roi[i].xywh.h;
-            crop_dims[i].xywh.w = (crop_box.r - crop_box.l) * input_roi[i].xywh.w;
-            crop_dims[i].xywh.h = (crop_box.b - crop_box.t) * input_roi[i].xywh.h;
-        } else if (_inputs[0]->info().roi_type() == RocalROIType::LTRB) {
-            crop_dims[i].xywh.x = (crop_box.l) * input_roi[i].ltrb.l;
-            crop_dims[i].xywh.y = (crop_box.t) * input_roi[i].ltrb.t;
-            crop_dims[i].xywh.w = (crop_box.r - crop_box.l) * (input_roi[i].ltrb.r - input_roi[i].ltrb.l + 1);
-            crop_dims[i].xywh.h = (crop_box.b - crop_box.t) * (input_roi[i].ltrb.b - input_roi[i].ltrb.t + 1);
+        const BoundingBoxCords &coords_buf = has_boxes ? _meta_data_info->get_bb_cords_batch()[i] : no_boxes;
+        unsigned image_width = has_sizes ? _meta_data_info->get_img_sizes_batch()[i].w : 0;
+        unsigned image_height = has_sizes ? _meta_data_info->get_img_sizes_batch()[i].h : 0;
+        SSDCrop crop = _sampler->sample(coords_buf, image_width, image_height, iteration, i);
+        _iou_range[i] = crop.iou_range;
+        _crop_boxes[i] = crop.box;
+
+        float x = input_roi[i].xywh.x, y = input_roi[i].xywh.y, w = input_roi[i].xywh.w, h = input_roi[i].xywh.h;
+        if (is_ltrb) {
+            x = input_roi[i].ltrb.l;
+            y = input_roi[i].ltrb.t;
+            w = input_roi[i].ltrb.r - input_roi[i].ltrb.l + 1;
+            h = input_roi[i].ltrb.b - input_roi[i].ltrb.t + 1;
         }
+        crop_dims[i].xywh.x = x + crop.box.l * w;
+        crop_dims[i].xywh.y = y + crop.box.t * h;
+        crop_dims[i].xywh.w = std::max(1.0f, (crop.box.r - crop.box.l) * w);
+        crop_dims[i].xywh.h = std::max(1.0f, (crop.box.b - crop.box.t) * h);
+        _crop_width_val[i] = crop_dims[i].xywh.w;
+        _crop_height_val[i] = crop_dims[i].xywh.h;
     }
     _outputs[0]->update_tensor_roi(_crop_width_val, _crop_height_val);
 }
@@ -198,4 +106,5 @@ void SSDRandomCropNode::init(FloatParam *crop_area_factor, FloatParam *crop_aspe
     _crop_param->set_area_factor(core(crop_area_factor));
     _crop_param->set_aspect_ratio(core(crop_aspect_ratio));
     _num_of_attempts = num_of_attempts;
+    _sampler = std::make_unique<SSDCropSampler>(ParameterFactory::instance()->create_random_stream_key(), _num_of_attempts);
 }
@@ -0,0 +1,133 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "augmentations/ssd_crop_sampler.h"
+
+#include <algorithm>
+#if ENABLE_SIMD
+#if _WIN32
+#include <intrin.h>
+#else
+#include <immintrin.h>
+#endif
+#endif
+
+namespace {
+// Minimum and maximum IoU of the SSD sampling options, the first option keeps the whole image
+const std::pair<float, float> SSD_IOU_OPTIONS[] = {{0.0f, 1.0f}, {0.1f, 1.0f}, {0.3f, 1.0f}, {0.5f, 1.0f}, {0.45f, 1.0f}, {0.35f, 1.0f}, {0.0f, 1.0f}};
+constexpr uint32_t SSD_IOU_OPTION_COUNT = sizeof(SSD_IOU_OPTIONS) / sizeof(SSD_IOU_OPTIONS[0]);
+
+// Draws the values of a sample from consecutive counters of its own stream
+class SampleRandom {
+   public:
+    SampleRandom(Philox4x32::Key key, uint64_t iteration, uint32_t sample_idx) : _key(key), _iteration(iteration), _sample_idx(sample_idx) {}
+    uint32_t next() { return Philox4x32::generate(_key, _iteration, _draw++, _sample_idx); }
+    //! Uniform in [start, end), from the top 24 bits so every value is exact in float
+    float uniform(float start, float end) { return start + (next() >> 8) * (1.0f / 16777216.0f) * (end - start); }
+    uint32_t below(uint32_t bound) { return static_cast<uint32_t>((static_cast<uint64_t>(next()) * bound) >> 32); }
+
+   private:
+    Philox4x32::Key _key;
+    uint64_t _iteration;
+    uint32_t _sample_idx;
+    uint32_t _draw = 0;
+};
+}  // namespace
+
+bool SSDCropSampler::accepts(const float *l, const float *t, const float *r, const float *b, const float *area, size_t count,
+                             const BoundingBoxCord &window, float min_iou, float max_iou) {
+    // IoU = intersection / union is compared as intersection against the bounds times the union, which is positive for a non empty window
+    const float window_area = (window.r - window.l) * (window.b - window.t);
+    bool center_inside = false;
+    size_t j = 0;
+#if (ENABLE_SIMD && __AVX2__)
+    const __m256 pwl = _mm256_set1_ps(window.l), pwt = _mm256_set1_ps(window.t);
+    const __m256 pwr = _mm256_set1_ps(window.r), pwb = _mm256_set1_ps(window.b);
+    const __m256 pwarea = _mm256_set1_ps(window_area), pmin = _mm256_set1_ps(min_iou), pmax = _mm256_set1_ps(max_iou);
+    const __m256 pzero = _mm256_setzero_ps(), phalf = _mm256_set1_ps(0.5f);
+    __m256 pcenter_inside = _mm256_setzero_ps();
+    for (; j + 8 <= count; j += 8) {
+        __m256 pl = _mm256_loadu_ps(l + j), pt = _mm256_loadu_ps(t + j);
+        __m256 pr = _mm256_loadu_ps(r + j), pb = _mm256_loadu_ps(b + j);
+        __m256 pw = _mm256_max_ps(pzero, _mm256_sub_ps(_mm256_min_ps(pr, pwr), _mm256_max_ps(pl, pwl)));
+        __m256 ph = _mm256_max_ps(pzero, _mm256_sub_ps(_mm256_min_ps(pb, pwb), _mm256_max_ps(pt, pwt)));
+        __m256 pintersection = _mm256_mul_ps(pw, ph);
+        __m256 punion = _mm256_sub_ps(_mm256_add_ps(_mm256_loadu_ps(area + j), pwarea), pintersection);
+        __m256 pin_range = _mm256_and_ps(_mm256_cmp_ps(pintersection, _mm256_mul_ps(pmin, punion), _CMP_GE_OQ),
+                                         _mm256_cmp_ps(pintersection, _mm256_mul_ps(pmax, punion), _CMP_LE_OQ));
+        if (_mm256_movemask_ps(pin_range) != 0xFF)
+            return false;
+        __m256 pcx = _mm256_mul_ps(_mm256_add_ps(pl, pr), phalf), pcy = _mm256_mul_ps(_mm256_add_ps(pt, pb), phalf);
+        __m256 pinside = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(pcx, pwl, _CMP_GE_OQ), _mm256_cmp_ps(pcx, pwr, _CMP_LE_OQ)),
+                                       _mm256_and_ps(_mm256_cmp_ps(pcy, pwt, _CMP_GE_OQ), _mm256_cmp_ps(pcy, pwb, _CMP_LE_OQ)));
+        pcenter_inside = _mm256_or_ps(pcenter_inside, pinside);
+    }
+    center_inside = _mm256_movemask_ps(pcenter_inside) != 0;
+#endif
+    for (; j < count; j++) {
+        float w = std::max(0.0f, std::min(r[j], window.r) - std::max(l[j], window.l));
+        float h = std::max(0.0f, std::min(b[j], window.b) - std::max(t[j], window.t));
+        float intersection = w * h;
+        float union_area = area[j] + window_area - intersection;
+        if (intersection < min_iou * union_area || intersection > max_iou * union_area)
+            return false;
+        float cx = 0.5f * (l[j] + r[j]), cy = 0.5f * (t[j] + b[j]);
+        center_inside |= (cx >= window.l && cx <= window.r && cy >= window.t && cy <= window.b);
+    }
+    return center_inside;
+}
+
+SSDCrop SSDCropSampler::sample(const BoundingBoxCords &boxes, unsigned image_width, unsigned image_height, uint64_t iteration, uint32_t sample_idx) const {
+    const size_t count = boxes.size();
+    const float scale_x = image_width ? 1.0f / image_width : 1.0f, scale_y = image_height ? 1.0f / image_height : 1.0f;
+    std::vector<float> l(count), t(count), r(count), b(count), area(count);
+    for (size_t j = 0; j < count; j++) {
+        l[j] = boxes[j].l * scale_x;
+        t[j] = boxes[j].t * scale_y;
+        r[j] = boxes[j].r * scale_x;
+        b[j] = boxes[j].b * scale_y;
+        area[j] = (r[j] - l[j]) * (b[j] - t[j]);
+    }
+
+    SampleRandom random(_key, iteration, sample_idx);
+    for (unsigned trial = 0; trial < MAX_TRIALS; trial++) {
+        uint32_t option = random.below(SSD_IOU_OPTION_COUNT);
+        auto iou_range = SSD_IOU_OPTIONS[option];
+        if (option == 0)
+            return {{0, 0, 1, 1}, iou_range, false};
+        for (unsigned attempt = 0; attempt < _num_attempts; attempt++) {
+            float w = random.uniform(0.3f, 1.0f), h = random.uniform(0.3f, 1.0f);
+            float aspect_ratio = w / h;
+            if (aspect_ratio < 0.5f || aspect_ratio > 2.0f)
+                continue;
+            BoundingBoxCord window;
+            window.l = random.uniform(0.0f, 1.0f - w);
+            window.t = random.uniform(0.0f, 1.0f - h);
+            window.r = window.l + w;
+            window.b = window.t + h;
+            // An image without boxes has nothing to keep, any window of the right shape does
+            if (!count || accepts(l.data(), t.data(), r.data(), b.data(), area.data(), count, window, iou_range.first, iou_range.second))
+                return {window, iou_range, false};
+        }
+    }
+    return {{0, 0, 1, 1}, SSD_IOU_OPTIONS[0], true};
+}
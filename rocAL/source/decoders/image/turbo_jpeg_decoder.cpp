@@ -22,6 +22,7 @@ THE SOFTWARE.
 
 
 #include <stdio.h>
+#include <cmath>
 #include "pipeline/commons.h"
 #include "decoders/image/turbo_jpeg_decoder.h"
 #include "decoders/libjpeg/libjpeg_extra.h"
@@ -126,13 +127,45 @@ Decoder::Status TJDecoder::decode(unsigned char* input_buffer, size_t input_size
         }
         // TODO : Turbo Jpeg supports multiple color packing and color formats, add more as an option to the API TJPF_RGB, TJPF_BGR, TJPF_RGBX, TJPF_BGRX, TJPF_RGBA, TJPF_GRAY, TJPF_CMYK , ...
         else {
+            const DecodeHint &hint = config.get_decode_hint();
+            if (hint.fixed_crop && original_image_width <= max_decoded_width && original_image_height <= max_decoded_height) {
+                // Only the anchored crop window is read downstream, it is computed the same way as the fixed crop parameter does on the decoded roi
+                size_t crop_width = (hint.crop_width > 0 && hint.crop_width <= original_image_width) ? hint.crop_width : original_image_width;
+                size_t crop_height = (hint.crop_height > 0 && hint.crop_height <= original_image_height) ? hint.crop_height : original_image_height;
+                if (crop_width != original_image_width || crop_height != original_image_height) {
+                    auto crop_x = static_cast<size_t>(std::nearbyintf(hint.crop_anchor_x * (original_image_width - crop_width)));
+                    auto crop_y = static_cast<size_t>(std::nearbyintf(hint.crop_anchor_y * (original_image_height - crop_height)));
+                    if (tjDecompress2_partial_window(m_jpegDecompressor,
+                                                     input_buffer,
+                                                     input_size,
+                                                     output_buffer,
+                                                     max_decoded_width * planes,
+                                                     tjpf,
+                                                     TJFLAG_ACCURATEDCT,
+                                                     crop_x, crop_y, crop_width, crop_height) != 0) {
+                        WRN("Jpeg partial image decode failed " + STR(tjGetErrorStr2(m_jpegDecompressor)))
+                        return Status::CONTENT_DECODE_FAILED;
+                    }
+                    // The roi stays the full image so the downstream crop picks the same window
+                    actual_decoded_width = original_image_width;
+                    actual_decoded_height = original_image_height;
+                    return Status::OK;
+                }
+            }
+            // Decode at the smallest scale the downstream resize still reads without upscaling, the max decoded size otherwise
+            size_t decode_width = max_decoded_width, decode_height = max_decoded_height;
+            int hinted_factor = hinted_scaling_factor(hint, original_image_width, original_image_height, max_decoded_width, max_decoded_height);
+            if (hinted_factor >= 0) {
+                decode_width = TJSCALED(original_image_width, _scaling_factors[hinted_factor]);
+                decode_height = TJSCALED(original_image_height, _scaling_factors[hinted_factor]);
+            }
             if (tjDecompress2(m_jpegDecompressor,
                               input_buffer,
                               input_size,
                               output_buffer,
-                              max_decoded_width,
+                              decode_width,
                               max_decoded_width * planes,
-                              max_decoded_height,
+                              decode_height,
                               tjpf,
                               TJFLAG_ACCURATEDCT) != 0) {
                 // try decode to original dim and scale using OpenCV
@@ -140,11 +173,11 @@ Decoder::Status TJDecoder::decode(unsigned char* input_buffer, size_t input_size
                 return Status::CONTENT_DECODE_FAILED;
             }
             // Find the decoded image size using the predefined scaling factors in the turbo jpeg decoder
-            uint scaledw = max_decoded_width, scaledh = max_decoded_height;
+            uint scaledw = decode_width, scaledh = decode_height;
             for (int j=0; j < _num_scaling_factors; j++) {
                 scaledw = TJSCALED(original_image_width, _scaling_factors[j]);
                 scaledh = TJSCALED(original_image_height, _scaling_factors[j]);
-                if (scaledw <= max_decoded_width && scaledh <= max_decoded_height)
+                if (scaledw <= decode_width && scaledh <= decode_height)
                     break;
             }
             actual_decoded_width = scaledw;
@@ -234,6 +267,22 @@ Decoder::Status TJDecoder::decode(unsigned char* input_buffer, size_t input_size
     return Status::OK;
 }
 
+int TJDecoder::hinted_scaling_factor(const DecodeHint &hint, size_t original_image_width, size_t original_image_height,
+                                     size_t max_decoded_width, size_t max_decoded_height) {
+    if (hint.width == 0 && hint.height == 0)
+        return -1;
+    // The scaling factors are ordered from the largest to the smallest, walk the downscaling ones from the smallest up
+    for (int j = _num_scaling_factors - 1; j >= 0; j--) {
+        if (_scaling_factors[j].num > _scaling_factors[j].denom)
+            break;
+        size_t scaledw = TJSCALED(original_image_width, _scaling_factors[j]);
+        size_t scaledh = TJSCALED(original_image_height, _scaling_factors[j]);
+        if (scaledw >= hint.width && scaledh >= hint.height)
+            return (scaledw <= max_decoded_width && scaledh <= max_decoded_height) ? j : -1;
+    }
+    return -1;
+}
+
 TJDecoder::~TJDecoder() {
     tjDestroy(m_jpegDecompressor);
 }
@@ -264,3 +264,68 @@ int tjDecompress2_partial_scale(tjhandle handle, const unsigned char *jpegBuf,
     if (tmp_row) free(tmp_row);
     return retval;
 }
+
+//! * Decompress a subregion of JPEG image to an RGB, grayscale, or CMYK image.
+//! * The rows and MCU columns outside the region are not decoded, the region keeps its position in the output
+
+int tjDecompress2_partial_window(tjhandle handle, const unsigned char *jpegBuf,
+                                 unsigned long jpegSize, unsigned char *dstBuf,
+                                 int pitch, int pixelFormat, int flags,
+                                 unsigned int crop_x, unsigned int crop_y,
+                                 unsigned int crop_width, unsigned int crop_height)
+{
+    JSAMPROW row_pointer;
+    int retval = 0;
+
+    if (jpegBuf == NULL || jpegSize <= 0 || dstBuf == NULL || pitch < 0 ||
+        pixelFormat < 0 || pixelFormat >= TJ_NUMPF || crop_width == 0 || crop_height == 0)
+        THROW("tjDecompress2_partial_window(): Invalid argument");
+
+    struct jpeg_decompress_struct cinfo;
+    // Initialize libjpeg structures to have a memory source
+    // Modify the usual jpeg error manager to catch fatal errors.
+    struct my_error_mgr jerr;
+    cinfo.err = jpeg_std_error(&jerr.pub);
+    jerr.pub.error_exit = my_error_exit;
+    cinfo.mem = NULL;
+    if (setjmp(jerr.setjmp_buffer)) {
+      /* If we get here, the JPEG code has signaled an error. */
+      jpeg_destroy_decompress(&cinfo);
+      return -1;
+    }
+
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, jpegBuf, jpegSize);
+    jpeg_read_header(&cinfo, TRUE);
+    cinfo.out_color_space = pf2cs[pixelFormat];
+    if (flags & TJFLAG_FASTDCT) cinfo.dct_method = JDCT_FASTEST;
+    if (flags & TJFLAG_FASTUPSAMPLE) cinfo.do_fancy_upsampling = FALSE;
+
+    jpeg_start_decompress(&cinfo);
+    /* Check for valid crop dimensions.  We cannot check these values until
+    * after jpeg_start_decompress() is called.
+    */
+    if (crop_x + crop_width > cinfo.output_width || crop_y + crop_height > cinfo.output_height) {
+        ERR("crop dimensions:" << crop_width << " x " << crop_height << " exceed image dimensions" <<
+            cinfo.output_width << " x " << cinfo.output_height);
+        retval = -1;  goto bailout;
+    }
+    if (pitch == 0) pitch = cinfo.output_width * tjPixelSize[pixelFormat];
+
+    // crop_x is moved back to the closest MCU boundary, the scanlines then start at that column of the image
+    jpeg_crop_scanline(&cinfo, &crop_x, &crop_width);
+    jpeg_skip_scanlines(&cinfo, crop_y);
+    while (cinfo.output_scanline < crop_y + crop_height) {
+        row_pointer = &dstBuf[cinfo.output_scanline * (size_t)pitch + crop_x * tjPixelSize[pixelFormat]];
+        if (jpeg_read_scanlines(&cinfo, &row_pointer, 1) == 0) {
+            ERR("Premature end of Jpeg data. Stopped at " << cinfo.output_scanline - crop_y << "/" << crop_height)
+            retval = -1;  goto bailout;
+        }
+    }
+    // The rows below the window are never read, stop without decoding them
+    jpeg_abort_decompress(&cinfo);
+
+  bailout:
+    jpeg_destroy_decompress(&cinfo);
+    return retval;
+}
@@ -82,6 +82,7 @@ void AudioLoaderSharded::initialize(ReaderConfig reader_cfg, DecoderConfig decod
     for (size_t i = 0; i < _shard_count; i++) {
         std::shared_ptr loader = std::make_shared<AudioLoader>(_dev_resources);
         loader->set_prefetch_queue_depth(_prefetch_queue_depth);
+        loader->set_host_memory_arena(_host_arena);
         _loaders.push_back(loader);
     }
     // Initialize loader modules
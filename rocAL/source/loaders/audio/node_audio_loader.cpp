@@ -47,7 +47,6 @@ void AudioLoaderNode::Init(unsigned internal_shard_count, unsigned cpu_num_threa
     reader_cfg.set_file_list_path(file_list_path);
     reader_cfg.set_sharding_info(sharding_info);
     _loader_module->initialize(reader_cfg, DecoderConfig(decoder_type), mem_type, _batch_size, false);
-    _loader_module->start_loading();
 }
 
 std::shared_ptr<LoaderModule> AudioLoaderNode::GetLoaderModule() {
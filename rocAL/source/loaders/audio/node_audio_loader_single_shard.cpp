@@ -49,7 +49,6 @@ void AudioLoaderSingleShardNode::Init(unsigned shard_id, unsigned shard_count, u
     reader_cfg.set_file_list_path(file_list_path);
     reader_cfg.set_sharding_info(sharding_info);
     _loader_module->initialize(reader_cfg, DecoderConfig(decoder_type), mem_type, _batch_size);
-    _loader_module->start_loading();
 }
 
 std::shared_ptr<LoaderModule> AudioLoaderSingleShardNode::GetLoaderModule() {
@@ -201,8 +201,7 @@ void CircularBuffer::init(RocalMemType output_mem_type, size_t output_mem_size,
         }
     } else {
         for (size_t buffIdx = 0; buffIdx < _buff_depth; buffIdx++) {
-            // a minimum of extra MEM_ALIGNMENT is allocated
-            _host_buffer_ptrs[buffIdx] = (unsigned char *)aligned_alloc(MEM_ALIGNMENT, MEM_ALIGNMENT * (_output_mem_size / MEM_ALIGNMENT + 1));
+            _host_buffer_ptrs[buffIdx] = allocate_host_buffer();
         }
     }
 #elif ENABLE_HIP
@@ -211,7 +210,9 @@ void CircularBuffer::init(RocalMemType output_mem_type, size_t output_mem_size,
                 THROW("Error HIP device resource is not initialized");
 
             for (size_t buffIdx = 0; buffIdx < _buff_depth; buffIdx++) {
-                if (_use_pinned_memory) {
+                if (_use_pinned_memory && _host_arena) {
+                    _host_buffer_ptrs[buffIdx] = allocate_host_buffer(true);
+                } else if (_use_pinned_memory) {
                     hipError_t err = hipHostMalloc((void **)&_host_buffer_ptrs[buffIdx], _output_mem_size, hipHostMallocDefault /*hipHostMallocMapped|hipHostMallocWriteCombined*/);
                     if (err != hipSuccess || !_host_buffer_ptrs[buffIdx]) {
                         THROW("hipHostMalloc of size " + TOSTR(_output_mem_size) + " failed " + TOSTR(err));
@@ -232,20 +233,35 @@ void CircularBuffer::init(RocalMemType output_mem_type, size_t output_mem_size,
             }
         } else {
             for (size_t buffIdx = 0; buffIdx < _buff_depth; buffIdx++) {
-                // a minimum of extra MEM_ALIGNMENT is allocated
-                _host_buffer_ptrs[buffIdx] = (unsigned char *)aligned_alloc(MEM_ALIGNMENT, MEM_ALIGNMENT * (_output_mem_size / MEM_ALIGNMENT + 1));
+                _host_buffer_ptrs[buffIdx] = allocate_host_buffer();
             }
         }
 #else
     for (size_t buffIdx = 0; buffIdx < _buff_depth; buffIdx++) {
-        // a minimum of extra MEM_ALIGNMENT is allocated
-        _host_buffer_ptrs[buffIdx] = (unsigned char*)aligned_alloc(MEM_ALIGNMENT, MEM_ALIGNMENT * (_output_mem_size / MEM_ALIGNMENT + 1));
+        _host_buffer_ptrs[buffIdx] = allocate_host_buffer();
     }
 #endif
     _initialized = true;
 }
 
+unsigned char *CircularBuffer::allocate_host_buffer(bool pinned) {
+    if (_host_arena)
+        return static_cast<unsigned char *>(_host_arena->allocate(_output_mem_size, pinned));
+    // a minimum of extra MEM_ALIGNMENT is allocated
+    return (unsigned char *)aligned_alloc(MEM_ALIGNMENT, MEM_ALIGNMENT * (_output_mem_size / MEM_ALIGNMENT + 1));
+}
+
+void CircularBuffer::release_host_buffer(unsigned char *buffer) {
+    if (_host_arena)
+        _host_arena->deallocate(buffer);
+    else
+        free(buffer);
+}
+
 void CircularBuffer::release() {
+    // Loaders reading the shared data service on the host never allocate their slots
+    if (!_initialized)
+        return;
     for (size_t buffIdx = 0; buffIdx < _buff_depth; buffIdx++) {
 #if ENABLE_OPENCL
         if (_output_mem_type == RocalMemType::OCL) {
@@ -256,7 +272,10 @@ void CircularBuffer::release() {
         } else {
 #elif ENABLE_HIP
             if (_output_mem_type == RocalMemType::HIP) {
-                if (_use_pinned_memory && _host_buffer_ptrs[buffIdx]) {
+                if (_use_pinned_memory && _host_buffer_ptrs[buffIdx] && _host_arena) {
+                    release_host_buffer(_host_buffer_ptrs[buffIdx]);
+                    _host_buffer_ptrs[buffIdx] = nullptr;
+                } else if (_use_pinned_memory && _host_buffer_ptrs[buffIdx]) {
                     hipError_t err = hipHostFree((void *)_host_buffer_ptrs[buffIdx]);
 
                     if (err != hipSuccess)
@@ -272,10 +291,10 @@ void CircularBuffer::release() {
                 }
             } else {
 #else
-        free(_host_buffer_ptrs[buffIdx]);
+        release_host_buffer(_host_buffer_ptrs[buffIdx]);
 #endif
 #if ENABLE_HIP || ENABLE_OPENCL
-            free(_host_buffer_ptrs[buffIdx]);
+            release_host_buffer(_host_buffer_ptrs[buffIdx]);
         }
 #endif
     }
@@ -23,12 +23,58 @@ THE SOFTWARE.
 #include "loaders/image/cifar10_loader.h"
 
 #include <chrono>
+#include <cstring>
 #include <thread>
+#if ENABLE_SIMD
+#if _WIN32
+#include <intrin.h>
+#else
+#include <immintrin.h>
+#endif
+#endif
 
 #include "vx_ext_amd.h"
 
 #define NEAREST_MULTIPLE_OF_8(size) (((size) + 8) & ~7)
 
+namespace {
+// A CIFAR10 record holds the 32x32 red, green and blue planes one after the other
+constexpr size_t CIFAR10_PLANE_SIZE = 32 * 32;
+constexpr size_t CIFAR10_RECORD_SIZE = 3 * CIFAR10_PLANE_SIZE;
+
+// Interleaves three planes pixel by pixel into dst, taking the channels in the order they are passed
+void planar_to_interleaved(const unsigned char *first, const unsigned char *second, const unsigned char *third, unsigned char *dst, size_t pixel_count) {
+    size_t i = 0;
+#if (ENABLE_SIMD && __AVX2__)
+    // Every 16 pixels of each plane spread over 48 output bytes, each output vector takes its bytes from the three planes
+    const __m128i pmask_first[3] = {_mm_setr_epi8(0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, 5),
+                                    _mm_setr_epi8(-1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10, -1),
+                                    _mm_setr_epi8(-1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1)};
+    const __m128i pmask_second[3] = {_mm_setr_epi8(-1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1),
+                                     _mm_setr_epi8(5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10),
+                                     _mm_setr_epi8(-1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1)};
+    const __m128i pmask_third[3] = {_mm_setr_epi8(-1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1),
+                                    _mm_setr_epi8(-1, 5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1),
+                                    _mm_setr_epi8(10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15)};
+    for (; i + 16 <= pixel_count; i += 16) {
+        __m128i pfirst = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first + i));
+        __m128i psecond = _mm_loadu_si128(reinterpret_cast<const __m128i *>(second + i));
+        __m128i pthird = _mm_loadu_si128(reinterpret_cast<const __m128i *>(third + i));
+        for (int v = 0; v < 3; v++) {
+            __m128i pout = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(pfirst, pmask_first[v]), _mm_shuffle_epi8(psecond, pmask_second[v])),
+                                        _mm_shuffle_epi8(pthird, pmask_third[v]));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 3 * i + 16 * v), pout);
+        }
+    }
+#endif
+    for (; i < pixel_count; i++) {
+        dst[3 * i] = first[i];
+        dst[3 * i + 1] = second[i];
+        dst[3 * i + 2] = third[i];
+    }
+}
+}  // namespace
+
 CIFAR10Loader::CIFAR10Loader(void* dev_resources) : _circ_buff(dev_resources),
                                                             _file_load_time("file load time", DBG_TIMING),
                                                             _swap_handle_time("Swap_handle_time", DBG_TIMING) {
@@ -122,6 +168,10 @@ void CIFAR10Loader::initialize(ReaderConfig reader_cfg, DecoderConfig decoder_cf
     _batch_size = batch_size;
     _loop = reader_cfg.loop();
     _image_size = _output_tensor->info().data_size() / batch_size;
+    auto color_format = _output_tensor->info().color_format();
+    _interleave_output = (color_format == RocalColorFormat::RGB24 || color_format == RocalColorFormat::BGR24) && _image_size >= CIFAR10_RECORD_SIZE;
+    _bgr_output = (color_format == RocalColorFormat::BGR24);
+    _record_buff.resize(CIFAR10_RECORD_SIZE);
     _output_names.resize(batch_size);
     try {
         _reader = create_reader(reader_cfg);
@@ -194,7 +244,16 @@ CIFAR10Loader::load_routine() {
                     ERR("Opened file " + _reader->id() + " of size 0");
                     continue;
                 }
-                _actual_read_size[file_counter] = _reader->read_data(read_ptr, readSize);
+                // Resident records are copied from the mapped files, planar records go straight into planar outputs and interleaved outputs take them from the record buffer
+                if (cifar10reader->record_view()) {
+                    copy_record(cifar10reader->record_view(), read_ptr);
+                    _actual_read_size[file_counter] = readSize;
+                } else if (!_interleave_output) {
+                    _actual_read_size[file_counter] = _reader->read_data(read_ptr, std::min(readSize, _image_size));
+                } else {
+                    _actual_read_size[file_counter] = _reader->read_data(_record_buff.data(), readSize);
+                    copy_record(_record_buff.data(), read_ptr);
+                }
                 _decoded_data_info._data_names[file_counter] = _reader->id();
                 _decoded_data_info._roi_width[file_counter] = _output_tensor->info().max_shape()[0];
                 _decoded_data_info._roi_height[file_counter] = _output_tensor->info().max_shape()[1];
@@ -238,6 +297,18 @@ CIFAR10Loader::load_routine() {
     return LoaderModuleStatus::OK;
 }
 
+void CIFAR10Loader::copy_record(const unsigned char *record, unsigned char *dst) {
+    if (_interleave_output) {
+        const unsigned char *red = record, *green = record + CIFAR10_PLANE_SIZE, *blue = record + 2 * CIFAR10_PLANE_SIZE;
+        if (_bgr_output)
+            planar_to_interleaved(blue, green, red, dst, CIFAR10_PLANE_SIZE);
+        else
+            planar_to_interleaved(red, green, blue, dst, CIFAR10_PLANE_SIZE);
+    } else {
+        memcpy(dst, record, std::min(_image_size, CIFAR10_RECORD_SIZE));
+    }
+}
+
 bool CIFAR10Loader::is_out_of_data() {
     return (remaining_count() < _batch_size);
 }
@@ -77,6 +77,7 @@ void CIFAR10LoaderSharded::initialize(ReaderConfig reader_cfg, DecoderConfig dec
     for (size_t i = 0; i < _shard_count; i++) {
         std::shared_ptr loader = std::make_shared<CIFAR10Loader>(_dev_resources);
         loader->set_prefetch_queue_depth(_prefetch_queue_depth);
+        loader->set_host_memory_arena(_host_arena);
         _loaders.push_back(loader);
     }
     // Initialize loader modules
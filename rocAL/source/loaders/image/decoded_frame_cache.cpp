@@ -0,0 +1,68 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "loaders/image/decoded_frame_cache.h"
+
+#include <cstring>
+
+const DecodedFrameCache::Frame *DecodedFrameCache::find(const std::string &path) const {
+    auto frame = _frames.find(path);
+    return frame != _frames.end() ? &frame->second : nullptr;
+}
+
+bool DecodedFrameCache::insert(const std::string &path, const unsigned char *src, size_t src_stride, size_t width, size_t height, unsigned planes,
+                               size_t original_width, size_t original_height, size_t next_use, size_t position) {
+    if (!in_window(next_use, position)) {
+        _frames.erase(path);
+        return false;
+    }
+    Frame &frame = _frames[path];
+    const size_t row_size = width * planes;
+    frame.pixels.resize(row_size * height);
+    for (size_t row = 0; row < height; row++)
+        memcpy(frame.pixels.data() + row * row_size, src + row * src_stride, row_size);
+    frame.width = width;
+    frame.height = height;
+    frame.original_width = original_width;
+    frame.original_height = original_height;
+    frame.next_use = next_use;
+    return true;
+}
+
+void DecodedFrameCache::update(const std::string &path, size_t next_use, size_t position) {
+    auto frame = _frames.find(path);
+    if (frame == _frames.end())
+        return;
+    if (in_window(next_use, position))
+        frame->second.next_use = next_use;
+    else
+        _frames.erase(frame);
+}
+
+void DecodedFrameCache::drop_passed(size_t position) {
+    for (auto frame = _frames.begin(); frame != _frames.end();) {
+        if (frame->second.next_use < position)
+            frame = _frames.erase(frame);
+        else
+            ++frame;
+    }
+}
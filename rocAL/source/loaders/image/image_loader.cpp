@@ -23,6 +23,7 @@ THE SOFTWARE.
 #include "loaders/image/image_loader.h"
 
 #include <chrono>
+#include <cstring>
 #include <thread>
 
 #include "loaders/image/image_read_and_decode.h"
@@ -49,6 +50,10 @@ ImageLoader::~ImageLoader() {
 }
 
 void ImageLoader::shut_down() {
+    if (_shared_source) {
+        _shared_source->detach(_shared_consumer_id);
+        _shared_source = nullptr;
+    }
     if (_internal_thread_running)
         stop_internal_thread();
     _circ_buff.release();
@@ -60,6 +65,15 @@ void ImageLoader::set_prefetch_queue_depth(size_t prefetch_queue_depth) {
     _prefetch_queue_depth = prefetch_queue_depth;
 }
 
+void ImageLoader::set_shared_data_service(const std::string &service_name, unsigned consumer_count) {
+    if (_is_initialized)
+        THROW("set_shared_data_service() should be called before initialize()")
+    if (consumer_count == 0)
+        THROW("Shared data service needs at least one consumer")
+    _shared_service_name = service_name;
+    _shared_consumer_count = consumer_count;
+}
+
 void ImageLoader::set_gpu_device_id(int device_id) {
     if (device_id < 0)
         THROW("invalid device_id passed to loader");
@@ -79,6 +93,13 @@ ImageLoader::remaining_count() {
 }
 
 void ImageLoader::reset() {
+    if (_shared_source) {
+        // Only this consumer moves to the start of the next pass, the other pipelines on the source keep their position
+        _image_counter = 0;
+        _shared_source->reset(_shared_consumer_id);
+        _remaining_image_count = _shared_source->count();
+        return;
+    }
     // stop the writer thread and empty the internal circular buffer
     _internal_thread_running = false;
     _circ_buff.unblock_writer();
@@ -91,6 +112,7 @@ void ImageLoader::reset() {
 
     // resetting the reader thread to the start of the media
     _image_counter = 0;
+    _epoch = 0;
     _image_loader->reset();
 
     // Start loading (writer thread) again
@@ -98,6 +120,11 @@ void ImageLoader::reset() {
 }
 
 void ImageLoader::de_init() {
+    // Detach from the shared source first so that it stops writing to the circular buffer
+    if (_shared_source) {
+        _shared_source->detach(_shared_consumer_id);
+        _shared_source = nullptr;
+    }
     // Set running to 0 and wait for the internal thread to join
     stop_internal_thread();
     _output_mem_size = 0;
@@ -141,7 +168,33 @@ void ImageLoader::initialize(ReaderConfig reader_cfg, DecoderConfig decoder_cfg,
     _batch_size = batch_size;
     _loop = reader_cfg.loop();
     _decoder_keep_original = decoder_keep_original;
+    if (_sample_quarantine)
+        reader_cfg.set_sample_quarantine(_sample_quarantine);
+    reader_cfg.set_file_scan_options(_file_scan_options);
+    if (_record_check)
+        reader_cfg.set_record_check(_record_check);
+    _circ_buff.set_host_memory_arena(_host_arena);
+    if (!_shared_service_name.empty()) {
+        if (_continuous_epochs)
+            THROW("Continuous epochs are not supported with the shared data service")
+        if (decoder_cfg._type == DecoderType::ROCJPEG_DEC)
+            THROW("rocJPEG decoder is not supported with the shared data service")
+        if (_randombboxcrop_meta_data_reader)
+            THROW("Random bbox crop decoding is not supported with the shared data service")
+        _max_tensor_width = _output_tensor->info().max_shape().at(0);
+        _max_tensor_height = _output_tensor->info().max_shape().at(1);
+        // The host outputs read the shared batches in place, the device outputs upload them through the circular buffer
+        if (_mem_type != RocalMemType::HOST)
+            _circ_buff.init(_mem_type, _output_mem_size, _prefetch_queue_depth);
+        _shared_source = SharedDataService::instance()->acquire(_shared_service_name, _shared_consumer_count);
+        _shared_consumer_id = _shared_source->attach(reader_cfg, decoder_cfg, _batch_size, _output_mem_size, _max_tensor_width, _max_tensor_height,
+                                                     _output_tensor->info().color_format(), _decoder_keep_original, _prefetch_queue_depth);
+        _is_initialized = true;
+        LOG("Loader module initialized on the shared data service " + _shared_service_name);
+        return;
+    }
     _image_loader = std::make_shared<ImageReadAndDecode>();
+    _image_loader->set_host_memory_arena(_host_arena);
     size_t shard_count = reader_cfg.get_shard_count();
     int device_id = reader_cfg.get_shard_id();
 #if ENABLE_HIP
@@ -183,7 +236,14 @@ void ImageLoader::start_loading() {
     if (!_is_initialized)
         THROW("start_loading() should be called after initialize() function is called")
 
+    if (_shared_source) {
+        _remaining_image_count = _shared_source->count();
+        _shared_source->start(_shared_consumer_id);
+        return;
+    }
     _remaining_image_count = _image_loader->count();
+    _output_reader_state = _image_loader->get_reader_state();
+    _output_epoch = _epoch;
     _internal_thread_running = true;
     _load_thread = std::thread(&ImageLoader::load_routine, this);
 }
@@ -216,9 +276,24 @@ ImageLoader::load_routine() {
                     _crop_image_info._crop_image_coords = _image_loader->get_batch_random_bbox_crop_coords();
                     _circ_buff.set_crop_image_info(_crop_image_info);
                 }
+                // The batch closes the epoch when the reader cannot fill another one
+                bool last_batch = _continuous_epochs && (_image_loader->count() < _batch_size);
+                _decoded_data_info._reader_state = _image_loader->get_reader_state();
+                _decoded_data_info._skipped_count = _image_loader->skipped_count();
+                _image_counter += _output_tensor->info().batch_size();
+                if (last_batch) {
+                    // Rewind and reshuffle the reader right away, the batches already in the circular buffer hide it from the consumer
+                    LOG("Cycled through all images, count " + TOSTR(_image_counter) + ", starting epoch " + TOSTR(_epoch + 1));
+                    _image_loader->reset();
+                }
+                // What the reader has left is the rest of the epoch, or the whole next epoch once it is rewound
+                _decoded_data_info._epoch_info = {_epoch, last_batch, _image_loader->count()};
                 _circ_buff.set_decoded_data_info(_decoded_data_info);
                 _circ_buff.push();
-                _image_counter += _output_tensor->info().batch_size();
+                if (last_batch) {
+                    _image_counter = 0;
+                    _epoch++;
+                }
             }
         }
         if (load_status != LoaderModuleStatus::OK) {
@@ -245,14 +320,55 @@ ImageLoader::load_routine() {
     return LoaderModuleStatus::OK;
 }
 
+LoaderState ImageLoader::get_state() {
+    if (_shared_source || _external_source_reader)
+        return {};
+    LoaderState state;
+    state.readers.push_back(_output_reader_state);
+    state.epochs.push_back(_output_epoch);
+    return state;
+}
+
+void ImageLoader::set_state(const LoaderState& state) {
+    if (_shared_source || _external_source_reader)
+        THROW("Restoring the loader state is not supported with the shared data service or external source")
+    if (state.readers.size() != 1 || state.epochs.size() != 1)
+        THROW("Loader state holds " + TOSTR(state.readers.size()) + " readers, expected 1")
+    // Drop the prefetched batches, they were read past the restored position
+    _internal_thread_running = false;
+    _circ_buff.unblock_writer();
+    if (_load_thread.joinable())
+        _load_thread.join();
+    _circ_buff.reset();
+
+    _image_counter = 0;
+    _image_loader->set_reader_state(state.readers[0]);
+    _epoch = state.epochs[0];
+    if (_continuous_epochs && _image_loader->count() < _batch_size) {
+        // The restored batch closed its epoch, the loader thread would have rewound the reader right after it
+        _image_loader->reset();
+        _epoch++;
+    }
+    start_loading();
+}
+
 bool ImageLoader::is_out_of_data() {
     return (remaining_count() < _batch_size);
 }
 
 size_t ImageLoader::last_batch_padded_size() {
+    if (_shared_source)
+        return _shared_source->last_batch_padded_size();
     return _image_loader->last_batch_padded_size();
 }
 
+void ImageLoader::set_decode_hint(const DecodeHint& hint) {
+    // The shared source decodes once for pipelines with different consumers, the hint of one pipeline does not hold for the others
+    if (_shared_source || !_image_loader)
+        return;
+    _image_loader->set_decode_hint(hint);
+}
+
 LoaderModuleStatus
 ImageLoader::update_output_image() {
     LoaderModuleStatus status = LoaderModuleStatus::OK;
@@ -261,6 +377,8 @@ ImageLoader::update_output_image() {
         return LoaderModuleStatus::NO_MORE_DATA_TO_READ;
     if (_stopped)
         return LoaderModuleStatus::OK;
+    if (_shared_source)
+        return update_shared_output_image();
 
     // _circ_buff.get_read_buffer_x() is blocking and puts the caller on sleep until new images are written to the _circ_buff
     if ((_mem_type == RocalMemType::OCL) || (_mem_type == RocalMemType::HIP)) {
@@ -284,16 +402,52 @@ ImageLoader::update_output_image() {
         _output_cropped_img_info = _circ_buff.get_cropped_image_info();
     }
     _output_names = _output_decoded_data_info._data_names;
+    _output_reader_state = _output_decoded_data_info._reader_state;
+    _output_epoch = _output_decoded_data_info._epoch_info.epoch;
     _output_tensor->update_tensor_roi(_output_decoded_data_info._roi_width, _output_decoded_data_info._roi_height);
     _circ_buff.pop();
-    if (!_loop)
-        _remaining_image_count -= _batch_size;
+    if (_continuous_epochs)  // Counts down the epoch of the output batch, refilled with the next epoch after its last batch
+        _remaining_image_count = _output_decoded_data_info._epoch_info.remaining_count;
+    else if (!_loop)
+        consume_remaining(_output_decoded_data_info._skipped_count);
 
     return status;
 }
 
+LoaderModuleStatus
+ImageLoader::update_shared_output_image() {
+    // next_batch() blocks until the batch of this consumer is decoded, it stays valid until the next call
+    auto data_buffer = _shared_source->next_batch(_shared_consumer_id, _output_decoded_data_info);
+    if (!data_buffer)
+        return LoaderModuleStatus::NO_MORE_DATA_TO_READ;
+    _swap_handle_time.start();
+    if (_mem_type == RocalMemType::HOST) {
+        if (_output_tensor->swap_handle(data_buffer) != 0)
+            return LoaderModuleStatus::HOST_BUFFER_SWAP_FAILED;
+    } else {
+        memcpy(_circ_buff.get_write_buffer(), data_buffer, _output_mem_size);
+        _circ_buff.push();
+        if (_output_tensor->swap_handle(_circ_buff.get_read_buffer_dev()) != 0)
+            return LoaderModuleStatus::DEVICE_BUFFER_SWAP_FAILED;
+        _circ_buff.pop();
+    }
+    _swap_handle_time.end();
+    _output_names = _output_decoded_data_info._data_names;
+    _output_reader_state = _output_decoded_data_info._reader_state;
+    _output_epoch = _output_decoded_data_info._epoch_info.epoch;
+    _output_tensor->update_tensor_roi(_output_decoded_data_info._roi_width, _output_decoded_data_info._roi_height);
+    if (!_loop)
+        consume_remaining(_output_decoded_data_info._skipped_count);
+    return LoaderModuleStatus::OK;
+}
+
+void ImageLoader::consume_remaining(size_t skipped_count) {
+    // The samples skipped while reading the batch will not be output either, the epoch is shorter by them
+    _remaining_image_count -= std::min(_remaining_image_count, _batch_size + skipped_count);
+}
+
 Timing ImageLoader::timing() {
-    auto t = _image_loader->timing();
+    auto t = _shared_source ? _shared_source->timing() : _image_loader->timing();
     t.process_time = _swap_handle_time.get_timing();
     return t;
 }
@@ -311,6 +465,8 @@ CropImageInfo ImageLoader::get_crop_image_info() {
 }
 
 void ImageLoader::feed_external_input(const std::vector<std::string>& input_images_names, const std::vector<unsigned char *>& input_buffer, const std::vector<ROIxywh>& roi_xywh, unsigned int max_width, unsigned int max_height, unsigned int channels, ExternalSourceFileMode mode, bool eos) {
+    if (_shared_source)
+        THROW("External source input is not supported with the shared data service")
     _external_source_reader = true;
     _external_input_eos = eos;
     _image_loader->feed_external_input(input_images_names, input_buffer, roi_xywh, max_width, max_height, channels, mode, eos);
@@ -76,10 +76,17 @@ void ImageLoaderSharded::initialize(ReaderConfig reader_cfg, DecoderConfig decod
     if (_initialized)
         return;
     _shard_count = reader_cfg.get_shard_count();
+    if (_sample_quarantine)
+        reader_cfg.set_sample_quarantine(_sample_quarantine);
+    reader_cfg.set_file_scan_options(_file_scan_options);
+    if (_record_check)
+        reader_cfg.set_record_check(_record_check);
     // Create loader modules
     for (size_t i = 0; i < _shard_count; i++) {
         std::shared_ptr loader = std::make_shared<ImageLoader>(_dev_resources);
         loader->set_prefetch_queue_depth(_prefetch_queue_depth);
+        loader->set_host_memory_arena(_host_arena);
+        loader->set_continuous_epochs(_continuous_epochs);
         _loaders.push_back(loader);
     }
     // Initialize loader modules
@@ -122,6 +129,31 @@ void ImageLoaderSharded::reset() {
     for (auto& loader : _loaders)
         loader->reset();
 }
+LoaderState ImageLoaderSharded::get_state() {
+    LoaderState state;
+    for (auto& loader : _loaders) {
+        auto loader_state = loader->get_state();
+        if (loader_state.readers.empty())
+            return {};
+        state.readers.push_back(loader_state.readers[0]);
+        state.epochs.push_back(loader_state.epochs[0]);
+    }
+    state.loader_idx = _loader_idx;
+    return state;
+}
+
+void ImageLoaderSharded::set_state(const LoaderState& state) {
+    if (state.readers.size() != _loaders.size() || state.epochs.size() != _loaders.size())
+        THROW("Loader state holds " + TOSTR(state.readers.size()) + " shards, the loader has " + TOSTR(_loaders.size()))
+    for (size_t idx = 0; idx < _loaders.size(); idx++) {
+        LoaderState loader_state;
+        loader_state.readers.push_back(state.readers[idx]);
+        loader_state.epochs.push_back(state.epochs[idx]);
+        _loaders[idx]->set_state(loader_state);
+    }
+    _loader_idx = state.loader_idx % _shard_count;
+}
+
 void ImageLoaderSharded::increment_loader_idx() {
     _loader_idx = (_loader_idx + 1) % _shard_count;
 }
@@ -139,6 +171,8 @@ Timing ImageLoaderSharded::timing() {
         max_read_time = (info.read_time > max_read_time) ? info.read_time : max_read_time;
         max_decode_time = (info.decode_time > max_decode_time) ? info.decode_time : max_decode_time;
         swap_handle_time += info.process_time;
+        t.frame_cache_hits += info.frame_cache_hits;
+        t.frame_cache_misses += info.frame_cache_misses;
     }
     t.decode_time = max_decode_time;
     t.read_time = max_read_time;
@@ -157,6 +191,11 @@ size_t ImageLoaderSharded::last_batch_padded_size() {
     return last_batch_padded_size;
 }
 
+void ImageLoaderSharded::set_decode_hint(const DecodeHint& hint) {
+    for (auto& loader : _loaders)
+        loader->set_decode_hint(hint);
+}
+
 void ImageLoaderSharded::feed_external_input(const std::vector<std::string>& input_images_names, const std::vector<unsigned char*>& input_buffer, const std::vector<ROIxywh>& roi_xywh, unsigned int max_width, unsigned int max_height, unsigned int channels, ExternalSourceFileMode mode, bool eos) {
     for (auto& loader : _loaders)
         loader->feed_external_input(input_images_names, input_buffer, roi_xywh, max_width, max_height, channels, mode, eos);
@@ -22,8 +22,10 @@ THE SOFTWARE.
 
 #include "loaders/image/image_read_and_decode.h"
 
+#include <algorithm>
 #include <cstring>
 #include <iterator>
+#include <unordered_map>
 
 #include "decoders/image/decoder_factory.h"
 #include "readers/image/external_source_reader.h"
@@ -50,6 +52,8 @@ ImageReadAndDecode::timing() {
     Timing t;
     t.decode_time = _decode_time.get_timing();
     t.read_time = _file_load_time.get_timing();
+    t.frame_cache_hits = _frame_cache_hits;
+    t.frame_cache_misses = _frame_cache_misses;
     return t;
 }
 
@@ -65,10 +69,11 @@ ImageReadAndDecode::~ImageReadAndDecode() {
 void ImageReadAndDecode::create(ReaderConfig reader_config, DecoderConfig decoder_config, int batch_size, int device_id) {
     // Can initialize it to any decoder types if needed
     _batch_size = batch_size;
-    _compressed_buff.resize(batch_size);
+    _compressed_buff.assign(batch_size, HostArenaBuffer(HostArenaAllocator<unsigned char>(_host_arena)));
     _decoder.resize(batch_size);
     _actual_read_size.resize(batch_size);
     _image_names.resize(batch_size);
+    _sample_keys.resize(batch_size);
     _compressed_image_size.resize(batch_size);
     _decompressed_buff_ptrs.resize(_batch_size);
     _actual_decoded_width.resize(_batch_size);
@@ -101,8 +106,18 @@ void ImageReadAndDecode::create(ReaderConfig reader_config, DecoderConfig decode
         }
     }
     _num_threads = reader_config.get_cpu_num_threads();
+    _sample_quarantine = reader_config.sample_quarantine();
+    _record_check = reader_config.record_check();
     _reader = create_reader(reader_config);
     _is_external_source = (reader_config.type() == StorageType::EXTERNAL_FILE_SOURCE);
+    if (reader_config.type() == StorageType::SEQUENCE_FILE_SYSTEM && _decoder_config._type == DecoderType::TURBO_JPEG) {
+        // A frame read again within a batch worth of frames is kept decoded, which covers the overlap of consecutive sequences
+        _sequence_reader = std::static_pointer_cast<SequenceFileSourceReader>(_reader);
+        _frame_cache = std::make_unique<DecodedFrameCache>(batch_size);
+        _frame_source.resize(batch_size);
+        _frame_position.resize(batch_size);
+        _cached_frames.resize(batch_size);
+    }
 }
 
 void ImageReadAndDecode::feed_external_input(const std::vector<std::string>& input_images_names, const std::vector<unsigned char *>& input_buffer,
@@ -136,6 +151,14 @@ void ImageReadAndDecode::reset() {
     // TODO: Reload images from the folder if needed
     _reader->reset();
     _set_device_id = false;
+    if (_frame_cache)
+        _frame_cache->clear();
+}
+
+void ImageReadAndDecode::set_reader_state(const ReaderState &state) {
+    _reader->set_state(state);
+    if (_frame_cache)
+        _frame_cache->clear();
 }
 
 size_t
@@ -162,6 +185,309 @@ ImageReadAndDecode::last_batch_padded_size() {
     return _reader->last_batch_padded_size();
 }
 
+bool ImageReadAndDecode::read_next_sample(size_t idx) {
+    while (_reader->count_items() > 0) {
+        size_t fsize = _reader->open();
+        if (fsize == 0) {
+            WRN("Opened file " + _reader->id() + " of size 0");
+            _skipped_count++;
+            continue;
+        }
+        if (_sample_quarantine && _sample_quarantine->contains(_reader->quarantine_key())) {
+            _reader->close();
+            _skipped_count++;
+            continue;
+        }
+        _compressed_buff[idx].reserve(fsize);
+        _actual_read_size[idx] = _reader->read_data(_compressed_buff[idx].data(), fsize);
+        _image_names[idx] = _reader->id();
+        _sample_keys[idx] = _reader->quarantine_key();
+        _reader->close();
+        if (_actual_read_size[idx] == 0) {  // Record rejected by the record check
+            if (idx == 0 || !_record_check || _record_check->policy() != RecordCheckPolicy::SUBSTITUTE) {
+                _skipped_count++;
+                continue;
+            }
+            copy_sample(idx, idx - 1);
+            return true;
+        }
+        _compressed_image_size[idx] = fsize;
+        return true;
+    }
+    return false;
+}
+
+bool ImageReadAndDecode::decode_header(size_t idx) {
+    int original_width, original_height, jpeg_sub_samp;
+    if (_decoder[idx]->decode_info(_compressed_buff[idx].data(), _actual_read_size[idx], &original_width, &original_height,
+                                   &jpeg_sub_samp) != Decoder::Status::OK)
+        return false;
+    _original_width[idx] = original_width;
+    _original_height[idx] = original_height;
+    return true;
+}
+
+void ImageReadAndDecode::copy_sample(size_t dst_idx, size_t src_idx) {
+    if (_frame_cache) {
+        share_frame(dst_idx, src_idx);
+        return;
+    }
+    _compressed_buff[dst_idx].reserve(_actual_read_size[src_idx]);
+    memcpy(_compressed_buff[dst_idx].data(), _compressed_buff[src_idx].data(), _actual_read_size[src_idx]);
+    _actual_read_size[dst_idx] = _actual_read_size[src_idx];
+    _compressed_image_size[dst_idx] = _compressed_image_size[src_idx];
+    _image_names[dst_idx] = _image_names[src_idx];
+    _sample_keys[dst_idx] = _sample_keys[src_idx];
+    _original_width[dst_idx] = _original_width[src_idx];
+    _original_height[dst_idx] = _original_height[src_idx];
+}
+
+void ImageReadAndDecode::complete_batch(size_t loaded_count) {
+    if (loaded_count == 0)
+        THROW("No samples left to load, the remaining samples of the reader are all quarantined")
+    // Quarantined samples skipped at the end of the stream can leave the batch short, it is completed with the loaded samples
+    for (size_t i = loaded_count; i < _batch_size; i++)
+        copy_sample(i, i % loaded_count);
+}
+
+void ImageReadAndDecode::validate_headers() {
+    std::vector<int> header_decoded(_batch_size);
+#pragma omp parallel for num_threads(_num_threads)
+    for (size_t i = 0; i < _batch_size; i++)
+        header_decoded[i] = decode_header(i);
+
+    // A sample failing the header decode is replaced with the next sample of the stream, not with a copy of another sample
+    for (size_t i = 0; i < _batch_size; i++) {
+        while (!header_decoded[i]) {
+            if (_sample_quarantine) {
+                _sample_quarantine->add(_sample_keys[i], "header decode failed");
+            } else {
+                WRN("Jpeg header decode failed for " + _image_names[i])
+            }
+            if (!read_next_sample(i))
+                break;
+            _skipped_count++;  // The failed sample leaves the batch, the next one takes its slot
+            header_decoded[i] = decode_header(i);
+        }
+    }
+
+    // Only when the stream has run out, the failed samples are substituted with a valid one from the same batch
+    auto valid_sample = std::find(header_decoded.begin(), header_decoded.end(), 1);
+    if (valid_sample == header_decoded.end())
+        THROW("All images in the batch failed decoding\n");
+    for (size_t i = 0; i < _batch_size; i++)
+        if (!header_decoded[i])
+            copy_sample(i, std::distance(header_decoded.begin(), valid_sample));
+}
+
+bool ImageReadAndDecode::decode_sample(size_t idx, size_t max_decoded_width, size_t max_decoded_height,
+                                       Decoder::ColorFormat color_format, bool keep_original) {
+    // initialize the actual decoded height and width with the maximum
+    _actual_decoded_width[idx] = max_decoded_width;
+    _actual_decoded_height[idx] = max_decoded_height;
+    if (_decoder[idx]->is_partial_decoder()) {
+        if (_randombboxcrop_meta_data_reader) {
+            _decoder[idx]->set_bbox_coords(_bbox_coords[idx]);
+        } else if (_random_crop_dec_param) {
+            Shape dec_shape = {_original_height[idx], _original_width[idx]};
+            auto crop_window = _random_crop_dec_param->generate_crop_window(dec_shape, idx);
+            _decoder[idx]->set_crop_window(crop_window);
+        }
+    }
+    // decode the image and get the actual decoded image width and height
+    size_t scaledw, scaledh;
+    if (_decoder[idx]->decode(_compressed_buff[idx].data(), _compressed_image_size[idx], _decompressed_buff_ptrs[idx],
+                              max_decoded_width, max_decoded_height,
+                              _original_width[idx], _original_height[idx],
+                              scaledw, scaledh,
+                              color_format, _decoder_config, keep_original) != Decoder::Status::OK)
+        return false;
+    _actual_decoded_width[idx] = scaledw;
+    _actual_decoded_height[idx] = scaledh;
+    return true;
+}
+
+void ImageReadAndDecode::replace_undecoded_samples(std::vector<int> &content_decoded, size_t max_decoded_width, size_t max_decoded_height,
+                                                   Decoder::ColorFormat color_format, unsigned planes, bool keep_original) {
+    // A sample failing the content decode is replaced with the next sample of the stream, like a sample failing the header decode
+    bool replaced = false;
+    for (size_t i = 0; i < _batch_size; i++) {
+        std::string failure = "content decode failed";
+        while (!content_decoded[i]) {
+            if (_sample_quarantine) {
+                _sample_quarantine->add(_sample_keys[i], failure);
+            } else {
+                WRN("Jpeg " + failure + " for " + _image_names[i])
+            }
+            if (!read_next_sample(i))
+                break;
+            _skipped_count++;  // The failed sample leaves the batch, the next one takes its slot
+            replaced = true;
+            if (_frame_cache) {
+                // The frame is kept out of the cache, the slots repeating the failed frame get the replacement under the path of the failed one
+                _frame_position[i] = _sequence_reader->last_position();
+                _frame_source[i] = FRAME_FAILED;
+            }
+            if (!decode_header(i)) {
+                failure = "header decode failed";
+                continue;
+            }
+            failure = "content decode failed";
+            content_decoded[i] = decode_sample(i, max_decoded_width, max_decoded_height, color_format, keep_original);
+        }
+    }
+    bool out_of_samples = std::find(content_decoded.begin(), content_decoded.end(), 0) != content_decoded.end();
+    if (!replaced && !out_of_samples)
+        return;
+
+    // Only when the stream has run out, the failed samples are substituted with a sample decoded in its own slot of the same batch
+    size_t valid_idx = 0;
+    while (valid_idx < _batch_size && (!content_decoded[valid_idx] ||
+                                       (_frame_cache && _frame_source[valid_idx] != FRAME_DECODED && _frame_source[valid_idx] != FRAME_FAILED)))
+        valid_idx++;
+    if (valid_idx == _batch_size)
+        THROW("All images in the batch failed decoding\n");
+    for (size_t i = 0; i < _batch_size; i++) {
+        if (content_decoded[i])
+            continue;
+        _image_names[i] = _image_names[valid_idx];
+        _sample_keys[i] = _sample_keys[valid_idx];
+    }
+    if (_randombboxcrop_meta_data_reader) {
+        // The crop coordinates were drawn for the names of the batch before the replacements, the batch is decoded again with new ones
+        _bbox_coords = _randombboxcrop_meta_data_reader->get_batch_crop_coords(_image_names);
+        set_batch_random_bbox_crop_coords(_bbox_coords);
+#pragma omp parallel for num_threads(_num_threads)
+        for (size_t i = 0; i < _batch_size; i++)
+            if (content_decoded[i])
+                decode_sample(i, max_decoded_width, max_decoded_height, color_format, keep_original);  // Decoded before, only the crop changes
+    }
+    const size_t stride = max_decoded_width * planes;
+    for (size_t i = 0; i < _batch_size; i++) {
+        if (content_decoded[i])
+            continue;
+        const size_t row_size = _actual_decoded_width[valid_idx] * planes;
+        for (size_t row = 0; row < _actual_decoded_height[valid_idx]; row++)
+            memcpy(_decompressed_buff_ptrs[i] + row * stride, _decompressed_buff_ptrs[valid_idx] + row * stride, row_size);
+        _actual_decoded_width[i] = _actual_decoded_width[valid_idx];
+        _actual_decoded_height[i] = _actual_decoded_height[valid_idx];
+        _original_width[i] = _original_width[valid_idx];
+        _original_height[i] = _original_height[valid_idx];
+        if (_frame_cache)
+            _frame_source[i] = FRAME_FAILED;  // Holds its substitute, which is not cached under the path of the failed frame
+    }
+}
+
+void ImageReadAndDecode::share_frame(size_t dst_idx, size_t src_idx) {
+    // A slot repeating a frame points at the slot that holds it, never at another repeating slot
+    _frame_source[dst_idx] = _frame_source[src_idx] < 0 && _frame_source[src_idx] != FRAME_CACHED ? src_idx : _frame_source[src_idx];
+    _cached_frames[dst_idx] = _cached_frames[src_idx];
+    _frame_position[dst_idx] = _frame_position[src_idx];
+    _image_names[dst_idx] = _image_names[src_idx];
+    _sample_keys[dst_idx] = _sample_keys[src_idx];
+}
+
+size_t ImageReadAndDecode::read_sequence_frames() {
+    // The cache only holds frames of the current pass over the frames
+    if (_sequence_reader->next_position() < _frame_cache_position)
+        _frame_cache->clear();
+    std::unordered_map<std::string, size_t> batch_slots;  // First slot of each frame of the batch
+    size_t loaded = 0;
+    while ((loaded != _batch_size) && _reader->count_items() > 0) {
+        const std::string &path = _sequence_reader->frame_path(_sequence_reader->next_position());
+        auto slot = batch_slots.find(path);
+        const DecodedFrameCache::Frame *frame = slot == batch_slots.end() ? _frame_cache->find(path) : nullptr;
+        if (slot != batch_slots.end() || frame) {
+            _sequence_reader->skip();
+            if (frame) {
+                _frame_source[loaded] = FRAME_CACHED;
+                _cached_frames[loaded] = frame;
+                _image_names[loaded] = _reader->id();
+                _sample_keys[loaded] = _reader->quarantine_key();
+                batch_slots.emplace(path, loaded);
+            } else {
+                share_frame(loaded, slot->second);
+            }
+            _frame_position[loaded] = _sequence_reader->last_position();
+            _frame_cache_hits++;
+            loaded++;
+            continue;
+        }
+        if (!read_next_sample(loaded))
+            break;
+        if (!decode_header(loaded)) {
+            if (_sample_quarantine) {
+                _sample_quarantine->add(_sample_keys[loaded], "header decode failed");
+            } else {
+                WRN("Jpeg header decode failed for " + _image_names[loaded])
+            }
+            _skipped_count++;
+            continue;
+        }
+        _frame_source[loaded] = FRAME_DECODED;
+        _frame_position[loaded] = _sequence_reader->last_position();
+        batch_slots.emplace(_sequence_reader->frame_path(_frame_position[loaded]), loaded);
+        _frame_cache_misses++;
+        loaded++;
+    }
+    return loaded;
+}
+
+void ImageReadAndDecode::fill_shared_frames(size_t max_decoded_width, unsigned planes) {
+    const size_t stride = max_decoded_width * planes;
+    // Cached frames are copied first, a slot repeating a frame of the batch may repeat a cached one
+#pragma omp parallel for num_threads(_num_threads)
+    for (size_t i = 0; i < _batch_size; i++) {
+        if (_frame_source[i] != FRAME_CACHED)
+            continue;
+        auto frame = _cached_frames[i];
+        const size_t row_size = frame->width * planes;
+        for (size_t row = 0; row < frame->height; row++)
+            memcpy(_decompressed_buff_ptrs[i] + row * stride, frame->pixels.data() + row * row_size, row_size);
+        _actual_decoded_width[i] = frame->width;
+        _actual_decoded_height[i] = frame->height;
+        _original_width[i] = frame->original_width;
+        _original_height[i] = frame->original_height;
+    }
+#pragma omp parallel for num_threads(_num_threads)
+    for (size_t i = 0; i < _batch_size; i++) {
+        if (_frame_source[i] < 0)
+            continue;
+        size_t src = _frame_source[i];
+        const size_t row_size = _actual_decoded_width[src] * planes;
+        for (size_t row = 0; row < _actual_decoded_height[src]; row++)
+            memcpy(_decompressed_buff_ptrs[i] + row * stride, _decompressed_buff_ptrs[src] + row * stride, row_size);
+        _actual_decoded_width[i] = _actual_decoded_width[src];
+        _actual_decoded_height[i] = _actual_decoded_height[src];
+        _original_width[i] = _original_width[src];
+        _original_height[i] = _original_height[src];
+    }
+
+    // The last slot reading a frame decides how long the frame is kept
+    const size_t position = _sequence_reader->next_position();
+    std::unordered_map<std::string, size_t> last_slot;
+    for (size_t i = 0; i < _batch_size; i++)
+        last_slot[_sequence_reader->frame_path(_frame_position[i])] = i;
+    for (auto &slot : last_slot) {
+        size_t i = slot.second;
+        size_t next_use = _sequence_reader->next_use(_frame_position[i]);
+        size_t src = _frame_source[i] >= 0 ? _frame_source[i] : i;
+        if (_frame_source[src] == FRAME_CACHED)
+            _frame_cache->update(slot.first, next_use, position);
+        else if (_frame_source[src] == FRAME_DECODED)
+            _frame_cache->insert(slot.first, _decompressed_buff_ptrs[src], stride, _actual_decoded_width[src], _actual_decoded_height[src], planes,
+                                 _original_width[src], _original_height[src], next_use, position);
+    }
+    _frame_cache->drop_passed(position);
+    _frame_cache_position = position;
+}
+
+void ImageReadAndDecode::set_decode_hint(const DecodeHint &hint) {
+    std::unique_lock<std::mutex> lock(_decode_hint_lock);
+    _pending_decode_hint = hint;
+    _decode_hint_changed = true;
+}
+
 LoaderModuleStatus
 ImageReadAndDecode::load(unsigned char *buff,
                          std::vector<std::string> &names,
@@ -179,6 +505,16 @@ ImageReadAndDecode::load(unsigned char *buff,
         THROW("Null pointer passed as output buffer")
     if (_reader->count_items() < _batch_size)
         return LoaderModuleStatus::NO_MORE_DATA_TO_READ;
+    _skipped_count = 0;
+    {
+        std::unique_lock<std::mutex> lock(_decode_hint_lock);
+        if (_decode_hint_changed) {
+            _decoder_config.set_decode_hint(_pending_decode_hint);
+            _decode_hint_changed = false;
+            if (_frame_cache)  // The cached frames were decoded with the previous hint
+                _frame_cache->clear();
+        }
+    }
     // load images/frames from the disk and push them as a large image onto the buff
     unsigned file_counter = 0;
     const auto ret = interpret_color_format(output_color_format);
@@ -200,11 +536,19 @@ ImageReadAndDecode::load(unsigned char *buff,
             }
 
             _actual_read_size[file_counter] = _reader->read_data(read_ptr, fsize);
-            if (_actual_read_size[file_counter] < fsize)
-                LOG("Reader read less than requested bytes of size: " + _actual_read_size[file_counter]);
-
-            _image_names[file_counter] = _reader->id();
-            _reader->close();
+            if (_actual_read_size[file_counter] == 0) {  // Record rejected by the record check
+                _reader->close();
+                if (file_counter == 0 || !_record_check || _record_check->policy() != RecordCheckPolicy::SUBSTITUTE)
+                    continue;
+                memcpy(read_ptr, read_ptr - image_size, _actual_read_size[file_counter - 1]);
+                _actual_read_size[file_counter] = _actual_read_size[file_counter - 1];
+                _image_names[file_counter] = _image_names[file_counter - 1];
+            } else {
+                if (_actual_read_size[file_counter] < fsize)
+                    LOG("Reader read less than requested bytes of size: " + _actual_read_size[file_counter]);
+                _image_names[file_counter] = _reader->id();
+                _reader->close();
+            }
             // _compressed_image_size[file_counter] = fsize;
             names[file_counter] = _image_names[file_counter];
             roi_width[file_counter] = max_decoded_width;
@@ -243,36 +587,23 @@ ImageReadAndDecode::load(unsigned char *buff,
             }
             skip_decode = true;
         } else {
-            while ((file_counter != _batch_size) && _reader->count_items() > 0) {
-                _reader->count_items();
-                size_t fsize = _reader->open();
-                if (fsize == 0) {
-                    WRN("Opened file " + _reader->id() + " of size 0");
-                    continue;
-                }
-                _compressed_buff[file_counter].reserve(fsize);
-                _actual_read_size[file_counter] = _reader->read_data(_compressed_buff[file_counter].data(), fsize);
-                _image_names[file_counter] = _reader->id();
-                _reader->close();
-                _compressed_image_size[file_counter] = fsize;
+            while ((file_counter != _batch_size) && read_next_sample(file_counter))
                 file_counter++;
-            }
+            complete_batch(file_counter);
+            if (_decoder_config._type != DecoderType::ROCJPEG_DEC)
+                validate_headers();
         }
         // return LoaderModuleStatus::OK;
     } else {
-        while ((file_counter != _batch_size) && _reader->count_items() > 0) {
-            size_t fsize = _reader->open();
-            if (fsize == 0) {
-                WRN("Opened file " + _reader->id() + " of size 0");
-                continue;
-            }
-            _compressed_buff[file_counter].reserve(fsize);
-            _actual_read_size[file_counter] = _reader->read_data(_compressed_buff[file_counter].data(), fsize);
-            _image_names[file_counter] = _reader->id();
-            _reader->close();
-            _compressed_image_size[file_counter] = fsize;
-            file_counter++;
+        if (_frame_cache) {
+            file_counter = read_sequence_frames();  // The headers are decoded as the frames are read
+        } else {
+            while ((file_counter != _batch_size) && read_next_sample(file_counter))
+                file_counter++;
         }
+        complete_batch(file_counter);
+        if (_decoder_config._type != DecoderType::ROCJPEG_DEC && !_frame_cache)
+            validate_headers();
         if (_randombboxcrop_meta_data_reader) {
             // Fetch the crop co-ordinates for a batch of images
             _bbox_coords = _randombboxcrop_meta_data_reader->get_batch_crop_coords(_image_names);
@@ -290,54 +621,17 @@ ImageReadAndDecode::load(unsigned char *buff,
             _decompressed_buff_ptrs[i] = buff + image_size * i;
 
         if (_decoder_config._type != DecoderType::ROCJPEG_DEC) {
+            std::vector<int> content_decoded(_batch_size, 1);
 #pragma omp parallel for num_threads(_num_threads)
             for (size_t i = 0; i < _batch_size; i++) {
-                // initialize the actual decoded height and width with the maximum
-                _actual_decoded_width[i] = max_decoded_width;
-                _actual_decoded_height[i] = max_decoded_height;
-                int original_width, original_height, jpeg_sub_samp;
-                if (_decoder[i]->decode_info(_compressed_buff[i].data(), _actual_read_size[i], &original_width, &original_height,
-                                            &jpeg_sub_samp) != Decoder::Status::OK) {
-                    // Substituting the image which failed decoding with other image from the same batch
-                    int j = ((i + 1) != _batch_size) ? _batch_size - 1 : _batch_size - 2;
-                    while ((j >= 0)) {
-                        if (_decoder[i]->decode_info(_compressed_buff[j].data(), _actual_read_size[j], &original_width, &original_height,
-                                                    &jpeg_sub_samp) == Decoder::Status::OK) {
-                            _image_names[i] = _image_names[j];
-                            _compressed_buff[i] = _compressed_buff[j];
-                            _actual_read_size[i] = _actual_read_size[j];
-                            _compressed_image_size[i] = _compressed_image_size[j];
-                            break;
-
-                        } else
-                            j--;
-                        if (j < 0) {
-                            THROW("All images in the batch failed decoding\n");
-                        }
-                    }
-                }
-                _original_height[i] = original_height;
-                _original_width[i] = original_width;
-                // decode the image and get the actual decoded image width and height
-                size_t scaledw, scaledh;
-                if (_decoder[i]->is_partial_decoder()) {
-                    if (_randombboxcrop_meta_data_reader) {
-                        _decoder[i]->set_bbox_coords(_bbox_coords[i]);
-                    } else if (_random_crop_dec_param) {
-                        Shape dec_shape = {_original_height[i], _original_width[i]};
-                        auto crop_window = _random_crop_dec_param->generate_crop_window(dec_shape, i);
-                        _decoder[i]->set_crop_window(crop_window);
-                    }
-                }
-                if (_decoder[i]->decode(_compressed_buff[i].data(), _compressed_image_size[i], _decompressed_buff_ptrs[i],
-                                        max_decoded_width, max_decoded_height,
-                                        original_width, original_height,
-                                        scaledw, scaledh,
-                                        decoder_color_format, _decoder_config, keep_original) != Decoder::Status::OK) {
-                }
-                _actual_decoded_width[i] = scaledw;
-                _actual_decoded_height[i] = scaledh;
+                if (_frame_cache && _frame_source[i] != FRAME_DECODED)
+                    continue;
+                // The headers are already decoded by validate_headers() and the original dims are set
+                content_decoded[i] = decode_sample(i, max_decoded_width, max_decoded_height, decoder_color_format, keep_original);
             }
+            replace_undecoded_samples(content_decoded, max_decoded_width, max_decoded_height, decoder_color_format, output_planes, keep_original);
+            if (_frame_cache)
+                fill_shared_frames(max_decoded_width, output_planes);
         } else if (_decoder_config._type == DecoderType::ROCJPEG_DEC) {
 #if ENABLE_HIP
             // Set device ID for load routine thread once
@@ -358,6 +652,8 @@ ImageReadAndDecode::load(unsigned char *buff,
                 if (_rocjpeg_decoder->decode_info(_compressed_buff[i].data(), _actual_read_size[i], &original_width, &original_height,
                                             &decoded_width, &decoded_height, 
                                             max_decoded_width, max_decoded_height, decoder_color_format, i) != Decoder::Status::OK) {
+                    if (_sample_quarantine)
+                        _sample_quarantine->add(_sample_keys[i], "header decode failed");
                     // Substituting the image which failed decoding with other image from the same batch
                     int j = ((i + 1) != _batch_size) ? _batch_size - 1 : _batch_size - 2;
                     while ((j >= 0)) {
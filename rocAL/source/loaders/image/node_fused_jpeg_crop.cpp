@@ -43,6 +43,7 @@ void FusedJpegCropNode::init(unsigned internal_shard_count, unsigned cpu_num_thr
     reader_cfg.set_batch_count(load_batch_count);
     reader_cfg.set_meta_data_reader(meta_data_reader);
     reader_cfg.set_sharding_info(sharding_info);
+    reader_cfg.set_seed(ParameterFactory::instance()->get_seed());
     auto decoder_cfg = DecoderConfig(decoder_type);
 
     decoder_cfg.set_random_area(random_area);
@@ -52,7 +53,6 @@ void FusedJpegCropNode::init(unsigned internal_shard_count, unsigned cpu_num_thr
     _loader_module->initialize(reader_cfg, decoder_cfg,
                                mem_type,
                                _batch_size);
-    _loader_module->start_loading();
 }
 
 std::shared_ptr<LoaderModule> FusedJpegCropNode::get_loader_module() {
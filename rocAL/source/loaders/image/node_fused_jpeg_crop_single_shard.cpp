@@ -46,6 +46,7 @@ void FusedJpegCropSingleShardNode::init(unsigned shard_id, unsigned shard_count,
     reader_cfg.set_batch_count(load_batch_count);
     reader_cfg.set_meta_data_reader(meta_data_reader);
     reader_cfg.set_sharding_info(sharding_info);
+    reader_cfg.set_seed(ParameterFactory::instance()->get_seed());
     auto decoder_cfg = DecoderConfig(decoder_type);
 
     decoder_cfg.set_random_area(area_factor);
@@ -55,7 +56,6 @@ void FusedJpegCropSingleShardNode::init(unsigned shard_id, unsigned shard_count,
     _loader_module->initialize(reader_cfg, decoder_cfg,
                                mem_type,
                                _batch_size);
-    _loader_module->start_loading();
 }
 
 std::shared_ptr<LoaderModule> FusedJpegCropSingleShardNode::get_loader_module() {
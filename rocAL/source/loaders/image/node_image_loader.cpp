@@ -22,6 +22,7 @@ THE SOFTWARE.
 
 #include "loaders/image/node_image_loader.h"
 
+#include "parameters/parameter_factory.h"
 #include "pipeline/exception.h"
 
 ImageLoaderNode::ImageLoaderNode(Tensor *output, void *device_resources) : Node({}, {output}) {
@@ -50,10 +51,10 @@ void ImageLoaderNode::init(unsigned internal_shard_count, unsigned cpu_num_threa
     reader_cfg.set_external_filemode(external_file_mode);
     reader_cfg.set_index_path(index_path);
     reader_cfg.set_sharding_info(sharding_info);
+    reader_cfg.set_seed(ParameterFactory::instance()->get_seed());
     _loader_module->initialize(reader_cfg, DecoderConfig(decoder_type),
                                mem_type,
                                _batch_size, decoder_keep_orig);
-    _loader_module->start_loading();
 }
 
 std::shared_ptr<LoaderModule> ImageLoaderNode::get_loader_module() {
@@ -22,6 +22,7 @@ THE SOFTWARE.
 
 #include "loaders/image/node_image_loader_single_shard.h"
 
+#include "parameters/parameter_factory.h"
 #include "pipeline/exception.h"
 
 ImageLoaderSingleShardNode::ImageLoaderSingleShardNode(Tensor *output, void *device_resources) : Node({}, {output}) {
@@ -52,10 +53,10 @@ void ImageLoaderSingleShardNode::init(unsigned shard_id, unsigned shard_count, u
     reader_cfg.set_external_filemode(external_file_mode);
     reader_cfg.set_index_path(index_path);
     reader_cfg.set_sharding_info(sharding_info);
+    reader_cfg.set_seed(ParameterFactory::instance()->get_seed());
     _loader_module->initialize(reader_cfg, DecoderConfig(decoder_type),
                                mem_type,
                                _batch_size, decoder_keep_original);
-    _loader_module->start_loading();
 }
 
 std::shared_ptr<LoaderModule> ImageLoaderSingleShardNode::get_loader_module() {
@@ -64,6 +65,12 @@ std::shared_ptr<LoaderModule> ImageLoaderSingleShardNode::get_loader_module() {
     return _loader_module;
 }
 
+void ImageLoaderSingleShardNode::set_shared_data_service(const std::string &service_name, unsigned consumer_count) {
+    if (!_loader_module)
+        THROW("ERROR: loader module is not set for ImageLoaderNode, cannot attach to the shared data service")
+    _loader_module->set_shared_data_service(service_name, consumer_count);
+}
+
 ImageLoaderSingleShardNode::~ImageLoaderSingleShardNode() {
     _loader_module = nullptr;
 }
@@ -28,8 +28,9 @@ NumpyLoaderSingleShardNode::NumpyLoaderSingleShardNode(Tensor *output, void *dev
     _loader_module = std::make_shared<NumpyLoader>(device_resources);
 }
 
-void NumpyLoaderSingleShardNode::init(unsigned shard_id, unsigned shard_count, const std::string &source_path, const std::vector<std::string> &files, StorageType storage_type, DecoderType decoder_type,
-                                      bool shuffle, bool loop, size_t load_batch_count, RocalMemType mem_type, unsigned seed, const ShardingInfo& sharding_info) {
+void NumpyLoaderSingleShardNode::init(unsigned shard_id, unsigned shard_count, unsigned cpu_num_threads, const std::string &source_path, const std::vector<std::string> &files, StorageType storage_type, DecoderType decoder_type,
+                                      bool shuffle, bool loop, size_t load_batch_count, RocalMemType mem_type, unsigned seed, const ShardingInfo& sharding_info,
+                                      const std::vector<int> &roi_start, const std::vector<int> &roi_shape) {
     if (!_loader_module)
         THROW("ERROR: loader module is not set for NumpyLoaderSingleShardNode, cannot initialize")
     if (shard_count < 1)
@@ -44,9 +45,10 @@ void NumpyLoaderSingleShardNode::init(unsigned shard_id, unsigned shard_count, c
     reader_cfg.set_batch_count(load_batch_count);
     reader_cfg.set_files_list(files);
     reader_cfg.set_seed(seed);
+    reader_cfg.set_cpu_num_threads(cpu_num_threads);
+    reader_cfg.set_numpy_roi(roi_start, roi_shape);
     reader_cfg.set_sharding_info(sharding_info);
     _loader_module->initialize(reader_cfg, DecoderConfig(DecoderType::SKIP_DECODE), mem_type, _batch_size);
-    _loader_module->start_loading();
 }
 
 std::shared_ptr<LoaderModule> NumpyLoaderSingleShardNode::get_loader_module() {
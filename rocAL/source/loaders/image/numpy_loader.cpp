@@ -22,6 +22,7 @@ THE SOFTWARE.
 
 #include "loaders/image/numpy_loader.h"
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
@@ -86,6 +87,28 @@ void NumpyLoader::reset() {
     start_loading();
 }
 
+LoaderState NumpyLoader::get_state() {
+    LoaderState state;
+    state.readers.push_back(_output_reader_state);
+    state.epochs.push_back(0);
+    return state;
+}
+
+void NumpyLoader::set_state(const LoaderState& state) {
+    if (state.readers.size() != 1)
+        THROW("Loader state holds " + TOSTR(state.readers.size()) + " readers, expected 1")
+    // Drop the prefetched batches, they were read past the restored position
+    _internal_thread_running = false;
+    _circ_buff.unblock_writer();
+    if (_load_thread.joinable())
+        _load_thread.join();
+    _circ_buff.reset();
+
+    _file_counter = 0;
+    _reader->set_state(state.readers[0]);
+    start_loading();
+}
+
 void NumpyLoader::de_init() {
     // Set running to 0 and wait for the internal thread to join
     stop_internal_thread();
@@ -129,12 +152,17 @@ void NumpyLoader::initialize(ReaderConfig reader_cfg, DecoderConfig decoder_cfg,
     _output_names.resize(batch_size);
     try {
         _reader = create_reader(reader_cfg);
+        _numpy_reader = std::dynamic_pointer_cast<NumpyDataReader>(_reader);
+        if (!_numpy_reader)
+            THROW("NumpyLoader needs a numpy reader")
     } catch (const std::exception &e) {
         de_init();
         throw;
     }
     _decoded_data_info._data_names.resize(_batch_size);
     _tensor_roi.resize(_batch_size);
+    _samples.resize(_batch_size);
+    _num_threads = std::max<size_t>(reader_cfg.get_cpu_num_threads(), 1);
     _circ_buff.init(_mem_type, _output_mem_size, _prefetch_queue_depth);
     _is_initialized = true;
     LOG("Loader module initialized");
@@ -145,6 +173,7 @@ void NumpyLoader::start_loading() {
         THROW("start_loading() should be called after initialize() function is called")
 
     _remaining_file_count = _reader->count_items();
+    _output_reader_state = _reader->get_state();
     _internal_thread_running = true;
     _load_thread = std::thread(&NumpyLoader::load_routine, this);
 }
@@ -174,20 +203,18 @@ NumpyLoader::load_routine() {
             unsigned file_counter = 0;
             _file_load_time.start();  // Debug timing
 
+            // Only the headers are parsed here, the data is copied out of the mapped files by all the threads below
             while ((file_counter != _batch_size) && _reader->count_items() > 0) {
-                auto read_ptr = data + _tensor_size * file_counter;
                 size_t read_size = _reader->open();
                 if (read_size == 0) {
                     ERR("Opened file " + _reader->id() + " of size 0");
                     _reader->close();
                     continue;
                 }
-                auto fsize = _reader->read_numpy_data(read_ptr, read_size, strides_in_dims);
-                if (fsize == 0) {
-                    ERR("Cannot read numpy data from " + _reader->id());
-                    _reader->close();
-                    continue;
-                }
+                _samples[file_counter] = _numpy_reader->current_sample();
+                const auto& header = _samples[file_counter].header;
+                if (read_size == header.numpy_data_nbytes())  // Only read ahead whole arrays, slabs only touch the pages they need
+                    _samples[file_counter].file->prefetch(header.data_offset, read_size);
                 _decoded_data_info._data_names[file_counter] = _reader->id();
                 auto original_roi = _reader->get_numpy_header_data().shape();
                 // The numpy header data contains the full array shape. We require only width and height for ROI updation
@@ -201,7 +228,14 @@ NumpyLoader::load_routine() {
                 _reader->close();
                 file_counter++;
             }
+#pragma omp parallel for num_threads(_num_threads)
+            for (size_t i = 0; i < file_counter; i++) {
+                if (copy_numpy_sample(_samples[i], data + _tensor_size * i, strides_in_dims) == 0)
+                    ERR("Cannot read numpy data from " + _decoded_data_info._data_names[i]);
+                _samples[i].file = nullptr;  // Unmaps the file
+            }
             _file_load_time.end();  // Debug timing
+            _decoded_data_info._reader_state = _reader->get_state();
             _circ_buff.set_decoded_data_info(_decoded_data_info);
             _circ_buff.push();
             _file_counter += _output_tensor->info().batch_size();
@@ -267,6 +301,7 @@ NumpyLoader::update_output_tensor() {
 
     _output_decoded_data_info = _circ_buff.get_decoded_data_info();
     _output_names = _output_decoded_data_info._data_names;
+    _output_reader_state = _output_decoded_data_info._reader_state;
     _output_tensor->update_tensor_roi(_tensor_roi);
     _circ_buff.pop();
     if (!_loop)
@@ -77,6 +77,7 @@ void NumpyLoaderSharded::initialize(ReaderConfig reader_cfg, DecoderConfig decod
     for (size_t i = 0; i < _shard_count; i++) {
         std::shared_ptr loader = std::make_shared<NumpyLoader>(_dev_resources);
         loader->set_prefetch_queue_depth(_prefetch_queue_depth);
+        loader->set_host_memory_arena(_host_arena);
         _loaders.push_back(loader);
     }
     // Initialize loader modules
@@ -115,6 +116,30 @@ void NumpyLoaderSharded::reset() {
     for (auto& loader : _loaders)
         loader->reset();
 }
+LoaderState NumpyLoaderSharded::get_state() {
+    LoaderState state;
+    for (auto& loader : _loaders) {
+        auto loader_state = loader->get_state();
+        if (loader_state.readers.empty())
+            return {};
+        state.readers.push_back(loader_state.readers[0]);
+        state.epochs.push_back(loader_state.epochs[0]);
+    }
+    state.loader_idx = _loader_idx;
+    return state;
+}
+
+void NumpyLoaderSharded::set_state(const LoaderState& state) {
+    if (state.readers.size() != _loaders.size())
+        THROW("Loader state holds " + TOSTR(state.readers.size()) + " shards, the loader has " + TOSTR(_loaders.size()))
+    for (size_t idx = 0; idx < _loaders.size(); idx++) {
+        LoaderState loader_state;
+        loader_state.readers.push_back(state.readers[idx]);
+        _loaders[idx]->set_state(loader_state);
+    }
+    _loader_idx = state.loader_idx % _shard_count;
+}
+
 void NumpyLoaderSharded::increment_loader_idx() {
     _loader_idx = (_loader_idx + 1) % _shard_count;
 }
@@ -0,0 +1,427 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "loaders/image/shared_image_source.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+SharedDataService *SharedDataService::_instance = nullptr;
+std::mutex SharedDataService::_instance_mutex;
+
+SharedDataService *SharedDataService::instance() {
+    if (_instance == nullptr) {
+        std::lock_guard<std::mutex> lock(_instance_mutex);
+        if (_instance == nullptr) {
+            _instance = new SharedDataService();
+        }
+    }
+    return _instance;
+}
+
+std::shared_ptr<SharedImageSource> SharedDataService::acquire(const std::string &service_name, unsigned consumer_count) {
+    if (service_name.empty())
+        THROW("Shared data service name cannot be empty")
+    if (consumer_count == 0)
+        THROW("Shared data service " + service_name + " needs at least one consumer")
+    std::lock_guard<std::mutex> lock(_lock);
+    auto it = _sources.find(service_name);
+    if (it != _sources.end()) {
+        if (auto source = it->second.lock())
+            return source;
+    }
+    auto source = std::make_shared<SharedImageSource>(service_name, consumer_count);
+    _sources[service_name] = source;
+    return source;
+}
+
+SharedImageSource::SharedImageSource(const std::string &service_name, unsigned consumer_count) : _service_name(service_name),
+                                                                                                   _expected_consumers(consumer_count) {
+}
+
+SharedImageSource::~SharedImageSource() {
+    std::unique_lock<std::mutex> lock(_lock);
+    stop_internal_thread(lock);
+    for (auto &consumer : _consumers)
+        free(consumer.second.private_buffer);
+    _consumers.clear();
+    for (auto &slot : _slots)
+        free(slot.data);
+    _slots.clear();
+    _image_loader = nullptr;
+}
+
+std::string SharedImageSource::make_config_key(ReaderConfig &reader_cfg, DecoderConfig &decoder_cfg, unsigned batch_size, size_t output_mem_size,
+                                               size_t max_width, size_t max_height, RocalColorFormat color_format, bool decoder_keep_original) {
+    return TOSTR((int)reader_cfg.type()) + ":" + reader_cfg.path() + ":" + reader_cfg.json_path() + ":" + reader_cfg.file_list_path() + ":" +
+           TOSTR(reader_cfg.shuffle()) + ":" + TOSTR(reader_cfg.loop()) + ":" + TOSTR(reader_cfg.get_shard_id()) + "/" + TOSTR(reader_cfg.get_shard_count()) + ":" +
+           TOSTR((int)decoder_cfg.type()) + ":" + TOSTR(batch_size) + ":" + TOSTR(output_mem_size) + ":" + TOSTR(max_width) + "x" + TOSTR(max_height) + ":" +
+           TOSTR((int)color_format) + ":" + TOSTR(decoder_keep_original);
+}
+
+std::shared_ptr<ImageReadAndDecode> SharedImageSource::create_loader() {
+    auto loader = std::make_shared<ImageReadAndDecode>();
+    loader->create(*_reader_cfg, _decoder_cfg, _batch_size);
+    return loader;
+}
+
+void SharedImageSource::init_data_info(DecodedDataInfo &info) {
+    info._data_names.resize(_batch_size);
+    info._roi_width.resize(_batch_size);
+    info._roi_height.resize(_batch_size);
+    info._original_width.resize(_batch_size);
+    info._original_height.resize(_batch_size);
+}
+
+unsigned char *SharedImageSource::allocate_buffer() {
+    // a minimum of extra MEM_ALIGNMENT is allocated, as for the circular buffer slots
+    const size_t MEM_ALIGNMENT = 256;
+    auto buffer = static_cast<unsigned char *>(aligned_alloc(MEM_ALIGNMENT, MEM_ALIGNMENT * (_output_mem_size / MEM_ALIGNMENT + 1)));
+    if (!buffer)
+        THROW("Shared data service " + _service_name + " could not allocate a batch of " + TOSTR(_output_mem_size) + " bytes")
+    return buffer;
+}
+
+unsigned SharedImageSource::attach(ReaderConfig reader_cfg, DecoderConfig decoder_cfg, unsigned batch_size, size_t output_mem_size,
+                                   size_t max_width, size_t max_height, RocalColorFormat color_format, bool decoder_keep_original, size_t window_depth) {
+    if (window_depth == 0)
+        THROW("The window of the shared data service " + _service_name + " should hold at least one batch")
+    std::lock_guard<std::mutex> lock(_lock);
+    if (_started)
+        THROW("Cannot attach to the shared data service " + _service_name + " after it has started loading")
+    if (_consumers.size() >= _expected_consumers)
+        THROW("Shared data service " + _service_name + " already has " + TOSTR(_expected_consumers) + " consumers attached")
+    auto config_key = make_config_key(reader_cfg, decoder_cfg, batch_size, output_mem_size, max_width, max_height, color_format, decoder_keep_original);
+    if (!_image_loader) {
+        _reader_cfg = std::make_shared<ReaderConfig>(reader_cfg);
+        _decoder_cfg = decoder_cfg;
+        _batch_size = batch_size;
+        _image_loader = create_loader();
+        _items_per_pass = _image_loader->count();
+        _config_key = config_key;
+        _output_mem_size = output_mem_size;
+        _max_width = max_width;
+        _max_height = max_height;
+        _color_format = color_format;
+        _decoder_keep_original = decoder_keep_original;
+        _window_depth = window_depth;
+        init_data_info(_decoded_data_info);
+        _head = StreamPosition(0, 0);
+        _pass_states[0].push_back(_image_loader->get_reader_state());
+    } else if (_config_key != config_key) {
+        THROW("Loader configuration does not match the one used by the other consumers of the shared data service " + _service_name)
+    }
+    _consumers[_next_consumer_id] = Consumer();
+    LOG("Consumer " + TOSTR(_next_consumer_id) + " attached to the shared data service " + _service_name)
+    return _next_consumer_id++;
+}
+
+void SharedImageSource::detach(unsigned consumer_id) {
+    std::unique_lock<std::mutex> lock(_lock);
+    auto it = _consumers.find(consumer_id);
+    if (it == _consumers.end())
+        return;
+    // Give back the batch the consumer holds and the ones it still had to read
+    release_held(it->second);
+    for (auto &slot : _slots)
+        if (slot.valid && slot.refs && !(slot.position < it->second.cursor))
+            slot.refs--;
+    free(it->second.private_buffer);
+    _consumers.erase(it);
+    _expected_consumers--;
+    drop_pass_states();
+    _slot_freed.notify_all();
+    if (_consumers.empty())
+        stop_internal_thread(lock);
+}
+
+void SharedImageSource::start(unsigned consumer_id) {
+    std::lock_guard<std::mutex> lock(_lock);
+    if (_consumers.find(consumer_id) == _consumers.end())
+        THROW("Consumer " + TOSTR(consumer_id) + " is not attached to the shared data service " + _service_name)
+    // The batches count the consumers that have to read them, so the stream can only start once every consumer is known
+    if (!_started && _consumers.size() == _expected_consumers)
+        start_internal_thread();
+}
+
+void SharedImageSource::reset(unsigned consumer_id) {
+    std::lock_guard<std::mutex> lock(_lock);
+    auto &consumer = _consumers.at(consumer_id);
+    release_held(consumer);
+    move_cursor(consumer, StreamPosition(consumer.cursor.first + 1, 0));
+    // A consumer decoding on its own moves its loader to the next pass the same way the decode thread does
+    if (consumer.private_loader)
+        consumer.private_loader->reset();
+    drop_pass_states();
+}
+
+void SharedImageSource::start_internal_thread() {
+    for (size_t i = 0; i < _window_depth + _expected_consumers; i++) {
+        Slot slot;
+        slot.data = allocate_buffer();
+        init_data_info(slot.info);
+        _slots.push_back(slot);
+    }
+    _started = true;
+    _internal_thread_running = true;
+    _load_thread = std::thread(&SharedImageSource::load_routine, this);
+    _batch_ready.notify_all();
+}
+
+void SharedImageSource::stop_internal_thread(std::unique_lock<std::mutex> &lock) {
+    _internal_thread_running = false;
+    _slot_freed.notify_all();
+    _batch_ready.notify_all();
+    lock.unlock();
+    if (_load_thread.joinable())
+        _load_thread.join();
+    lock.lock();
+}
+
+size_t SharedImageSource::count() {
+    if (!_image_loader)
+        THROW("Shared data service " + _service_name + " has no loader attached")
+    return _items_per_pass;
+}
+
+size_t SharedImageSource::last_batch_padded_size() {
+    return _image_loader ? _image_loader->last_batch_padded_size() : 0;
+}
+
+Timing SharedImageSource::timing() {
+    return _image_loader ? _image_loader->timing() : Timing();
+}
+
+int SharedImageSource::find_slot(const StreamPosition &position) {
+    for (size_t i = 0; i < _slots.size(); i++)
+        if (_slots[i].valid && _slots[i].position == position)
+            return i;
+    return -1;
+}
+
+int SharedImageSource::free_slot() {
+    for (size_t i = 0; i < _slots.size(); i++)
+        if (!_slots[i].valid || _slots[i].refs == 0)
+            return i;
+    return -1;
+}
+
+bool SharedImageSource::head_waiter() {
+    for (auto &consumer : _consumers)
+        if (consumer.second.waiting && consumer.second.cursor == _head)
+            return true;
+    return false;
+}
+
+int SharedImageSource::evict_slot() {
+    // The oldest batch no consumer is holding, the consumers that did not read it yet decode it on their own
+    int oldest = -1;
+    for (size_t i = 0; i < _slots.size(); i++) {
+        bool held = false;
+        for (auto &consumer : _consumers)
+            held |= (consumer.second.held_slot == (int)i);
+        if (!held && (oldest < 0 || _slots[i].position < _slots[oldest].position))
+            oldest = i;
+    }
+    if (oldest >= 0) {
+        LOG("Shared data service " + _service_name + " drops batch " + TOSTR(_slots[oldest].position.second) + " of pass " + TOSTR(_slots[oldest].position.first) + " before all its consumers read it")
+    }
+    return oldest;
+}
+
+void SharedImageSource::release_held(Consumer &consumer) {
+    if (consumer.held_slot < 0)
+        return;
+    _slots[consumer.held_slot].refs--;
+    consumer.held_slot = -1;
+    _slot_freed.notify_all();
+}
+
+void SharedImageSource::move_cursor(Consumer &consumer, const StreamPosition &cursor) {
+    // The batches the consumer skips no longer count it
+    for (auto &slot : _slots)
+        if (slot.valid && slot.refs && !(slot.position < consumer.cursor) && slot.position < cursor)
+            slot.refs--;
+    consumer.cursor = cursor;
+    _slot_freed.notify_all();
+}
+
+void SharedImageSource::drop_pass_states() {
+    uint64_t first_pass = _head.first;
+    for (auto &consumer : _consumers)
+        first_pass = std::min(first_pass, consumer.second.cursor.first);
+    while (!_pass_states.empty() && _pass_states.begin()->first < first_pass)
+        _pass_states.erase(_pass_states.begin());
+}
+
+void SharedImageSource::end_pass() {
+    _image_loader->reset();
+    _head = StreamPosition(_head.first + 1, 0);
+    _pass_states[_head.first].push_back(_image_loader->get_reader_state());
+}
+
+unsigned char *SharedImageSource::next_batch(unsigned consumer_id, DecodedDataInfo &info) {
+    std::unique_lock<std::mutex> lock(_lock);
+    auto &consumer = _consumers.at(consumer_id);
+    release_held(consumer);
+    while (true) {
+        int slot = find_slot(consumer.cursor);
+        if (slot >= 0) {
+            if (consumer.private_loader) {
+                LOG("Consumer " + TOSTR(consumer_id) + " of the shared data service " + _service_name + " reads from the shared batches again")
+                consumer.private_loader = nullptr;
+            }
+            // The reference the consumer had on the batch as a reader is now the one it holds it with
+            consumer.held_slot = slot;
+            consumer.cursor.second++;
+            info = _slots[slot].info;
+            return _slots[slot].data;
+        }
+        if (consumer.private_loader || (_started && consumer.cursor < _head) ||
+            (_started && _head < consumer.cursor && free_slot() < 0))
+            return decode_private(consumer, info, lock);
+        if (_started && !_internal_thread_running)
+            return nullptr;
+        // Waits for the decode thread, which drops the oldest batch nobody holds if the window is full and the consumer is at the head
+        consumer.waiting = true;
+        _slot_freed.notify_all();
+        _batch_ready.wait(lock);
+        consumer.waiting = false;
+    }
+}
+
+unsigned char *SharedImageSource::decode_private(Consumer &consumer, DecodedDataInfo &info, std::unique_lock<std::mutex> &lock) {
+    auto position = consumer.cursor;
+    if (!consumer.private_loader) {
+        // Positions a loader of its own where the consumer is in the stream, the readers replay their shuffles to get there
+        ReaderState state;
+        uint64_t resets = 0;
+        if (position.first > _head.first) {
+            if (position.second != 0)
+                THROW("Consumer of the shared data service " + _service_name + " is past the start of a pass the decode thread did not reach")
+            state = _pass_states.at(_head.first).at(0);
+            resets = position.first - _head.first;
+        } else {
+            state = _pass_states.at(position.first).at(position.second);
+        }
+        LOG("Consumer of the shared data service " + _service_name + " decodes batch " + TOSTR(position.second) + " of pass " + TOSTR(position.first) + " on its own")
+        lock.unlock();
+        auto loader = create_loader();
+        loader->set_reader_state(state);
+        for (uint64_t i = 0; i < resets; i++)
+            loader->reset();
+        if (!consumer.private_buffer)
+            consumer.private_buffer = allocate_buffer();
+        init_data_info(consumer.private_info);
+        lock.lock();
+        consumer.private_loader = loader;
+    }
+    lock.unlock();
+    auto load_status = consumer.private_loader->load(consumer.private_buffer,
+                                                     consumer.private_info._data_names,
+                                                     _max_width,
+                                                     _max_height,
+                                                     consumer.private_info._roi_width,
+                                                     consumer.private_info._roi_height,
+                                                     consumer.private_info._original_width,
+                                                     consumer.private_info._original_height,
+                                                     _color_format, _decoder_keep_original);
+    lock.lock();
+    if (load_status != LoaderModuleStatus::OK)
+        THROW("Consumer of the shared data service " + _service_name + " could not decode batch " + TOSTR(position.second) + " of pass " + TOSTR(position.first) + " on its own")
+    consumer.private_info._epoch_info = {position.first, false};
+    consumer.private_info._reader_state = consumer.private_loader->get_reader_state();
+    consumer.private_info._skipped_count = consumer.private_loader->skipped_count();
+    // The decode thread may have reached the position meanwhile and counted the consumer as a reader
+    move_cursor(consumer, StreamPosition(position.first, position.second + 1));
+    drop_pass_states();
+    info = consumer.private_info;
+    return consumer.private_buffer;
+}
+
+void SharedImageSource::load_routine() {
+    LOG("Started the shared loader thread for " + _service_name + " with " + TOSTR(_consumers.size()) + " consumers");
+    LoaderModuleStatus last_load_status = LoaderModuleStatus::OK;
+    std::unique_lock<std::mutex> lock(_lock);
+    while (_internal_thread_running) {
+        int slot = free_slot();
+        if (slot < 0 && head_waiter())
+            slot = evict_slot();
+        if (slot < 0) {
+            _slot_freed.wait(lock);
+            continue;
+        }
+        // Nobody reads the slot while it is rewritten
+        _slots[slot].valid = false;
+        _slots[slot].refs = 0;
+        auto position = _head;
+        lock.unlock();
+        auto load_status = _image_loader->load(_slots[slot].data,
+                                               _decoded_data_info._data_names,
+                                               _max_width,
+                                               _max_height,
+                                               _decoded_data_info._roi_width,
+                                               _decoded_data_info._roi_height,
+                                               _decoded_data_info._original_width,
+                                               _decoded_data_info._original_height,
+                                               _color_format, _decoder_keep_original);
+        lock.lock();
+        if (load_status == LoaderModuleStatus::OK) {
+            auto &decoded = _slots[slot];
+            decoded.info = _decoded_data_info;
+            decoded.info._epoch_info = {position.first, false};
+            decoded.info._reader_state = _image_loader->get_reader_state();
+            decoded.info._skipped_count = _image_loader->skipped_count();
+            decoded.position = position;
+            decoded.valid = true;
+            for (auto &consumer : _consumers)
+                if (!(position < consumer.second.cursor))
+                    decoded.refs++;
+            // The reader is rewound and reshuffled for the next pass right away, the consumers reset when they are done with theirs
+            if (_image_loader->count() < _batch_size) {
+                end_pass();
+            } else {
+                _head.second++;
+                _pass_states[_head.first].push_back(_image_loader->get_reader_state());
+            }
+            _batch_ready.notify_all();
+        } else {
+            if (last_load_status != load_status) {
+                if (load_status == LoaderModuleStatus::NO_MORE_DATA_TO_READ ||
+                    load_status == LoaderModuleStatus::NO_FILES_TO_READ) {
+                    LOG("Shared data service " + _service_name + " cycled through all images");
+                } else {
+                    ERR("ERROR: Detected error in reading the images for the shared data service " + _service_name);
+                }
+                last_load_status = load_status;
+            }
+            if (load_status == LoaderModuleStatus::NO_MORE_DATA_TO_READ && _head.second > 0) {
+                end_pass();
+                continue;
+            }
+            lock.unlock();
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+            lock.lock();
+        }
+    }
+}
@@ -25,6 +25,8 @@ THE SOFTWARE.
 #include <memory>
 #include <numeric>
 #include <sstream>
+
+#include "parameters/parameter_factory.h"
 #ifdef ROCAL_VIDEO
 
 VideoLoaderNode::VideoLoaderNode(Tensor *output, void *device_resources) : Node({}, {output}) {
@@ -47,8 +49,8 @@ void VideoLoaderNode::init(unsigned internal_shard_count, const std::string &sou
     reader_cfg.set_frame_step(step);
     reader_cfg.set_frame_stride(stride);
     reader_cfg.set_video_properties(video_prop);
+    reader_cfg.set_seed(ParameterFactory::instance()->get_seed());
     _loader_module->initialize(reader_cfg, DecoderConfig(decoder_type), mem_type, _batch_size);
-    _loader_module->start_loading();
 }
 
 std::shared_ptr<LoaderModule> VideoLoaderNode::get_loader_module() {
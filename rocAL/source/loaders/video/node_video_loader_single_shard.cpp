@@ -22,6 +22,7 @@ THE SOFTWARE.
 
 #include "loaders/video/node_video_loader_single_shard.h"
 
+#include "parameters/parameter_factory.h"
 #include "pipeline/exception.h"
 #ifdef ROCAL_VIDEO
 
@@ -48,8 +49,8 @@ void VideoLoaderSingleShardNode::init(unsigned shard_id, unsigned shard_count, c
     reader_cfg.set_frame_step(step);
     reader_cfg.set_frame_stride(stride);
     reader_cfg.set_video_properties(video_prop);
+    reader_cfg.set_seed(ParameterFactory::instance()->get_seed());
     _loader_module->initialize(reader_cfg, DecoderConfig(decoder_type), mem_type, _batch_size);
-    _loader_module->start_loading();
 }
 
 std::shared_ptr<LoaderModule> VideoLoaderSingleShardNode::get_loader_module() {
@@ -88,6 +88,30 @@ void VideoLoader::reset() {
     start_loading();
 }
 
+LoaderState VideoLoader::get_state() {
+    LoaderState state;
+    state.readers.push_back(_output_reader_state);
+    state.epochs.push_back(0);
+    return state;
+}
+
+void VideoLoader::set_state(const LoaderState& state) {
+    if (state.readers.size() != 1)
+        THROW("Loader state holds " + TOSTR(state.readers.size()) + " readers, expected 1")
+    // Drop the prefetched sequences, they were read past the restored position
+    _internal_thread_running = false;
+    _circ_buff.unblock_writer();
+    if (_load_thread.joinable())
+        _load_thread.join();
+    _circ_buff.reset();
+    _sequence_start_framenum_vec.clear();
+    _sequence_frame_timestamps_vec.clear();
+
+    _image_counter = 0;
+    _video_loader->set_reader_state(state.readers[0]);
+    start_loading();
+}
+
 void VideoLoader::de_init() {
     // Set running to 0 and wait for the internal thread to join
     stop_internal_thread();
@@ -161,6 +185,7 @@ void VideoLoader::start_loading() {
     if (!_is_initialized)
         THROW("start_loading() should be called after initialize() function is called")
     _remaining_sequences_count = _video_loader->count();
+    _output_reader_state = _video_loader->get_reader_state();
     _internal_thread_running = true;
     _load_thread = std::thread(&VideoLoader::load_routine, this);
 }
@@ -191,6 +216,7 @@ VideoLoader::load_routine() {
                                               _output_tensor->info().color_format());
 
             if (load_status == LoaderModuleStatus::OK) {
+                _decoded_data_info._reader_state = _video_loader->get_reader_state();
                 _circ_buff.set_decoded_data_info(_decoded_data_info);
                 _circ_buff.push();
                 _image_counter += _output_tensor->info().batch_size();
@@ -251,6 +277,7 @@ VideoLoader::update_output_image() {
         return LoaderModuleStatus::OK;
     _output_decoded_data_info = _circ_buff.get_decoded_data_info();
     _output_names = _output_decoded_data_info._data_names;
+    _output_reader_state = _output_decoded_data_info._reader_state;
     _output_tensor->update_tensor_roi(_output_decoded_data_info._roi_width, _output_decoded_data_info._roi_height);
     _circ_buff.pop();
     if (!_loop)
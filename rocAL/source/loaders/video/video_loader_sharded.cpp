@@ -77,6 +77,7 @@ void VideoLoaderSharded::initialize(ReaderConfig reader_cfg, DecoderConfig decod
     for (size_t i = 0; i < _shard_count; i++) {
         auto loader = std::make_shared<VideoLoader>(_dev_resources);
         loader->set_prefetch_queue_depth(_prefetch_queue_depth);
+        loader->set_host_memory_arena(_host_arena);
         _loaders.push_back(loader);
     }
 
@@ -118,6 +119,30 @@ void VideoLoaderSharded::reset() {
         loader->reset();
 }
 
+LoaderState VideoLoaderSharded::get_state() {
+    LoaderState state;
+    for (auto &loader : _loaders) {
+        auto loader_state = loader->get_state();
+        if (loader_state.readers.empty())
+            return {};
+        state.readers.push_back(loader_state.readers[0]);
+        state.epochs.push_back(loader_state.epochs[0]);
+    }
+    state.loader_idx = _loader_idx;
+    return state;
+}
+
+void VideoLoaderSharded::set_state(const LoaderState &state) {
+    if (state.readers.size() != _loaders.size())
+        THROW("Loader state holds " + TOSTR(state.readers.size()) + " shards, the loader has " + TOSTR(_loaders.size()))
+    for (size_t idx = 0; idx < _loaders.size(); idx++) {
+        LoaderState loader_state;
+        loader_state.readers.push_back(state.readers[idx]);
+        _loaders[idx]->set_state(loader_state);
+    }
+    _loader_idx = state.loader_idx % _shard_count;
+}
+
 void VideoLoaderSharded::increment_loader_idx() {
     _loader_idx = (_loader_idx + 1) % _shard_count;
 }
@@ -22,10 +22,25 @@ THE SOFTWARE.
 #include "meta_data/bounding_box_graph.h"
 
 void BoundingBoxGraph::process(pMetaDataBatch input_meta_data, pMetaDataBatch output_meta_data) {
-    size_t num_meta_nodes = _meta_nodes.size();
-    for (auto &meta_node : _meta_nodes) {
-        meta_node->update_parameters(input_meta_data, output_meta_data);
-        if (--num_meta_nodes > 0)
+    auto meta_node = _meta_nodes.begin();
+    while (meta_node != _meta_nodes.end()) {
+        // Consecutive axis aligned nodes are folded into one transform and applied in a single pass,
+        // the batch is only cloned around the nodes that have to run on their own (rotate, ssd random crop)
+        _transform.reset(input_meta_data->size());
+        bool composed = false;
+        while (meta_node != _meta_nodes.end()) {
+            _transform.set_pad_empty(false);
+            if (!(*meta_node)->compose(_transform)) break;
+            composed = true;
+            meta_node++;
+        }
+        if (composed) {
+            _transform.apply(input_meta_data, output_meta_data);
+        } else {
+            (*meta_node)->update_parameters(input_meta_data, output_meta_data);
+            meta_node++;
+        }
+        if (meta_node != _meta_nodes.end())
             input_meta_data = output_meta_data->clone();
     }
 }
@@ -0,0 +1,96 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "meta_data/keypoint_heatmap_generator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+KeypointHeatmapGenerator::KeypointHeatmapGenerator(unsigned image_width, unsigned image_height, unsigned heatmap_width, unsigned heatmap_height, float sigma, unsigned num_joints)
+    : _image_width(image_width), _image_height(image_height), _heatmap_width(heatmap_width), _heatmap_height(heatmap_height), _sigma(sigma), _num_joints(num_joints) {
+    if (!_image_width || !_image_height)
+        THROW("The output image size of the key points reader must be set to generate heatmaps")
+    if (!_heatmap_width || !_heatmap_height)
+        THROW("The heatmap width and height must be positive")
+    if (_sigma <= 0)
+        THROW("The heatmap sigma must be positive, got " + TOSTR(_sigma))
+    _stride_x = static_cast<float>(_image_width) / _heatmap_width;
+    _stride_y = static_cast<float>(_image_height) / _heatmap_height;
+    _window_radius = 3 * _sigma;
+}
+
+float KeypointHeatmapGenerator::splat_joint(const Joint &joint, float visibility, float *heatmap) const {
+    // Same rounding and window as the HRNet reference target generation
+    int mu_x = static_cast<int>(joint[0] / _stride_x + 0.5f);
+    int mu_y = static_cast<int>(joint[1] / _stride_y + 0.5f);
+    int ul_x = static_cast<int>(mu_x - _window_radius), ul_y = static_cast<int>(mu_y - _window_radius);
+    int br_x = static_cast<int>(mu_x + _window_radius + 1), br_y = static_cast<int>(mu_y + _window_radius + 1);
+    if (ul_x >= static_cast<int>(_heatmap_width) || ul_y >= static_cast<int>(_heatmap_height) || br_x < 0 || br_y < 0)
+        return 0;
+    if (visibility <= 0.5f)
+        return visibility;
+
+    // The Gaussian is separable, so the window is the outer product of one row and one column of weights
+    const float center = std::floor((2 * _window_radius + 1) / 2);
+    const float scale = -1.f / (2 * _sigma * _sigma);
+    const int first_x = std::max(ul_x, 0), end_x = std::min(br_x, static_cast<int>(_heatmap_width));
+    const int first_y = std::max(ul_y, 0), end_y = std::min(br_y, static_cast<int>(_heatmap_height));
+    std::vector<float> weights_x(end_x - first_x);
+    for (int x = first_x; x < end_x; x++) {
+        float d = (x - ul_x) - center;
+        weights_x[x - first_x] = std::exp(d * d * scale);
+    }
+    const float *row_weights = weights_x.data();
+    const int window_width = end_x - first_x;
+    for (int y = first_y; y < end_y; y++) {
+        float d = (y - ul_y) - center;
+        float weight_y = std::exp(d * d * scale);
+        float *row = heatmap + static_cast<size_t>(y) * _heatmap_width + first_x;
+#pragma omp simd
+        for (int x = 0; x < window_width; x++)
+            row[x] = weight_y * row_weights[x];
+    }
+    return visibility;
+}
+
+void KeypointHeatmapGenerator::generate(pMetaDataBatch meta_data, float *heatmaps, float *target_weights) const {
+    if (meta_data->get_metadata_type() != MetaDataType::KeyPoints)
+        THROW("Heatmaps can only be generated from key points meta data")
+    auto &joints_data = meta_data->get_joints_data_batch();
+    const int batch_size = meta_data->size();
+    for (int i = 0; i < batch_size; i++) {  // Checked up front, the joints are drawn in a parallel region which must not throw
+        if (joints_data.joints_batch[i].size() < _num_joints || joints_data.joints_visibility_batch[i].size() < _num_joints)
+            THROW("Sample " + TOSTR(i) + " has fewer than " + TOSTR(_num_joints) + " joints")
+    }
+
+    // Every joint has its own heatmap, so the joints of the whole batch are drawn in parallel
+    const int joint_count = batch_size * _num_joints;
+    const size_t plane_floats = plane_size();
+#pragma omp parallel for schedule(dynamic, 4)
+    for (int n = 0; n < joint_count; n++) {
+        int sample = n / _num_joints, joint = n % _num_joints;
+        float *heatmap = heatmaps + static_cast<size_t>(n) * plane_floats;
+        memset(heatmap, 0, plane_floats * sizeof(float));
+        target_weights[n] = splat_joint(joints_data.joints_batch[sample][joint], joints_data.joints_visibility_batch[sample][joint][0], heatmap);
+    }
+}
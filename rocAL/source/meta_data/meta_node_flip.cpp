@@ -25,36 +25,25 @@ void FlipMetaNode::initialize() {
     _h_flip_val.resize(_batch_size);
     _v_flip_val.resize(_batch_size);
 }
-void FlipMetaNode::update_parameters(pMetaDataBatch input_meta_data, pMetaDataBatch output_meta_data) {
+bool FlipMetaNode::compose(MetaTransform &transform) {
+    _batch_size = transform.size();
     initialize();
-    if (_batch_size != input_meta_data->size()) {
-        _batch_size = input_meta_data->size();
-    }
     auto input_roi = _node->get_src_roi();
     auto h_flag = _node->get_horizontal_flip();
     auto v_flag = _node->get_vertical_flip();
     vxCopyArrayRange((vx_array)h_flag, 0, _batch_size, sizeof(int), _h_flip_val.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
     vxCopyArrayRange((vx_array)v_flag, 0, _batch_size, sizeof(int), _v_flip_val.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
     for (int i = 0; i < _batch_size; i++) {
-        auto bb_count = input_meta_data->get_labels_batch()[i].size();
-        BoundingBoxCords coords_buf = input_meta_data->get_bb_cords_batch()[i];
-        Labels bb_labels = input_meta_data->get_labels_batch()[i];
-        BoundingBoxCords bb_coords;
-        for (uint j = 0; j < bb_count; j++) {
-            if (_h_flip_val[i]) {
-                auto l = coords_buf[j].l;
-                coords_buf[j].l = input_roi[i].xywh.w - coords_buf[j].r;
-                coords_buf[j].r = input_roi[i].xywh.w - l;
-            }
-            if (_v_flip_val[i]) {
-                auto t = coords_buf[j].t;
-                coords_buf[j].t = input_roi[i].xywh.h - coords_buf[j].b;
-                coords_buf[j].b = input_roi[i].xywh.h - t;
-            }
-
-            bb_coords.push_back(coords_buf[j]);
+        float sx = 1, tx = 0, sy = 1, ty = 0;
+        if (_h_flip_val[i]) {
+            sx = -1;
+            tx = input_roi[i].xywh.w;
+        }
+        if (_v_flip_val[i]) {
+            sy = -1;
+            ty = input_roi[i].xywh.h;
         }
-        output_meta_data->get_bb_cords_batch()[i] = bb_coords;
-        output_meta_data->get_labels_batch()[i] = bb_labels;
+        transform.affine(i, sx, tx, sy, ty);
     }
+    return true;
 }
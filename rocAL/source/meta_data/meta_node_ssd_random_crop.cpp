@@ -21,30 +21,19 @@ THE SOFTWARE.
 */
 
 #include "meta_data/meta_node_ssd_random_crop.h"
-void SSDRandomCropMetaNode::initialize() {
-    _crop_width_val.resize(_batch_size);
-    _crop_height_val.resize(_batch_size);
-    _x1_val.resize(_batch_size);
-    _y1_val.resize(_batch_size);
-}
 void SSDRandomCropMetaNode::update_parameters(pMetaDataBatch input_meta_data, pMetaDataBatch output_meta_data) {
-    initialize();
     if (_batch_size != input_meta_data->size()) {
         _batch_size = input_meta_data->size();
     }
     std::vector<std::pair<float, float>> iou_range = _node->get_iou_range();
     bool entire_iou = _node->is_entire_iou();
-    _meta_crop_param = _node->get_crop_param();
+    const auto &crop_boxes = _node->get_crop_boxes();
+    if (crop_boxes.size() < static_cast<size_t>(_batch_size))
+        THROW("SSDRandomCropMetaNode: the crop node sampled " + TOSTR(crop_boxes.size()) + " crops for a batch of " + TOSTR(_batch_size))
     _dst_width = _node->get_dst_width();
     _dst_height = _node->get_dst_height();
-    _crop_width = _meta_crop_param->cropw_arr;
-    _crop_height = _meta_crop_param->croph_arr;
-    _x1 = _meta_crop_param->x1_arr;
-    _y1 = _meta_crop_param->y1_arr;
-    vxCopyArrayRange((vx_array)_crop_width, 0, _batch_size, sizeof(uint), _crop_width_val.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
-    vxCopyArrayRange((vx_array)_crop_height, 0, _batch_size, sizeof(uint), _crop_height_val.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
-    vxCopyArrayRange((vx_array)_x1, 0, _batch_size, sizeof(uint), _x1_val.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
-    vxCopyArrayRange((vx_array)_y1, 0, _batch_size, sizeof(uint), _y1_val.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
+    // The crops sampled by the node are normalized, the boxes are in pixels of the images when their sizes are known
+    const bool has_sizes = input_meta_data->get_img_sizes_batch().size() >= static_cast<size_t>(_batch_size);
     for (int i = 0; i < _batch_size; i++) {
         auto bb_count = input_meta_data->get_labels_batch()[i].size();
         Labels labels_buf = input_meta_data->get_labels_batch()[i];
@@ -52,16 +41,21 @@ void SSDRandomCropMetaNode::update_parameters(pMetaDataBatch input_meta_data, pM
         BoundingBoxCords bb_coords;
         Labels bb_labels;
         BoundingBoxCord crop_box;
-        crop_box.l = _x1_val[i];
-        crop_box.t = _y1_val[i];
-        crop_box.r = _x1_val[i] + _crop_width_val[i];
-        crop_box.b = _y1_val[i] + _crop_height_val[i];
+        float scale_x = 1.0f, scale_y = 1.0f;
+        if (has_sizes && input_meta_data->get_img_sizes_batch()[i].w && input_meta_data->get_img_sizes_batch()[i].h) {
+            scale_x = input_meta_data->get_img_sizes_batch()[i].w;
+            scale_y = input_meta_data->get_img_sizes_batch()[i].h;
+        }
+        crop_box.l = crop_boxes[i].l * scale_x;
+        crop_box.t = crop_boxes[i].t * scale_y;
+        crop_box.r = crop_boxes[i].r * scale_x;
+        crop_box.b = crop_boxes[i].b * scale_y;
         for (uint j = 0; j < bb_count; j++) {
             auto x_c = 0.5f * (box_coords_buf[j].l + box_coords_buf[j].r);
             auto y_c = 0.5f * (box_coords_buf[j].t + box_coords_buf[j].b);
             bool is_center_in_crop = (x_c >= crop_box.l && x_c <= crop_box.r) && (y_c >= crop_box.t && y_c <= crop_box.b);
             float bb_iou = BBoxIntersectionOverUnion(box_coords_buf[j], crop_box, entire_iou);
-            if (bb_iou >= iou_range[j].first && bb_iou <= iou_range[j].second && is_center_in_crop) {
+            if (bb_iou >= iou_range[i].first && bb_iou <= iou_range[i].second && is_center_in_crop) {
                 float xA = std::max(crop_box.l, box_coords_buf[j].l);
                 float yA = std::max(crop_box.t, box_coords_buf[j].t);
                 float xB = std::min(crop_box.r, box_coords_buf[j].r);
@@ -0,0 +1,164 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "meta_data/meta_transform.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+// Fraction of box covered by window, same measure the crop meta nodes filter on
+inline float box_coverage(const BoundingBoxCord &box, const BoundingBoxCord &window) {
+    float xA = std::max(box.l, window.l);
+    float yA = std::max(box.t, window.t);
+    float xB = std::min(box.r, window.r);
+    float yB = std::min(box.b, window.b);
+    float intersection_area = std::max(0.0f, xB - xA) * std::max(0.0f, yB - yA);
+    float box_area = (box.b - box.t) * (box.r - box.l);
+    return intersection_area / box_area;
+}
+
+inline void transform_box(BoundingBoxCord &box, float sx, float tx, float sy, float ty) {
+    float l = sx * box.l + tx, r = sx * box.r + tx;
+    float t = sy * box.t + ty, b = sy * box.b + ty;
+    box.l = std::min(l, r);
+    box.r = std::max(l, r);
+    box.t = std::min(t, b);
+    box.b = std::max(t, b);
+}
+}  // namespace
+
+void MetaTransform::reset(int batch_size) {
+    _samples.assign(batch_size, SampleTransform());
+    _pad_empty = false;
+}
+
+void MetaTransform::affine(int idx, float sx, float tx, float sy, float ty) {
+    auto &sample = _samples[idx];
+    sample.sx *= sx;
+    sample.tx = sx * sample.tx + tx;
+    sample.sy *= sy;
+    sample.ty = sy * sample.ty + ty;
+    for (auto &window : sample.windows)
+        transform_box(window.box, sx, tx, sy, ty);
+}
+
+void MetaTransform::clip(int idx, const BoundingBoxCord &window, float iou_threshold) {
+    _samples[idx].windows.push_back({window, iou_threshold});
+    affine(idx, 1, -window.l, 1, -window.t);
+}
+
+void MetaTransform::set_roi_size(int idx, int width, int height) {
+    _samples[idx].update_roi = true;
+    _samples[idx].roi_size = {width, height};
+}
+
+void MetaTransform::apply_boxes(const SampleTransform &transform, BoundingBoxCords &boxes, Labels &labels) const {
+    const float sx = transform.sx, tx = transform.tx, sy = transform.sy, ty = transform.ty;
+    BoundingBoxCord *box = boxes.data();
+    const int bb_count = boxes.size();
+#pragma omp simd
+    for (int j = 0; j < bb_count; j++)
+        transform_box(box[j], sx, tx, sy, ty);
+
+    for (const auto &window : transform.windows) {
+        size_t kept = 0;
+        for (size_t j = 0; j < boxes.size(); j++) {
+            if (box_coverage(boxes[j], window.box) >= window.iou_threshold) {
+                boxes[kept].l = std::max(boxes[j].l, window.box.l);
+                boxes[kept].t = std::max(boxes[j].t, window.box.t);
+                boxes[kept].r = std::min(boxes[j].r, window.box.r);
+                boxes[kept].b = std::min(boxes[j].b, window.box.b);
+                labels[kept] = labels[j];
+                kept++;
+            }
+        }
+        boxes.resize(kept);
+        labels.resize(kept);
+        // A crop that keeps no box reports the whole window as background
+        if (kept == 0) {
+            boxes.push_back(window.box);
+            labels.push_back(0);
+        }
+    }
+    if (boxes.empty() && _pad_empty)
+        boxes.push_back(BoundingBoxCord{0, 0, 0, 0});
+}
+
+void MetaTransform::apply(pMetaDataBatch input_meta_data, pMetaDataBatch output_meta_data) const {
+    const auto type = input_meta_data->get_metadata_type();
+    const int batch_size = _samples.size();
+    if (type == MetaDataType::KeyPoints)
+        output_meta_data->get_joints_data_batch().image_path_batch = input_meta_data->get_joints_data_batch().image_path_batch;
+#pragma omp parallel for
+    for (int i = 0; i < batch_size; i++) {
+        const auto &transform = _samples[i];
+        Labels &input_labels = input_meta_data->get_labels_batch()[i];
+        BoundingBoxCords &input_boxes = input_meta_data->get_bb_cords_batch()[i];
+        const size_t bb_count = std::min(input_labels.size(), input_boxes.size());
+        Labels labels(input_labels.begin(), input_labels.begin() + bb_count);
+        BoundingBoxCords boxes(input_boxes.begin(), input_boxes.begin() + bb_count);
+        apply_boxes(transform, boxes, labels);
+        output_meta_data->get_bb_cords_batch()[i] = std::move(boxes);
+        output_meta_data->get_labels_batch()[i] = std::move(labels);
+        if (transform.update_roi)
+            output_meta_data->get_img_roi_sizes_batch()[i] = transform.roi_size;
+
+        if (type == MetaDataType::PolygonMask) {
+            MaskCords mask_cords = input_meta_data->get_mask_cords_batch()[i];
+            float *vertex = mask_cords.data();
+            const int mask_size = mask_cords.size();
+#pragma omp simd
+            for (int idx = 0; idx < mask_size; idx += 2) {
+                vertex[idx] = transform.sx * vertex[idx] + transform.tx;
+                vertex[idx + 1] = transform.sy * vertex[idx + 1] + transform.ty;
+            }
+            output_meta_data->get_mask_cords_batch()[i] = std::move(mask_cords);
+            output_meta_data->get_mask_polygons_count_batch()[i] = input_meta_data->get_mask_polygons_count_batch()[i];
+            output_meta_data->get_mask_vertices_count_batch()[i] = input_meta_data->get_mask_vertices_count_batch()[i];
+        } else if (type == MetaDataType::KeyPoints) {
+            auto &input_joints = input_meta_data->get_joints_data_batch();
+            auto &output_joints = output_meta_data->get_joints_data_batch();
+            output_joints.image_id_batch[i] = input_joints.image_id_batch[i];
+            output_joints.annotation_id_batch[i] = input_joints.annotation_id_batch[i];
+            output_joints.joints_visibility_batch[i] = input_joints.joints_visibility_batch[i];
+            output_joints.score_batch[i] = input_joints.score_batch[i];
+            output_joints.rotation_batch[i] = input_joints.rotation_batch[i];
+            Joints joints = input_joints.joints_batch[i];
+            for (auto &joint : joints) {
+                joint[0] = transform.sx * joint[0] + transform.tx;
+                joint[1] = transform.sy * joint[1] + transform.ty;
+            }
+            output_joints.joints_batch[i] = std::move(joints);
+            auto center = input_joints.center_batch[i];
+            auto scale = input_joints.scale_batch[i];
+            if (center.size() >= 2 && scale.size() >= 2) {
+                center[0] = transform.sx * center[0] + transform.tx;
+                center[1] = transform.sy * center[1] + transform.ty;
+                scale[0] *= std::abs(transform.sx);
+                scale[1] *= std::abs(transform.sy);
+            }
+            output_joints.center_batch[i] = std::move(center);
+            output_joints.scale_batch[i] = std::move(scale);
+        }
+    }
+}
@@ -0,0 +1,143 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "meta_data/polygon_mask_rasterizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+PolygonMaskRasterizer::PolygonMaskRasterizer(unsigned width, unsigned height, MaskType mask_type, unsigned max_instances)
+    : _width(width), _height(height), _mask_type(mask_type), _max_instances(max_instances) {
+    if (!_width || !_height)
+        THROW("The mask width and height must be positive")
+    if (_mask_type == MaskType::INSTANCE && !_max_instances)
+        THROW("The maximum number of instances must be positive for instance masks")
+}
+
+void PolygonMaskRasterizer::fill_polygon(const float *vertices, int vertex_count, unsigned width, unsigned height, uint8_t value, uint8_t *mask) {
+    if (vertex_count < 3) return;
+    float min_y = vertices[1], max_y = vertices[1];
+    for (int v = 1; v < vertex_count; v++) {
+        min_y = std::min(min_y, vertices[2 * v + 1]);
+        max_y = std::max(max_y, vertices[2 * v + 1]);
+    }
+    // Rows whose centers lie within the polygon's vertical extent
+    int first_row = std::max(static_cast<int>(std::ceil(min_y - 0.5f)), 0);
+    int last_row = std::min(static_cast<int>(std::floor(max_y - 0.5f)), static_cast<int>(height) - 1);
+    std::vector<float> crossings;
+    crossings.reserve(vertex_count);
+    for (int row = first_row; row <= last_row; row++) {
+        float center_y = row + 0.5f;
+        crossings.clear();
+        for (int v = 0, prev = vertex_count - 1; v < vertex_count; prev = v++) {
+            float x0 = vertices[2 * prev], y0 = vertices[2 * prev + 1];
+            float x1 = vertices[2 * v], y1 = vertices[2 * v + 1];
+            // Half open in y, so a vertex on the scanline is counted once and horizontal edges are skipped
+            if ((y0 <= center_y) != (y1 <= center_y))
+                crossings.push_back(x0 + (center_y - y0) * (x1 - x0) / (y1 - y0));
+        }
+        std::sort(crossings.begin(), crossings.end());
+        uint8_t *mask_row = mask + static_cast<size_t>(row) * width;
+        for (size_t c = 0; c + 1 < crossings.size(); c += 2) {
+            // Pixels whose centers lie in [crossings[c], crossings[c + 1])
+            int first_col = std::max(static_cast<int>(std::ceil(crossings[c] - 0.5f)), 0);
+            int end_col = std::min(static_cast<int>(std::ceil(crossings[c + 1] - 0.5f)), static_cast<int>(width));
+            if (first_col < end_col)
+                memset(mask_row + first_col, value, end_col - first_col);
+        }
+    }
+}
+
+std::vector<size_t> PolygonMaskRasterizer::object_offsets(pMetaDataBatch meta_data, int sample) const {
+    auto &polygon_counts = meta_data->get_mask_polygons_count_batch()[sample];
+    auto &vertices_counts = meta_data->get_mask_vertices_count_batch()[sample];
+    std::vector<size_t> offsets(polygon_counts.size());
+    size_t offset = 0;
+    for (size_t object = 0; object < polygon_counts.size(); object++) {
+        offsets[object] = offset;
+        for (int polygon = 0; polygon < polygon_counts[object]; polygon++)
+            offset += vertices_counts[object][polygon];
+    }
+    // Checked up front, the objects are drawn in parallel regions which must not throw
+    if (offset > meta_data->get_mask_cords_batch()[sample].size())
+        THROW("Polygon coordinates of sample " + TOSTR(sample) + " are out of range")
+    return offsets;
+}
+
+unsigned PolygonMaskRasterizer::instance_count(pMetaDataBatch meta_data, int sample) const {
+    // The objects are the labels with polygons, as counted by rocalGetMaskCount()
+    size_t object_count = std::min(meta_data->get_labels_batch()[sample].size(), meta_data->get_mask_polygons_count_batch()[sample].size());
+    return std::min(object_count, static_cast<size_t>(_max_instances));
+}
+
+void PolygonMaskRasterizer::fill_object(pMetaDataBatch meta_data, int sample, int object, size_t first_vertex, uint8_t value, uint8_t *mask) const {
+    auto &mask_cords = meta_data->get_mask_cords_batch()[sample];
+    auto &vertices_counts = meta_data->get_mask_vertices_count_batch()[sample][object];
+    size_t offset = first_vertex;
+    for (int polygon = 0; polygon < meta_data->get_mask_polygons_count_batch()[sample][object]; polygon++) {
+        int coordinate_count = vertices_counts[polygon];
+        fill_polygon(mask_cords.data() + offset, coordinate_count / 2, _width, _height, value, mask);
+        offset += coordinate_count;
+    }
+}
+
+void PolygonMaskRasterizer::rasterize(pMetaDataBatch meta_data, uint8_t *buffer) const {
+    if (meta_data->get_metadata_type() != MetaDataType::PolygonMask)
+        THROW("Masks can only be rasterized from polygon mask meta data")
+    const int batch_size = meta_data->size();
+    const size_t plane_bytes = plane_size();
+    std::vector<std::vector<size_t>> offsets(batch_size);
+    for (int i = 0; i < batch_size; i++)
+        offsets[i] = object_offsets(meta_data, i);
+    if (_mask_type == MaskType::SEMANTIC) {
+        // Objects of a sample overlap, so each sample is drawn by one thread in annotation order
+#pragma omp parallel for schedule(dynamic)
+        for (int i = 0; i < batch_size; i++) {
+            uint8_t *mask = buffer + i * sample_size();
+            memset(mask, 0, plane_bytes);
+            auto &labels = meta_data->get_labels_batch()[i];
+            size_t object_count = std::min(labels.size(), offsets[i].size());
+            for (size_t object = 0; object < object_count; object++) {
+                uint8_t value = static_cast<uint8_t>(std::min(std::max(labels[object], 0), 255));
+                fill_object(meta_data, i, object, offsets[i][object], value, mask);
+            }
+        }
+        return;
+    }
+
+    // Every instance has its own plane, so the instances of the whole batch are drawn in parallel
+    std::vector<std::pair<int, int>> instances;
+    for (int i = 0; i < batch_size; i++) {
+        unsigned count = instance_count(meta_data, i);
+        for (unsigned object = 0; object < count; object++)
+            instances.emplace_back(i, object);
+    }
+    const int instance_total = instances.size();
+#pragma omp parallel for schedule(dynamic)
+    for (int n = 0; n < instance_total; n++) {
+        int sample = instances[n].first, object = instances[n].second;
+        uint8_t *mask = buffer + sample * sample_size() + object * plane_bytes;
+        memset(mask, 0, plane_bytes);
+        fill_object(meta_data, sample, object, offsets[sample][object], 1, mask);
+    }
+}
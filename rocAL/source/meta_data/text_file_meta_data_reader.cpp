@@ -22,32 +22,54 @@ THE SOFTWARE.
 
 #include "meta_data/text_file_meta_data_reader.h"
 
+#include <fcntl.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
-#include <fstream>
-#include <iostream>
-#include <sstream>
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <functional>
+#include <thread>
 #include <utility>
 
 #include "pipeline/commons.h"
 #include "pipeline/exception.h"
 
+namespace {
+constexpr uint32_t EMPTY_SLOT = UINT32_MAX;
+constexpr uint32_t RELEASED_SLOT = UINT32_MAX - 1;
+constexpr size_t MIN_CHUNK_SIZE = 1 << 20;  // Smaller files are parsed by fewer threads
+
+// The separators skipped by the >> operator of the streams within a line
+inline bool is_blank(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f'; }
+}  // namespace
+
 void TextFileMetaDataReader::init(const MetaDataConfig &cfg, pMetaDataBatch meta_data_batch) {
     _path = cfg.path();
     _output = meta_data_batch;
 }
 
-bool TextFileMetaDataReader::exists(const std::string &image_name) {
-    return _map_content.find(image_name) != _map_content.end();
+size_t TextFileMetaDataReader::find_slot(std::string_view image_name) const {
+    // Returns the slot of the name or the empty slot ending its probe sequence
+    if (_index.empty())
+        return 0;
+    const size_t hash = std::hash<std::string_view>{}(image_name);
+    const uint32_t hash_tag = static_cast<uint32_t>(static_cast<uint64_t>(hash) >> 32);
+    const size_t mask = _index.size() - 1;
+    for (size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+        uint32_t entry_idx = _index[slot];
+        if (entry_idx == EMPTY_SLOT)
+            return slot;
+        if (entry_idx != RELEASED_SLOT && _entries[entry_idx].hash_tag == hash_tag && entry_name(_entries[entry_idx]) == image_name)
+            return slot;
+    }
 }
 
-void TextFileMetaDataReader::add(std::string image_name, int label) {
-    pMetaData info = std::make_shared<Label>(label);
-    if (exists(image_name)) {
-        WRN("Entity with the same name exists")
-        return;
-    }
-    _map_content.insert(std::pair<std::string, std::shared_ptr<Label>>(image_name, info));
+bool TextFileMetaDataReader::exists(const std::string &image_name) {
+    return !_index.empty() && _index[find_slot(image_name)] < RELEASED_SLOT;
 }
 
 void TextFileMetaDataReader::lookup(const std::vector<std::string> &image_names) {
@@ -59,34 +81,125 @@ void TextFileMetaDataReader::lookup(const std::vector<std::string> &image_names)
         _output->resize(image_names.size());
     for (unsigned i = 0; i < image_names.size(); i++) {
         auto image_name = image_names[i];
-        auto it = _map_content.find(image_name);
-        if (_map_content.end() == it)
+        uint32_t entry_idx = _index.empty() ? EMPTY_SLOT : _index[find_slot(image_name)];
+        if (entry_idx >= RELEASED_SLOT)
             THROW("ERROR: Given name not present in the map" + image_name)
-        _output->get_labels_batch()[i] = it->second->get_labels();
+        _output->get_labels_batch()[i] = {_entries[entry_idx].label};
     }
 }
 
-void TextFileMetaDataReader::read_all(const std::string &path) {
-    std::ifstream text_file(path.c_str());
-    if (text_file.good()) {
-        std::string line;
-        while (std::getline(text_file, line)) {
-            std::istringstream line_ss(line);
-            int label;
-            std::string file_name;
-            if (!(line_ss >> file_name >> label))
-                continue;
-            _relative_file_path.push_back(file_name); // to be used in file source reader to reduce I/O operations
-            auto last_id = file_name;
-            auto last_slash_idx = last_id.find_last_of("\\/");
-            if (std::string::npos != last_slash_idx) {
-                last_id.erase(0, last_slash_idx + 1);
-            }
-            add(last_id, label);
+void TextFileMetaDataReader::parse_lines(const char *data, size_t begin, size_t end, std::vector<Entry> &entries) {
+    // Tokenizes the lines in place, each line is a file path and a label separated by blanks like the >> operator reads them
+    for (size_t line_start = begin; line_start < end;) {
+        const char *line_end = static_cast<const char *>(memchr(data + line_start, '\n', end - line_start));
+        const char *p = data + line_start, *eol = line_end ? line_end : data + end;
+        line_start = (eol - data) + 1;
+        while (p < eol && is_blank(*p)) p++;
+        const char *path_begin = p;
+        while (p < eol && !is_blank(*p)) p++;
+        const char *path_end = p;
+        while (p < eol && is_blank(*p)) p++;
+        bool negative = (p < eol && *p == '-');
+        if (p < eol && (*p == '-' || *p == '+')) p++;
+        int64_t label = 0;
+        const char *digits = p;
+        while (p < eol && *p >= '0' && *p <= '9' && label <= INT_MAX) label = label * 10 + (*p++ - '0');
+        if (path_begin == path_end || p == digits || (p < eol && *p >= '0' && *p <= '9'))
+            continue;  // No file name or label, or the label does not fit an int
+        if (negative) label = -label;
+        if (label > INT_MAX || label < INT_MIN)
+            continue;
+        const char *name_begin = path_end;
+        while (name_begin > path_begin && name_begin[-1] != '/' && name_begin[-1] != '\\') name_begin--;
+        const size_t hash = std::hash<std::string_view>{}(std::string_view(name_begin, path_end - name_begin));
+        entries.push_back({static_cast<size_t>(path_begin - data), static_cast<uint32_t>(path_end - path_begin),
+                           static_cast<uint32_t>(name_begin - path_begin), static_cast<uint32_t>(static_cast<uint64_t>(hash) >> 32), static_cast<int>(label)});
+    }
+}
+
+void TextFileMetaDataReader::build_index() {
+    // Keeps the table at most 70% full, a name found again keeps the label of its first line
+    size_t capacity = 16;
+    while (capacity * 7 < _entries.size() * 10) capacity <<= 1;
+    _index.assign(capacity, EMPTY_SLOT);
+    size_t duplicates = 0;
+    for (size_t entry_idx = 0; entry_idx < _entries.size(); entry_idx++) {
+        size_t slot = find_slot(entry_name(_entries[entry_idx]));
+        if (_index[slot] != EMPTY_SLOT) {
+            duplicates++;
+            continue;
         }
-    } else {
+        _index[slot] = static_cast<uint32_t>(entry_idx);
+    }
+    if (duplicates) {
+        WRN("Entity with the same name exists, kept the first label of " + TOSTR(duplicates) + " repeated names")
+    }
+}
+
+void TextFileMetaDataReader::read_all(const std::string &path) {
+    // The file is mapped and parsed in place by chunks of whole lines in parallel, the index refers to the names in the mapped file
+    unmap();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
         THROW("Can't open the metadata file at " + path)
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+        ::close(fd);
+        THROW("Can't open the metadata file at " + path)
+    }
+    _file_size = file_stat.st_size;
+    if (_file_size > 0) {
+        void *data = mmap(nullptr, _file_size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+        if (data == MAP_FAILED) {
+            ::close(fd);
+            THROW("Can't map the metadata file at " + path + ": " + strerror(errno))
+        }
+        _file_data = static_cast<const char *>(data);
+    }
+    ::close(fd);
+
+    // Each chunk takes the lines starting within it
+    size_t chunk_count = std::max<size_t>(1, std::min<size_t>(_file_size / MIN_CHUNK_SIZE, 4 * std::max(1u, std::thread::hardware_concurrency())));
+    std::vector<size_t> chunk_starts(chunk_count + 1, _file_size);
+    chunk_starts[0] = 0;
+    for (size_t chunk = 1; chunk < chunk_count; chunk++) {
+        size_t start = std::max(chunk_starts[chunk - 1], _file_size * chunk / chunk_count);
+        const char *line_end = static_cast<const char *>(memchr(_file_data + start - 1, '\n', _file_size - start + 1));
+        chunk_starts[chunk] = line_end ? (line_end - _file_data) + 1 : _file_size;
+    }
+    std::vector<std::vector<Entry>> chunk_entries(chunk_count);
+#pragma omp parallel for schedule(dynamic)
+    for (size_t chunk = 0; chunk < chunk_count; chunk++)
+        parse_lines(_file_data, chunk_starts[chunk], chunk_starts[chunk + 1], chunk_entries[chunk]);
+
+    size_t entry_count = 0;
+    for (auto &entries : chunk_entries) entry_count += entries.size();
+    if (entry_count >= RELEASED_SLOT)
+        THROW("The metadata file at " + path + " has more lines than the index can hold")
+    _entries.reserve(entry_count);
+    for (auto &entries : chunk_entries) {
+        _entries.insert(_entries.end(), entries.begin(), entries.end());
+        std::vector<Entry>().swap(entries);
+    }
+    build_index();
+}
+
+const std::map<std::string, std::shared_ptr<MetaData>> &TextFileMetaDataReader::get_map_content() {
+    if (_map_content.empty()) {
+        for (auto entry_idx : _index)
+            if (entry_idx < RELEASED_SLOT)
+                _map_content.emplace(std::string(entry_name(_entries[entry_idx])), std::make_shared<Label>(_entries[entry_idx].label));
     }
+    return _map_content;
+}
+
+std::vector<std::string> TextFileMetaDataReader::get_relative_file_path() {
+    // to be used in file source reader to reduce I/O operations
+    std::vector<std::string> relative_file_path(_entries.size());
+#pragma omp parallel for
+    for (size_t entry_idx = 0; entry_idx < _entries.size(); entry_idx++)
+        relative_file_path[entry_idx].assign(_file_data + _entries[entry_idx].path_offset, _entries[entry_idx].path_size);
+    return relative_file_path;
 }
 
 void TextFileMetaDataReader::release(std::string image_name) {
@@ -94,15 +207,31 @@ void TextFileMetaDataReader::release(std::string image_name) {
         WRN("ERROR: Given not present in the map" + image_name);
         return;
     }
+    // The slot stays taken so the names probed past it are still found
+    _index[find_slot(image_name)] = RELEASED_SLOT;
     _map_content.erase(image_name);
 }
 
 void TextFileMetaDataReader::release() {
     _map_content.clear();
+    unmap();
+}
+
+void TextFileMetaDataReader::unmap() {
+    _entries.clear();
+    _index.clear();
+    if (_file_data)
+        munmap(const_cast<char *>(_file_data), _file_size);
+    _file_data = nullptr;
+    _file_size = 0;
 }
 
 TextFileMetaDataReader::TextFileMetaDataReader() {
 }
+
+TextFileMetaDataReader::~TextFileMetaDataReader() {
+    unmap();
+}
 //
 // Created by mvx on 3/31/20.
 //
@@ -30,14 +30,14 @@ THE SOFTWARE.
 void CropParam::set_x_drift_factor(Parameter<float> *x_drift) {
     if (!x_drift)
         return;
-    ParameterFactory::instance()->destroy_param(x_drift_factor);
+    ParameterFactory::instance()->replace_param(x_drift_factor, x_drift);
     x_drift_factor = x_drift;
 }
 
 void CropParam::set_y_drift_factor(Parameter<float> *y_drift) {
     if (!y_drift)
         return;
-    ParameterFactory::instance()->destroy_param(y_drift_factor);
+    ParameterFactory::instance()->replace_param(y_drift_factor, y_drift);
     y_drift_factor = y_drift;
 }
 
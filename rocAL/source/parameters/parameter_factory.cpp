@@ -26,6 +26,7 @@ THE SOFTWARE.
 #include <ctime>
 
 #include "parameters/parameter_simple.h"
+#include "pipeline/exception.h"
 ParameterFactory* ParameterFactory::_instance = nullptr;
 std::mutex ParameterFactory::_mutex;
 
@@ -64,6 +65,7 @@ bool validate_uniform_rand_param(pParam rand_obj) {
 
 ParameterFactory::ParameterFactory() {
     generate_seed();
+    set_seed(_seed);
 }
 ParameterFactory* ParameterFactory::instance() {
     if (_instance == nullptr)  // For performance reasons
@@ -82,18 +84,53 @@ ParameterFactory::~ParameterFactory() {
             [](auto&& arg) {
                 delete arg;
             },
-            rand_obj);
-}
-
-void ParameterFactory::renew_parameters() {
-    for (auto&& rand_obj : _parameters)
+            rand_obj.first);
+    for (auto&& rand_obj : _released)
         std::visit(
             [](auto&& arg) {
-                arg->renew();
+                delete arg;
             },
             rand_obj);
 }
 
+void ParameterFactory::renew_parameters(const void* owner) {
+    // Every parameter draws from its own counter based stream, so the values don't depend on the order of renewal
+    std::lock_guard<std::mutex> lock(_params_lock);
+    for (auto&& rand_obj : _parameters)
+        if (!rand_obj.second || rand_obj.second == owner)
+            std::visit(
+                [](auto&& arg) {
+                    arg->renew();
+                },
+                rand_obj.first);
+}
+
+void ParameterFactory::release_owner(const void* owner) {
+    std::lock_guard<std::mutex> lock(_params_lock);
+    for (auto it = _parameters.begin(); it != _parameters.end();) {
+        if (owner && it->second == owner) {
+            _creation_order.erase(std::remove(_creation_order.begin(), _creation_order.end(), it->first), _creation_order.end());
+            _released.push_back(it->first);
+            it = _parameters.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    if (_owner == owner)
+        _owner = nullptr;
+}
+
+std::vector<pParamCore> ParameterFactory::owned_params(const void* owner) {
+    // The parameters created before any pipeline are renewed by all of them, so they are part of the state of each
+    std::vector<pParamCore> params;
+    for (auto&& param : _creation_order) {
+        auto param_owner = _parameters.at(param);
+        if (!param_owner || param_owner == owner)
+            params.push_back(param);
+    }
+    return params;
+}
+
 unsigned
 ParameterFactory::get_seed() {
     return _seed;
@@ -113,53 +150,82 @@ ParameterFactory::get_seed_from_seedsequence() {
 
 void ParameterFactory::set_seed(unsigned seed) {
     _seed = seed;
+    _seed_sequence_idx = 0;
+    _stream_count = 0;
     _seed_vector.resize(MAX_SEEDS);
     std::seed_seq ss{seed};
     ss.generate(_seed_vector.begin(), _seed_vector.end());
 }
 
 IntParam* ParameterFactory::create_uniform_int_rand_param(int start, int end) {
-    auto gen = new UniformRand<int>(start, end, get_seed_from_seedsequence());
+    auto gen = new UniformRand<int>(start, end, get_seed_from_seedsequence(), next_stream());
     auto ret = new IntParam(gen, RocalParameterType::RANDOM_UNIFORM);
-    _parameters.insert(gen);
+    add_param(gen);
     return ret;
 }
 
 FloatParam* ParameterFactory::create_uniform_float_rand_param(float start, float end) {
-    auto gen = new UniformRand<float>(start, end, get_seed_from_seedsequence());
+    auto gen = new UniformRand<float>(start, end, get_seed_from_seedsequence(), next_stream());
     auto ret = new FloatParam(gen, RocalParameterType::RANDOM_UNIFORM);
-    _parameters.insert(gen);
+    add_param(gen);
     return ret;
 }
 
 IntParam* ParameterFactory::create_custom_int_rand_param(const int* value, const double* frequencies, size_t size) {
-    auto gen = new CustomRand<int>(value, frequencies, size, get_seed_from_seedsequence());
+    auto gen = new CustomRand<int>(value, frequencies, size, get_seed_from_seedsequence(), next_stream());
     auto ret = new IntParam(gen, RocalParameterType::RANDOM_CUSTOM);
-    _parameters.insert(gen);
+    add_param(gen);
     return ret;
 }
 
 FloatParam* ParameterFactory::create_custom_float_rand_param(const float* value, const double* frequencies, size_t size) {
-    auto gen = new CustomRand<float>(value, frequencies, size, get_seed_from_seedsequence());
+    auto gen = new CustomRand<float>(value, frequencies, size, get_seed_from_seedsequence(), next_stream());
     auto ret = new FloatParam(gen, RocalParameterType::RANDOM_CUSTOM);
-    _parameters.insert(gen);
+    add_param(gen);
     return ret;
 }
 
 IntParam* ParameterFactory::create_single_value_int_param(int value) {
     auto gen = new SimpleParameter<int>(value);
     auto ret = new IntParam(gen, RocalParameterType::DETERMINISTIC);
-    _parameters.insert(gen);
+    add_param(gen);
     return ret;
 }
 
 FloatParam* ParameterFactory::create_single_value_float_param(float value) {
     auto gen = new SimpleParameter<float>(value);
     auto ret = new FloatParam(gen, RocalParameterType::DETERMINISTIC);
-    _parameters.insert(gen);
+    add_param(gen);
     return ret;
 }
 
+std::vector<uint64_t> ParameterFactory::get_state(const void* owner) {
+    std::lock_guard<std::mutex> lock(_params_lock);
+    auto params = owned_params(owner);
+    std::vector<uint64_t> iterations;
+    iterations.reserve(params.size());
+    for (auto&& param : params)
+        std::visit(
+            [&iterations](auto&& arg) {
+                iterations.push_back(arg->iteration());
+            },
+            param);
+    return iterations;
+}
+
+void ParameterFactory::set_state(const void* owner, const std::vector<uint64_t>& iterations) {
+    std::lock_guard<std::mutex> lock(_params_lock);
+    auto params = owned_params(owner);
+    if (iterations.size() != params.size())
+        THROW("State holds " + TOSTR(iterations.size()) + " parameters, the pipeline created " + TOSTR(params.size()))
+    for (size_t idx = 0; idx < iterations.size(); idx++)
+        std::visit(
+            [&iterations, idx](auto&& arg) {
+                arg->set_iteration(iterations[idx]);
+            },
+            params[idx]);
+}
+
 Parameter<int>* core(IntParam* arg) {
     if (!arg)
         return nullptr;
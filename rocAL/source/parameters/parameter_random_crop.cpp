@@ -30,14 +30,14 @@ THE SOFTWARE.
 void RocalRandomCropParam::set_area_factor(Parameter<float>* crop_area_factor) {
     if (!crop_area_factor)
         return;
-    ParameterFactory::instance()->destroy_param(area_factor);
+    ParameterFactory::instance()->replace_param(area_factor, crop_area_factor);
     area_factor = crop_area_factor;
 }
 
 void RocalRandomCropParam::set_aspect_ratio(Parameter<float>* crop_aspect_ratio) {
     if (!crop_aspect_ratio)
         return;
-    ParameterFactory::instance()->destroy_param(aspect_ratio);
+    ParameterFactory::instance()->replace_param(aspect_ratio, crop_aspect_ratio);
     aspect_ratio = crop_aspect_ratio;
 }
 
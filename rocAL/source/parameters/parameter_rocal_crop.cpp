@@ -30,14 +30,14 @@ THE SOFTWARE.
 void RocalCropParam::set_crop_height_factor(Parameter<float>* crop_h_factor) {
     if (!crop_h_factor)
         return;
-    ParameterFactory::instance()->destroy_param(crop_height_factor);
+    ParameterFactory::instance()->replace_param(crop_height_factor, crop_h_factor);
     crop_height_factor = crop_h_factor;
 }
 
 void RocalCropParam::set_crop_width_factor(Parameter<float>* crop_w_factor) {
     if (!crop_w_factor)
         return;
-    ParameterFactory::instance()->destroy_param(crop_width_factor);
+    ParameterFactory::instance()->replace_param(crop_width_factor, crop_w_factor);
     crop_width_factor = crop_w_factor;
 }
 
@@ -0,0 +1,270 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "pipeline/graph_optimizer.h"
+
+#include <algorithm>
+#include <typeinfo>
+
+#include "augmentations/geometry_augmentations/node_crop.h"
+#include "augmentations/geometry_augmentations/node_crop_mirror_normalize.h"
+#include "augmentations/geometry_augmentations/node_flip.h"
+#include "augmentations/geometry_augmentations/node_resize.h"
+#include "augmentations/geometry_augmentations/node_resize_mirror_normalize.h"
+#include "augmentations/node_copy.h"
+#include "augmentations/node_nop.h"
+#include "pipeline/log.h"
+
+namespace {
+// Returns the node if it is exactly of type T, nodes derived from T run a different kernel and are not matched
+template <typename T>
+std::shared_ptr<T> node_of_type(const std::shared_ptr<Node> &node) {
+    auto &ref = *node;
+    return typeid(ref) == typeid(T) ? std::static_pointer_cast<T>(node) : nullptr;
+}
+
+bool same_format(Tensor *tensor, Tensor *other) {
+    return tensor->info().data_type() == other->info().data_type() && tensor->info().layout() == other->info().layout();
+}
+
+bool is_image_layout(Tensor *tensor) {
+    return tensor->info().layout() == RocalTensorlayout::NHWC || tensor->info().layout() == RocalTensorlayout::NCHW;
+}
+
+// The fused kernels only mirror horizontally, the vertical flag has to be known to be always off
+bool flips_only_horizontally(const std::shared_ptr<FlipNode> &flip) {
+    auto vertical = flip->get_vertical_param();
+    return vertical && vertical->single_value() && vertical->default_value() == 0;
+}
+}  // namespace
+
+GraphOptimizer::GraphOptimizer(std::list<std::shared_ptr<Node>> &nodes, std::map<Tensor *, std::shared_ptr<Node>> &tensor_map) : _nodes(nodes),
+                                                                                                                                   _tensor_map(tensor_map) {}
+
+std::vector<Tensor *> GraphOptimizer::run() {
+    [[maybe_unused]] auto node_count = _nodes.size();  // Only logged
+    auto copies = remove_copies();
+    auto fused = fuse_crop_flip() + fuse_resize_flip();
+    auto dead = remove_dead_nodes();
+    if (copies || fused || dead) {
+        LOG("Graph optimizer reduced " + TOSTR(node_count) + " nodes to " + TOSTR(_nodes.size()) + ": " + TOSTR(copies) + " copies dropped, " +
+            TOSTR(fused) + " chains fused, " + TOSTR(dead) + " unused nodes removed")
+    }
+    return _removed_tensors;
+}
+
+std::vector<std::shared_ptr<Node>> GraphOptimizer::consumers(Tensor *tensor) {
+    std::vector<std::shared_ptr<Node>> consumer_nodes;
+    for (auto &node : _nodes) {
+        auto inputs = node->input();
+        if (std::find(inputs.begin(), inputs.end(), tensor) != inputs.end())
+            consumer_nodes.push_back(node);
+    }
+    return consumer_nodes;
+}
+
+// A tensor can be folded into a fused node when only the next node of the chain reads it
+bool GraphOptimizer::is_intermediate(Tensor *tensor) {
+    return _kept_tensors.find(tensor) == _kept_tensors.end() && consumers(tensor).size() == 1;
+}
+
+void GraphOptimizer::link(const std::shared_ptr<Node> &parent, const std::shared_ptr<Node> &child) {
+    parent->add_next(child);
+    child->add_previous(parent);
+}
+
+// Drops the node from the nodes before and after it, the removed node must not keep the graph alive or be reached from it
+void GraphOptimizer::unlink(const std::shared_ptr<Node> &node) {
+    for (auto &parent : node->previous())
+        parent->remove_next(node);
+    for (auto &child : node->next())
+        child->remove_previous(node);
+    node->release();
+}
+
+bool GraphOptimizer::is_source(const std::shared_ptr<Node> &node) {
+    for (auto &input : node->input())
+        if (_tensor_map.find(input) != _tensor_map.end())
+            return false;
+    return true;
+}
+
+void GraphOptimizer::replace(const std::shared_ptr<Node> &head, const std::shared_ptr<Node> &tail, const std::shared_ptr<Node> &fused) {
+    fused->set_graph_id(head->get_graph_id());
+    for (auto &input : fused->input())
+        link(_tensor_map.find(input)->second, fused);
+    for (auto &child : tail->next())
+        link(fused, child);
+    unlink(head);
+    unlink(tail);
+    auto intermediate = head->output()[0];
+    _tensor_map.erase(intermediate);
+    _removed_tensors.push_back(intermediate);
+    for (auto &output : fused->output())
+        _tensor_map[output] = fused;
+    // The fused node takes the place of the tail, its consumers come after it and the inputs of the head before it
+    _nodes.insert(std::find(_nodes.begin(), _nodes.end(), tail), fused);
+    _nodes.remove(head);
+    _nodes.remove(tail);
+}
+
+unsigned GraphOptimizer::remove_copies() {
+    unsigned removed = 0;
+    for (auto it = _nodes.begin(); it != _nodes.end();) {
+        auto node = *it;
+        bool is_copy = node_of_type<CopyNode>(node) || node_of_type<NopNode>(node);
+        if (is_copy && is_source(node)) {
+            ++it;
+            continue;
+        }
+        auto input = node->input()[0], output = node->output()[0];
+        if (!is_copy || is_kept(node) || _kept_tensors.find(output) != _kept_tensors.end() || !(input->info() == output->info())) {
+            ++it;
+            continue;
+        }
+        auto parent = _tensor_map.find(input)->second;
+        for (auto &consumer : consumers(output)) {
+            consumer->replace_input(output, input);
+            link(parent, consumer);
+        }
+        unlink(node);
+        _tensor_map.erase(output);
+        _removed_tensors.push_back(output);
+        LOG("Graph optimizer dropped a " + std::string(node_of_type<CopyNode>(node) ? "Copy" : "Nop") + " node")
+        it = _nodes.erase(it);
+        removed++;
+    }
+    return removed;
+}
+
+unsigned GraphOptimizer::fuse_crop_flip() {
+    unsigned fused = 0;
+    std::vector<std::shared_ptr<Node>> nodes(_nodes.begin(), _nodes.end());
+    for (auto &node : nodes) {
+        auto flip = node_of_type<FlipNode>(node);
+        if (!flip || is_kept(flip) || !flips_only_horizontally(flip))
+            continue;
+        auto crop_output = flip->input()[0];
+        auto parent = _tensor_map.find(crop_output);
+        if (parent == _tensor_map.end())
+            continue;
+        auto crop = node_of_type<CropNode>(parent->second);
+        if (!crop || is_kept(crop) || !is_intermediate(crop_output))
+            continue;
+        // CropMirrorNormalize crops a fixed size at an anchor, drifted and random crops have no equivalent
+        auto crop_param = crop->get_crop_param();
+        if (!crop_param->is_fixed_crop() || crop_param->crop_w == 0 || crop_param->crop_h == 0)
+            continue;
+        auto input = crop->input()[0], output = flip->output()[0];
+        if (!is_image_layout(input) || !same_format(input, crop_output) || !same_format(crop_output, output))
+            continue;
+
+        // Mean 0 and standard deviation 1 leave the values as they are
+        std::vector<float> mean(3, 0.0f), std_dev(3, 1.0f);
+        auto cmn = std::make_shared<CropMirrorNormalizeNode>(crop->input(), flip->output());
+        cmn->init(crop_param->crop_h, crop_param->crop_w, crop_param->get_crop_anchor_x(), crop_param->get_crop_anchor_y(),
+                  mean, std_dev, flip->get_horizontal_param());
+        replace(crop, flip, cmn);
+        LOG("Graph optimizer fused Crop -> Flip into CropMirrorNormalize")
+        fused++;
+    }
+    return fused;
+}
+
+unsigned GraphOptimizer::fuse_resize_flip() {
+    unsigned fused = 0;
+    std::vector<std::shared_ptr<Node>> nodes(_nodes.begin(), _nodes.end());
+    for (auto &node : nodes) {
+        auto flip = node_of_type<FlipNode>(node);
+        if (!flip || is_kept(flip) || !flips_only_horizontally(flip))
+            continue;
+        auto resize_output = flip->input()[0];
+        auto parent = _tensor_map.find(resize_output);
+        if (parent == _tensor_map.end())
+            continue;
+        auto resize = node_of_type<ResizeNode>(parent->second);
+        if (!resize || is_kept(resize) || !is_intermediate(resize_output))
+            continue;
+        // ResizeMirrorNormalize only interpolates linearly, and derives the output size differently in the min max mode and when only one dimension is given
+        if (resize->get_interpolation_type() != RocalResizeInterpolationType::ROCAL_LINEAR_INTERPOLATION ||
+            resize->get_scaling_mode() == RocalResizeScalingMode::ROCAL_SCALING_MODE_MIN_MAX ||
+            resize->get_dest_width() == 0 || resize->get_dest_height() == 0)
+            continue;
+        auto input = resize->input()[0], output = flip->output()[0];
+        if (!is_image_layout(input) || !same_format(input, resize_output) || !same_format(resize_output, output))
+            continue;
+
+        // Mean 0 and standard deviation 1 leave the values as they are
+        std::vector<float> mean(3, 0.0f), std_dev(3, 1.0f);
+        auto rmn = std::make_shared<ResizeMirrorNormalizeNode>(resize->input(), flip->output());
+        rmn->init(resize->get_dest_width(), resize->get_dest_height(), resize->get_scaling_mode(), resize->get_max_size(),
+                  resize->get_interpolation_type(), mean, std_dev, flip->get_horizontal_param());
+        replace(resize, flip, rmn);
+        LOG("Graph optimizer fused Resize -> Flip into ResizeMirrorNormalize")
+        fused++;
+    }
+    return fused;
+}
+
+unsigned GraphOptimizer::remove_dead_nodes() {
+    // Walks back from the kept tensors and nodes, whatever is not reached does not contribute to any output
+    std::set<Node *> live_nodes;
+    std::vector<Node *> pending;
+    auto mark_live = [&](Node *node) {
+        if (live_nodes.insert(node).second)
+            pending.push_back(node);
+    };
+    for (auto &node : _nodes) {
+        // Loaders and other nodes reading no other node feed the pipeline and keep its meta data and sample counts going
+        bool is_live = is_kept(node) || is_source(node);
+        for (auto &output : node->output())
+            is_live |= (_kept_tensors.find(output) != _kept_tensors.end());
+        if (is_live)
+            mark_live(node.get());
+    }
+    while (!pending.empty()) {
+        auto node = pending.back();
+        pending.pop_back();
+        for (auto &input : node->input()) {
+            auto parent = _tensor_map.find(input);
+            if (parent != _tensor_map.end())
+                mark_live(parent->second.get());
+        }
+    }
+
+    unsigned removed = 0;
+    for (auto it = _nodes.begin(); it != _nodes.end();) {
+        if (live_nodes.find(it->get()) != live_nodes.end()) {
+            ++it;
+            continue;
+        }
+        for (auto &output : (*it)->output()) {
+            _tensor_map.erase(output);
+            _removed_tensors.push_back(output);
+        }
+        unlink(*it);
+        LOG("Graph optimizer removed a node no output depends on")
+        it = _nodes.erase(it);
+        removed++;
+    }
+    return removed;
+}
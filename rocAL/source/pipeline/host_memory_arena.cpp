@@ -0,0 +1,203 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "pipeline/host_memory_arena.h"
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+#include "pipeline/commons.h"
+#if ENABLE_HIP
+#include "hip/hip_runtime_api.h"
+#endif
+
+namespace {
+const size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+const size_t CHUNK_SIZE = 32 * 1024 * 1024;        // Mapping the small blocks are carved from
+const size_t SMALL_BLOCK_LIMIT = CHUNK_SIZE / 8;  // Larger blocks get a mapping of their own
+
+size_t page_size() {
+    static const size_t size = sysconf(_SC_PAGESIZE);
+    return size;
+}
+
+size_t round_up(size_t value, size_t multiple) {
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+void bind_to_numa_node(void *address, size_t size, int node) {
+#ifdef SYS_mbind
+    // mbind() through the system call, rocAL does not depend on libnuma
+    const int MPOL_BIND_MODE = 2;
+    const size_t bits = 8 * sizeof(unsigned long);
+    std::vector<unsigned long> node_mask(node / bits + 1, 0);
+    node_mask[node / bits] |= 1UL << (node % bits);
+    if (syscall(SYS_mbind, address, size, MPOL_BIND_MODE, node_mask.data(), node_mask.size() * bits + 1, 0) != 0) {
+        WRN("Could not bind host memory to NUMA node " + TOSTR(node) + ": " + strerror(errno))
+    }
+#else
+    WRN("NUMA binding is not supported on this system")
+#endif
+}
+}  // namespace
+
+HostMemoryArena::~HostMemoryArena() {
+    for (auto &mapping : _mappings) {
+#if ENABLE_HIP
+        if (mapping.pinned && hipHostUnregister(mapping.address) != hipSuccess)
+            ERR("Could not unregister the pinned host memory of the arena")
+#endif
+        munmap(mapping.address, mapping.size);
+    }
+}
+
+void HostMemoryArena::set_options(const HostArenaOptions &options) {
+    std::lock_guard<std::mutex> lock(_lock);
+    if (!_mappings.empty())
+        THROW("Host memory options should be set before the arena allocates any memory")
+    _options = options;
+}
+
+void *HostMemoryArena::map(size_t size, bool pinned, size_t &mapped_size) {
+    bool huge_pages = _options.huge_pages != HugePageMode::NONE;
+    size_t page = huge_pages ? HUGE_PAGE_SIZE : page_size();
+    mapped_size = round_up(size, page);
+    void *address = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    if (_options.huge_pages == HugePageMode::EXPLICIT) {
+        address = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (address == MAP_FAILED && !_huge_page_pool_warned) {
+            WRN("The huge page pool cannot hold " + TOSTR(mapped_size) + " bytes, using transparent huge pages")
+            _huge_page_pool_warned = true;
+        }
+    }
+#endif
+    if (address == MAP_FAILED) {
+        // Transparent huge pages only back ranges aligned to the huge page size, so map one page more and trim it
+        size_t reserved_size = huge_pages ? mapped_size + page : mapped_size;
+        void *reserved = mmap(nullptr, reserved_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (reserved == MAP_FAILED)
+            THROW("Could not map " + TOSTR(mapped_size) + " bytes of host memory: " + strerror(errno))
+        auto start = reinterpret_cast<uintptr_t>(reserved);
+        auto aligned_start = round_up(start, page);
+        if (aligned_start > start)
+            munmap(reserved, aligned_start - start);
+        if (aligned_start + mapped_size < start + reserved_size)
+            munmap(reinterpret_cast<void *>(aligned_start + mapped_size), start + reserved_size - aligned_start - mapped_size);
+        address = reinterpret_cast<void *>(aligned_start);
+#ifdef MADV_HUGEPAGE
+        if (huge_pages)
+            madvise(address, mapped_size, MADV_HUGEPAGE);
+#endif
+    }
+    if (_options.numa_node >= 0)
+        bind_to_numa_node(address, mapped_size, _options.numa_node);
+    if (_options.prefault) {
+        auto bytes = static_cast<volatile unsigned char *>(address);
+        for (size_t offset = 0; offset < mapped_size; offset += page_size())
+            bytes[offset] = 0;
+    }
+    if (pinned) {
+#if ENABLE_HIP
+        hipError_t err = hipHostRegister(address, mapped_size, hipHostRegisterMapped);
+        if (err != hipSuccess) {
+            munmap(address, mapped_size);
+            THROW("hipHostRegister of size " + TOSTR(mapped_size) + " failed " + TOSTR(err))
+        }
+#else
+        munmap(address, mapped_size);
+        THROW("Pinned host memory is only supported with the HIP backend")
+#endif
+    }
+    _mappings.push_back({address, mapped_size, pinned});
+    _stats.mapped_bytes += mapped_size;
+    _stats.mapping_count++;
+    if (huge_pages)
+        _stats.huge_page_bytes += mapped_size;
+    if (pinned)
+        _stats.pinned_bytes += mapped_size;
+    return address;
+}
+
+void *HostMemoryArena::carve(size_t size) {
+    if (_chunk_left < size) {
+        // The rest of the chunk is kept for smaller requests
+        if (_chunk_left >= page_size())
+            _free_blocks[0].emplace(_chunk_left, _chunk);
+        size_t chunk_size;
+        _chunk = static_cast<unsigned char *>(map(CHUNK_SIZE, false, chunk_size));
+        _chunk_left = chunk_size;
+    }
+    void *block = _chunk;
+    _chunk += size;
+    _chunk_left -= size;
+    return block;
+}
+
+void *HostMemoryArena::allocate(size_t size, bool pinned) {
+    std::lock_guard<std::mutex> lock(_lock);
+    size = round_up(std::max(size, (size_t)1), page_size());
+    _stats.allocation_count++;
+    void *block = nullptr;
+    auto &free_blocks = _free_blocks[pinned];
+    auto it = free_blocks.lower_bound(size);
+    if (it != free_blocks.end() && it->first <= 2 * size) {
+        // A released block at most twice as large is handed out whole
+        size = it->first;
+        block = it->second;
+        free_blocks.erase(it);
+        _stats.reuse_count++;
+    } else if (pinned || size > SMALL_BLOCK_LIMIT) {
+        block = map(size, pinned, size);
+    } else {
+        block = carve(size);
+    }
+    _blocks[block] = {size, pinned};
+    _stats.in_use_bytes += size;
+    _stats.peak_in_use_bytes = std::max(_stats.peak_in_use_bytes, _stats.in_use_bytes);
+    return block;
+}
+
+void HostMemoryArena::deallocate(void *ptr) {
+    if (!ptr)
+        return;
+    std::lock_guard<std::mutex> lock(_lock);
+    auto it = _blocks.find(ptr);
+    if (it == _blocks.end()) {
+        ERR("The released block was not allocated by the host memory arena")
+        return;
+    }
+    _stats.in_use_bytes -= it->second.size;
+    _free_blocks[it->second.pinned].emplace(it->second.size, ptr);
+    _blocks.erase(it);
+}
+
+HostArenaStats HostMemoryArena::stats() {
+    std::lock_guard<std::mutex> lock(_lock);
+    return _stats;
+}
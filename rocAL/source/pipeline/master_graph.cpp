@@ -24,6 +24,7 @@ THE SOFTWARE.
 #endif
 #include <vx_ext_amd.h>
 #include <VX/vx_types.h>
+#include <algorithm>
 #include <cstring>
 #include <sched.h>
 #include <half/half.hpp>
@@ -35,6 +36,12 @@ THE SOFTWARE.
 #include "meta_data/meta_data_graph_factory.h"
 #include "meta_data/randombboxcrop_meta_data_reader_factory.h"
 #include "augmentations/node_copy.h"
+#include "augmentations/geometry_augmentations/node_crop_mirror_normalize.h"
+#include "augmentations/geometry_augmentations/node_crop_resize.h"
+#include "augmentations/geometry_augmentations/node_resize.h"
+#include "augmentations/geometry_augmentations/node_resize_mirror_normalize.h"
+#include "pipeline/graph_optimizer.h"
+#include "pipeline/thread_pool.h"
 
 using half_float::half;
 
@@ -184,6 +191,7 @@ MasterGraph::MasterGraph(size_t batch_size, RocalAffinity affinity, size_t cpu_t
 #endif
         }
         ParameterFactory::instance()->set_seed(0);  // Setting default seed for ParameterFactory instance. User can set the seed manually by calling rocalSetSeed(seed_value)
+        ParameterFactory::instance()->set_owner(this);
     } catch (const std::exception &e) {
         release();
         throw;
@@ -223,10 +231,21 @@ MasterGraph::run() {
 }
 
 void MasterGraph::decrease_image_count() {
+    if (_continuous_epochs) {
+        // The count runs down the epoch of the batch returned by run(), its last batch starts the count of the next epoch
+        _remaining_count = static_cast<int>(_ring_buffer.get_epoch_info().remaining_count);
+        return;
+    }
     if (!_loop)
         _remaining_count -= (_is_sequence_reader_output ? _sequence_batch_size : _user_batch_size);
 }
 
+void MasterGraph::skip_image_count(size_t skipped_count) {
+    // Samples the loader went past while reading a batch, quarantined or failing decode, are never output
+    if (!_loop && !_continuous_epochs)
+        _remaining_count -= skipped_count;
+}
+
 size_t
 MasterGraph::calculate_cpu_num_threads(size_t shard_count) {
     if (_cpu_num_threads <= 0) {
@@ -244,18 +263,45 @@ MasterGraph::calculate_cpu_num_threads(size_t shard_count) {
     return _cpu_num_threads;
 }
 
+void MasterGraph::create_intermediate_tensors() {
+    // Any tensor not yet created is an intermediate tensor, host and HIP ones are placed in arenas shared by tensors not alive at the same time
+    std::vector<Tensor *> planned_tensors;
+    for (auto &node : _nodes) {
+        for (auto &tensor : node->output()) {
+            if (tensor->info().type() != TensorInfo::Type::UNKNOWN)
+                continue;
+            if (tensor->info().mem_type() == RocalMemType::HOST || tensor->info().mem_type() == RocalMemType::HIP) {
+                if (tensor->create_from_handle(_context) != 0)
+                    THROW("Cannot create the intermediate tensor from handle")
+                planned_tensors.push_back(tensor);
+            } else {
+                tensor->create_virtual(_context, _graphs.empty() ? _graph->get() : _graphs[node->get_graph_id()]->get());
+            }
+            _internal_tensors.push_back(tensor);
+        }
+    }
+    _memory_planner = std::make_unique<TensorMemoryPlanner>(_nodes);
+    _memory_planner->plan(planned_tensors);
+    _memory_planner->allocate();
+
+    // Everything else the pipeline holds is allocated per output or loader and does not depend on the plan
+    size_t output_size = 0, loader_size = 0;
+    for (auto &size : _internal_tensor_list.data_size())
+        output_size += size;
+    for (auto &node : _root_nodes)
+        for (auto &output : node->output())
+            loader_size += output->info().data_size();
+    _peak_memory_size = _memory_planner->planned_size() + (output_size + loader_size) * _prefetch_queue_depth;
+    LOG("Intermediate tensors take " + std::to_string(_memory_planner->planned_size() >> 20) + " MB in " + TOSTR(_memory_planner->arena_count()) +
+        " arenas instead of " + std::to_string(_memory_planner->unplanned_size() >> 20) + " MB, the pipeline holds " + std::to_string(_peak_memory_size >> 20) + " MB")
+}
+
 void MasterGraph::create_single_graph() {
     // Actual graph creating and calls into adding nodes to graph is deferred and is happening here to enable potential future optimizations
     _graph = std::make_shared<Graph>(_context, _affinity, 0, _cpu_num_threads, _gpu_id);
-    for (auto &node : _nodes) {
-        // Any tensor not yet created can be created as virtual tensor
-        for (auto &tensor : node->output())
-            if (tensor->info().type() == TensorInfo::Type::UNKNOWN) {
-                tensor->create_virtual(_context, _graph->get());
-                _internal_tensors.push_back(tensor);
-            }
+    create_intermediate_tensors();
+    for (auto &node : _nodes)
         node->create(_graph);
-    }
     _graph->verify();
 }
 
@@ -265,15 +311,9 @@ void MasterGraph::create_multiple_graphs() {
     for (unsigned n = 0; n < _loaders_count; n++) {
         _graphs.emplace_back(std::make_shared<Graph>(_context, _affinity, 0, _cpu_num_threads, _gpu_id));
     }
-    for (auto &node : _nodes) {
-        // Any tensor not yet created can be created as virtual tensor
-        for (auto &tensor : node->output())
-            if (tensor->info().type() == TensorInfo::Type::UNKNOWN) {
-                tensor->create_virtual(_context, _graphs[node->get_graph_id()]->get());
-                _internal_tensors.push_back(tensor);
-            }
+    create_intermediate_tensors();
+    for (auto &node : _nodes)
         node->create(_graphs[node->get_graph_id()]);
-    }
 
     for (auto &graph : _graphs)
         graph->verify();
@@ -283,7 +323,18 @@ MasterGraph::Status
 MasterGraph::build() {
     if (_internal_tensor_list.empty())
         THROW("No output tensors are there, cannot create the pipeline")
+    if (_multi_view_count && _augmented_meta_data) {
+        // Every view is augmented on its own, only a label holds for all the views of a sample
+        auto meta_data = _augmented_meta_data.get();
+        if (!dynamic_cast<LabelBatch *>(meta_data) || dynamic_cast<BoundingBoxBatch *>(meta_data))
+            THROW("Multi view only supports label metadata, the other metadata can not follow the augmentations of each view")
+        while (_labels_tensor_list.size() < _user_batch_size * _multi_view_count)
+            _labels_tensor_list.push_back(new Tensor(_labels_tensor_list[0]->info()));
+    }
 
+    // The loaders and nodes may create parameters while they are created
+    ParameterFactory::instance()->set_owner(this);
+    _ring_buffer.set_host_memory_arena(_host_arena);
 #if ENABLE_HIP || ENABLE_OPENCL
     _ring_buffer.init(_mem_type, (void *)_device.resources(), _internal_tensor_list.data_size(), _internal_tensor_list.roi_size());
 #else
@@ -295,6 +346,9 @@ MasterGraph::build() {
     if (_loader_modules.size() < 1)
         THROW("At least one loader needs to be created in the pipeline")
 
+    if (_optimize_graph)
+        optimize_graph();
+
     if (_loaders_count > 1) {
         _meta_data_reader = nullptr; // Disable metadata reader for multiple loaders pipeline, support not enabled
         create_multiple_graphs();
@@ -302,6 +356,10 @@ MasterGraph::build() {
         _loader_module = _loader_modules[0];
         create_single_graph();
     }
+    // The loaders start prefetching only once the decode hints of the graph are set, so that every batch is decoded with them
+    set_loader_decode_hints();
+    for (auto &loader_module : _loader_modules)
+        loader_module->start_loading();
     start_processing();
     return Status::OK;
 }
@@ -320,6 +378,126 @@ MasterGraph::create_loader_output_tensor(const TensorInfo &info) {
     return output;
 }
 
+Tensor *
+MasterGraph::create_loader_output_alias(Tensor *loader_output, const TensorInfo &alias_info) {
+    auto parent = _tensor_map.find(loader_output);
+    if (parent == _tensor_map.end() || std::find(_root_nodes.begin(), _root_nodes.end(), parent->second) == _root_nodes.end())
+        THROW("Only the output of a loader can be aliased")
+    if (alias_info.data_size() != loader_output->info().data_size())
+        THROW("Alias size " + TOSTR(alias_info.data_size()) + " does not match the loader output size " + TOSTR(loader_output->info().data_size()))
+    /*
+     *   NOTE: The alias is a regular (non-virtual) tensor as the loader output, its handle is swapped to the loader output's buffer on every load
+     */
+    auto alias = new Tensor(alias_info);
+    if (alias->create_from_handle(_context) != 0)
+        THROW("Creating alias tensor for loader output failed");
+    _internal_tensors.push_back(alias);
+    _tensor_map.insert(std::make_pair(alias, parent->second));
+    _loader_output_aliases.emplace_back(alias, loader_output);
+    return alias;
+}
+
+void MasterGraph::optimize_graph() {
+    GraphOptimizer optimizer(_nodes, _tensor_map);
+    for (unsigned idx = 0; idx < _internal_tensor_list.size(); idx++)
+        optimizer.keep_tensor(_internal_tensor_list[idx]);
+    // Meta data nodes read the parameters of their augmentation node, the SSD crop node changes the meta data itself
+    for (auto &node : _meta_data_nodes)
+        optimizer.keep_node(node);
+    for (auto &node : _nodes)
+        if (node->_is_ssd)
+            optimizer.keep_node(node);
+    for (auto &tensor : optimizer.run())
+        _internal_tensors.push_back(tensor);
+}
+
+void MasterGraph::set_loader_decode_hints() {
+    auto loader_module = _loader_modules.begin();
+    for (auto &root_node : _root_nodes) {
+        auto loader = *(loader_module++);
+        auto loader_output = root_node->output()[0];
+        // The hint only holds when every reader of the decoded image is known, outputs and aliases are read as is
+        bool is_output = false;
+        for (unsigned idx = 0; idx < _internal_tensor_list.size(); idx++)
+            is_output |= (_internal_tensor_list[idx] == loader_output);
+        for (auto &alias : _loader_output_aliases)
+            is_output |= (alias.second == loader_output);
+        if (is_output)
+            continue;
+
+        std::vector<std::shared_ptr<Node>> consumers;
+        for (auto &node : _nodes) {
+            auto inputs = node->input();
+            if (std::find(inputs.begin(), inputs.end(), loader_output) != inputs.end())
+                consumers.push_back(node);
+        }
+        if (consumers.empty())
+            continue;
+
+        DecodeHint resize_hint, crop_hint;
+        bool all_resize = true, all_fixed_crop = true;
+        for (auto &node : consumers) {
+            // Resize reads the whole roi, it can be decoded at a smaller scale as long as it does not get smaller than the resized output
+            if (dynamic_cast<ResizeNode *>(node.get()) || dynamic_cast<ResizeMirrorNormalizeNode *>(node.get())) {
+                auto max_shape = node->output()[0]->info().max_shape();
+                resize_hint.width = std::max(resize_hint.width, static_cast<unsigned>(max_shape[0]));
+                resize_hint.height = std::max(resize_hint.height, static_cast<unsigned>(max_shape[1]));
+            } else {
+                all_resize = false;
+            }
+            // An anchored fixed crop reads a window that only depends on the image size, CropResize crops relative to the roi and is left out
+            auto crop_node = dynamic_cast<CropNode *>(node.get());
+            auto cmn_node = dynamic_cast<CropMirrorNormalizeNode *>(node.get());
+            auto crop_param = cmn_node ? cmn_node->return_crop_param() : (crop_node ? crop_node->get_crop_param() : nullptr);
+            if (crop_param && !dynamic_cast<CropResizeNode *>(node.get()) && crop_param->is_fixed_crop()) {
+                DecodeHint hint;
+                hint.fixed_crop = true;
+                hint.crop_width = crop_param->crop_w;
+                hint.crop_height = crop_param->crop_h;
+                hint.crop_anchor_x = crop_param->get_crop_anchor_x();
+                hint.crop_anchor_y = crop_param->get_crop_anchor_y();
+                if (crop_hint.fixed_crop && (crop_hint.crop_width != hint.crop_width || crop_hint.crop_height != hint.crop_height ||
+                                             crop_hint.crop_anchor_x != hint.crop_anchor_x || crop_hint.crop_anchor_y != hint.crop_anchor_y))
+                    all_fixed_crop = false;
+                crop_hint = hint;
+            } else {
+                all_fixed_crop = false;
+            }
+        }
+        if (all_resize) {
+            LOG("Loader output is only resized, decoding it at no less than " + TOSTR(resize_hint.width) + "x" + TOSTR(resize_hint.height))
+            loader->set_decode_hint(resize_hint);
+        } else if (all_fixed_crop) {
+            LOG("Loader output is only cropped, decoding its " + TOSTR(crop_hint.crop_width) + "x" + TOSTR(crop_hint.crop_height) + " crop window")
+            loader->set_decode_hint(crop_hint);
+        }
+    }
+}
+
+void MasterGraph::set_multi_view(unsigned num_views) {
+    if (_multi_view_count && _multi_view_count != num_views)
+        THROW("The pipeline already makes " + TOSTR(_multi_view_count) + " views of each sample, the labels can follow a single view count")
+    _multi_view_count = num_views;
+}
+
+void MasterGraph::repeat_labels_per_view(pMetaDataBatch meta_data) {
+    // The views of a sample are contiguous in the output, each one gets the label of its sample
+    auto &labels = meta_data->get_labels_batch();
+    std::vector<Labels> view_labels;
+    view_labels.reserve(labels.size() * _multi_view_count);
+    for (auto &label : labels)
+        view_labels.insert(view_labels.end(), _multi_view_count, label);
+    labels = std::move(view_labels);
+}
+
+void MasterGraph::update_loader_output_aliases() {
+    for (auto &[alias, loader_output] : _loader_output_aliases) {
+        if (alias->swap_handle(loader_output->buffer()) != 0)
+            THROW("Swapping the handle of the loader output alias failed")
+        loader_output->copy_roi(alias->info().roi().get_ptr());
+    }
+}
+
 Tensor *
 MasterGraph::create_tensor(const TensorInfo &info, bool is_output) {
     auto *output = new Tensor(info);
@@ -348,9 +526,100 @@ void MasterGraph::set_output(Tensor *output_tensor) {
     }
 }
 
+void MasterGraph::set_shared_data_service(const std::string &service_name, unsigned consumer_count) {
+    if (!_root_nodes.empty())
+        THROW("Shared data service should be set before the loaders are added to the pipeline")
+    if (service_name.empty() || consumer_count == 0)
+        THROW("Shared data service needs a valid name and at least one consumer")
+    _shared_service_name = service_name;
+    _shared_service_consumer_count = consumer_count;
+}
+
+void MasterGraph::set_sample_quarantine_file(const std::string &file_path) {
+    if (!_root_nodes.empty())
+        THROW("Sample quarantine file should be set before the loaders are added to the pipeline")
+    _sample_quarantine = std::make_shared<SampleQuarantine>(file_path);
+}
+
+void MasterGraph::set_continuous_epochs(bool continuous_epochs) {
+    if (!_root_nodes.empty())
+        THROW("Continuous epochs should be set before the loaders are added to the pipeline")
+    _continuous_epochs = continuous_epochs;
+}
+
+void MasterGraph::set_file_scan_options(const FileScanOptions &options) {
+    if (!_root_nodes.empty())
+        THROW("File scan options should be set before the loaders are added to the pipeline")
+    _file_scan_options = options;
+}
+
+void MasterGraph::set_record_check_policy(RecordCheckPolicy policy) {
+    if (!_root_nodes.empty())
+        THROW("Record check policy should be set before the loaders are added to the pipeline")
+    _record_check = policy == RecordCheckPolicy::OFF ? nullptr : std::make_shared<RecordCheck>(policy);
+}
+
+void MasterGraph::set_graph_optimization(bool enable) {
+    if (_graph || !_graphs.empty())
+        THROW("Graph optimization should be set before the pipeline is built")
+    _optimize_graph = enable;
+}
+
+void MasterGraph::set_host_memory_options(const HostArenaOptions &options) {
+    if (!_root_nodes.empty())
+        THROW("Host memory options should be set before the loaders are added to the pipeline")
+    // Without the options the host buffers keep coming from the heap and hipHostMalloc
+    if (!_host_arena)
+        _host_arena = std::make_shared<HostMemoryArena>();
+    _host_arena->set_options(options);
+}
+
+PipelineState MasterGraph::capture_state() {
+    PipelineState state;
+    state.seed = ParameterFactory::instance()->get_seed();
+    for (auto &loader_module : _loader_modules)
+        state.loaders.push_back(loader_module->get_state());
+    state.parameters = ParameterFactory::instance()->get_state(this);
+    return state;
+}
+
+PipelineState MasterGraph::get_state() {
+    auto state = _first_run ? _start_state : _ring_buffer.get_pipeline_state();
+    if (state.loaders.empty())
+        THROW("Pipeline state is not available, the pipeline is not running")
+    for (auto &loader_state : state.loaders)
+        if (loader_state.readers.empty())
+            THROW("Saving the state is not supported by the loaders of this pipeline")
+    return state;
+}
+
+void MasterGraph::set_state(const PipelineState &state) {
+    if (!_processing)
+        THROW("Pipeline state can only be restored on a built pipeline")
+    if (state.seed != ParameterFactory::instance()->get_seed())
+        THROW("Pipeline state was saved with seed " + TOSTR(state.seed) + ", the pipeline uses seed " + TOSTR(ParameterFactory::instance()->get_seed()))
+    if (state.loaders.size() != _loader_modules.size())
+        THROW("Pipeline state holds " + TOSTR(state.loaders.size()) + " loaders, the pipeline has " + TOSTR(_loader_modules.size()))
+    // Stop the output thread and drop the processed batches like reset() does, then resume the loaders at the saved position
+    _processing = false;
+    _ring_buffer.unblock_writer();
+    if (_output_thread.joinable())
+        _output_thread.join();
+    _ring_buffer.reset();
+    _sequence_start_framenum_vec.clear();
+    _sequence_frame_timestamps_vec.clear();
+    for (size_t idx = 0; idx < _loader_modules.size(); idx++)
+        _loader_modules[idx]->set_state(state.loaders[idx]);
+    ParameterFactory::instance()->set_state(this, state.parameters);
+    _first_run = true;
+    _output_routine_finished_processing = false;
+    start_processing();
+}
+
 void MasterGraph::release() {
     LOG("MasterGraph release ...")
     stop_processing();
+    ParameterFactory::instance()->release_owner(this);
     for (auto &node : _nodes)
         node->release();
     _nodes.clear();
@@ -382,6 +651,14 @@ void MasterGraph::release() {
         delete tensor;                // It will call the vxReleaseTensor internally in the destructor
     _internal_tensor_list.release();  // It will call the vxReleaseTensor internally in the destructor for each tensor in the list
     _output_tensor_list.release();    // It will call the vxReleaseTensor internally in the destructor for each tensor in the list
+    for (auto &lease : _output_leases) {
+        lease.first->release();
+        delete lease.first;
+    }
+    _output_leases.clear();
+    _rasterized_mask_tensor_list.release();
+    _heatmap_tensor_list.release();
+    _target_weight_tensor_list.release();
     _metadata_output_tensor_list.release(); // It will call the vxReleaseTensor internally in the destructor for each tensor in the list of TensorList
 
     if (_graph != nullptr)
@@ -391,6 +668,8 @@ void MasterGraph::release() {
     for (auto& graph : _graphs) {
         graph->release();
     }
+    if (_memory_planner)
+        _memory_planner->release();
     if (_meta_data_reader != nullptr)
         _meta_data_reader->release();
 
@@ -405,7 +684,7 @@ void MasterGraph::release() {
 MasterGraph::Status
 MasterGraph::update_node_parameters() {
     // Randomize random parameters
-    ParameterFactory::instance()->renew_parameters();
+    ParameterFactory::instance()->renew_parameters(this);
 
     // Apply renewed parameters to VX parameters used in augmentation
     for (auto &node : _nodes)
@@ -472,7 +751,7 @@ size_t
 MasterGraph::remaining_count() {
     if (!_external_source_eos && _external_source_reader)
         return _user_batch_size;
-    return (_remaining_count >= 0) ? _remaining_count : 0;
+    return std::max(_remaining_count.load(), 0);
 }
 
 RocalMemType
@@ -497,6 +776,8 @@ MasterGraph::timing() {
         t.decode_time += loader_time.decode_time;
         t.read_time += loader_time.read_time;
         t.process_time += loader_time.process_time;
+        t.frame_cache_hits += loader_time.frame_cache_hits;
+        t.frame_cache_misses += loader_time.frame_cache_misses;
     }
     t.process_time += _process_time.get_timing();
     t.copy_to_output += _convert_time.get_timing();
@@ -937,6 +1218,36 @@ MasterGraph::get_output_tensors() {
     return &_output_tensor_list;
 }
 
+TensorList *
+MasterGraph::acquire_output() {
+    auto lease = _ring_buffer.lease_read_buffers();
+    auto output = new TensorList();
+    for (unsigned i = 0; i < _output_tensor_list.size(); i++) {
+        auto tensor = new Tensor(_output_tensor_list[i]->info());
+        tensor->set_mem_handle(lease.buffers[i]);
+        tensor->set_roi(lease.roi_buffers[i]);
+        output->push_back(tensor);
+    }
+    std::lock_guard<std::mutex> lock(_output_lease_lock);
+    _output_leases[output] = lease.id;
+    return output;
+}
+
+void MasterGraph::release_output(TensorList *output) {
+    size_t lease_id;
+    {
+        std::lock_guard<std::mutex> lock(_output_lease_lock);
+        auto lease = _output_leases.find(output);
+        if (lease == _output_leases.end())
+            THROW("The output tensor list was not acquired from this pipeline or was already released")
+        lease_id = lease->second;
+        _output_leases.erase(lease);
+    }
+    _ring_buffer.release_lease(lease_id);
+    output->release();
+    delete output;
+}
+
 bool MasterGraph::is_out_of_data() {
     // If any of the loader module's remaining count is less than the batch size, return loader out of data
     for (auto& loader_module : _loader_modules) {
@@ -970,11 +1281,13 @@ void MasterGraph::output_routine() {
             auto load_ret = _loader_module->load_next();
             if (load_ret != LoaderModuleStatus::OK)
                 THROW("Loader module failed to load next batch of images, status " + TOSTR(load_ret))
+            update_loader_output_aliases();
             if (!_processing)
                 break;
             auto full_batch_data_names = _loader_module->get_id();
             auto decode_data_info = _loader_module->get_decode_data_info();
             auto crop_image_info = _loader_module->get_crop_image_info();
+            skip_image_count(decode_data_info._skipped_count);
 
             if (full_batch_data_names.size() != _user_batch_size)
                 WRN("Master Graph: Names count does not equal batch_size" + TOSTR(full_batch_data_names.size()))
@@ -1011,6 +1324,8 @@ void MasterGraph::output_routine() {
                     }
                     _meta_data_graph->process(_augmented_meta_data, output_meta_data);
                 }
+                if (_multi_view_count)
+                    repeat_labels_per_view(output_meta_data);
             }
             _process_time.start();
             _graph->process();
@@ -1034,12 +1349,20 @@ void MasterGraph::output_routine() {
                 int *matches_write_buffer = reinterpret_cast<int *>(_ring_buffer.get_meta_write_buffers()[2]);
                 _meta_data_graph->update_box_iou_matcher(_iou_matcher_info, matches_write_buffer, output_meta_data);
             }
+            if (_mask_rasterizer)
+                _mask_rasterizer->rasterize(output_meta_data, reinterpret_cast<uint8_t *>(_ring_buffer.get_meta_write_buffers()[_rasterized_mask_buffer_idx]));
+            if (_heatmap_generator) {
+                auto meta_write_buffers = _ring_buffer.get_meta_write_buffers();
+                _heatmap_generator->generate(output_meta_data, reinterpret_cast<float *>(meta_write_buffers[_heatmap_buffer_idx]), reinterpret_cast<float *>(meta_write_buffers[_target_weight_buffer_idx]));
+            }
             _bencode_time.end();
 #ifdef ROCAL_VIDEO
             _sequence_start_framenum_vec.insert(_sequence_start_framenum_vec.begin(), _loader_module->get_sequence_start_frame_number());
             _sequence_frame_timestamps_vec.insert(_sequence_frame_timestamps_vec.begin(), _loader_module->get_sequence_frame_timestamps());
 #endif
             _ring_buffer.set_meta_data(full_batch_data_names, output_meta_data);
+            _ring_buffer.set_epoch_info(decode_data_info._epoch_info);
+            _ring_buffer.set_pipeline_state(capture_state());
             _ring_buffer.push();  // The data and metadata is now stored in output the ring_buffer, increases it's level by 1
         }
     } catch (const std::exception &e) {
@@ -1069,11 +1392,15 @@ void MasterGraph::output_routine_multiple_loaders() {
             _rb_block_if_full_time.end();
 
             // Swap handles on the input tensor, so that new tensor is loaded to be processed
+            size_t skipped_count = 0;
             for (auto loader_module : _loader_modules) {
                 auto load_ret = loader_module->load_next();
                 if (load_ret != LoaderModuleStatus::OK)
                     THROW("Loader module failed to load next batch of images, status " + TOSTR(load_ret))
+                skipped_count = std::max(skipped_count, loader_module->get_decode_data_info()._skipped_count);
             }
+            skip_image_count(skipped_count);
+            update_loader_output_aliases();
 
             if (!_processing)
                 break;
@@ -1086,6 +1413,8 @@ void MasterGraph::output_routine_multiple_loaders() {
                 break;
 
             update_node_parameters();
+            _ring_buffer.set_epoch_info(_loader_modules[0]->get_decode_data_info()._epoch_info);
+            _ring_buffer.set_pipeline_state(capture_state());
             _process_time.start();
             for (auto& graph : _graphs) {
                 graph->process();
@@ -1106,11 +1435,12 @@ void MasterGraph::output_routine_multiple_loaders() {
 }
 
 void MasterGraph::start_processing() {
+    _start_state = capture_state();
     _processing = true;
     _remaining_count = _loader_modules[0]->remaining_count();
     for (int i = 1; i < _loaders_count; i++) {
         // Stores the least remaining count value of all loaders
-        _remaining_count = std::min(_remaining_count, static_cast<int>(_loader_modules[i]->remaining_count()));
+        _remaining_count = std::min(_remaining_count.load(), static_cast<int>(_loader_modules[i]->remaining_count()));
     }
     if (_loaders_count == 1) {
         _output_thread = std::thread(&MasterGraph::output_routine, this);
@@ -1151,6 +1481,9 @@ TensorListVector* MasterGraph::create_coco_meta_data_reader(const char *source_p
     config.set_aspect_ratio_grouping(aspect_ratio_grouping);
     config.set_out_img_width(pose_output_width);
     config.set_out_img_height(pose_output_height);
+    _pose_sigma = sigma;
+    _pose_output_width = pose_output_width;
+    _pose_output_height = pose_output_height;
     _meta_data_graph = create_meta_data_graph(config);
     _meta_data_reader = create_meta_data_reader(config, _augmented_meta_data);
     _meta_data_reader->read_all(source_path);
@@ -1548,6 +1881,48 @@ void MasterGraph::box_iou_matcher(std::vector<float> &anchors,
     _iou_matcher_info.allow_low_quality_matches = allow_low_quality_matches;
 }
 
+void MasterGraph::polygon_mask_rasterizer(unsigned mask_width, unsigned mask_height, MaskType mask_type, unsigned max_instances) {
+    if (!_meta_data_reader || _augmented_meta_data->get_metadata_type() != MetaDataType::PolygonMask)
+        THROW("Masks can only be rasterized with a COCO reader that outputs polygon masks")
+    if (_mask_rasterizer)
+        THROW("A mask rasterizer has already been created")
+    _mask_rasterizer = std::make_unique<PolygonMaskRasterizer>(mask_width, mask_height, mask_type, max_instances);
+    std::vector<size_t> dims;
+    if (mask_type == MaskType::SEMANTIC)
+        dims = {mask_height, mask_width};
+    else
+        dims = {max_instances, mask_height, mask_width};
+    auto default_mask_info = TensorInfo(std::move(dims), _mem_type, RocalTensorDataType::UINT8);  // Create default rasterized mask info
+    default_mask_info.set_metadata();
+    for (unsigned i = 0; i < _user_batch_size; i++) {
+        auto mask_info = default_mask_info;
+        _rasterized_mask_tensor_list.push_back(new Tensor(mask_info));
+    }
+    _rasterized_mask_buffer_idx = _ring_buffer.add_metadata_sub_buffer(_user_batch_size * _mask_rasterizer->sample_size());
+}
+
+void MasterGraph::keypoint_heatmaps(unsigned heatmap_width, unsigned heatmap_height, float sigma) {
+    if (!_meta_data_reader || _augmented_meta_data->get_metadata_type() != MetaDataType::KeyPoints)
+        THROW("Heatmaps can only be generated with a COCO key points reader")
+    if (_heatmap_generator)
+        THROW("Key point heatmaps have already been enabled")
+    _heatmap_generator = std::make_unique<KeypointHeatmapGenerator>(_pose_output_width, _pose_output_height, heatmap_width, heatmap_height, sigma > 0 ? sigma : _pose_sigma);
+    std::vector<size_t> dims = {NUMBER_OF_JOINTS, heatmap_height, heatmap_width};
+    auto default_heatmap_info = TensorInfo(std::move(dims), _mem_type, RocalTensorDataType::FP32);  // Create default heatmap info
+    default_heatmap_info.set_metadata();
+    dims = {NUMBER_OF_JOINTS, 1};
+    auto default_target_weight_info = TensorInfo(std::move(dims), _mem_type, RocalTensorDataType::FP32);  // Create default target weight info
+    default_target_weight_info.set_metadata();
+    for (unsigned i = 0; i < _user_batch_size; i++) {
+        auto heatmap_info = default_heatmap_info;
+        auto target_weight_info = default_target_weight_info;
+        _heatmap_tensor_list.push_back(new Tensor(heatmap_info));
+        _target_weight_tensor_list.push_back(new Tensor(target_weight_info));
+    }
+    _heatmap_buffer_idx = _ring_buffer.add_metadata_sub_buffer(_user_batch_size * default_heatmap_info.data_size());
+    _target_weight_buffer_idx = _ring_buffer.add_metadata_sub_buffer(_user_batch_size * default_target_weight_info.data_size());
+}
+
 size_t MasterGraph::bounding_box_batch_count(pMetaDataBatch meta_data_batch) {
     size_t size = 0;
     for (unsigned i = 0; i < _user_batch_size; i++)
@@ -1566,7 +1941,7 @@ TensorList *MasterGraph::labels_meta_data() {
     if (_ring_buffer.level() == 0)
         THROW("No meta data has been loaded")
     auto meta_data_buffers = (unsigned char *)_ring_buffer.get_meta_read_buffers()[0];  // Get labels buffer from ring buffer
-    auto labels = _ring_buffer.get_meta_data().second->get_labels_batch();
+    auto &labels = _ring_buffer.get_meta_data().second->get_labels_batch();
     for (unsigned i = 0; i < _labels_tensor_list.size(); i++) {
         _labels_tensor_list[i]->set_dims({labels[i].size()});
         _labels_tensor_list[i]->set_mem_handle((void *)meta_data_buffers);
@@ -1575,6 +1950,135 @@ TensorList *MasterGraph::labels_meta_data() {
     return &_labels_tensor_list;
 }
 
+namespace {
+constexpr size_t LABEL_TASK_BYTES = 256 * 1024;          // Bytes of labels written by one task
+constexpr size_t LABEL_MIN_PARALLEL_BYTES = 1 << 20;    // Smaller label batches are written on the calling thread
+
+size_t label_type_size(RocalLabelType label_type) {
+    switch (label_type) {
+        case ROCAL_LABEL_INT32:
+            return sizeof(int32_t);
+        case ROCAL_LABEL_INT64:
+            return sizeof(int64_t);
+        case ROCAL_LABEL_FP32:
+            return sizeof(float);
+        default:
+            THROW("Unsupported label type " + TOSTR(label_type))
+    }
+}
+
+// Runs write(first, last) over ranges of samples, on the host copy pool when the batch is large
+void write_label_samples(size_t num_samples, size_t sample_bytes, const std::function<void(size_t, size_t)> &write) {
+    if (num_samples * sample_bytes < LABEL_MIN_PARALLEL_BYTES) {
+        write(0, num_samples);
+        return;
+    }
+    size_t samples_per_task = std::max(LABEL_TASK_BYTES / sample_bytes, static_cast<size_t>(1));
+    size_t num_tasks = (num_samples + samples_per_task - 1) / samples_per_task;
+    host_copy_thread_pool().parallel_for(num_tasks, [&](size_t task) {
+        size_t first = task * samples_per_task;
+        write(first, std::min(first + samples_per_task, num_samples));
+    });
+}
+
+template <typename T>
+void write_labels(T *dst, const std::vector<Labels> &labels) {
+    for (size_t i = 0; i < labels.size(); i++)
+        dst[i] = labels[i].empty() ? static_cast<T>(-1) : static_cast<T>(labels[i][0]);
+}
+
+// Label 0 is encoded as the last class and label n as class n - 1, as done by rocalGetOneHotImageLabels()
+template <typename T>
+void write_one_hot_labels(T *dst, const std::vector<Labels> &labels, size_t first, size_t last, unsigned num_of_classes, T on_value, T off_value) {
+    for (size_t i = first; i < last; i++) {
+        T *sample = dst + i * num_of_classes;
+        std::fill(sample, sample + num_of_classes, off_value);
+        if (labels[i].empty()) continue;
+        int label_index = labels[i][0];
+        if (label_index > 0 && label_index <= static_cast<int>(num_of_classes))
+            sample[label_index - 1] = on_value;
+        else if (!label_index)
+            sample[num_of_classes - 1] = on_value;
+    }
+}
+}  // namespace
+
+void *MasterGraph::label_host_buffer(void *buf, size_t size, RocalOutputMemType output_mem_type) {
+    if (output_mem_type != RocalOutputMemType::ROCAL_MEMCPY_GPU)
+        return buf;
+    if (_label_staging_buffer.size() < size)
+        _label_staging_buffer.resize(size);
+    return _label_staging_buffer.data();
+}
+
+void MasterGraph::upload_labels(void *buf, size_t size, RocalOutputMemType output_mem_type) {
+    if (output_mem_type != RocalOutputMemType::ROCAL_MEMCPY_GPU)
+        return;
+#if ENABLE_HIP
+    hipError_t err = hipMemcpy(buf, _label_staging_buffer.data(), size, hipMemcpyHostToDevice);
+    if (err != hipSuccess)
+        THROW("Invalid Data Pointer: Error copying to device memory")
+#elif ENABLE_OPENCL
+    if (clEnqueueWriteBuffer(get_ocl_cmd_q(), (cl_mem)buf, CL_TRUE, 0, size, _label_staging_buffer.data(), 0, NULL, NULL) != CL_SUCCESS)
+        THROW("Invalid Data Pointer: Error copying to device memory")
+#else
+    THROW("Copying the labels to device memory is not supported without a GPU backend")
+#endif
+}
+
+void MasterGraph::copy_labels(void *buf, RocalLabelType label_type, RocalOutputMemType output_mem_type) {
+    auto &meta_data_batch = meta_data().second;
+    if (!meta_data_batch)
+        THROW("No label has been loaded for this output batch")
+    auto &labels = meta_data_batch->get_labels_batch();
+    size_t size = labels.size() * label_type_size(label_type);
+    void *dst = label_host_buffer(buf, size, output_mem_type);
+    switch (label_type) {
+        case ROCAL_LABEL_INT32:
+            write_labels(static_cast<int32_t *>(dst), labels);
+            break;
+        case ROCAL_LABEL_INT64:
+            write_labels(static_cast<int64_t *>(dst), labels);
+            break;
+        case ROCAL_LABEL_FP32:
+            write_labels(static_cast<float *>(dst), labels);
+            break;
+    }
+    upload_labels(buf, size, output_mem_type);
+}
+
+void MasterGraph::copy_one_hot_labels(void *buf, unsigned num_of_classes, RocalLabelType label_type, float label_smoothing, RocalOutputMemType output_mem_type) {
+    if (num_of_classes == 0)
+        THROW("The number of classes must be positive for one hot labels")
+    if (label_smoothing < 0.0f || label_smoothing >= 1.0f)
+        THROW("Label smoothing must be in [0, 1), got " + TOSTR(label_smoothing))
+    if (label_smoothing != 0.0f && label_type != ROCAL_LABEL_FP32)
+        THROW("Label smoothing is only supported for float labels")
+    auto &meta_data_batch = meta_data().second;
+    if (!meta_data_batch)
+        THROW("No label has been loaded for this output batch")
+    auto &labels = meta_data_batch->get_labels_batch();
+    size_t sample_bytes = num_of_classes * label_type_size(label_type);
+    size_t size = labels.size() * sample_bytes;
+    void *dst = label_host_buffer(buf, size, output_mem_type);
+    float off_value = label_smoothing / num_of_classes;
+    float on_value = 1.0f - label_smoothing + off_value;
+    write_label_samples(labels.size(), sample_bytes, [&](size_t first, size_t last) {
+        switch (label_type) {
+            case ROCAL_LABEL_INT32:
+                write_one_hot_labels<int32_t>(static_cast<int32_t *>(dst), labels, first, last, num_of_classes, 1, 0);
+                break;
+            case ROCAL_LABEL_INT64:
+                write_one_hot_labels<int64_t>(static_cast<int64_t *>(dst), labels, first, last, num_of_classes, 1, 0);
+                break;
+            case ROCAL_LABEL_FP32:
+                write_one_hot_labels<float>(static_cast<float *>(dst), labels, first, last, num_of_classes, on_value, off_value);
+                break;
+        }
+    });
+    upload_labels(buf, size, output_mem_type);
+}
+
 TensorListVector *MasterGraph::ascii_values_meta_data() {
     if (!_meta_data_reader && _loaders_count > 1)
         THROW("Metadata reader is not compatible with multiple loaders")
@@ -1649,6 +2153,49 @@ TensorList *MasterGraph::matched_index_meta_data() {
     return &_matches_tensor_list;
 }
 
+TensorList *MasterGraph::rasterized_mask_meta_data() {
+    if (!_mask_rasterizer)
+        THROW("Polygon mask rasterizer is not set, cannot return rasterized masks")
+    if (_ring_buffer.level() == 0)
+        THROW("No meta data has been loaded")
+    auto meta_data_buffers = reinterpret_cast<unsigned char *>(_ring_buffer.get_meta_read_buffers()[_rasterized_mask_buffer_idx]);  // Get rasterized mask buffer from ring buffer
+    auto meta_data = _ring_buffer.get_meta_data().second;
+    for (unsigned i = 0; i < _rasterized_mask_tensor_list.size(); i++) {
+        if (_mask_rasterizer->mask_type() == MaskType::SEMANTIC)
+            _rasterized_mask_tensor_list[i]->set_dims({_mask_rasterizer->height(), _mask_rasterizer->width()});
+        else
+            _rasterized_mask_tensor_list[i]->set_dims({_mask_rasterizer->instance_count(meta_data, i), _mask_rasterizer->height(), _mask_rasterizer->width()});
+        _rasterized_mask_tensor_list[i]->set_mem_handle(reinterpret_cast<void *>(meta_data_buffers + i * _mask_rasterizer->sample_size()));
+    }
+    return &_rasterized_mask_tensor_list;
+}
+
+TensorList *MasterGraph::keypoint_heatmap_meta_data() {
+    if (!_heatmap_generator)
+        THROW("Key point heatmaps are not enabled, cannot return heatmaps")
+    if (_ring_buffer.level() == 0)
+        THROW("No meta data has been loaded")
+    auto meta_data_buffers = reinterpret_cast<unsigned char *>(_ring_buffer.get_meta_read_buffers()[_heatmap_buffer_idx]);  // Get heatmap buffer from ring buffer
+    for (unsigned i = 0; i < _heatmap_tensor_list.size(); i++) {
+        _heatmap_tensor_list[i]->set_mem_handle(reinterpret_cast<void *>(meta_data_buffers));
+        meta_data_buffers += _heatmap_tensor_list[i]->info().data_size();
+    }
+    return &_heatmap_tensor_list;
+}
+
+TensorList *MasterGraph::keypoint_target_weight_meta_data() {
+    if (!_heatmap_generator)
+        THROW("Key point heatmaps are not enabled, cannot return target weights")
+    if (_ring_buffer.level() == 0)
+        THROW("No meta data has been loaded")
+    auto meta_data_buffers = reinterpret_cast<unsigned char *>(_ring_buffer.get_meta_read_buffers()[_target_weight_buffer_idx]);  // Get target weight buffer from ring buffer
+    for (unsigned i = 0; i < _target_weight_tensor_list.size(); i++) {
+        _target_weight_tensor_list[i]->set_mem_handle(reinterpret_cast<void *>(meta_data_buffers));
+        meta_data_buffers += _target_weight_tensor_list[i]->info().data_size();
+    }
+    return &_target_weight_tensor_list;
+}
+
 void MasterGraph::notify_user_thread() {
     if (_output_routine_finished_processing)
         return;
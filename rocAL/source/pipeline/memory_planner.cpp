@@ -0,0 +1,154 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "pipeline/memory_planner.h"
+
+#include <cstdlib>
+
+#include "device/device_manager_hip.h"
+#include "pipeline/exception.h"
+#include "pipeline/log.h"
+
+TensorMemoryPlanner::TensorMemoryPlanner(const std::list<std::shared_ptr<Node>> &nodes) {
+    size_t node_idx = 0;
+    for (auto &node : nodes) {
+        _node_index[node.get()] = node_idx++;
+        for (auto &output : node->output())
+            _producers[output] = node.get();
+        for (auto &input : node->input())
+            _consumers[input].push_back(node.get());
+    }
+    // A node runs after the producers of its inputs and so after all of their ancestors
+    _ancestors.resize(nodes.size(), std::vector<bool>(nodes.size(), false));
+    for (auto &node : nodes) {
+        auto node_idx = _node_index[node.get()];
+        for (auto &input : node->input()) {
+            auto producer = _producers.find(input);
+            if (producer == _producers.end())
+                continue;
+            auto parent_idx = _node_index[producer->second];
+            _ancestors[node_idx][parent_idx] = true;
+            for (size_t idx = 0; idx < nodes.size(); idx++)
+                if (_ancestors[parent_idx][idx])
+                    _ancestors[node_idx][idx] = true;
+        }
+    }
+}
+
+TensorMemoryPlanner::~TensorMemoryPlanner() {
+    release();
+}
+
+bool TensorMemoryPlanner::is_ancestor(Node *ancestor, Node *node) {
+    return _ancestors[_node_index[node]][_node_index[ancestor]];
+}
+
+bool TensorMemoryPlanner::can_reuse(const Arena &arena, Node *producer) {
+    auto last_tensor = arena.last_tensor;
+    if (!is_ancestor(_producers[last_tensor], producer))
+        return false;
+    // The arena can only be written once every reader of its previous tensor is done, a node reading and writing it is not
+    for (auto &consumer : _consumers[last_tensor])
+        if (!is_ancestor(consumer, producer))
+            return false;
+    return true;
+}
+
+void TensorMemoryPlanner::plan(const std::vector<Tensor *> &tensors) {
+    for (auto &tensor : tensors) {
+        auto producer = _producers.find(tensor);
+        if (producer == _producers.end())
+            THROW("Only the outputs of the nodes can be planned")
+        size_t size = MEM_ALIGNMENT * ((tensor->info().data_size() + MEM_ALIGNMENT - 1) / MEM_ALIGNMENT);
+        _unplanned_size += size;
+
+        // Prefer the smallest free arena the tensor fits in, otherwise grow the largest free one
+        Arena *best_fit = nullptr, *largest = nullptr;
+        for (auto &arena : _arenas) {
+            if (arena.mem_type != tensor->info().mem_type() || !can_reuse(arena, producer->second))
+                continue;
+            if (arena.size >= size && (!best_fit || arena.size < best_fit->size))
+                best_fit = &arena;
+            if (!largest || arena.size > largest->size)
+                largest = &arena;
+        }
+        auto arena = best_fit ? best_fit : largest;
+        if (!arena) {
+            _arenas.emplace_back();
+            arena = &_arenas.back();
+            arena->mem_type = tensor->info().mem_type();
+        }
+        arena->size = std::max(arena->size, size);
+        arena->last_tensor = tensor;
+        arena->tensors.push_back(tensor);
+    }
+}
+
+void TensorMemoryPlanner::allocate() {
+    for (auto &arena : _arenas) {
+        if (arena.buffer)
+            continue;
+        if (arena.mem_type == RocalMemType::HIP) {
+#if ENABLE_HIP
+            hipError_t err = hipMalloc(&arena.buffer, arena.size);
+            if (err != hipSuccess)
+                THROW("hipMalloc of size " + TOSTR(arena.size) + " failed for the intermediate tensors " + TOSTR(err))
+#else
+            THROW("HIP intermediate tensors need rocAL to be built with HIP")
+#endif
+        } else {
+            arena.buffer = aligned_alloc(MEM_ALIGNMENT, arena.size);
+            if (!arena.buffer)
+                THROW("Allocating " + TOSTR(arena.size) + " bytes failed for the intermediate tensors")
+        }
+        for (auto &tensor : arena.tensors)
+            if (tensor->swap_handle(arena.buffer) != 0)
+                THROW("Swapping the handle of an intermediate tensor to its arena failed")
+    }
+}
+
+void TensorMemoryPlanner::release() {
+    for (auto &arena : _arenas) {
+        if (!arena.buffer)
+            continue;
+        if (arena.mem_type == RocalMemType::HIP) {
+#if ENABLE_HIP
+            if (hipFree(arena.buffer) != hipSuccess)
+                ERR("Could not release hip memory of the intermediate tensors")
+#endif
+        } else {
+            free(arena.buffer);
+        }
+        arena.buffer = nullptr;
+    }
+}
+
+size_t TensorMemoryPlanner::planned_size() const {
+    size_t size = 0;
+    for (auto &arena : _arenas)
+        size += arena.size;
+    return size;
+}
+
+size_t TensorMemoryPlanner::unplanned_size() const {
+    return _unplanned_size;
+}
@@ -22,6 +22,10 @@ THE SOFTWARE.
 
 #include "pipeline/node.h"
 
+#include <algorithm>
+
+#include "pipeline/exception.h"
+
 Node::~Node() {
     if (_node) vxReleaseNode(&_node);
     _node = nullptr;
@@ -44,6 +48,12 @@ void Node::update_parameters() {
     update_node();
 }
 
+void Node::replace_input(Tensor *input, Tensor *replacement) {
+    if (_node)
+        THROW("Cannot replace the input of a Node already added to the graph")
+    std::replace(_inputs.begin(), _inputs.end(), input, replacement);
+}
+
 void Node::add_next(const std::shared_ptr<Node> &node) {
     // Set graph ID to the Node, to denote the graph to which it belongs to
     if (node->get_graph_id() < 0) node->set_graph_id(_graph_id);
@@ -57,3 +67,11 @@ void Node::add_previous(const std::shared_ptr<Node> &node) {
     }
     _prev.emplace_back(node);
 }
+
+void Node::remove_next(const std::shared_ptr<Node> &node) {
+    _next.erase(std::remove(_next.begin(), _next.end(), node), _next.end());
+}
+
+void Node::remove_previous(const std::shared_ptr<Node> &node) {
+    _prev.erase(std::remove(_prev.begin(), _prev.end(), node), _prev.end());
+}
@@ -0,0 +1,130 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "pipeline/pipeline_state.h"
+
+#include <cstring>
+
+#include "pipeline/exception.h"
+#include "pipeline/log.h"
+
+namespace {
+const uint32_t PIPELINE_STATE_MAGIC = 0x53434F52;  // "ROCS"
+const uint32_t PIPELINE_STATE_VERSION = 1;
+
+class StateWriter {
+   public:
+    template <typename T>
+    void write(T value) {
+        auto bytes = reinterpret_cast<const uint8_t *>(&value);
+        _data.insert(_data.end(), bytes, bytes + sizeof(T));
+    }
+    std::vector<uint8_t> &data() { return _data; }
+
+   private:
+    std::vector<uint8_t> _data;
+};
+
+class StateReader {
+   public:
+    StateReader(const uint8_t *data, size_t size) : _data(data), _size(size) {}
+    template <typename T>
+    T read() {
+        if (_offset + sizeof(T) > _size)
+            THROW("Pipeline state is truncated")
+        T value;
+        memcpy(&value, _data + _offset, sizeof(T));
+        _offset += sizeof(T);
+        return value;
+    }
+    //! Reads an element count, bounded by the bytes left so a corrupt count cannot trigger a huge allocation
+    uint64_t read_count(size_t element_size) {
+        auto count = read<uint64_t>();
+        if (count > (_size - _offset) / element_size)
+            THROW("Pipeline state is corrupt")
+        return count;
+    }
+
+   private:
+    const uint8_t *_data;
+    size_t _size;
+    size_t _offset = 0;
+};
+}  // namespace
+
+std::vector<uint8_t> serialize_pipeline_state(const PipelineState &state) {
+    StateWriter writer;
+    writer.write(PIPELINE_STATE_MAGIC);
+    writer.write(PIPELINE_STATE_VERSION);
+    writer.write(state.seed);
+    writer.write<uint64_t>(state.loaders.size());
+    for (auto &loader : state.loaders) {
+        if (loader.epochs.size() != loader.readers.size())
+            THROW("Loader state needs an epoch per reader")
+        writer.write(loader.loader_idx);
+        writer.write<uint64_t>(loader.readers.size());
+        for (size_t shard = 0; shard < loader.readers.size(); shard++) {
+            auto &reader = loader.readers[shard];
+            writer.write(reader.epoch);
+            writer.write(reader.curr_file_idx);
+            writer.write(reader.read_counter);
+            writer.write(reader.shard_id);
+            writer.write(loader.epochs[shard]);
+        }
+    }
+    writer.write<uint64_t>(state.parameters.size());
+    for (auto iteration : state.parameters)
+        writer.write(iteration);
+    return std::move(writer.data());
+}
+
+PipelineState deserialize_pipeline_state(const uint8_t *data, size_t size) {
+    if (!data)
+        THROW("Pipeline state buffer is null")
+    StateReader reader(data, size);
+    if (reader.read<uint32_t>() != PIPELINE_STATE_MAGIC)
+        THROW("Buffer does not hold a rocAL pipeline state")
+    auto version = reader.read<uint32_t>();
+    if (version != PIPELINE_STATE_VERSION)
+        THROW("Unsupported pipeline state version " + TOSTR(version))
+    PipelineState state;
+    state.seed = reader.read<uint64_t>();
+    state.loaders.resize(reader.read_count(2 * sizeof(uint64_t)));
+    for (auto &loader : state.loaders) {
+        loader.loader_idx = reader.read<uint64_t>();
+        auto shard_count = reader.read_count(5 * sizeof(uint64_t));
+        loader.readers.resize(shard_count);
+        loader.epochs.resize(shard_count);
+        for (size_t shard = 0; shard < shard_count; shard++) {
+            auto &reader_state = loader.readers[shard];
+            reader_state.epoch = reader.read<uint64_t>();
+            reader_state.curr_file_idx = reader.read<uint64_t>();
+            reader_state.read_counter = reader.read<int64_t>();
+            reader_state.shard_id = reader.read<uint64_t>();
+            loader.epochs[shard] = reader.read<uint64_t>();
+        }
+    }
+    state.parameters.resize(reader.read_count(sizeof(uint64_t)));
+    for (auto &iteration : state.parameters)
+        iteration = reader.read<uint64_t>();
+    return state;
+}
@@ -20,6 +20,8 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 THE SOFTWARE.
 */
 
+#include <algorithm>
+
 #include "pipeline/ring_buffer.h"
 #include "device/device_manager.h"
 
@@ -114,6 +116,8 @@ void RingBuffer::init(RocalMemType mem_type, void *devres, std::vector<size_t> &
     _mem_type = mem_type;
     _dev = devres;
     _sub_buffer_size = sub_buffer_size;
+    _roi_buffer_size = roi_buffer_size;
+    _slot_leases.assign(BUFF_DEPTH, 0);
     auto sub_buffer_count = sub_buffer_size.size();
     if (BUFF_DEPTH < 2)
         THROW("Error internal buffer size for the ring buffer should be greater than one")
@@ -176,7 +180,7 @@ void RingBuffer::init(RocalMemType mem_type, void *devres, std::vector<size_t> &
             _host_sub_buffers[buffIdx].resize(sub_buffer_count);
             _host_roi_buffers[buffIdx].resize(sub_buffer_count);
             for (size_t sub_buff_idx = 0; sub_buff_idx < sub_buffer_count; sub_buff_idx++) {
-                _host_sub_buffers[buffIdx][sub_buff_idx] = aligned_alloc(MEM_ALIGNMENT, MEM_ALIGNMENT * (_sub_buffer_size[sub_buff_idx] / MEM_ALIGNMENT + 1));
+                _host_sub_buffers[buffIdx][sub_buff_idx] = allocate_host_sub_buffer(_sub_buffer_size[sub_buff_idx]);
                 _host_roi_buffers[buffIdx][sub_buff_idx] = static_cast<unsigned *>(malloc(roi_buffer_size[sub_buff_idx]));  // Allocate HOST ROI buffers
             }
         }
@@ -262,10 +266,25 @@ void RingBuffer::init_metadata(RocalMemType mem_type, std::vector<size_t> &sub_b
     }
 }
 
+unsigned RingBuffer::add_metadata_sub_buffer(size_t size) {
+    if (_host_meta_data_buffers.size() != BUFF_DEPTH)
+        THROW("Metadata buffers need to be initialized before adding a sub buffer")
+    for (size_t buffIdx = 0; buffIdx < BUFF_DEPTH; buffIdx++) {
+        void *buffer = malloc(size);
+        if (buffer == nullptr)
+            THROW("Metadata ring buffer allocation failed")
+        _host_meta_data_buffers[buffIdx].emplace_back(buffer);
+        _meta_data_sub_buffer_size[buffIdx].emplace_back(size);
+    }
+    return _meta_data_sub_buffer_count++;
+}
+
 void RingBuffer::push() {
     // pushing and popping to and from image and metadata buffer should be atomic so that their level stays the same at all times
     std::unique_lock<std::mutex> lock(_names_buff_lock);
     _meta_ring_buffer.push(_last_image_meta_data);
+    _epoch_ring_buffer.push(_last_epoch_info);
+    _state_ring_buffer.push(_last_pipeline_state);
     increment_write_ptr();
 }
 
@@ -274,17 +293,26 @@ void RingBuffer::pop() {
         return;
     // pushing and popping to and from image and metadata buffer should be atomic so that their level stays the same at all times
     std::unique_lock<std::mutex> lock(_names_buff_lock);
+    detach_slot_lease(_read_ptr);
     increment_read_ptr();
     _meta_ring_buffer.pop();
+    _epoch_ring_buffer.pop();
+    _state_ring_buffer.pop();
 }
 
 void RingBuffer::reset() {
+    for (size_t slot = 0; slot < _slot_leases.size(); slot++)
+        detach_slot_lease(slot);
     _write_ptr = 0;
     _read_ptr = 0;
     _level = 0;
     _dont_block = false;
     while (!_meta_ring_buffer.empty())
         _meta_ring_buffer.pop();
+    while (!_epoch_ring_buffer.empty())
+        _epoch_ring_buffer.pop();
+    while (!_state_ring_buffer.empty())
+        _state_ring_buffer.pop();
 }
 
 void RingBuffer::release_gpu_res() {
@@ -340,7 +368,7 @@ RingBuffer::~RingBuffer() {
         for (unsigned buffIdx = 0; buffIdx < _host_sub_buffers.size(); buffIdx++) {
             for (unsigned sub_buf_idx = 0; sub_buf_idx < _host_sub_buffers[buffIdx].size(); sub_buf_idx++) {
                 if (_host_sub_buffers[buffIdx][sub_buf_idx])
-                    free(_host_sub_buffers[buffIdx][sub_buf_idx]);
+                    free_host_sub_buffer(_host_sub_buffers[buffIdx][sub_buf_idx]);
                 if (_host_roi_buffers[buffIdx][sub_buf_idx])
                     free(_host_roi_buffers[buffIdx][sub_buf_idx]);
             }
@@ -354,9 +382,90 @@ RingBuffer::~RingBuffer() {
         _host_sub_buffers.clear();
         _host_meta_data_buffers.clear();
         _host_roi_buffers.clear();
+        // Buffers still leased become invalid along with the pipeline
+        for (auto &lease : _leases)
+            _spare_buffers.push_back(std::move(lease.second));
+        _leases.clear();
+        for (auto &spare : _spare_buffers) {
+            for (size_t idx = 0; idx < spare.buffers.size(); idx++) {
+                free_host_sub_buffer(spare.buffers[idx]);
+                free(spare.roi_buffers[idx]);
+            }
+        }
+        _spare_buffers.clear();
     }
 }
 
+void *RingBuffer::allocate_host_sub_buffer(size_t size) {
+    if (_host_arena)
+        return _host_arena->allocate(size);
+    // a minimum of extra MEM_ALIGNMENT is allocated
+    return aligned_alloc(MEM_ALIGNMENT, MEM_ALIGNMENT * (size / MEM_ALIGNMENT + 1));
+}
+
+void RingBuffer::free_host_sub_buffer(void *buffer) {
+    if (_host_arena)
+        _host_arena->deallocate(buffer);
+    else
+        free(buffer);
+}
+
+OutputLease RingBuffer::lease_read_buffers() {
+    if (_mem_type != RocalMemType::HOST)
+        THROW("Output leases are only supported for host outputs")
+    block_if_empty();
+    if (empty())
+        THROW("There is no output batch to lease")
+    std::unique_lock<std::mutex> lock(_lease_lock);
+    if (_slot_leases[_read_ptr])
+        THROW("The current output batch is already leased")
+    OutputLease lease;
+    lease.id = _next_lease_id++;
+    lease.buffers = _host_sub_buffers[_read_ptr];
+    lease.roi_buffers = _host_roi_buffers[_read_ptr];
+    _slot_leases[_read_ptr] = lease.id;
+    _leases[lease.id] = lease;
+    return lease;
+}
+
+void RingBuffer::release_lease(size_t lease_id) {
+    std::unique_lock<std::mutex> lock(_lease_lock);
+    auto lease = _leases.find(lease_id);
+    if (lease == _leases.end())
+        THROW("Output lease " + TOSTR(lease_id) + " is not held")
+    auto slot = std::find(_slot_leases.begin(), _slot_leases.end(), lease_id);
+    if (slot != _slot_leases.end())
+        *slot = 0;  // The batch is still in the ring, its buffers are written again once it is popped
+    else
+        _spare_buffers.push_back(std::move(lease->second));
+    _leases.erase(lease);
+}
+
+OutputLease RingBuffer::take_spare_buffers() {
+    if (!_spare_buffers.empty()) {
+        auto spare = std::move(_spare_buffers.back());
+        _spare_buffers.pop_back();
+        return spare;
+    }
+    OutputLease spare;
+    for (size_t sub_buff_idx = 0; sub_buff_idx < _sub_buffer_size.size(); sub_buff_idx++) {
+        spare.buffers.push_back(allocate_host_sub_buffer(_sub_buffer_size[sub_buff_idx]));
+        spare.roi_buffers.push_back(static_cast<unsigned *>(malloc(_roi_buffer_size[sub_buff_idx])));
+    }
+    return spare;
+}
+
+void RingBuffer::detach_slot_lease(size_t slot) {
+    std::unique_lock<std::mutex> lock(_lease_lock);
+    if (slot >= _slot_leases.size() || !_slot_leases[slot])
+        return;
+    // The leased buffers stay with the lease, the slot gets spare buffers so the writer never touches leased memory
+    auto spare = take_spare_buffers();
+    _host_sub_buffers[slot] = std::move(spare.buffers);
+    _host_roi_buffers[slot] = std::move(spare.roi_buffers);
+    _slot_leases[slot] = 0;
+}
+
 bool RingBuffer::empty() {
     return (_level <= 0);
 }
@@ -410,6 +519,20 @@ void RingBuffer::rellocate_meta_data_buffer(void *buffer, size_t buffer_size, un
     _meta_data_sub_buffer_size[_write_ptr][buff_idx] = buffer_size;
 }
 
+EpochInfo RingBuffer::get_epoch_info() {
+    std::unique_lock<std::mutex> lock(_names_buff_lock);
+    if (_epoch_ring_buffer.empty())
+        return {};
+    return _epoch_ring_buffer.front();
+}
+
+PipelineState RingBuffer::get_pipeline_state() {
+    std::unique_lock<std::mutex> lock(_names_buff_lock);
+    if (_state_ring_buffer.empty())
+        return {};
+    return _state_ring_buffer.front();
+}
+
 MetaDataNamePair &RingBuffer::get_meta_data() {
     block_if_empty();
     std::unique_lock<std::mutex> lock(_names_buff_lock);
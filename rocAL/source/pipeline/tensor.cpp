@@ -27,10 +27,19 @@ THE SOFTWARE.
 #endif
 #include <vx_ext_amd.h>
 
+#include <algorithm>
 #include <cstring>
 #include <stdexcept>
+#if ENABLE_SIMD
+#if _WIN32
+#include <intrin.h>
+#else
+#include <immintrin.h>
+#endif
+#endif
 #include "pipeline/commons.h"
 #include "pipeline/tensor.h"
+#include "pipeline/thread_pool.h"
 
 vx_enum vx_mem_type(RocalMemType mem) {
     switch (mem) {
@@ -475,6 +484,159 @@ unsigned Tensor::copy_data(void *user_buffer, uint x_offset, uint y_offset, uint
     return 0;
 }
 
+namespace {
+constexpr size_t PACKED_COPY_TASK_BYTES = 256 * 1024;       // Bytes copied by one task of the packed copy
+constexpr size_t PACKED_COPY_MIN_PARALLEL_BYTES = 1 << 20;  // Smaller packed copies run on the calling thread
+constexpr size_t STREAMING_STORE_MIN_ROW_BYTES = 4096;      // Rows at least this long are written with non temporal stores
+
+struct PackedCopyTask {
+    size_t region;
+    size_t first_row;
+    size_t num_rows;
+};
+
+// Large rows bypass the cache, the packed buffer is handed over to the user and would only evict the pipeline's data
+void copy_row(unsigned char *dst, const unsigned char *src, size_t size, bool streaming) {
+#if ENABLE_SIMD
+    if (streaming) {
+        size_t head = (16 - (reinterpret_cast<uintptr_t>(dst) & 15)) & 15;
+        memcpy(dst, src, head);
+        size_t vector_size = (size - head) & ~static_cast<size_t>(15);
+        for (size_t i = head; i < head + vector_size; i += 16)
+            _mm_stream_si128(reinterpret_cast<__m128i *>(dst + i), _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i)));
+        memcpy(dst + head + vector_size, src + head + vector_size, size - head - vector_size);
+        return;
+    }
+#endif
+    memcpy(dst, src, size);
+}
+
+void copy_region_rows(const PackedSampleRegion &region, size_t first_row, size_t num_rows, unsigned char *dst_buffer) {
+    bool streaming = region.row_bytes >= STREAMING_STORE_MIN_ROW_BYTES;
+    auto dst = dst_buffer + region.dst_offset + first_row * region.row_bytes;
+    for (size_t row = first_row; row < first_row + num_rows; row++) {
+        size_t index = row, src_offset = 0;
+        for (size_t d = region.outer_extents.size(); d-- > 0;) {
+            src_offset += (index % region.outer_extents[d]) * region.outer_strides[d];
+            index /= region.outer_extents[d];
+        }
+        copy_row(dst, region.src + src_offset, region.row_bytes, streaming);
+        dst += region.row_bytes;
+    }
+#if ENABLE_SIMD
+    if (streaming) _mm_sfence();  // Non temporal stores are weakly ordered, make them visible before the copy returns
+#endif
+}
+}  // namespace
+
+std::vector<PackedSampleRegion> Tensor::packed_regions() {
+    if (_info.is_metadata())
+        THROW("Packed copy is not supported for metadata tensors")
+    if (_info.mem_type() != RocalMemType::HOST)
+        THROW("Packed copy is only supported for tensors in host memory")
+
+    // Sequences keep a ROI per frame, so they are packed frame by frame
+    auto layout = _info.layout();
+    bool is_sequence = (layout == RocalTensorlayout::NFHWC || layout == RocalTensorlayout::NFCHW);
+    unsigned first_dim = is_sequence ? 2 : 1;
+    size_t num_samples = is_sequence ? _info._dims[0] * _info._dims[1] : _info._batch_size;
+    std::vector<size_t> dims(_info._dims.begin() + first_dim, _info._dims.end());
+    std::vector<size_t> strides(_info._strides.begin() + first_dim, _info._strides.end());
+    size_t sample_stride = _info._strides[first_dim - 1];
+    size_t num_dims = dims.size();
+    if (!_info.is_image() && _info._roi.no_of_dims() != num_dims)
+        THROW("The ROI dimensions " + TOSTR(_info._roi.no_of_dims()) + " do not match the sample dimensions " + TOSTR(num_dims))
+
+    auto base = static_cast<const unsigned char *>(_mem_handle);
+    std::vector<size_t> begin(num_dims), extent(num_dims);
+    std::vector<PackedSampleRegion> regions(num_samples);
+    size_t dst_offset = 0;
+    for (size_t i = 0; i < num_samples; i++) {
+        if (_info.is_image()) {
+            Roi2DCords roi = _info._roi.get_2D_roi()[i];
+            if (_info.roi_type() == RocalROIType::LTRB)
+                roi.xywh = {roi.ltrb.l, roi.ltrb.t, roi.ltrb.r - roi.ltrb.l + 1, roi.ltrb.b - roi.ltrb.t + 1};
+            size_t height_dim = (layout == RocalTensorlayout::NCHW || layout == RocalTensorlayout::NFCHW) ? 1 : 0;
+            std::fill(begin.begin(), begin.end(), 0);
+            extent = dims;
+            begin[height_dim] = roi.xywh.y;
+            extent[height_dim] = roi.xywh.h;
+            begin[height_dim + 1] = roi.xywh.x;
+            extent[height_dim + 1] = roi.xywh.w;
+        } else {
+            auto &coords = _info._roi[i];
+            for (size_t d = 0; d < num_dims; d++) {
+                begin[d] = coords.begin[d];
+                extent[d] = coords.end[d];
+            }
+        }
+        for (size_t d = 0; d < num_dims; d++) {
+            begin[d] = std::min(begin[d], dims[d]);
+            extent[d] = std::min(extent[d], dims[d] - begin[d]);
+        }
+
+        // The dimensions below the first one the region doesn't cover completely are contiguous in the padded buffer
+        size_t row_dim = num_dims - 1;
+        while (row_dim > 0 && begin[row_dim] == 0 && extent[row_dim] == dims[row_dim])
+            row_dim--;
+        auto &region = regions[i];
+        region.row_bytes = strides[num_dims - 1];
+        for (size_t d = row_dim; d < num_dims; d++)
+            region.row_bytes *= extent[d];
+        region.num_rows = 1;
+        size_t src_offset = i * sample_stride;
+        for (size_t d = 0; d < num_dims; d++) {
+            src_offset += begin[d] * strides[d];
+            if (d < row_dim) {
+                region.num_rows *= extent[d];
+                region.outer_extents.push_back(extent[d]);
+                region.outer_strides.push_back(strides[d]);
+            }
+        }
+        if (base) region.src = base + src_offset;
+        region.dst_offset = dst_offset;
+        dst_offset += region.row_bytes * region.num_rows;
+    }
+    return regions;
+}
+
+size_t Tensor::packed_data_size() {
+    auto regions = packed_regions();
+    if (regions.empty()) return 0;
+    return regions.back().dst_offset + regions.back().row_bytes * regions.back().num_rows;
+}
+
+unsigned Tensor::copy_data_packed(void *user_buffer, std::vector<size_t> &sample_offsets) {
+    if (_mem_handle == nullptr) return 0;
+    auto regions = packed_regions();
+    sample_offsets.resize(regions.size() + 1);
+    std::vector<PackedCopyTask> tasks;
+    size_t packed_size = 0;
+    for (size_t i = 0; i < regions.size(); i++) {
+        auto &region = regions[i];
+        sample_offsets[i] = region.dst_offset;
+        packed_size += region.row_bytes * region.num_rows;
+        if (region.row_bytes == 0) continue;
+        // Small samples are copied by a single task, large ones are split into bands of rows
+        size_t rows_per_task = std::max(PACKED_COPY_TASK_BYTES / region.row_bytes, static_cast<size_t>(1));
+        for (size_t row = 0; row < region.num_rows; row += rows_per_task)
+            tasks.push_back({i, row, std::min(rows_per_task, region.num_rows - row)});
+    }
+    sample_offsets.back() = packed_size;
+
+    auto dst_buffer = static_cast<unsigned char *>(user_buffer);
+    auto copy_task = [&](size_t t) {
+        copy_region_rows(regions[tasks[t].region], tasks[t].first_row, tasks[t].num_rows, dst_buffer);
+    };
+    if (packed_size < PACKED_COPY_MIN_PARALLEL_BYTES) {
+        for (size_t t = 0; t < tasks.size(); t++)
+            copy_task(t);
+    } else {
+        host_copy_thread_pool().parallel_for(tasks.size(), copy_task);
+    }
+    return 0;
+}
+
 int Tensor::swap_handle(void *handle) {
     vx_status status;
     if ((status = vxSwapTensorHandle(_vx_handle, handle, nullptr)) != VX_SUCCESS) {
@@ -0,0 +1,105 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "pipeline/thread_pool.h"
+
+#include <algorithm>
+
+namespace {
+constexpr unsigned HOST_COPY_MAX_THREADS = 8;  // The copies are bound by the memory bandwidth well before this
+}
+
+ThreadPool::ThreadPool(unsigned num_threads) {
+    for (unsigned i = 1; i < num_threads; i++)
+        _workers.emplace_back(&ThreadPool::worker_routine, this);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _stop = true;
+    }
+    _start_cv.notify_all();
+    for (auto &worker : _workers)
+        worker.join();
+}
+
+void ThreadPool::run_tasks() {
+    size_t index;
+    while ((index = _next_index.fetch_add(1)) < _count) {
+        try {
+            (*_work)(index);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(_lock);
+            if (!_error) _error = std::current_exception();
+        }
+    }
+}
+
+void ThreadPool::worker_routine() {
+    size_t generation = 0;
+    std::unique_lock<std::mutex> lock(_lock);
+    while (true) {
+        _start_cv.wait(lock, [&] { return _stop || _generation != generation; });
+        if (_stop) return;
+        generation = _generation;
+        lock.unlock();
+        run_tasks();
+        lock.lock();
+        if (--_busy_workers == 0) _done_cv.notify_one();
+    }
+}
+
+void ThreadPool::parallel_for(size_t count, const std::function<void(size_t)> &work) {
+    if (count == 0) return;
+    if (_workers.empty() || count == 1) {
+        for (size_t i = 0; i < count; i++)
+            work(i);
+        return;
+    }
+    std::lock_guard<std::mutex> job_lock(_job_lock);
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _work = &work;
+        _count = count;
+        _next_index = 0;
+        _error = nullptr;
+        _busy_workers = _workers.size();
+        _generation++;
+    }
+    _start_cv.notify_all();
+    run_tasks();
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        _done_cv.wait(lock, [&] { return _busy_workers == 0; });
+        _work = nullptr;
+        error = _error;
+        _error = nullptr;
+    }
+    if (error) std::rethrow_exception(error);
+}
+
+ThreadPool &host_copy_thread_pool() {
+    static ThreadPool pool(std::min(std::max(std::thread::hardware_concurrency(), 1u), HOST_COPY_MAX_THREADS));
+    return pool;
+}
@@ -0,0 +1,155 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "readers/crc32c.h"
+
+#include <array>
+#include <cstring>
+#include <vector>
+
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#define CRC32C_HW 1
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define CRC32C_HW 1
+#else
+#define CRC32C_HW 0
+#endif
+
+// All the helpers below work on the bare CRC register, the initial and final inversions are done by crc32c_extend
+namespace {
+constexpr uint32_t CRC32C_POLY = 0x82f63b78u;  // Castagnoli polynomial, bit reflected
+
+inline uint64_t load_u64(const uint8_t *p) {
+    uint64_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+// Table of slicing-by-8, entry [k][b] is the register after byte b followed by k zero bytes
+struct SliceTables {
+    std::array<std::array<uint32_t, 256>, 8> table;
+    SliceTables() {
+        for (uint32_t b = 0; b < 256; b++) {
+            uint32_t c = b;
+            for (int bit = 0; bit < 8; bit++)
+                c = (c >> 1) ^ (CRC32C_POLY & (0u - (c & 1)));
+            table[0][b] = c;
+        }
+        for (uint32_t b = 0; b < 256; b++)
+            for (int k = 1; k < 8; k++)
+                table[k][b] = (table[k - 1][b] >> 8) ^ table[0][table[k - 1][b] & 0xff];
+    }
+};
+
+const SliceTables &slice_tables() {
+    static const SliceTables tables;
+    return tables;
+}
+
+uint32_t update_table(uint32_t c, const uint8_t *p, size_t size) {
+    const auto &t = slice_tables().table;
+    for (; size >= 8; p += 8, size -= 8) {
+        uint64_t v = load_u64(p) ^ c;
+        c = t[7][v & 0xff] ^ t[6][(v >> 8) & 0xff] ^ t[5][(v >> 16) & 0xff] ^ t[4][(v >> 24) & 0xff] ^
+            t[3][(v >> 32) & 0xff] ^ t[2][(v >> 40) & 0xff] ^ t[1][(v >> 48) & 0xff] ^ t[0][v >> 56];
+    }
+    for (; size > 0; p++, size--)
+        c = (c >> 8) ^ t[0][(c ^ *p) & 0xff];
+    return c;
+}
+
+#if CRC32C_HW
+#if defined(__SSE4_2__)
+inline uint32_t update_u64(uint32_t c, uint64_t v) { return static_cast<uint32_t>(_mm_crc32_u64(c, v)); }
+inline uint32_t update_u8(uint32_t c, uint8_t v) { return _mm_crc32_u8(c, v); }
+#else
+inline uint32_t update_u64(uint32_t c, uint64_t v) { return __crc32cd(c, v); }
+inline uint32_t update_u8(uint32_t c, uint8_t v) { return __crc32cb(c, v); }
+#endif
+
+// Advances a register over STRIDE zero bytes, the register of a block is then the advanced register of the preceding
+// blocks xored with the register of the block computed from zero, which lets three blocks be computed independently
+template <size_t STRIDE>
+struct ZeroShift {
+    std::array<std::array<uint32_t, 256>, 4> table;
+    ZeroShift() {
+        std::vector<uint8_t> zeros(STRIDE, 0);
+        uint32_t bit_shift[32];
+        for (int bit = 0; bit < 32; bit++)
+            bit_shift[bit] = update_table(1u << bit, zeros.data(), STRIDE);
+        for (int k = 0; k < 4; k++)
+            for (uint32_t b = 0; b < 256; b++) {
+                uint32_t c = 0;
+                for (int bit = 0; bit < 8; bit++)
+                    if (b & (1u << bit))
+                        c ^= bit_shift[8 * k + bit];
+                table[k][b] = c;
+            }
+    }
+    uint32_t operator()(uint32_t c) const {
+        return table[0][c & 0xff] ^ table[1][(c >> 8) & 0xff] ^ table[2][(c >> 16) & 0xff] ^ table[3][c >> 24];
+    }
+};
+
+template <size_t STRIDE>
+uint32_t update_interleaved(uint32_t c, const uint8_t *&p, size_t &size) {
+    static const ZeroShift<STRIDE> shift;
+    for (; size >= 3 * STRIDE; p += 3 * STRIDE, size -= 3 * STRIDE) {
+        uint32_t c0 = c, c1 = 0, c2 = 0;
+        for (size_t i = 0; i < STRIDE; i += 8) {
+            c0 = update_u64(c0, load_u64(p + i));
+            c1 = update_u64(c1, load_u64(p + STRIDE + i));
+            c2 = update_u64(c2, load_u64(p + 2 * STRIDE + i));
+        }
+        c = shift(shift(c0) ^ c1) ^ c2;
+    }
+    return c;
+}
+
+uint32_t update_hardware(uint32_t c, const uint8_t *p, size_t size) {
+    for (; size > 0 && (reinterpret_cast<uintptr_t>(p) & 7); p++, size--)
+        c = update_u8(c, *p);
+    c = update_interleaved<8192>(c, p, size);  // Records of the usual image sizes
+    c = update_interleaved<256>(c, p, size);   // Remainder and small records
+    for (; size >= 8; p += 8, size -= 8)
+        c = update_u64(c, load_u64(p));
+    for (; size > 0; p++, size--)
+        c = update_u8(c, *p);
+    return c;
+}
+#endif
+}  // namespace
+
+uint32_t crc32c_extend(uint32_t crc, const void *data, size_t size) {
+    auto p = static_cast<const uint8_t *>(data);
+#if CRC32C_HW
+    return ~update_hardware(~crc, p, size);
+#else
+    return ~update_table(~crc, p, size);
+#endif
+}
+
+bool crc32c_hardware_accelerated() {
+    return CRC32C_HW;
+}
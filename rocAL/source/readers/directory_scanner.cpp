@@ -0,0 +1,303 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include "pipeline/commons.h"
+#include "pipeline/filesystem.h"
+#include "readers/directory_scanner.h"
+
+namespace {
+const char MANIFEST_MAGIC[4] = {'R', 'M', 'A', 'N'};
+const uint32_t MANIFEST_VERSION = 2;  // Version 1 list manifests held the files found to exist
+
+// FNV-1a, stable across builds so that every rank finds the same manifest
+uint64_t hash_key(const std::string &key) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (unsigned char c : key) {
+        hash ^= c;
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// Runs work(i) for i in [0, count) on num_threads threads
+void parallel_for(size_t count, unsigned num_threads, const std::function<void(size_t)> &work) {
+    std::atomic<size_t> next_idx(0);
+    auto worker = [&]() {
+        for (size_t i = next_idx++; i < count; i = next_idx++)
+            work(i);
+    };
+    std::vector<std::thread> threads;
+    for (unsigned i = 1; i < num_threads; i++)
+        threads.emplace_back(worker);
+    worker();
+    for (auto &thread : threads)
+        thread.join();
+}
+
+struct FolderEntry {
+    std::string name;
+    bool is_file;
+    bool is_folder;
+    bool operator<(const FolderEntry &other) const { return name < other.name; }
+};
+
+// Lists the entries of a folder in sorted order, the entry type comes from readdir() and is only stat'ed if the file system does not report it or for symbolic links
+std::vector<FolderEntry> list_folder(const std::string &folder_path) {
+    DIR *dir = opendir(folder_path.c_str());
+    if (dir == nullptr)
+        THROW("DirectoryScanner ERROR: Failed opening the directory at " + folder_path)
+    std::vector<FolderEntry> entries;
+    struct dirent *entity;
+    while ((entity = readdir(dir)) != nullptr) {
+        if (strcmp(entity->d_name, ".") == 0 || strcmp(entity->d_name, "..") == 0) continue;
+        auto type = entity->d_type;
+        if (type == DT_UNKNOWN || type == DT_LNK) {
+            struct stat entry_stat;
+            if (stat((folder_path + "/" + entity->d_name).c_str(), &entry_stat) != 0)
+                continue;
+            type = S_ISREG(entry_stat.st_mode) ? DT_REG : (S_ISDIR(entry_stat.st_mode) ? DT_DIR : DT_UNKNOWN);
+        }
+        entries.push_back({entity->d_name, type == DT_REG, type == DT_DIR});
+    }
+    closedir(dir);
+    std::sort(entries.begin(), entries.end());
+    return entries;
+}
+
+void write_string(std::ofstream &out, const std::string &value) {
+    uint32_t size = value.size();
+    out.write(reinterpret_cast<const char *>(&size), sizeof(size));
+    out.write(value.data(), size);
+}
+
+bool read_string(std::ifstream &in, std::string &value) {
+    uint32_t size = 0;
+    if (!in.read(reinterpret_cast<char *>(&size), sizeof(size)))
+        return false;
+    value.resize(size);
+    return static_cast<bool>(in.read(&value[0], size));
+}
+}  // namespace
+
+DirectoryScanner::DirectoryScanner(const FileScanOptions &options, FileFilter filter) : _options(options), _filter(std::move(filter)) {}
+
+unsigned DirectoryScanner::num_threads(size_t work_count) {
+    size_t max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    return std::max<size_t>(std::min(work_count, max_threads), 1);
+}
+
+int64_t DirectoryScanner::modification_time(const std::string &path) {
+    struct stat path_stat;
+    if (stat(path.c_str(), &path_stat) != 0)
+        return -1;
+    return static_cast<int64_t>(path_stat.st_mtim.tv_sec) * 1000000000 + path_stat.st_mtim.tv_nsec;
+}
+
+std::vector<std::string> DirectoryScanner::list_files(const std::string &folder_path) {
+    std::vector<std::string> file_paths;
+    for (auto &entry : list_folder(folder_path)) {
+        if (entry.is_file && (!_filter || _filter(entry.name)))
+            file_paths.push_back(folder_path + "/" + entry.name);
+    }
+    return file_paths;
+}
+
+std::vector<std::string> DirectoryScanner::scan_folder(const std::string &root_path) {
+    std::vector<std::string> file_paths;
+    std::string key = "folder:" + root_path;
+    if (load_manifest(key, file_paths))
+        return file_paths;
+
+    // The subfolders are read until the first file of the root folder is met, the root folder files then come after them
+    std::vector<ScannedFolder> folders = {{root_path, modification_time(root_path)}};
+    std::vector<std::string> folders_to_list;
+    for (auto &entry : list_folder(root_path)) {
+        if (entry.is_file) {
+            if (_filter && !_filter(entry.name))
+                continue;
+            folders_to_list.push_back(root_path);
+            break;  // assume directory has only files.
+        } else if (entry.is_folder) {
+            auto folder_path = root_path + "/" + entry.name;
+            folders_to_list.push_back(folder_path);
+            folders.push_back({folder_path, modification_time(folder_path)});
+        }
+    }
+
+    std::vector<std::vector<std::string>> folder_files(folders_to_list.size());
+    std::vector<std::string> errors(folders_to_list.size());
+    parallel_for(folders_to_list.size(), num_threads(folders_to_list.size()), [&](size_t i) {
+        try {
+            folder_files[i] = list_files(folders_to_list[i]);
+        } catch (const std::exception &e) {
+            errors[i] = e.what();
+        }
+    });
+    for (auto &error : errors)
+        if (!error.empty())
+            THROW(error)
+
+    size_t file_count = 0;
+    for (auto &files : folder_files)
+        file_count += files.size();
+    file_paths.reserve(file_count);
+    for (auto &files : folder_files)
+        std::move(files.begin(), files.end(), std::back_inserter(file_paths));
+    save_manifest(key, folders, file_paths);
+    return file_paths;
+}
+
+std::vector<std::string> DirectoryScanner::read_file_list(const std::string &file_list_path, const std::string &root_path) {
+    std::vector<std::string> file_paths;
+    // The manifest only saves parsing the list, its files are checked on every scan since deleting one does not change the list
+    std::string key = "list:" + file_list_path + ":" + root_path;
+    if (load_manifest(key, file_paths))
+        return existing_files(file_paths);
+
+    std::ifstream fp(file_list_path);
+    if (!fp.is_open())
+        return file_paths;
+    std::string line;
+    while (std::getline(fp, line)) {
+        std::istringstream ss(line);
+        std::string file_path;
+        std::getline(ss, file_path, ' ');
+        if (file_path.empty())
+            continue;
+        if (filesys::path(file_path).is_relative()) {  // Only add root path if the file list contains relative file paths
+            if (!filesys::exists(root_path))
+                THROW("File list contains relative paths but root path doesn't exists");
+            file_path = root_path + "/" + file_path;
+        }
+        file_paths.push_back(std::move(file_path));
+    }
+    save_manifest(key, {{file_list_path, modification_time(file_list_path)}}, file_paths);
+    return existing_files(file_paths);
+}
+
+std::vector<std::string> DirectoryScanner::existing_files(const std::vector<std::string> &file_paths) {
+    if (_options.trust_file_list)
+        return file_paths;
+    std::vector<char> is_file(file_paths.size(), 0);
+    parallel_for(file_paths.size(), num_threads(file_paths.size() / 1024 + 1), [&](size_t i) {
+        struct stat file_stat;
+        is_file[i] = (stat(file_paths[i].c_str(), &file_stat) == 0) && S_ISREG(file_stat.st_mode);
+    });
+    std::vector<std::string> existing;
+    existing.reserve(file_paths.size());
+    for (size_t i = 0; i < file_paths.size(); i++)
+        if (is_file[i])
+            existing.push_back(file_paths[i]);
+    return existing;
+}
+
+std::string DirectoryScanner::manifest_path(const std::string &key) {
+    std::stringstream name;
+    name << std::hex << hash_key(key);
+    return _options.manifest_dir + "/rocal_" + name.str() + ".manifest";
+}
+
+bool DirectoryScanner::load_manifest(const std::string &key, std::vector<std::string> &file_paths) {
+    if (_options.manifest_dir.empty())
+        return false;
+    std::ifstream in(manifest_path(key), std::ios::binary);
+    if (!in)
+        return false;
+    char magic[4];
+    uint32_t version = 0, folder_count = 0;
+    std::string stored_key;
+    if (!in.read(magic, sizeof(magic)) || memcmp(magic, MANIFEST_MAGIC, sizeof(magic)) != 0 ||
+        !in.read(reinterpret_cast<char *>(&version), sizeof(version)) || version != MANIFEST_VERSION ||
+        !read_string(in, stored_key) || stored_key != key ||
+        !in.read(reinterpret_cast<char *>(&folder_count), sizeof(folder_count)))
+        return false;
+    // The manifest is stale as soon as an entry is added to or removed from one of the scanned folders
+    for (uint32_t i = 0; i < folder_count; i++) {
+        std::string folder_path;
+        int64_t stored_time = 0;
+        if (!read_string(in, folder_path) || !in.read(reinterpret_cast<char *>(&stored_time), sizeof(stored_time)))
+            return false;
+        if (stored_time < 0 || modification_time(folder_path) != stored_time)
+            return false;
+    }
+    uint64_t file_count = 0;
+    if (!in.read(reinterpret_cast<char *>(&file_count), sizeof(file_count)))
+        return false;
+    std::vector<std::string> loaded(file_count);
+    for (auto &file_path : loaded)
+        if (!read_string(in, file_path))
+            return false;
+    file_paths = std::move(loaded);
+    INFO("Loaded " + TOSTR(file_paths.size()) + " file paths from the manifest " + manifest_path(key))
+    return true;
+}
+
+void DirectoryScanner::save_manifest(const std::string &key, const std::vector<ScannedFolder> &folders, const std::vector<std::string> &file_paths) {
+    if (_options.manifest_dir.empty())
+        return;
+    std::error_code error;
+    filesys::create_directories(_options.manifest_dir, error);
+    // Written aside and renamed, so that ranks loading the manifest never see it half written
+    auto path = manifest_path(key);
+    auto temp_path = path + "." + std::to_string(getpid()) + ".tmp";
+    {
+        std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            WRN("DirectoryScanner cannot write the manifest " + path)
+            return;
+        }
+        uint32_t folder_count = folders.size();
+        uint64_t file_count = file_paths.size();
+        out.write(MANIFEST_MAGIC, sizeof(MANIFEST_MAGIC));
+        out.write(reinterpret_cast<const char *>(&MANIFEST_VERSION), sizeof(MANIFEST_VERSION));
+        write_string(out, key);
+        out.write(reinterpret_cast<const char *>(&folder_count), sizeof(folder_count));
+        for (auto &folder : folders) {
+            write_string(out, folder.path);
+            out.write(reinterpret_cast<const char *>(&folder.modification_time), sizeof(folder.modification_time));
+        }
+        out.write(reinterpret_cast<const char *>(&file_count), sizeof(file_count));
+        for (auto &file_path : file_paths)
+            write_string(out, file_path);
+        if (!out) {
+            WRN("DirectoryScanner cannot write the manifest " + path)
+            out.close();
+            std::remove(temp_path.c_str());
+            return;
+        }
+    }
+    if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+        WRN("DirectoryScanner cannot write the manifest " + path)
+        std::remove(temp_path.c_str());
+    }
+}
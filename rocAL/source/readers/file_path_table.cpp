@@ -0,0 +1,60 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "pipeline/commons.h"
+#include "readers/file_path_table.h"
+
+FilePathTable::SampleId FilePathTable::add(const std::string &file_path) {
+    if (_directory_of.size() >= UINT32_MAX)
+        THROW("FilePathTable can not hold more than " + TOSTR(UINT32_MAX) + " files")
+    auto separator_idx = file_path.find_last_of("/\\");
+    size_t name_start = (separator_idx == std::string::npos) ? 0 : separator_idx + 1;
+    auto directory = file_path.substr(0, name_start);
+    auto directory_id = _directory_ids.emplace(directory, _directories.size());
+    if (directory_id.second)
+        _directories.push_back(std::move(directory));
+    _directory_of.push_back(directory_id.first->second);
+    _name_arena.append(file_path, name_start, std::string::npos);
+    _name_offsets.push_back(_name_arena.size());
+    return _directory_of.size() - 1;
+}
+
+std::string_view FilePathTable::name(SampleId id) const {
+    return std::string_view(_name_arena).substr(_name_offsets[id], _name_offsets[id + 1] - _name_offsets[id]);
+}
+
+std::string FilePathTable::path(SampleId id) const {
+    std::string out;
+    path(id, out);
+    return out;
+}
+
+void FilePathTable::path(SampleId id, std::string &out) const {
+    auto file_name = name(id);
+    out.assign(directory(id)).append(file_name.data(), file_name.size());
+}
+
+void FilePathTable::shrink_to_fit() {
+    _directory_of.shrink_to_fit();
+    _name_offsets.shrink_to_fit();
+    _name_arena.shrink_to_fit();
+}
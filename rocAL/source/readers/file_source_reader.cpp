@@ -25,13 +25,11 @@ THE SOFTWARE.
 #include <cstring>
 #include <math.h>
 #include "pipeline/commons.h"
+#include "readers/directory_scanner.h"
 #include "readers/file_source_reader.h"
 #include "pipeline/filesystem.h"
 
 FileSourceReader::FileSourceReader() {
-    _src_dir = nullptr;
-    _sub_dir = nullptr;
-    _entity = nullptr;
     _curr_file_idx = 0;
     _current_file_size = 0;
     _current_fPtr = nullptr;
@@ -44,12 +42,14 @@ Reader::Status FileSourceReader::initialize(ReaderConfig desc) {
     auto ret = Reader::Status::OK;
     _folder_path = desc.path();
     _file_list_path = desc.file_list_path();
+    _file_scan_options = desc.file_scan_options();
     _shard_id = desc.get_shard_id();
     _shard_count = desc.get_shard_count();
     _batch_size = desc.get_batch_size();
     _shuffle = desc.shuffle();
     _loop = desc.loop();
     _meta_data_reader = desc.meta_data_reader();
+    _sample_quarantine = desc.sample_quarantine();
     _sharding_info = desc.get_sharding_info();
     _pad_last_batch_repeated = _sharding_info.pad_last_batch_repeated;
     _stick_to_shard = _sharding_info.stick_to_shard;
@@ -58,27 +58,23 @@ Reader::Status FileSourceReader::initialize(ReaderConfig desc) {
     _curr_file_idx = _shard_start_idx_vector[_shard_id]; // shard's start_idx would vary for every shard in the vector
     // shuffle dataset if set
     if (ret == Reader::Status::OK && _shuffle)
-        std::random_shuffle(_file_names.begin() + _shard_start_idx_vector[_shard_id],
-                            _file_names.begin() + _shard_end_idx_vector[_shard_id]);
+        init_shuffle(desc.seed());
 
     return ret;
 }
 
 void FileSourceReader::incremenet_read_ptr() {
     _read_counter++;
-    increment_curr_file_idx(_file_names.size());
+    increment_curr_file_idx(_file_ids.size());
 }
 
 size_t FileSourceReader::open() {
-    auto file_path = _file_names[_curr_file_idx];  // Get next file name
+    auto sample_id = _file_ids[shuffled_file_idx(_curr_file_idx)];  // Get next file
     incremenet_read_ptr();
-    _last_file_path = _last_id = file_path;
-    auto last_slash_idx = _last_id.find_last_of("\\/");
-    if (std::string::npos != last_slash_idx) {
-        _last_id.erase(0, last_slash_idx + 1);
-    }
+    _file_table.path(sample_id, _last_file_path);  // Reuses the storage of the previous path
+    _last_id.assign(_file_table.name(sample_id));
 
-    _current_fPtr = fopen(file_path.c_str(), "rb");  // Open the file,
+    _current_fPtr = fopen(_last_file_path.c_str(), "rb");  // Open the file,
 
     if (!_current_fPtr)  // Check if it is ready for reading
         return 0;
@@ -126,10 +122,7 @@ int FileSourceReader::release() {
 }
 
 void FileSourceReader::reset() {
-    if (_shuffle)
-        std::random_shuffle(_file_names.begin() + _shard_start_idx_vector[_shard_id],
-                            _file_names.begin() + _shard_start_idx_vector[_shard_id] + actual_shard_size_without_padding());
-
+    _epoch++;
     if (_stick_to_shard == false)  // Pick elements from the next shard - hence increment shard_id
         increment_shard_id();      // Should work for both single and multiple shards
 
@@ -137,149 +130,92 @@ void FileSourceReader::reset() {
 
     if (_sharding_info.last_batch_policy == RocalBatchPolicy::DROP) {  // Skipping the dropped batch in next epoch
         for (uint i = 0; i < _batch_size; i++)
-            increment_curr_file_idx(_file_names.size());
+            increment_curr_file_idx(_file_ids.size());
     }
 }
 
 Reader::Status FileSourceReader::generate_file_names() {
-    if ((_sub_dir = opendir(_folder_path.c_str())) == nullptr)
-        THROW("FileReader ShardID [" + TOSTR(_shard_id) + "] ERROR: Failed opening the directory at " + _folder_path);
-
-    std::vector<std::string> entry_name_list;
-    std::string _full_path = _folder_path;
-
-    while ((_entity = readdir(_sub_dir)) != nullptr) {
-        std::string entry_name(_entity->d_name);
-        if (strcmp(_entity->d_name, ".") == 0 || strcmp(_entity->d_name, "..") == 0) continue;
-        entry_name_list.push_back(entry_name);
-    }
-    closedir(_sub_dir);
-    std::sort(entry_name_list.begin(), entry_name_list.end());
-
-    auto ret = Reader::Status::OK;
+    DirectoryScanner scanner(_file_scan_options, [](const std::string &file_name) {
+        // ignore files with unsupported extensions
+        auto file_extension_idx = file_name.find_last_of(".");
+        if (file_extension_idx == std::string::npos)
+            return true;
+        std::string file_extension = file_name.substr(file_extension_idx + 1);
+        std::transform(file_extension.begin(), file_extension.end(), file_extension.begin(),
+                       [](unsigned char c) { return std::tolower(c); });
+        return (file_extension == "jpg") || (file_extension == "jpeg") || (file_extension == "png") || (file_extension == "ppm") || (file_extension == "bmp") || (file_extension == "pgm") || (file_extension == "tif") || (file_extension == "tiff") || (file_extension == "webp") || (file_extension == "wav");
+    });
+
+    std::vector<std::string> file_paths;
     if (!_file_list_path.empty()) {  // Reads the file paths from the file list and adds to file_names vector for decoding
         if (_meta_data_reader) {
             auto vec_rel_file_path = _meta_data_reader->get_relative_file_path();  // Get the relative file path's from meta_data_reader
-            for (auto file_path : vec_rel_file_path) {
+            for (auto &file_path : vec_rel_file_path) {
                 if (filesys::path(file_path).is_relative()) {  // Only add root path if the file list contains relative file paths
                     if (!filesys::exists(_folder_path))
                         THROW("File list contains relative paths but root path doesn't exists");
-                    _absolute_file_path = _folder_path + "/" + file_path;
-                }
-                if (filesys::is_regular_file(_absolute_file_path)) {
-                    _file_names.push_back(_absolute_file_path);
-                    _file_count_all_shards++;
+                    file_path = _folder_path + "/" + file_path;
                 }
             }
-            _last_file_name = _absolute_file_path;
+            file_paths = scanner.existing_files(vec_rel_file_path);
         } else {
-            std::ifstream fp(_file_list_path);
-            if (fp.is_open()) {
-                while (fp) {
-                    std::string file_label_path;
-                    std::getline(fp, file_label_path);
-                    std::istringstream ss(file_label_path);
-                    std::string file_path;
-                    std::getline(ss, file_path, ' ');
-                    if (filesys::path(file_path).is_relative()) {  // Only add root path if the file list contains relative file paths
-                        if (!filesys::exists(_folder_path))
-                            THROW("File list contains relative paths but root path doesn't exists");
-                        file_path = _folder_path + "/" + file_path;
-                    }
-                    std::string file_name = file_path.substr(file_path.find_last_of("/\\") + 1);
-
-                    if (filesys::is_regular_file(file_path)) {
-                        _last_file_name = file_path;
-                        _file_names.push_back(file_path);
-                        _file_count_all_shards++;
-                    }
-                }
-            }
+            file_paths = scanner.read_file_list(_file_list_path, _folder_path);
         }
     } else {
-        for (unsigned dir_count = 0; dir_count < entry_name_list.size(); ++dir_count) {
-            std::string subfolder_path = _full_path + "/" + entry_name_list[dir_count];
-            filesys::path pathObj(subfolder_path);
-            if (filesys::exists(pathObj) && filesys::is_regular_file(pathObj)) {
-                // ignore files with unsupported extensions
-                auto file_extension_idx = subfolder_path.find_last_of(".");
-                if (file_extension_idx != std::string::npos) {
-                    std::string file_extension = subfolder_path.substr(file_extension_idx + 1);
-                    std::transform(file_extension.begin(), file_extension.end(), file_extension.begin(),
-                                   [](unsigned char c) { return std::tolower(c); });
-                    if ((file_extension != "jpg") && (file_extension != "jpeg") && (file_extension != "png") && (file_extension != "ppm") && (file_extension != "bmp") && (file_extension != "pgm") && (file_extension != "tif") && (file_extension != "tiff") && (file_extension != "webp") && (file_extension != "wav"))
-                        continue;
-                }
-                ret = open_folder();
-                break;  // assume directory has only files.
-            } else if (filesys::exists(pathObj) && filesys::is_directory(pathObj)) {
-                _folder_path = subfolder_path;
-                if (open_folder() != Reader::Status::OK)
-                    WRN("FileReader ShardID [" + TOSTR(_shard_id) + "] File reader cannot access the storage at " + _folder_path);
+        for (auto &file_path : scanner.scan_folder(_folder_path)) {
+            std::string filename = file_path.substr(file_path.find_last_of("/\\") + 1);
+            if (!_meta_data_reader || _meta_data_reader->exists(filename)) {  // Check if the file is present in metadata reader and add to file names list, to avoid issues while lookup
+                file_paths.push_back(file_path);
+            } else {
+                WRN("Skipping file," + filename + " as it is not present in metadata reader")
             }
         }
     }
+    for (auto &file_path : file_paths)
+        _file_ids.push_back(_file_table.add(file_path));
+    _file_count_all_shards += file_paths.size();
+
+    remove_quarantined_files();
+    _file_table.shrink_to_fit();
 
-    if (_file_names.empty())
+    if (_file_ids.empty())
         ERR("FileReader ShardID [" + TOSTR(_shard_id) + "] Did not load any file from " + _folder_path)
 
     size_t padded_samples = ((_shard_size > 0) ? _shard_size : largest_shard_size_without_padding()) % _batch_size;
     _last_batch_padded_size = ((_batch_size > 1) && (padded_samples > 0)) ? (_batch_size - padded_samples) : 0;
 
-    // Pad the _file_names with last element of the shard in the vector when _pad_last_batch_repeated is True
+    // Pad the _file_ids with last element of the shard in the vector when _pad_last_batch_repeated is True
     if (_pad_last_batch_repeated == true) {
-        update_filenames_with_padding(_file_names, _batch_size);
+        update_filenames_with_padding(_file_ids, _batch_size);
     }
 
-    _last_file_name = _file_names[_file_names.size() - 1];
+    if (!_file_ids.empty())
+        _last_file_name = _file_table.path(_file_ids.back());
     compute_start_and_end_idx_of_all_shards();
 
-    return ret;
+    return Reader::Status::OK;
+}
+
+void FileSourceReader::remove_quarantined_files() {
+    if (!_sample_quarantine || _sample_quarantine->count() == 0)
+        return;
+    auto quarantined = std::remove_if(_file_ids.begin(), _file_ids.end(),
+                                      [&](FilePathTable::SampleId sample_id) { return _sample_quarantine->contains(_file_table.path(sample_id)); });
+    size_t quarantined_count = std::distance(quarantined, _file_ids.end());
+    _file_ids.erase(quarantined, _file_ids.end());
+    _file_count_all_shards -= quarantined_count;
+    if (quarantined_count) {
+        INFO("FileReader ShardID [" + TOSTR(_shard_id) + "] Skipped " + TOSTR(quarantined_count) + " quarantined files")
+    }
 }
 
 Reader::Status FileSourceReader::subfolder_reading() {
     auto ret = generate_file_names();
-    if (!_file_names.empty())
-        LOG("FileReader ShardID [" + TOSTR(_shard_id) + "] Total of " + TOSTR(_file_names.size()) + " images loaded from " + STR(_folder_path))
+    if (!_file_ids.empty())
+        LOG("FileReader ShardID [" + TOSTR(_shard_id) + "] Total of " + TOSTR(_file_ids.size()) + " images loaded from " + STR(_folder_path))
     return ret;
 }
 
-Reader::Status FileSourceReader::open_folder() {
-    if ((_src_dir = opendir(_folder_path.c_str())) == nullptr)
-        THROW("FileReader ShardID [" + TOSTR(_shard_id) + "] ERROR: Failed opening the directory at " + _folder_path);
-
-    // Sort all the files inside the directory and then process them for sharding
-    std::vector<filesys::path> files_in_directory;
-    std::copy(filesys::directory_iterator(filesys::path(_folder_path)), filesys::directory_iterator(), std::back_inserter(files_in_directory));
-    std::sort(files_in_directory.begin(), files_in_directory.end());
-    for (const std::string file_path : files_in_directory) {
-        std::string filename = file_path.substr(file_path.find_last_of("/\\") + 1);
-        if (!filesys::is_regular_file(filesys::path(file_path)))
-            continue;
-
-        auto file_extension_idx = file_path.find_last_of(".");
-        if (file_extension_idx != std::string::npos) {
-            std::string file_extension = file_path.substr(file_extension_idx + 1);
-            std::transform(file_extension.begin(), file_extension.end(), file_extension.begin(),
-                           [](unsigned char c) { return std::tolower(c); });
-            if ((file_extension != "jpg") && (file_extension != "jpeg") && (file_extension != "png") && (file_extension != "ppm") && (file_extension != "bmp") && (file_extension != "pgm") && (file_extension != "tif") && (file_extension != "tiff") && (file_extension != "webp") && (file_extension != "wav"))
-                continue;
-        }
-        if (!_meta_data_reader || _meta_data_reader->exists(filename)) {  // Check if the file is present in metadata reader and add to file names list, to avoid issues while lookup
-            _file_names.push_back(file_path);
-            _last_file_name = file_path;
-            _file_count_all_shards++;
-        } else {
-            WRN("Skipping file," + filename + " as it is not present in metadata reader")
-        }
-    }
-
-    if (_file_names.empty())
-        ERR("FileReader ShardID [" + TOSTR(_shard_id) + "] Did not load any file from " + _folder_path)
-    closedir(_src_dir);
-    return Reader::Status::OK;
-}
-
 std::string FileSourceReader::get_root_folder_path() {
     return _folder_path;
 }
@@ -56,8 +56,7 @@ Reader::Status Caffe2LMDBRecordReader::initialize(ReaderConfig desc) {
     _curr_file_idx = _shard_start_idx_vector[_shard_id]; // shard's start_idx would vary for every shard in the vector
     // shuffle dataset if set
     if (ret == Reader::Status::OK && _shuffle)
-        std::random_shuffle(_file_names.begin() + _shard_start_idx_vector[_shard_id],
-                            _file_names.begin() + _shard_end_idx_vector[_shard_id]);
+        init_shuffle(desc.seed());
 
     return ret;
 }
@@ -68,14 +67,14 @@ void Caffe2LMDBRecordReader::incremenet_read_ptr() {
 }
 
 size_t Caffe2LMDBRecordReader::open() {
-    auto file_path = _file_names[_curr_file_idx];  // Get next file name
+    auto file_path = _file_names[shuffled_file_idx(_curr_file_idx)];  // Get next file name
     _last_id = file_path;
-    _current_file_size = _file_size[_file_names[_curr_file_idx]];
+    _current_file_size = _file_size[file_path];
     return _current_file_size;
 }
 
 size_t Caffe2LMDBRecordReader::read_data(unsigned char *buf, size_t read_size) {
-    read_image(buf, _file_names[_curr_file_idx]);
+    read_image(buf, _file_names[shuffled_file_idx(_curr_file_idx)]);
     incremenet_read_ptr();
     return read_size;
 }
@@ -99,9 +98,7 @@ int Caffe2LMDBRecordReader::release() {
 }
 
 void Caffe2LMDBRecordReader::reset() {
-    if (_shuffle)
-        std::random_shuffle(_file_names.begin() + _shard_start_idx_vector[_shard_id],
-                            _file_names.begin() + _shard_end_idx_vector[_shard_id]);
+    _epoch++;
     if (_stick_to_shard == false)  // Pick elements from the next shard - hence increment shard_id
         increment_shard_id();      // Should work for both single and multiple shards
     _read_counter = 0;
@@ -21,8 +21,13 @@ THE SOFTWARE.
 */
 
 #include <cassert>
+#include <cerrno>
 #include "pipeline/commons.h"
 #include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <algorithm>
 #include <random>
 #include "readers/image/cifar10_data_reader.h"
@@ -55,19 +60,13 @@ Reader::Status CIFAR10DataReader::initialize(ReaderConfig desc) {
     _stick_to_shard = _sharding_info.stick_to_shard;
     _shard_size = _sharding_info.shard_size;
     _shuffle = desc.shuffle();
+    _memory_resident = desc.memory_resident();
     ret = subfolder_reading();
+    if (ret == Reader::Status::OK && _memory_resident)
+        map_files();
     // shuffle dataset if set
-    if (ret == Reader::Status::OK && _shuffle) {
-        std::mt19937 rng1(_shard_id);
-        auto rng2 = rng1;
-        auto rng3 = rng1;
-        std::shuffle(_file_names.begin() + _shard_start_idx_vector[_shard_id],
-                            _file_names.begin() + _shard_end_idx_vector[_shard_id], rng1);
-        std::shuffle(_file_offsets.begin() + _shard_start_idx_vector[_shard_id],
-                            _file_offsets.begin() + _shard_end_idx_vector[_shard_id], rng2);
-        std::shuffle(_file_idx.begin() + _shard_start_idx_vector[_shard_id],
-                            _file_idx.begin() + _shard_end_idx_vector[_shard_id], rng3);
-    }
+    if (ret == Reader::Status::OK && _shuffle)
+        init_shuffle(desc.seed());
     return ret;
 
 }
@@ -78,9 +77,10 @@ void CIFAR10DataReader::incremenet_read_ptr() {
 }
 
 size_t CIFAR10DataReader::open() {
-    auto file_path = _file_names[_curr_file_idx];  // Get next file name
-    auto file_offset = _file_offsets[_curr_file_idx];
-    _last_file_idx = _file_idx[_curr_file_idx];
+    auto file_idx = shuffled_file_idx(_curr_file_idx);
+    auto file_path = _file_names[file_idx];  // Get next file name
+    auto file_offset = _file_offsets[file_idx];
+    _last_file_idx = _file_idx[file_idx];
     incremenet_read_ptr();
     // update _last_id for the next record
     _last_id = file_path;
@@ -91,6 +91,13 @@ size_t CIFAR10DataReader::open() {
     // add file_idx to last_id so the loader knows the index within the same master file
     _last_id.append("_");
     _last_id.append(std::to_string(_last_file_idx));
+    if (_memory_resident) {
+        auto &mapped_file = _mapped_files.at(file_path);
+        if (file_offset + _raw_file_size > mapped_file.second)  // not enough data in the file to read
+            return 0;
+        _record_view = mapped_file.first + file_offset + 1;  // 1 extra byte for label
+        return (_raw_file_size - 1);
+    }
     // compare the file_name with the last one opened
     if (file_path.compare(_last_file_name) != 0) {
         if (_current_fPtr) {
@@ -124,11 +131,14 @@ size_t CIFAR10DataReader::open() {
 }
 
 size_t CIFAR10DataReader::read_data(unsigned char* buf, size_t read_size) {
-    if (!_current_fPtr)
-        return 0;
-
     // Requested read size bigger than the raw file size? just read as many bytes as the raw file size
     read_size = (read_size > (_raw_file_size - 1)) ? _raw_file_size - 1 : read_size;
+    if (_memory_resident) {
+        memcpy(buf, _record_view, read_size);
+        return read_size;
+    }
+    if (!_current_fPtr)
+        return 0;
 
     size_t actual_read_size = fread(buf, sizeof(unsigned char), read_size, _current_fPtr);
     return actual_read_size;
@@ -143,6 +153,30 @@ CIFAR10DataReader::~CIFAR10DataReader() {
         fclose(_current_fPtr);
         _current_fPtr = nullptr;
     }
+    for (auto &mapped_file : _mapped_files)
+        munmap(mapped_file.second.first, mapped_file.second.second);
+}
+
+void CIFAR10DataReader::map_files() {
+    // The pages are read in up front, the records are then served without going through the file system again
+    for (auto &file_path : _file_names) {
+        if (_mapped_files.find(file_path) != _mapped_files.end())
+            continue;
+        int fd = ::open(file_path.c_str(), O_RDONLY);
+        if (fd < 0)
+            THROW("CIFAR10DataReader ERROR: Could not open file " + file_path + ": " + std::strerror(errno))
+        struct stat file_stat;
+        if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+            ::close(fd);
+            THROW("CIFAR10DataReader ERROR: Could not stat file " + file_path)
+        }
+        void *data = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+        ::close(fd);  // The mapping keeps its own reference to the file
+        if (data == MAP_FAILED)
+            THROW("CIFAR10DataReader ERROR: Could not map file " + file_path + ": " + std::strerror(errno))
+        _mapped_files.emplace(file_path, std::make_pair(static_cast<unsigned char *>(data), static_cast<size_t>(file_stat.st_size)));
+    }
+    LOG("CIFAR10DataReader  Mapped " + TOSTR(_mapped_files.size()) + " data files")
 }
 
 int CIFAR10DataReader::release() {
@@ -151,17 +185,7 @@ int CIFAR10DataReader::release() {
 }
 
 void CIFAR10DataReader::reset() {
-    if (_shuffle) {
-        std::mt19937 rng1(_shard_id);
-        auto rng2 = rng1;
-        auto rng3 = rng1;
-        std::shuffle(_file_names.begin() + _shard_start_idx_vector[_shard_id],
-                            _file_names.begin() + _shard_start_idx_vector[_shard_id] + actual_shard_size_without_padding(), rng1);
-        std::shuffle(_file_offsets.begin() + _shard_start_idx_vector[_shard_id],
-                            _file_offsets.begin() + _shard_start_idx_vector[_shard_id] + actual_shard_size_without_padding(), rng2);
-        std::shuffle(_file_idx.begin() + _shard_start_idx_vector[_shard_id],
-                            _file_idx.begin() + _shard_start_idx_vector[_shard_id] + actual_shard_size_without_padding(), rng3);
-    }
+    _epoch++;
     if (_stick_to_shard == false)  // Pick elements from the next shard - hence increment shard_id
         increment_shard_id();      // Should work for both single and multiple shards
     _read_counter = 0;
@@ -227,6 +251,7 @@ Reader::Status CIFAR10DataReader::subfolder_reading() {
                 size_t num_padded_samples = 0;
                 num_padded_samples = (largest_shard_size - actual_shard_size_without_padding) + _batch_size - (largest_shard_size % _batch_size);
                 _file_count_all_shards += num_padded_samples;
+                _padded_file_count += num_padded_samples;
                 _file_names.insert(end, num_padded_samples, _file_names[start_idx + actual_shard_size_without_padding + total_padded_samples - 1]);
                 _file_offsets.insert(end_offset, num_padded_samples, _file_offsets[start_idx + actual_shard_size_without_padding + total_padded_samples - 1]);
                 _file_idx.insert(end_file_idx, num_padded_samples, _file_idx[start_idx + actual_shard_size_without_padding + total_padded_samples - 1]);
@@ -52,6 +52,7 @@ Reader::Status COCOFileSourceReader::initialize(ReaderConfig desc) {
     _shard_size = _sharding_info.shard_size;
     _loop = desc.loop();
     _shuffle = desc.shuffle();
+    _shuffle_rng.seed(desc.seed());
     _meta_data_reader = desc.meta_data_reader();
 
     if (_json_path == "") {
@@ -95,8 +96,8 @@ Reader::Status COCOFileSourceReader::initialize(ReaderConfig desc) {
     } else {
         // shuffle dataset if set
         if (ret == Reader::Status::OK && _shuffle)
-            std::random_shuffle(_file_names.begin() + _shard_start_idx_vector[_shard_id],
-                                _file_names.begin() + _shard_end_idx_vector[_shard_id]);
+            std::shuffle(_file_names.begin() + _shard_start_idx_vector[_shard_id],
+                         _file_names.begin() + _shard_end_idx_vector[_shard_id], _shuffle_rng);
     }
     return ret;
 }
@@ -189,26 +190,27 @@ void COCOFileSourceReader::shuffle_with_aspect_ratios() {
     auto shard_end_idx = shard_start_idx + actual_shard_size_without_padding();
     auto mid = std::upper_bound(_aspect_ratios.begin() + shard_start_idx, _aspect_ratios.begin() + shard_end_idx, 1.0f) - (_aspect_ratios.begin() + shard_start_idx);
     // Shuffle within groups using the mid element as the limit - [start, mid) and [mid, last)
-    std::random_shuffle(_file_names.begin() + shard_start_idx, _file_names.begin() + shard_start_idx + mid);
-    std::random_shuffle(_file_names.begin() + shard_start_idx + mid, _file_names.begin() + shard_end_idx);
+    std::shuffle(_file_names.begin() + shard_start_idx, _file_names.begin() + shard_start_idx + mid, _shuffle_rng);
+    std::shuffle(_file_names.begin() + shard_start_idx + mid, _file_names.begin() + shard_end_idx, _shuffle_rng);
     std::vector<std::string> shuffled_filenames;
     int split_count = (_file_names.size() /_shard_count) / _batch_size;  // Number of batches for current shard
     std::vector<int> indexes(split_count);
     std::iota(indexes.begin(), indexes.end(), 0);
     // Shuffle the index vector and use the index to fetch batch size elements for decoding
-    std::random_shuffle(indexes.begin(), indexes.end());
+    std::shuffle(indexes.begin(), indexes.end(), _shuffle_rng);
     for (auto const idx : indexes)
         shuffled_filenames.insert(shuffled_filenames.end(), _file_names.begin() + shard_start_idx + idx * _batch_size, _file_names.begin() + shard_start_idx + idx * _batch_size + _batch_size);
     std::copy(_file_names.begin() + shard_start_idx, _file_names.begin() + shard_end_idx, std::back_inserter(shuffled_filenames));
 }
 
 void COCOFileSourceReader::reset() {
+    _epoch++;
     if (_meta_data_reader && _meta_data_reader->get_aspect_ratio_grouping()) {
         _file_names = _sorted_file_names;
         if (_shuffle) shuffle_with_aspect_ratios();
     } else if (_shuffle) {
-        std::random_shuffle(_file_names.begin() + _shard_start_idx_vector[_shard_id],
-                            _file_names.begin() + _shard_end_idx_vector[_shard_id]);
+        std::shuffle(_file_names.begin() + _shard_start_idx_vector[_shard_id],
+                     _file_names.begin() + _shard_end_idx_vector[_shard_id], _shuffle_rng);
     }
     if (_stick_to_shard == false) // Pick elements from the next shard - hence increment shard_id
         increment_shard_id();     // Should work for both single and multiple shards
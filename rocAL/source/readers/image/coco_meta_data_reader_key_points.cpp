@@ -34,6 +34,7 @@ using namespace std;
 void COCOMetaDataReaderKeyPoints::init(const MetaDataConfig &cfg, pMetaDataBatch meta_data_batch) {
     _path = cfg.path();
     _output = meta_data_batch;
+    _output->set_metadata_type(cfg.type());
     _out_img_width = cfg.out_img_width();
     _out_img_height = cfg.out_img_height();
 }
@@ -159,6 +159,7 @@ int ExternalSourceReader::release() {
 }
 
 void ExternalSourceReader::reset() {
+    _epoch++;
     _read_counter = 0;
     _curr_file_idx = 0;
     _end_of_sequence = false;  // reset for looping
@@ -20,6 +20,8 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 THE SOFTWARE.
 */
 
+#include <algorithm>
+
 #include "readers/image/image_reader.h"
 
 void Reader::increment_curr_file_idx(size_t dataset_size) {
@@ -81,7 +83,8 @@ size_t Reader::get_max_size_of_shard(size_t batch_size, bool loop) {
     return size;
 }
 
-void Reader::update_filenames_with_padding(std::vector<std::string> &file_names, size_t batch_size) {
+template <typename T>
+void Reader::update_filenames_with_padding(std::vector<T> &file_names, size_t batch_size) {
     // pad the last sample when the dataset_size is not divisible by
     // the number of shard's (or) when the shard's size is not
     // divisible by the batch size making each shard having equal
@@ -98,8 +101,57 @@ void Reader::update_filenames_with_padding(std::vector<std::string> &file_names,
             size_t num_padded_samples = 0;
             num_padded_samples = (largest_shard_size - actual_shard_size_without_padding) + batch_size - (largest_shard_size % batch_size);
             _file_count_all_shards += num_padded_samples;
+            _padded_file_count += num_padded_samples;
             file_names.insert(end, num_padded_samples, file_names[start_idx + actual_shard_size_without_padding + total_padded_samples - 1]);
             total_padded_samples += num_padded_samples;
         }
     }
 }
+
+template void Reader::update_filenames_with_padding(std::vector<std::string> &file_names, size_t batch_size);
+template void Reader::update_filenames_with_padding(std::vector<uint32_t> &file_names, size_t batch_size);
+
+void Reader::init_shuffle(unsigned seed) {
+    _sampler.init(seed, _file_count_all_shards - _padded_file_count);
+}
+
+size_t Reader::shuffled_file_idx(size_t file_idx) {
+    size_t dataset_size = _sampler.size();
+    if (!_shuffle || dataset_size <= 1 || _shard_start_idx_vector.empty())
+        return file_idx;
+    if (_sampler.epoch() != _epoch)
+        _sampler.set_epoch(_epoch);
+
+    // Position of the file in its shard, the padded files of a shard repeat its last sample
+    auto shard = std::upper_bound(_shard_start_idx_vector.begin(), _shard_start_idx_vector.end(), file_idx) - _shard_start_idx_vector.begin() - 1;
+    size_t shard_begin = (dataset_size * shard) / _shard_count;
+    size_t shard_size = (dataset_size * (shard + 1)) / _shard_count - shard_begin;
+    if (shard_size == 0)
+        return file_idx;
+    size_t position = shard_begin + std::min<size_t>(file_idx - _shard_start_idx_vector[shard], shard_size - 1);
+
+    // The shards are contiguous slices of the permuted dataset, map the sample back to where it is stored
+    size_t sample = _sampler.sample(position);
+    size_t sample_shard = ((sample + 1) * _shard_count - 1) / dataset_size;
+    return _shard_start_idx_vector[sample_shard] + sample - (dataset_size * sample_shard) / _shard_count;
+}
+
+ReaderState Reader::get_state() {
+    ReaderState state;
+    state.epoch = _epoch;
+    state.curr_file_idx = _curr_file_idx;
+    state.read_counter = _read_counter;
+    state.shard_id = _shard_id;
+    return state;
+}
+
+void Reader::set_state(const ReaderState &state) {
+    if (state.epoch < _epoch)
+        THROW("Cannot rewind the reader to epoch " + TOSTR(state.epoch) + " from epoch " + TOSTR(_epoch))
+    // Each reset moves to the permutation of the next epoch, so replaying them rebuilds the order of the saved epoch
+    while (_epoch < state.epoch)
+        reset();
+    _curr_file_idx = state.curr_file_idx;
+    _read_counter = state.read_counter;
+    _shard_id = state.shard_id;
+}
@@ -52,13 +52,13 @@ Reader::Status MXNetRecordIOReader::initialize(ReaderConfig desc) {
     _pad_last_batch_repeated = _sharding_info.pad_last_batch_repeated;
     _stick_to_shard = _sharding_info.stick_to_shard;
     _shard_size = _sharding_info.shard_size;
+    _record_check = desc.record_check();
     ret = record_reading();
     _curr_file_idx = _shard_start_idx_vector[_shard_id]; // shard's start_idx would vary for every shard in the vector
 
     // shuffle dataset if set
     if (ret == Reader::Status::OK && _shuffle)
-        std::random_shuffle(_file_names.begin() + _shard_start_idx_vector[_shard_id],
-                            _file_names.begin() + _shard_end_idx_vector[_shard_id]);
+        init_shuffle(desc.seed());
 
     return ret;
 }
@@ -69,19 +69,19 @@ void MXNetRecordIOReader::incremenet_read_ptr() {
 }
 
 size_t MXNetRecordIOReader::open() {
-    auto file_path = _file_names[_curr_file_idx];  // Get next file name
+    auto file_path = _file_names[shuffled_file_idx(_curr_file_idx)];  // Get next file name
     _last_id = file_path;
-    auto it = _record_properties.find(_file_names[_curr_file_idx]);
+    auto it = _record_properties.find(file_path);
     std::tie(_current_file_size, _seek_pos, _data_size_to_read) = it->second;
     return _current_file_size;
 }
 
 size_t MXNetRecordIOReader::read_data(unsigned char *buf, size_t read_size) {
-    auto it = _record_properties.find(_file_names[_curr_file_idx]);
+    auto it = _record_properties.find(_file_names[shuffled_file_idx(_curr_file_idx)]);
     std::tie(_current_file_size, _seek_pos, _data_size_to_read) = it->second;
-    read_image(buf, _seek_pos, _data_size_to_read);
+    bool intact = read_image(buf, _seek_pos, _data_size_to_read);
     incremenet_read_ptr();
-    return read_size;
+    return intact ? read_size : 0;
 }
 
 int MXNetRecordIOReader::close() {
@@ -96,9 +96,7 @@ int MXNetRecordIOReader::release() {
 }
 
 void MXNetRecordIOReader::reset() {
-    if (_shuffle)
-        std::random_shuffle(_file_names.begin() + _shard_start_idx_vector[_shard_id],
-                            _file_names.begin() + _shard_end_idx_vector[_shard_id]);
+    _epoch++;
     if (_stick_to_shard == false) // Pick elements from the next shard - hence increment shard_id
         increment_shard_id();     // Should work for both single and multiple shards
     _read_counter = 0;
@@ -186,6 +184,12 @@ void MXNetRecordIOReader::read_image_names() {
         auto ret = _file_contents.read((char *)_data_ptr, _data_size_to_read).gcount();
         if (ret == -1 || ret != _data_size_to_read)
             THROW("MXNetRecordIOReader ERROR:  Unable to read the data from the file ");
+        // A record too corrupted to be indexed is left out, the others are checked as they are read
+        if (_record_check && record_image_size(_data, _data_size_to_read) < 0) {
+            _record_check->count(_shard_id, false, "at offset " + std::to_string(_seek_pos));
+            delete[] _data;
+            continue;
+        }
 
         _magic = *((uint32_t *)_data_ptr);
         _data_ptr += sizeof(_magic);
@@ -219,7 +223,19 @@ void MXNetRecordIOReader::read_image_names() {
     }
 }
 
-void MXNetRecordIOReader::read_image(unsigned char *buff, int64_t seek_position, int64_t _data_size_to_read) {
+int64_t MXNetRecordIOReader::record_image_size(const uint8_t *data, int64_t data_size) {
+    const int64_t prefix_size = 2 * sizeof(uint32_t);  // Magic and length flag
+    if (data_size < prefix_size + (int64_t)sizeof(ImageRecordIOHeader) || *((uint32_t *)data) != _kMagic)
+        return -1;
+    int64_t record_length = DecodeLength(*((uint32_t *)data + 1));
+    int64_t label_size = ((ImageRecordIOHeader *)(data + prefix_size))->flag * sizeof(float);
+    int64_t image_size = record_length - (int64_t)sizeof(ImageRecordIOHeader) - label_size;
+    if (record_length + prefix_size > data_size || image_size < 0)
+        return -1;
+    return image_size;
+}
+
+bool MXNetRecordIOReader::read_image(unsigned char *buff, int64_t seek_position, int64_t _data_size_to_read) {
     uint32_t _magic, _length_flag;
     _file_contents.seekg(seek_position, ifstream::beg);
     uint8_t *_data = new uint8_t[_data_size_to_read];
@@ -227,6 +243,11 @@ void MXNetRecordIOReader::read_image(unsigned char *buff, int64_t seek_position,
     auto ret = _file_contents.read((char *)_data_ptr, _data_size_to_read).gcount();
     if (ret == -1 || ret != _data_size_to_read)
         THROW("MXNetRecordIOReader ERROR:  Unable to read the data from the file ");
+    // The image also has to keep the size it had when the record was indexed, which the output buffer is sized for
+    if (_record_check && !_record_check->count(_shard_id, record_image_size(_data, _data_size_to_read) == _current_file_size, _last_id)) {
+        delete[] _data;
+        return false;
+    }
     _magic = *((uint32_t *)_data_ptr);
     _data_ptr += sizeof(_magic);
     if (_magic != _kMagic)
@@ -246,4 +267,5 @@ void MXNetRecordIOReader::read_image(unsigned char *buff, int64_t seek_position,
     else
         THROW("\nMultiple record reading has not supported");
     delete[] _data;
+    return true;
 }
@@ -26,6 +26,10 @@ THE SOFTWARE.
 #include <numeric>
 #include <random>
 #include <math.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "pipeline/commons.h"
 #include "pipeline/filesystem.h"
 #include "readers/image/numpy_data_reader.h"
@@ -53,6 +57,128 @@ THE SOFTWARE.
         }                                                                \
     }
 
+std::mutex NumpyDataReader::_cache_mutex;
+std::map<std::string, NumpyDataReader::CachedHeader> NumpyDataReader::_header_cache;
+
+std::shared_ptr<NumpyMappedFile> NumpyMappedFile::open(const std::string& file_path) {
+    int fd = ::open(file_path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        ERR("Could not open file " + file_path + ": " + std::strerror(errno));
+        return nullptr;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+        ERR("Could not stat file " + file_path + ": " + std::strerror(errno));
+        ::close(fd);
+        return nullptr;
+    }
+    std::shared_ptr<NumpyMappedFile> file(new NumpyMappedFile());
+    file->_size = file_stat.st_size;
+    file->_modification_time = static_cast<int64_t>(file_stat.st_mtim.tv_sec) * 1000000000 + file_stat.st_mtim.tv_nsec;
+    if (file->_size > 0) {
+        void* data = mmap(nullptr, file->_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            ERR("Could not map file " + file_path + ": " + std::strerror(errno));
+            ::close(fd);
+            return nullptr;
+        }
+        file->_data = static_cast<unsigned char*>(data);
+    }
+    ::close(fd);  // The mapping keeps its own reference to the file
+    return file;
+}
+
+NumpyMappedFile::~NumpyMappedFile() {
+    if (_data)
+        munmap(_data, _size);
+}
+
+void NumpyMappedFile::prefetch(size_t offset, size_t size) const {
+    if (!_data || offset >= _size)
+        return;
+    static const size_t page_size = sysconf(_SC_PAGESIZE);
+    size_t aligned_offset = offset - (offset % page_size);  // madvise needs a page aligned address
+    size = std::min(size + offset - aligned_offset, _size - aligned_offset);
+    madvise(_data + aligned_offset, size, MADV_WILLNEED);
+}
+
+template <typename T>
+static void gather_elements(unsigned char* dst, const unsigned char* src, size_t count, size_t src_stride) {
+    auto dst_ptr = reinterpret_cast<T*>(dst);
+    auto src_ptr = reinterpret_cast<const T*>(src);
+    for (size_t i = 0; i < count; i++)
+        dst_ptr[i] = src_ptr[i * src_stride];
+}
+
+size_t copy_numpy_sample(const NumpySample& sample, unsigned char* dst, const std::vector<unsigned>& strides_in_dims) {
+    if (!sample.file || !sample.file->data())
+        return 0;
+    const auto& header = sample.header;
+    const size_t num_dims = header.array_shape.size();
+    const size_t dtype_size = tensor_data_size(header.type_info);
+    const unsigned char* src = sample.file->data() + header.data_offset;
+    if (num_dims == 0) {  // Scalar array
+        memcpy(dst, src, dtype_size);
+        return dtype_size;
+    }
+
+    // Element strides of the array in the file, the first dimension is the contiguous one for fortran ordered arrays
+    std::vector<size_t> src_strides(num_dims), dst_strides(num_dims);
+    size_t stride = 1;
+    for (size_t i = 0; i < num_dims; i++) {
+        size_t d = header.fortran_order ? i : num_dims - 1 - i;
+        src_strides[d] = stride;
+        stride *= header.array_shape[d];
+    }
+    size_t src_offset = 0;
+    for (size_t d = 0; d < num_dims; d++) {
+        dst_strides[d] = strides_in_dims[d + 1];
+        src_offset += sample.roi_start[d] * src_strides[d];
+    }
+    src += src_offset * dtype_size;
+
+    // Merge the innermost dimensions that are contiguous in both the file and the output into a single run
+    const bool contiguous = src_strides[num_dims - 1] == 1;
+    size_t inner_dim = num_dims - 1;
+    size_t run = sample.roi_shape[inner_dim];
+    while (contiguous && inner_dim > 0 && src_strides[inner_dim - 1] == run && dst_strides[inner_dim - 1] == run) {
+        inner_dim--;
+        run *= sample.roi_shape[inner_dim];
+    }
+    size_t num_rows = 1;
+    for (size_t d = 0; d < inner_dim; d++)
+        num_rows *= sample.roi_shape[d];
+
+    const size_t run_bytes = run * dtype_size;
+    const size_t inner_src_stride = src_strides[num_dims - 1];
+    for (size_t row = 0; row < num_rows; row++) {
+        size_t src_idx = 0, dst_idx = 0, remaining = row;
+        for (size_t d = inner_dim; d-- > 0;) {
+            size_t coord = remaining % sample.roi_shape[d];
+            remaining /= sample.roi_shape[d];
+            src_idx += coord * src_strides[d];
+            dst_idx += coord * dst_strides[d];
+        }
+        unsigned char* dst_row = dst + dst_idx * dtype_size;
+        const unsigned char* src_row = src + src_idx * dtype_size;
+        if (contiguous) {
+            memcpy(dst_row, src_row, run_bytes);
+            continue;
+        }
+        // Fortran ordered arrays are transposed while copying
+        switch (dtype_size) {
+            case 1: gather_elements<uint8_t>(dst_row, src_row, run, inner_src_stride); break;
+            case 2: gather_elements<uint16_t>(dst_row, src_row, run, inner_src_stride); break;
+            case 4: gather_elements<uint32_t>(dst_row, src_row, run, inner_src_stride); break;
+            case 8: gather_elements<uint64_t>(dst_row, src_row, run, inner_src_stride); break;
+            default:
+                for (size_t i = 0; i < run; i++)
+                    memcpy(dst_row + i * dtype_size, src_row + i * inner_src_stride * dtype_size, dtype_size);
+        }
+    }
+    return num_rows * run_bytes;
+}
+
 NumpyDataReader::NumpyDataReader() {
     _loop = false;
     _shuffle = false;
@@ -75,14 +201,15 @@ Reader::Status NumpyDataReader::initialize(ReaderConfig desc) {
     _shard_size = _sharding_info.shard_size;
     _files = desc.get_files();
     _seed = desc.seed();
+    _roi_start = desc.numpy_roi_start();
+    _roi_shape = desc.numpy_roi_shape();
+    for (auto start : _roi_start)
+        if (start < 0)
+            THROW("NumpyDataReader ShardID [" + TOSTR(_shard_id) + "] ERROR: roi_start can not be negative");
     ret = subfolder_reading();
-    _file_headers.resize(_file_names.size());
     // shuffle dataset if set
-    if (ret == Reader::Status::OK && _shuffle) {
-        std::mt19937 rng(_seed);
-        std::shuffle(_file_names.begin() + _shard_start_idx_vector[_shard_id],
-                     _file_names.begin() + _shard_end_idx_vector[_shard_id], rng);
-    }
+    if (ret == Reader::Status::OK && _shuffle)
+        init_shuffle(_seed);
     return ret;
 }
 
@@ -92,8 +219,7 @@ void NumpyDataReader::incremenet_read_ptr() {
 }
 
 size_t NumpyDataReader::open() {
-    auto file_path = _file_names[_curr_file_idx];       // Get current file name
-    _curr_file_header = _file_headers[_curr_file_idx];  // Get current file header
+    auto file_path = _file_names[shuffled_file_idx(_curr_file_idx)];  // Get current file name
     incremenet_read_ptr();
     _last_file_path = _last_id = file_path;
     auto last_slash_idx = _last_id.find_last_of("\\/");
@@ -101,40 +227,59 @@ size_t NumpyDataReader::open() {
         _last_id.erase(0, last_slash_idx + 1);
     }
 
+    _curr_sample = NumpySample();  // Samples handed out by current_sample() keep their own reference to the mapping
+    _curr_read_offset = 0;
+    auto file = NumpyMappedFile::open(file_path);
+    if (!file)
+        return 0;
+
     _header_parsing_failed = false;
-    auto ret = get_header_from_cache(file_path, _curr_file_header);
-    if (!ret) {
-        parse_header(_curr_file_header, file_path);
-        if(_header_parsing_failed) {
+    auto& header = _curr_sample.header;
+    if (!get_header_from_cache(file_path, *file, header)) {
+        parse_header(header, *file, file_path);
+        if (_header_parsing_failed) {
             ERR("Numpy header parsing failed");
             return 0;
         }
-        update_header_cache(file_path, _curr_file_header);
-    } else {
-        _current_file_ptr = std::fopen(file_path.c_str(), "rb");
-        if (_current_file_ptr == nullptr) {
-            ERR("Could not open file " + file_path + ": " + std::strerror(errno));
-            return 0;
-        }
+        update_header_cache(file_path, *file, header);
+    }
+    _curr_sample.file = file;
+    set_sample_roi(_curr_sample);
+
+    size_t roi_size = tensor_data_size(header.type_info);
+    for (auto extent : _curr_sample.roi_shape)
+        roi_size *= extent;
+    return roi_size;  // Returns the size of the numpy array region that is read (in bytes)
+}
+
+void NumpyDataReader::set_sample_roi(NumpySample& sample) {
+    const auto& shape = sample.header.array_shape;
+    sample.roi_start.assign(shape.size(), 0);
+    sample.roi_shape = shape;
+    for (size_t d = 0; d < shape.size(); d++) {
+        if (d < _roi_start.size())
+            sample.roi_start[d] = std::min<unsigned>(_roi_start[d], shape[d]);
+        unsigned extent = shape[d] - sample.roi_start[d];
+        if (d < _roi_shape.size() && _roi_shape[d] >= 0)
+            extent = std::min<unsigned>(_roi_shape[d], extent);
+        sample.roi_shape[d] = extent;
     }
-    fseek(_current_file_ptr, 0, SEEK_SET);  // Take the file pointer back to the start
-    return _curr_file_header.numpy_data_nbytes();  // Returns the numpy array data size (in bytes)
 }
 
-bool NumpyDataReader::get_header_from_cache(const std::string& file_name, NumpyHeaderData& header) {
+bool NumpyDataReader::get_header_from_cache(const std::string& file_name, const NumpyMappedFile& file, NumpyHeaderData& header) {
     std::unique_lock<std::mutex> cache_lock(_cache_mutex);
     auto it = _header_cache.find(file_name);
-    if (it == _header_cache.end()) {
+    if (it == _header_cache.end() || it->second.file_size != file.size() || it->second.modification_time != file.modification_time()) {
         return false;
     } else {
-        header = it->second;
+        header = it->second.header;
         return true;
     }
 }
 
-void NumpyDataReader::update_header_cache(const std::string& file_name, const NumpyHeaderData& value) {
+void NumpyDataReader::update_header_cache(const std::string& file_name, const NumpyMappedFile& file, const NumpyHeaderData& value) {
     std::unique_lock<std::mutex> cache_lock(_cache_mutex);
-    _header_cache[file_name] = value;
+    _header_cache[file_name] = {value, file.size(), file.modification_time()};
 }
 
 template <size_t N>
@@ -231,93 +376,55 @@ void NumpyDataReader::parse_header_data(NumpyHeaderData& target, const std::stri
         while (std::isspace(*hdr)) hdr++;
         CHECK_CONDITION_AND_SET_FLAG(!(try_skip_char(hdr, ",")) && (target.array_shape.size() <= 1), "The first number in a tuple must be followed by a comma.", void())
     }
-    if (target.fortran_order) {
-        // cheapest thing to do is to define the tensor in an reversed way
-        std::reverse(target.array_shape.begin(), target.array_shape.end());
-    }
 }
 
-void NumpyDataReader::parse_header(NumpyHeaderData& parsed_header, std::string file_path) {
-    std::vector<char> token(HEADER_OFFSET + 1);  // Need to store 10 bytes of numpy header info and null termination character
-    _current_file_ptr = std::fopen(file_path.c_str(), "rb");
-    CHECK_CONDITION_AND_SET_FLAG(_current_file_ptr == nullptr, "Could not open file " + file_path + ": " + std::strerror(errno), void())
-
-    int64_t offset = HEADER_OFFSET;
-    int64_t n_read = std::fread(token.data(), 1, offset, _current_file_ptr);
+void NumpyDataReader::parse_header(NumpyHeaderData& parsed_header, const NumpyMappedFile& file, const std::string& file_path) {
     // check if header is too short
-    CHECK_CONDITION_AND_SET_FLAG(n_read != offset, "Can not read numpy header file contents", void())
-    token[n_read] = '\0';
+    CHECK_CONDITION_AND_SET_FLAG(file.size() < HEADER_OFFSET, "Can not read numpy header file contents of " + file_path, void())
+    const char* token = reinterpret_cast<const char*>(file.data());
 
     // rocAL only supports numpy V1 headers
     // https://numpy.org/neps/nep-0001-npy-format.html
     int np_api_version = token[6];
     CHECK_CONDITION_AND_SET_FLAG(np_api_version != 1, "rocAL only supports reading npy files with NPY file format version 1", void())
     // check if the file is actually a numpy file
-    std::string header = std::string(token.data());
-    CHECK_CONDITION_AND_SET_FLAG(header.find("NUMPY") == std::string::npos, "File is not a numpy file", void())
+    CHECK_CONDITION_AND_SET_FLAG(std::memcmp(token + 1, "NUMPY", 5) != 0, "File is not a numpy file", void())
 
     // extract header length which can have up to 65535 bytes - NPYv1 format
     uint16_t header_len = 0;
-    memcpy(&header_len, &token[8], 2);
+    memcpy(&header_len, token + 8, 2);
     CHECK_CONDITION_AND_SET_FLAG((header_len + 10) % 16 != 0, "Error extracting numpy header length", void())
-
-    token.resize(header_len + 1);
-    CHECK_CONDITION_AND_SET_FLAG(std::fseek(_current_file_ptr, offset, SEEK_SET), "Seek operation failed in " + file_path + ": " + std::strerror(errno), void())
-    n_read = std::fread(token.data(), 1, header_len, _current_file_ptr);
-    CHECK_CONDITION_AND_SET_FLAG(n_read != header_len, "Can not read numpy header upto header_len", void())    
-    token[header_len] = '\0';
-    header = std::string(token.data());
+    CHECK_CONDITION_AND_SET_FLAG(file.size() < static_cast<size_t>(HEADER_OFFSET + header_len), "Can not read numpy header upto header_len", void())
+    std::string header(token + HEADER_OFFSET, header_len);
     CHECK_CONDITION_AND_SET_FLAG(header.find('{') == std::string::npos, "Header is corrupted", void())
-    offset += header_len;
-    CHECK_CONDITION_AND_SET_FLAG(std::fseek(_current_file_ptr, offset, SEEK_SET), "Seek operation failed in " + file_path + ": " + std::strerror(errno), void())
 
     parse_header_data(parsed_header, header);
     if (_header_parsing_failed) return;
-    parsed_header.data_offset = offset;
+    parsed_header.data_offset = HEADER_OFFSET + header_len;
+    CHECK_CONDITION_AND_SET_FLAG(file.size() < parsed_header.data_offset + parsed_header.numpy_data_nbytes(), "Numpy file " + file_path + " is truncated", void())
 }
 
 size_t NumpyDataReader::read_numpy_data(void* buf, size_t read_size, std::vector<unsigned>& strides_in_dims) {
-    if (!_current_file_ptr) {
-        ERR("Null file pointer");
-        return 0;
-    }
-    
-    auto shape = _curr_file_header.shape();
-    auto data_type_size = tensor_data_size(_curr_file_header.type());
-    if (std::fseek(_current_file_ptr, _curr_file_header.data_offset, SEEK_SET)) {
-        ERR("Seek operation failed for " + _last_file_path + ": " + std::strerror(errno));
+    if (!_curr_sample.file) {
+        ERR("No numpy file is opened");
         return 0;
     }
-
-    if (strides_in_dims[0] == _curr_file_header.size())
-        return std::fread((unsigned char*)buf, sizeof(unsigned char), _curr_file_header.numpy_data_nbytes(), _current_file_ptr);
-    else
-        return parse_numpy_data((unsigned char*)buf, strides_in_dims, shape, data_type_size);
-}
-
-size_t NumpyDataReader::parse_numpy_data(unsigned char* buf, std::vector<unsigned>& strides_in_dims, std::vector<unsigned>& shapes, size_t dtype_size, unsigned dim) {
-    if (dim == (shapes.size() - 1)) {
-        auto actual_read_size = std::fread(buf, sizeof(unsigned char), shapes[dim] * dtype_size, _current_file_ptr);
-        return actual_read_size;
-    }
-    unsigned char* startPtr = buf;
-    size_t read_size = 0;
-    for (unsigned d = 0; d < shapes[dim]; d++) {
-        read_size += parse_numpy_data(startPtr, strides_in_dims, shapes, dtype_size, dim + 1);
-        startPtr += (strides_in_dims[dim + 1] * dtype_size);
-    }
-    return read_size;
+    return copy_numpy_sample(_curr_sample, static_cast<unsigned char*>(buf), strides_in_dims);
 }
 
 const NumpyHeaderData NumpyDataReader::get_numpy_header_data() {
-    return _curr_file_header;
+    auto header = _curr_sample.header;
+    header.array_shape = _curr_sample.roi_shape;
+    return header;
 }
 
 size_t NumpyDataReader::read_data(unsigned char* buf, size_t read_size) {
-    if (!_current_file_ptr)
+    if (!_curr_sample.file || _curr_read_offset >= _curr_sample.file->size())
         return 0;
 
-    size_t actual_read_size = fread(buf, sizeof(unsigned char), read_size, _current_file_ptr);
+    size_t actual_read_size = std::min(read_size, _curr_sample.file->size() - _curr_read_offset);
+    memcpy(buf, _curr_sample.file->data() + _curr_read_offset, actual_read_size);
+    _curr_read_offset += actual_read_size;
     return actual_read_size;
 }
 
@@ -330,20 +437,12 @@ NumpyDataReader::~NumpyDataReader() {
 }
 
 int NumpyDataReader::release() {
-    if (!_current_file_ptr)
-        return 0;
-    fclose(_current_file_ptr);
-    _current_file_ptr = nullptr;
+    _curr_sample.file = nullptr;
     return 0;
 }
 
 void NumpyDataReader::reset() {
-    if (_shuffle) {
-        std::mt19937 rng(_seed);
-        std::shuffle(_file_names.begin() + _shard_start_idx_vector[_shard_id],
-                     _file_names.begin() + _shard_start_idx_vector[_shard_id] + actual_shard_size_without_padding(), rng);
-    }
-
+    _epoch++;
     if (_stick_to_shard == false)  // Pick elements from the next shard - hence increment shard_id
         increment_shard_id();      // Should work for both single and multiple shards
 
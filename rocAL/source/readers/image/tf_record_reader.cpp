@@ -21,6 +21,7 @@ THE SOFTWARE.
 */
 
 #include "readers/image/tf_record_reader.h"
+#include "readers/crc32c.h"
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -58,11 +59,11 @@ Reader::Status TFRecordReader::initialize(ReaderConfig desc) {
     _pad_last_batch_repeated = _sharding_info.pad_last_batch_repeated;
     _stick_to_shard = _sharding_info.stick_to_shard;
     _shard_size = _sharding_info.shard_size;
+    _record_check = desc.record_check();
     ret = folder_reading();
     // shuffle dataset if set
     if (ret == Reader::Status::OK && _shuffle)
-        std::random_shuffle(_file_names.begin() + _shard_start_idx_vector[_shard_id],
-                            _file_names.begin() + _shard_end_idx_vector[_shard_id]);
+        init_shuffle(desc.seed());
     return ret;
 }
 
@@ -71,22 +72,21 @@ void TFRecordReader::incremenet_read_ptr() {
     increment_curr_file_idx(_file_names.size());
 }
 size_t TFRecordReader::open() {
-    auto file_path = _file_names[_curr_file_idx];  // Get next file name
+    auto file_path = _file_names[shuffled_file_idx(_curr_file_idx)];  // Get next file name
     _last_id = file_path;
     auto last_slash_idx = _last_id.find_last_of("\\/");
     if (std::string::npos != last_slash_idx) {
         _last_id.erase(0, last_slash_idx + 1);
     }
-    _current_file_size = _file_size[_file_names[_curr_file_idx]];
+    _current_file_size = _file_size[file_path];
     return _current_file_size;
 }
 
 size_t TFRecordReader::read_data(unsigned char *buf, size_t read_size) {
-    auto ret = read_image(buf, _file_names[_curr_file_idx], _file_size[_file_names[_curr_file_idx]]);
-    if (ret != Reader::Status::OK)
-        THROW("TFRecordReader: Error in reading TF records");
+    auto& file_path = _file_names[shuffled_file_idx(_curr_file_idx)];
+    bool intact = read_image(buf, file_path, _file_size[file_path]);
     incremenet_read_ptr();
-    return read_size;
+    return intact ? read_size : 0;
 }
 
 int TFRecordReader::close() {
@@ -102,9 +102,7 @@ int TFRecordReader::release() {
 }
 
 void TFRecordReader::reset() {
-    if (_shuffle)
-        std::random_shuffle(_file_names.begin() + _shard_start_idx_vector[_shard_id],
-                            _file_names.begin() + _shard_start_idx_vector[_shard_id] + actual_shard_size_without_padding());
+    _epoch++;
     if (_stick_to_shard == false) // Pick elements from the next shard - hence increment shard_id
         increment_shard_id();     // Should work for both single and multiple shards
     _read_counter = 0;
@@ -191,6 +189,12 @@ Reader::Status TFRecordReader::read_image_names(std::ifstream &file_contents, ui
         file_contents.read((char *)&length_crc, sizeof(length_crc));
         if (!file_contents)
             THROW("TFRecordReader: Error in reading TF records")
+        // Only the records failing the check while indexing are counted, the others are counted as they are read
+        if (_record_check && crc32c_mask(crc32c(&data_length, sizeof(data_length))) != length_crc) {
+            _record_check->count(_shard_id, false, _folder_path);
+            WRN("TFRecordReader: The record with a corrupted length and the records following it in " + _folder_path + " are left out")
+            break;
+        }
         if (uint(length + data_length + 16) == file_size) {
             _last_rec = true;
         }
@@ -198,9 +202,15 @@ Reader::Status TFRecordReader::read_image_names(std::ifstream &file_contents, ui
         file_contents.read(data.get(), data_length);
         if (!file_contents)
             THROW("TFRecordReader: Error in reading TF records")
-        _single_example.ParseFromArray(data.get(), data_length);
+        bool parsed = _single_example.ParseFromArray(data.get(), data_length);
         _features = _single_example.features();
         auto feature = _features.feature();
+        // A record too corrupted to be indexed is left out, the data of the others is checked as they are read
+        if (_record_check && (!parsed || !feature.count(_encoded_key) || (!_filename_key.empty() && !feature.count(_filename_key)))) {
+            _record_check->count(_shard_id, false, _folder_path);
+            file_contents.seekg(sizeof(data_crc), std::ifstream::cur);
+            continue;
+        }
         std::string file_path = _folder_path;
         std::string fname;
         if (!_filename_key.empty()) {
@@ -228,8 +238,7 @@ Reader::Status TFRecordReader::read_image_names(std::ifstream &file_contents, ui
     return ret;
 }
 
-Reader::Status TFRecordReader::read_image(unsigned char *buff, std::string file_name, uint file_size) {
-    auto ret = Reader::Status::OK;
+bool TFRecordReader::read_image(unsigned char *buff, std::string file_name, uint file_size) {
     std::string temp = file_name.substr(0, file_name.find_last_of("\\/"));
     const size_t last_slash_idx = file_name.find_last_of("\\/");
     if (std::string::npos != last_slash_idx) {
@@ -252,10 +261,26 @@ Reader::Status TFRecordReader::read_image(unsigned char *buff, std::string file_
     file_contents.read((char *)&length_crc, sizeof(length_crc));
     if (!file_contents)
         THROW("TFRecordReader: Error in reading TF records")
+    // A length failing its CRC can't be trusted to read the data, the record is counted once its data is checked otherwise
+    if (_record_check && crc32c_mask(crc32c(&data_length, sizeof(data_length))) != length_crc)
+        return _record_check->count(_shard_id, false, _last_id);
     std::unique_ptr<char[]> data(new char[data_length]);
-    file_contents.read(data.get(), data_length);
+    uint32_t crc = 0;
+    const size_t chunk_size = _record_check ? RECORD_READ_CHUNK : data_length;
+    for (size_t offset = 0; offset < data_length; offset += chunk_size) {
+        size_t read_size = std::min<size_t>(chunk_size, data_length - offset);
+        file_contents.read(data.get() + offset, read_size);
+        if (!file_contents)
+            THROW("TFRecordReader: Error in reading TF records")
+        if (_record_check)
+            crc = crc32c_extend(crc, data.get() + offset, read_size);
+    }
+    file_contents.read((char *)&data_crc, sizeof(data_crc));
     if (!file_contents)
         THROW("TFRecordReader: Error in reading TF records")
+    file_contents.close();
+    if (_record_check && !_record_check->count(_shard_id, crc32c_mask(crc) == data_crc, _last_id))
+        return false;
     _single_example.ParseFromArray(data.get(), data_length);
     _features = _single_example.features();
     auto feature = _features.feature();
@@ -269,9 +294,5 @@ Reader::Status TFRecordReader::read_image(unsigned char *buff, std::string file_
         _single_feature = feature.at(_encoded_key);
         memcpy(buff, _single_feature.bytes_list().value()[0].c_str(), _single_feature.bytes_list().value()[0].size());
     }
-    file_contents.read((char *)&data_crc, sizeof(data_crc));
-    if (!file_contents)
-        THROW("TFRecordReader: Error in reading TF records")
-    file_contents.close();
-    return ret;
+    return true;
 }
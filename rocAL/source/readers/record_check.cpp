@@ -0,0 +1,46 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "readers/record_check.h"
+
+#include "pipeline/commons.h"
+
+bool RecordCheck::count(size_t shard_id, bool intact, const std::string &record_id) {
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        auto &counters = _counters[shard_id];
+        counters.checked++;
+        if (!intact)
+            counters.corrupted++;
+    }
+    if (!intact) {
+        if (_policy == RecordCheckPolicy::FAIL)
+            THROW("Record " + record_id + " of shard " + TOSTR(shard_id) + " is corrupted")
+        WRN("Record " + record_id + " of shard " + TOSTR(shard_id) + " is corrupted, " + (_policy == RecordCheckPolicy::SKIP ? "skipped" : "substituted"))
+    }
+    return intact;
+}
+
+std::map<size_t, RecordCheck::Counters> RecordCheck::counters() {
+    std::lock_guard<std::mutex> lock(_lock);
+    return _counters;
+}
@@ -0,0 +1,73 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include <fstream>
+#include "pipeline/commons.h"
+#include "readers/sample_quarantine.h"
+
+SampleQuarantine::SampleQuarantine(const std::string &file_path) : _file_path(file_path) {
+    if (_file_path.empty())
+        return;
+    // Each line holds the sample key and, after a tab, the reason it was quarantined
+    std::ifstream quarantine_file(_file_path);
+    std::string line;
+    while (std::getline(quarantine_file, line)) {
+        auto key = line.substr(0, line.find('\t'));
+        if (!key.empty() && _key_set.insert(key).second)
+            _keys.push_back(key);
+    }
+    if (!_keys.empty()) {
+        INFO("Loaded " + TOSTR(_keys.size()) + " quarantined samples from " + _file_path)
+    }
+}
+
+bool SampleQuarantine::contains(const std::string &key) {
+    std::unique_lock<std::mutex> lock(_lock);
+    return _key_set.find(key) != _key_set.end();
+}
+
+bool SampleQuarantine::add(const std::string &key, const std::string &reason) {
+    std::unique_lock<std::mutex> lock(_lock);
+    if (!_key_set.insert(key).second)
+        return false;
+    _keys.push_back(key);
+    WRN("Quarantined sample " + key + ": " + reason)
+    if (!_file_path.empty()) {
+        std::ofstream quarantine_file(_file_path, std::ios::app);
+        if (quarantine_file) {
+            quarantine_file << key << '\t' << reason << '\n';
+        } else {
+            WRN("Cannot append to the quarantine file " + _file_path)
+        }
+    }
+    return true;
+}
+
+std::vector<std::string> SampleQuarantine::keys() {
+    std::unique_lock<std::mutex> lock(_lock);
+    return _keys;
+}
+
+size_t SampleQuarantine::count() {
+    std::unique_lock<std::mutex> lock(_lock);
+    return _keys.size();
+}
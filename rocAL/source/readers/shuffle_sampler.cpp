@@ -0,0 +1,73 @@
+/*
+Copyright (c) 2019 - 2025 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "readers/shuffle_sampler.h"
+
+namespace {
+// SplitMix64 finalizer, spreads every input bit over the whole word
+uint64_t mix(uint64_t value) {
+    value += 0x9E3779B97F4A7C15ULL;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+}  // namespace
+
+void ShuffleSampler::init(uint64_t seed, size_t size) {
+    _seed = seed;
+    _size = size;
+    unsigned bits = 0;
+    while (bits < 64 && (uint64_t(1) << bits) < size)
+        bits++;
+    _half_bits = (bits + 1) / 2 > 0 ? (bits + 1) / 2 : 1;
+    _half_mask = (uint64_t(1) << _half_bits) - 1;
+    set_epoch(0);
+}
+
+void ShuffleSampler::set_epoch(uint64_t epoch) {
+    _epoch = epoch;
+    uint64_t key = mix(_seed ^ mix(epoch));
+    for (unsigned round = 0; round < ROUNDS; round++)
+        _round_keys[round] = key = mix(key + round);
+}
+
+uint64_t ShuffleSampler::permute(uint64_t value) const {
+    uint64_t left = value >> _half_bits;
+    uint64_t right = value & _half_mask;
+    for (unsigned round = 0; round < ROUNDS; round++) {
+        uint64_t next_right = left ^ (mix(right ^ _round_keys[round]) & _half_mask);
+        left = right;
+        right = next_right;
+    }
+    return (left << _half_bits) | right;
+}
+
+size_t ShuffleSampler::sample(size_t idx) const {
+    if (_size <= 1 || idx >= _size)
+        return idx;
+    // The domain is less than 4 times the size, so a few walks are enough on average
+    uint64_t value = idx;
+    do {
+        value = permute(value);
+    } while (value >= _size);
+    return value;
+}
@@ -23,6 +23,7 @@ THE SOFTWARE.
 #include <cassert>
 #include <algorithm>
 #include <cstring>
+#include <unordered_map>
 #include "pipeline/commons.h"
 #include "readers/video/sequence_file_source_reader.h"
 #include "pipeline/filesystem.h"
@@ -55,6 +56,7 @@ Reader::Status SequenceFileSourceReader::initialize(ReaderConfig desc) {
     _shard_count = desc.get_shard_count();
     _user_batch_count = desc.get_batch_size();
     _shuffle = desc.shuffle();
+    _shuffle_rng.seed(desc.seed());
     _loop = desc.loop();
     _sequence_length = desc.get_sequence_length();
     _step = desc.get_frame_step();
@@ -77,27 +79,53 @@ Reader::Status SequenceFileSourceReader::initialize(ReaderConfig desc) {
 
     // shuffle dataset if set
     if (ret == Reader::Status::OK && _shuffle)
-        std::random_shuffle(_sequence_frame_names.begin(), _sequence_frame_names.end());
+        std::shuffle(_sequence_frame_names.begin(), _sequence_frame_names.end(), _shuffle_rng);
 
+    build_frame_order();
+    return ret;
+}
+
+void SequenceFileSourceReader::build_frame_order() {
+    _frame_names.clear();
     for (auto &&seq : _sequence_frame_names) {
         _frame_names.insert(_frame_names.end(), seq.begin(), seq.end());
     }
-    return ret;
+    _next_use.assign(_frame_names.size(), NO_NEXT_USE);
+    std::unordered_map<std::string, size_t> later_use;
+    for (size_t position = _frame_names.size(); position-- > 0;) {
+        auto use = later_use.find(_frame_names[position]);
+        if (use != later_use.end()) {
+            _next_use[position] = use->second;
+            use->second = position;
+        } else {
+            later_use.emplace(_frame_names[position], position);
+        }
+    }
 }
 
 void SequenceFileSourceReader::incremenet_read_ptr() {
     _read_counter++;
+    _last_position = _curr_file_idx;
     _curr_file_idx = (_curr_file_idx + 1) % _frame_names.size();
 }
 
-size_t SequenceFileSourceReader::open() {
-    auto file_path = _frame_names[_curr_file_idx];  // Get next file name
-    incremenet_read_ptr();
+void SequenceFileSourceReader::set_last_id(const std::string &file_path) {
     _last_id = file_path;
     auto last_slash_idx = _last_id.find_last_of("\\/");
     if (std::string::npos != last_slash_idx) {
         _last_id.erase(0, last_slash_idx + 1);
     }
+}
+
+void SequenceFileSourceReader::skip() {
+    set_last_id(_frame_names[_curr_file_idx]);
+    incremenet_read_ptr();
+}
+
+size_t SequenceFileSourceReader::open() {
+    auto file_path = _frame_names[_curr_file_idx];  // Get next file name
+    incremenet_read_ptr();
+    set_last_id(file_path);
     _current_fPtr = fopen(file_path.c_str(), "rb");  // Open the file,
     if (!_current_fPtr)                              // Check if it is ready for reading
         return 0;
@@ -140,8 +168,11 @@ int SequenceFileSourceReader::release() {
 }
 
 void SequenceFileSourceReader::reset() {
-    if (_shuffle)
-        std::random_shuffle(_sequence_frame_names.begin(), _sequence_frame_names.end());
+    _epoch++;
+    if (_shuffle) {
+        std::shuffle(_sequence_frame_names.begin(), _sequence_frame_names.end(), _shuffle_rng);
+        build_frame_order();  // The frames are read in the new order of the sequences
+    }
 
     _read_counter = 0;
     _curr_file_idx = 0;
@@ -45,6 +45,7 @@ VideoReader::Status VideoFileSourceReader::initialize(ReaderConfig desc) {
     _shard_id = desc.get_shard_id();
     _shard_count = desc.get_shard_count();
     _shuffle = desc.shuffle();
+    _shuffle_rng.seed(desc.seed());
     _loop = desc.loop();
     _video_prop = desc.get_video_properties();
     _video_count = _video_prop.videos_count;
@@ -71,7 +72,7 @@ VideoReader::Status VideoFileSourceReader::initialize(ReaderConfig desc) {
     }
     // shuffle dataset if set
     if (ret == VideoReader::Status::OK && _shuffle)
-        std::random_shuffle(_sequences.begin(), _sequences.end());
+        std::shuffle(_sequences.begin(), _sequences.end(), _shuffle_rng);
 
     return ret;
 }
@@ -93,12 +94,31 @@ VideoFileSourceReader::~VideoFileSourceReader() {
 }
 
 void VideoFileSourceReader::reset() {
+    _epoch++;
     if (_shuffle)
-        std::random_shuffle(_sequences.begin(), _sequences.end());
+        std::shuffle(_sequences.begin(), _sequences.end(), _shuffle_rng);
     _read_counter = 0;
     _curr_sequence_idx = 0;
 }
 
+ReaderState VideoFileSourceReader::get_state() {
+    ReaderState state;
+    state.epoch = _epoch;
+    state.curr_file_idx = _curr_sequence_idx;
+    state.read_counter = _read_counter;
+    state.shard_id = _shard_id;
+    return state;
+}
+
+void VideoFileSourceReader::set_state(const ReaderState &state) {
+    if (state.epoch < _epoch)
+        THROW("Cannot rewind the reader to epoch " + TOSTR(state.epoch) + " from epoch " + TOSTR(_epoch))
+    while (_epoch < state.epoch)
+        reset();
+    _curr_sequence_idx = state.curr_file_idx;
+    _read_counter = state.read_counter;
+}
+
 VideoReader::Status VideoFileSourceReader::create_sequence_info() {
     VideoReader::Status status = VideoReader::Status::OK;
     for (size_t i = 0; i < _video_count; i++) {
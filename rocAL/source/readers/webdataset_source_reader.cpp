@@ -69,8 +69,7 @@ Reader::Status WebDatasetSourceReader::initialize(ReaderConfig desc) {
     _curr_file_idx = _shard_start_idx_vector[_shard_id]; // shard's start_idx would vary for every shard in the vector
     // shuffle dataset if set
     if (ret == Reader::Status::OK && _shuffle)
-        std::random_shuffle(_file_names.begin() + _shard_start_idx_vector[_shard_id],
-                            _file_names.begin() + _shard_end_idx_vector[_shard_id]);
+        init_shuffle(desc.seed());
     return ret;
 }
 
@@ -80,18 +79,19 @@ void WebDatasetSourceReader::incremenet_read_ptr() {
 }
 
 size_t WebDatasetSourceReader::open() {
-    auto file_path = _file_names[_curr_file_idx];  // Get next file name
+    auto file_path = _file_names[shuffled_file_idx(_curr_file_idx)];  // Get next file name
     _last_id = file_path;
     auto last_slash_idx = _last_id.find_last_of("\\/");
     if (std::string::npos != last_slash_idx) {
         _last_id.erase(0, last_slash_idx + 1);
     }
-    _current_file_size = _file_size[_file_names[_curr_file_idx]];
+    _current_file_size = _file_size[file_path];
     return _current_file_size;
 }
 
 size_t WebDatasetSourceReader::read_data(unsigned char* buf, size_t read_size) {
-    auto ret = read_web_dataset_at_offset(buf, _file_names[_curr_file_idx], _file_size[_file_names[_curr_file_idx]], _file_offset[_file_names[_curr_file_idx]], _file_wds_shard_idx_mapping[_file_names[_curr_file_idx]]);
+    auto& file_path = _file_names[shuffled_file_idx(_curr_file_idx)];
+    auto ret = read_web_dataset_at_offset(buf, file_path, _file_size[file_path], _file_offset[file_path], _file_wds_shard_idx_mapping[file_path]);
     if (ret != Reader::Status::OK)
         THROW("WebDatasetSourceReader: Error in reading tar records of the web  dataset reader");
     incremenet_read_ptr();
@@ -111,10 +111,7 @@ int WebDatasetSourceReader::release() {
 }
 
 void WebDatasetSourceReader::reset() {
-    if (_shuffle)
-        std::random_shuffle(_file_names.begin() + _shard_start_idx_vector[_shard_id],
-                            _file_names.begin() + _shard_start_idx_vector[_shard_id] + actual_shard_size_without_padding());
-
+    _epoch++;
     if (_stick_to_shard == false)  // Pick elements from the next shard - hence increment shard_id
         increment_shard_id();      // Should work for both single and multiple shards
 
@@ -677,7 +677,7 @@ def ssd_random_crop(*inputs, p_threshold=None, crop_area_factor=None, crop_aspec
 
     # pybind call arguments
     kwargs_pybind = {"input_image": inputs[0], "is_output": False, "p_threshold": p_threshold, "crop_area_factor": crop_area_factor,
-                     "crop_aspect_ratio": crop_aspect_ratio, "crop_pos_x": crop_pos_x, "crop_pos_y": crop_pos_y, "num_of_attempts": _num_attempts, "output_layout": output_layout, "output_dtype": output_dtype}
+                     "crop_aspect_ratio": crop_aspect_ratio, "crop_pos_x": crop_pos_x, "crop_pos_y": crop_pos_y, "num_of_attempts": num_attempts, "output_layout": output_layout, "output_dtype": output_dtype}
     ssd_random_cropped_image = b.ssdRandomCrop(
         Pipeline._current_pipeline._handle, *(kwargs_pybind.values()))
     return (ssd_random_cropped_image)
@@ -1017,6 +1017,22 @@ def nop(*inputs, device=None):
     return (nop_output)
 
 
+def multi_view(*inputs, num_views=2, device=None):
+    """!Creates num_views views of every decoded sample, each view is augmented with its own random values.
+
+        @param inputs                                     the output of a decoder passed to the augmentation
+        @param num_views (int, optional, default = 2)     number of views created for each sample
+        @param device (string, optional, default = None)  Parameter unused for augmentation
+
+        @return    Views of every sample, the labels of the batch are repeated for every view
+    """
+    # pybind call arguments
+    kwargs_pybind = {"input_image": inputs[0], "num_views": num_views, "is_output": False}
+    views = b.multiView(Pipeline._current_pipeline._handle,
+                        *(kwargs_pybind.values()))
+    return (views)
+
+
 def copy(*inputs, device=None):
     """!Copies input tensor to output tensor.
 
@@ -1088,6 +1104,42 @@ def box_iou_matcher(*inputs, anchors, high_threshold=0.5,
     return (box_iou_matcher, [])
 
 
+def polygon_mask_rasterizer(*inputs, mask_width, mask_height, mask_type=types.INSTANCE_MASKS, max_instances=100, device=None):
+    """!Draws the polygon masks of the COCO reader into uint8 masks, after the augmentations moved the polygons.
+
+        @param inputs (list)                                                 The polygon masks of the COCO reader.
+        @param mask_width (int)                                              Width of the masks, normally the output image width.
+        @param mask_height (int)                                             Height of the masks, normally the output image height.
+        @param mask_type (int, optional, default = types.INSTANCE_MASKS)     types.INSTANCE_MASKS draws a binary mask per object, types.SEMANTIC_MASKS draws the labels of all the objects into one mask.
+        @param max_instances (int, optional, default = 100)                  The most objects of an image that get an instance mask.
+        @param device (string, optional, default = None)                     Parameter unused for augmentation
+
+        @return    The masks are returned by Pipeline.get_rasterized_masks().
+    """
+    # pybind call arguments
+    kwargs_pybind = {"mask_width": mask_width, "mask_height": mask_height,
+                     "mask_type": mask_type, "max_instances": max_instances}
+    b.polygonMaskRasterizer(Pipeline._current_pipeline._handle, *(kwargs_pybind.values()))
+    return []
+
+
+def keypoint_heatmaps(*inputs, heatmap_width, heatmap_height, sigma=0.0, device=None):
+    """!Generates HRNet style Gaussian target heatmaps and target weights from the joints of the COCO key points reader.
+
+        @param inputs (list)                                 The joints of the COCO key points reader.
+        @param heatmap_width (int)                           Width of the heatmaps, normally a quarter of the output width given to the reader.
+        @param heatmap_height (int)                          Height of the heatmaps, normally a quarter of the output height given to the reader.
+        @param sigma (float, optional, default = 0.0)        Standard deviation of the Gaussians in heatmap cells, 0 uses the sigma given to the reader.
+        @param device (string, optional, default = None)     Parameter unused for augmentation
+
+        @return    The heatmaps are returned by Pipeline.get_keypoint_heatmaps() and the target weights by Pipeline.get_keypoint_target_weights().
+    """
+    # pybind call arguments
+    kwargs_pybind = {"heatmap_width": heatmap_width, "heatmap_height": heatmap_height, "sigma": sigma}
+    b.keypointHeatmaps(Pipeline._current_pipeline._handle, *(kwargs_pybind.values()))
+    return []
+
+
 def external_source(source, device=None, color_format=types.RGB, random_shuffle=False, mode=types.EXTSOURCE_FNAME, max_width=2000, max_height=2000, last_batch_policy=types.LAST_BATCH_FILL, pad_last_batch_repeated=False, stick_to_shard=True, shard_size=-1):
     """
     External Source Reader - User can pass a iterator or callable source.
@@ -220,6 +220,32 @@ class Pipeline(object):
     def get_image_labels(self):
         return b.getImageLabels(self._handle)
 
+    def copy_image_labels(self, array, label_type=None, dest_device_type=None):
+        """!Copies the labels of the current batch to array, converted to its data type.
+
+            @param array               numpy array of int32, int64 or float32, or the address of a buffer holding label_type values
+            @param label_type          data type of the buffer when array is an address
+            @param dest_device_type    memory type of the buffer when array is an address, the output memory type of the pipeline by default
+        """
+        if label_type is None:
+            b.copyImageLabels(self._handle, array)
+        else:
+            b.copyImageLabels(self._handle, array, label_type, dest_device_type if dest_device_type is not None else self._output_memory_type)
+
+    def copy_one_hot_labels(self, array, label_smoothing=0.0, label_type=None, dest_device_type=None):
+        """!Encodes the labels of the current batch as one hot vectors of num_classes straight into array.
+
+            @param array               numpy array of int32, int64 or float32, or the address of a buffer holding label_type values
+            @param label_smoothing     share of the probability spread evenly over all the classes, needs float labels
+            @param label_type          data type of the buffer when array is an address
+            @param dest_device_type    memory type of the buffer when array is an address, the output memory type of the pipeline by default
+        """
+        if label_type is None:
+            b.copyOneHotLabels(self._handle, array, self._num_classes, label_smoothing)
+        else:
+            b.copyOneHotLabels(self._handle, array, self._num_classes, label_type, label_smoothing,
+                               dest_device_type if dest_device_type is not None else self._output_memory_type)
+
     def copy_encoded_boxes_and_lables(self, bbox_array, label_array):
         b.rocalCopyEncodedBoxesAndLables(self._handle, bbox_array, label_array)
 
@@ -244,6 +270,11 @@ class Pipeline(object):
     def rocal_reset_loaders(self):
         return b.rocalResetLoaders(self._handle)
 
+    def set_shared_data_service(self, service_name, num_pipelines):
+        """!Attaches the pipeline to a data service shared with other pipelines in the process, must be called before the readers are added
+        """
+        return b.rocalSetSharedDataService(self._handle, service_name, num_pipelines)
+
     def is_empty(self):
         return b.isEmpty(self._handle)
 
@@ -253,12 +284,114 @@ class Pipeline(object):
     def get_matched_indices(self):
         return b.getMatchedIndices(self._handle)
 
+    def get_rasterized_masks(self):
+        """!Returns the masks drawn by fn.polygon_mask_rasterizer() for the current batch, one uint8 array per image that is only valid until the next batch is run.
+        """
+        return b.getRasterizedMasks(self._handle)
+
+    def get_keypoint_heatmaps(self):
+        """!Returns the heatmaps generated by fn.keypoint_heatmaps() for the current batch, one float array of shape (joints, height, width) per image that is only valid until the next batch is run.
+        """
+        return b.getKeypointHeatmaps(self._handle)
+
+    def get_keypoint_target_weights(self):
+        """!Returns the target weights of the joints for the current batch, one float array per image holding the visibility of each joint or 0 when its Gaussian misses the heatmap.
+        """
+        return b.getKeypointTargetWeights(self._handle)
+
     def get_output_tensors(self):
         return b.getOutputTensors(self._handle)
+
+    def acquire_output(self):
+        """!Leases the output tensors of the current batch without copying them, the pipeline keeps producing batches in other buffers until the list is passed to release_output(). Only host outputs can be leased.
+        """
+        return b.acquireOutput(self._handle)
+
+    def release_output(self, output):
+        """!Returns the buffers of a tensor list from acquire_output() to the pipeline, its tensors must not be used afterwards.
+        """
+        b.releaseOutput(self._handle, output)
     
     def get_last_batch_padded_size(self):
         return b.getLastBatchPaddedSize(self._handle)
 
+    def get_peak_memory_size(self):
+        """!Returns the bytes held for the intermediate tensors, the output ring buffer and the loader buffers once the pipeline is built.
+        """
+        return b.getPeakMemorySize(self._handle)
+
+    def set_quarantine_file(self, file_path):
+        """!Persists the samples that fail decoding to file_path, samples listed in it are skipped. Call before defining the readers.
+        """
+        b.rocalSetQuarantineFile(self._handle, file_path)
+
+    def set_continuous_epochs(self, enable=True):
+        """!Makes the loaders rewind and reshuffle on their own at the end of each epoch and keep prefetching, reset() is not needed between epochs. Call before defining the readers.
+        get_remaining_images() then counts the images left in the epoch of the current batch and starts over after its last batch.
+        """
+        b.rocalSetContinuousEpochs(self._handle, enable)
+
+    def set_file_scan_options(self, manifest_dir="", trust_file_list=False):
+        """!Caches the file listings in manifest_dir, reused while the folders are unmodified, and takes the files of a file list as given when trust_file_list is True. Call before defining the readers.
+        """
+        b.rocalSetFileScanOptions(self._handle, manifest_dir, trust_file_list)
+
+    def set_host_memory_options(self, huge_pages=types.HUGE_PAGES_NONE, prefault=False, numa_node=-1):
+        """!Maps the host memory of the output ring buffer and the loader buffers with huge_pages, touching the pages up front when prefault is True and binding them to numa_node unless it is -1. Call before defining the readers.
+        The host buffers are allocated from the heap when it is not called.
+        """
+        b.rocalSetHostMemoryOptions(self._handle, huge_pages, prefault, numa_node)
+
+    def get_host_memory_stats(self):
+        """!Returns the mapped, huge page, pinned and in use bytes and the allocation counts of the pipeline host buffers, all zero unless set_host_memory_options() was called.
+        """
+        return b.getHostMemoryStats(self._handle)
+
+    def get_frame_cache_stats(self):
+        """!Returns the frames the sequence reader reused decoded for overlapping sequences as hits, and the frames it read and decoded as misses.
+        """
+        return b.getFrameCacheStats(self._handle)
+
+    def set_record_check_policy(self, policy=types.RECORD_CHECK_SKIP):
+        """!Makes the TFRecord and MXNet RecordIO readers verify every record they read, the corrupted records are skipped, substituted with the previous sample of the batch or fail the read as per policy. Call before defining the readers.
+        """
+        b.rocalSetRecordCheckPolicy(self._handle, policy)
+
+    def set_graph_optimization(self, enable=True):
+        """!Enables or disables the dropping, fusing and removal of nodes done when the pipeline is built, the outputs are the same either way. Call before build().
+        """
+        b.rocalSetGraphOptimization(self._handle, enable)
+
+    def get_record_check_stats(self):
+        """!Returns the shard id and the counts of checked and corrupted records of every shard read with the record check.
+        """
+        return b.getRecordCheckStats(self._handle)
+
+    def get_batch_epoch(self):
+        """!Returns the epoch the current batch was read in, counted from 0.
+        """
+        return b.getBatchEpoch(self._handle)
+
+    def is_last_batch_of_epoch(self):
+        """!Returns True if the current batch is the last one of its epoch when continuous epochs are enabled.
+        """
+        return b.isLastBatchOfEpoch(self._handle)
+
+    def get_state(self):
+        """!Returns the reader positions and random parameter state following the current batch as bytes, to be saved with a training checkpoint.
+        """
+        return b.getState(self._handle)
+
+    def set_state(self, state):
+        """!Resumes the pipeline at the batch following the one the state was saved at. Call after build() on a pipeline defined the same way and with the same seed.
+        """
+        b.setState(self._handle, state)
+
+    def get_quarantined_samples(self):
+        """!Returns the file paths or record ids of the samples that failed decoding and are skipped by the loaders.
+        """
+        return b.getQuarantinedSamples(self._handle)
+
     def run(self):
         """
         It raises StopIteration if data set reached its end.
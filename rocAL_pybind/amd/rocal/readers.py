@@ -64,6 +64,30 @@ def coco(annotations_file='', ltrb=True, masks=False, ratio=False, avoid_class_r
     return (meta_data, labels, bboxes)
 
 
+def coco_keypoints(annotations_file='', sigma=0.0, output_width=0, output_height=0):
+    """!Creates a COCOReader node reading the person key points.
+
+        @param annotations_file    Path to the COCO person key points annotations file.
+        @param sigma               Standard deviation of the Gaussians of the key point heatmaps.
+        @param output_width        Width of the output images the joints are given in.
+        @param output_height       Height of the output images the joints are given in.
+
+        @return    meta data, and the joints as the key point heatmaps input.
+    """
+    Pipeline._current_pipeline._reader = "COCOReader"
+    # Output
+    joints = []
+    kwargs_pybind = {
+        "source_path": annotations_file,
+        "is_output": True,
+        "sigma": sigma,
+        "pose_output_width": output_width,
+        "pose_output_height": output_height}
+    meta_data = b.cocoReaderKeyPoints(
+        Pipeline._current_pipeline._handle, *(kwargs_pybind.values()))
+    return (meta_data, joints)
+
+
 def file(file_root, file_filters=None, file_list='', stick_to_shard=False, pad_last_batch=False):
     """!Creates a labelReader node for reading files from folder or file_list.
 
@@ -385,21 +409,39 @@ def webdataset(path, index_paths="", ext = None, missing_components_behavior = t
 
 def numpy(*inputs, file_root='', files=[], num_shards=1, output_layout=types.NONE, 
           random_shuffle=False, shard_id=0, stick_to_shard=True, shard_size=-1,
-          last_batch_policy=types.LAST_BATCH_FILL, pad_last_batch=True, seed=0):
+          last_batch_policy=types.LAST_BATCH_FILL, pad_last_batch=True, seed=0, roi_start=[], roi_shape=[]):
+    """!Creates a NumpyReader node for reading numpy arrays, or a region of them when roi_start/roi_shape are given.
+
+        @param file_root            Root directory containing the npy files.
+        @param files                List of npy files to read instead of the files in file_root.
+        @param num_shards           Number of shards for data parallelism.
+        @param output_layout        Layout of the output tensor.
+        @param random_shuffle       Whether to shuffle the arrays randomly.
+        @param shard_id             Shard ID for the current reader.
+        @param stick_to_shard       Determines whether the reader should stick to a data shard instead of going through the entire dataset.
+        @param shard_size           Number of samples in a shard, -1 to use the size of the dataset split between the shards.
+        @param last_batch_policy    Determines how the last batch of the shard is filled.
+        @param pad_last_batch       If set to True, pads the shard by repeating the last sample.
+        @param seed                 Seed used to shuffle the arrays.
+        @param roi_start            Start of the region to read in every array, per dimension. Missing dimensions start at 0.
+        @param roi_shape            Shape of the region to read in every array, per dimension. Missing dimensions and -1 read up to the end of the dimension.
 
+        @return    Loaded numpy arrays.
+    """
     Pipeline._current_pipeline._reader = "NumpyReader"
     Pipeline._current_pipeline._last_batch_policy = last_batch_policy
     sharding_info = b.RocalShardingInfo(last_batch_policy, pad_last_batch, stick_to_shard, shard_size)
     # Output
     kwargs_pybind = {"source_path": file_root, "output_layout": output_layout, "files": files, "is_output": False, "shuffle": random_shuffle,
-                     "loop": False, "shard_id": shard_id, "shard_count": num_shards, "seed": seed, "sharding_info": sharding_info}
+                     "loop": False, "shard_id": shard_id, "shard_count": num_shards, "seed": seed, "sharding_info": sharding_info,
+                     "roi_start": roi_start, "roi_shape": roi_shape}
     numpy_reader_output = b.numpyReader(
         Pipeline._current_pipeline._handle, *(kwargs_pybind.values()))
     return (numpy_reader_output)
 
 def cifar10(*inputs, file_root='', num_shards=1, image_type=types.RGB_PLANAR, filename_prefix='data_batch_',
           random_shuffle=False, shard_id=0, stick_to_shard=True, shard_size=-1,
-          last_batch_policy=types.LAST_BATCH_FILL, pad_last_batch=True):
+          last_batch_policy=types.LAST_BATCH_FILL, pad_last_batch=True, memory_resident=False):
     """!Creates an CIFAR10Reader node for reading data from CIFAR10 binary files.
 
         @param file_root            Root directory containing CIFAR10 binary files.
@@ -410,6 +452,7 @@ def cifar10(*inputs, file_root='', num_shards=1, image_type=types.RGB_PLANAR, fi
         @param shard_id             Shard ID for the current reader.
         @param stick_to_shard       Determines whether the reader should stick to a data shard instead of going through the entire dataset.
         @param pad_last_batch       If set to True, pads the shard by repeating the last sample.
+        @param memory_resident      If set to True, maps the binary files into memory once and copies the images from there instead of reading the files.
 
         @return    Loaded data from the CIFAR10 binary files.
     """
@@ -423,7 +466,7 @@ def cifar10(*inputs, file_root='', num_shards=1, image_type=types.RGB_PLANAR, fi
     sharding_info = b.RocalShardingInfo(last_batch_policy, pad_last_batch, stick_to_shard, shard_size)
     # Output
     kwargs_pybind = {"source_path": file_root, "color_format": image_type, "shard_id": shard_id, "shard_count": num_shards, "is_output": False, "shuffle": random_shuffle,
-                     "loop": False, "output_width": 32, "output_height": 32, "filename_prefix": filename_prefix, "sharding_info": sharding_info}
+                     "loop": False, "output_width": 32, "output_height": 32, "filename_prefix": filename_prefix, "sharding_info": sharding_info, "memory_resident": memory_resident}
     cifar10_reader_output = b.cifar10Reader(
         Pipeline._current_pipeline._handle, *(kwargs_pybind.values()))
     return (cifar10_reader_output)
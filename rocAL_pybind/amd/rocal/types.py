@@ -126,6 +126,26 @@ from rocal_pybind.types import MISSING_COMPONENT_ERROR
 from rocal_pybind.types import MISSING_COMPONENT_SKIP
 from rocal_pybind.types import MISSING_COMPONENT_EMPTY
 
+#     RocalHugePageMode
+from rocal_pybind.types import HUGE_PAGES_NONE
+from rocal_pybind.types import HUGE_PAGES_TRANSPARENT
+from rocal_pybind.types import HUGE_PAGES_EXPLICIT
+
+#     RocalRecordCheckPolicy
+from rocal_pybind.types import RECORD_CHECK_OFF
+from rocal_pybind.types import RECORD_CHECK_SKIP
+from rocal_pybind.types import RECORD_CHECK_SUBSTITUTE
+from rocal_pybind.types import RECORD_CHECK_FAIL
+
+#     RocalLabelType
+from rocal_pybind.types import LABEL_INT32
+from rocal_pybind.types import LABEL_INT64
+from rocal_pybind.types import LABEL_FP32
+
+#     RocalMaskType
+from rocal_pybind.types import INSTANCE_MASKS
+from rocal_pybind.types import SEMANTIC_MASKS
+
 _known_types = {
 
     OK: ("OK", OK),
@@ -211,6 +231,22 @@ _known_types = {
     MISSING_COMPONENT_ERROR : ("MISSING_COMPONENT_ERROR", MISSING_COMPONENT_ERROR),
     MISSING_COMPONENT_SKIP : ("MISSING_COMPONENT_SKIP", MISSING_COMPONENT_SKIP),
     MISSING_COMPONENT_EMPTY : ("MISSING_COMPONENT_EMPTY", MISSING_COMPONENT_EMPTY),
+
+    HUGE_PAGES_NONE : ("HUGE_PAGES_NONE", HUGE_PAGES_NONE),
+    HUGE_PAGES_TRANSPARENT : ("HUGE_PAGES_TRANSPARENT", HUGE_PAGES_TRANSPARENT),
+    HUGE_PAGES_EXPLICIT : ("HUGE_PAGES_EXPLICIT", HUGE_PAGES_EXPLICIT),
+
+    RECORD_CHECK_OFF : ("RECORD_CHECK_OFF", RECORD_CHECK_OFF),
+    RECORD_CHECK_SKIP : ("RECORD_CHECK_SKIP", RECORD_CHECK_SKIP),
+    RECORD_CHECK_SUBSTITUTE : ("RECORD_CHECK_SUBSTITUTE", RECORD_CHECK_SUBSTITUTE),
+    RECORD_CHECK_FAIL : ("RECORD_CHECK_FAIL", RECORD_CHECK_FAIL),
+
+    LABEL_INT32 : ("LABEL_INT32", LABEL_INT32),
+    LABEL_INT64 : ("LABEL_INT64", LABEL_INT64),
+    LABEL_FP32 : ("LABEL_FP32", LABEL_FP32),
+
+    INSTANCE_MASKS : ("INSTANCE_MASKS", INSTANCE_MASKS),
+    SEMANTIC_MASKS : ("SEMANTIC_MASKS", SEMANTIC_MASKS),
 }
 
 def data_type_function(dtype):
@@ -141,6 +141,18 @@ py::object wrapperRocalExternalSourceFeedInput(
         return py::cast<py::none>(Py_None);
     }
 
+    RocalLabelType label_type_of(const py::array &array) {
+        if (!(array.flags() & py::array::c_style))
+            throw std::runtime_error("Labels can only be copied to contiguous arrays");
+        if (array.dtype().is(py::dtype::of<int32_t>()))
+            return ROCAL_LABEL_INT32;
+        if (array.dtype().is(py::dtype::of<int64_t>()))
+            return ROCAL_LABEL_INT64;
+        if (array.dtype().is(py::dtype::of<float>()))
+            return ROCAL_LABEL_FP32;
+        throw std::runtime_error("Labels can only be copied to int32, int64 or float32 arrays");
+    }
+
 std::unordered_map<int, std::string> rocalToPybindLayout = {
     {0, "NHWC"},
     {1, "NCHW"},
@@ -294,12 +306,45 @@ PYBIND11_MODULE(rocal_pybind, m) {
     m.def("rocalVerify", &rocalVerify);
     m.def("rocalRun", &rocalRun, py::return_value_policy::reference);
     m.def("rocalRelease", &rocalRelease, py::return_value_policy::reference);
+    m.def("rocalSetSharedDataService", &rocalSetSharedDataService, "Attaches the pipeline to a data service shared with other pipelines in the process");
+    m.def("rocalSetQuarantineFile", &rocalSetQuarantineFile, "Persists the samples quarantined by the loaders to a file, listed samples are skipped");
+    m.def("rocalSetContinuousEpochs", &rocalSetContinuousEpochs, "Makes the loaders run the epochs back to back without a reset");
+    m.def("rocalSetFileScanOptions", &rocalSetFileScanOptions, "Sets the manifest cache folder and whether file lists are trusted when listing the dataset files");
+    m.def("rocalSetHostMemoryOptions", &rocalSetHostMemoryOptions, "Sets the huge page use, pre-faulting and NUMA node of the pipeline host buffers");
+    m.def("rocalSetGraphOptimization", &rocalSetGraphOptimization, "Enables or disables the rewrites of the augmentation graph when the pipeline is built");
+    m.def("rocalSetRecordCheckPolicy", &rocalSetRecordCheckPolicy, "Makes the record file readers verify the records read and sets what is done with the corrupted ones");
+    m.def("getState", [](RocalContext context) {
+        std::string state(rocalGetStateSize(context), '\0');
+        if (state.empty() || rocalGetState(context, state.data()) != ROCAL_OK)
+            throw std::runtime_error(rocalGetErrorMessage(context));
+        return py::bytes(state);
+    }, "Returns the serialized state to resume the pipeline after the current batch");
+    m.def("setState", [](RocalContext context, py::bytes state) {
+        std::string data = state;
+        if (rocalSetState(context, data.data(), data.size()) != ROCAL_OK)
+            throw std::runtime_error(rocalGetErrorMessage(context));
+    }, "Resumes the pipeline from a state returned by getState");
     // rocal_api_types.h
     py::class_<TimingInfo>(m, "TimingInfo")
         .def_readwrite("load_time", &TimingInfo::load_time)
         .def_readwrite("decode_time", &TimingInfo::decode_time)
         .def_readwrite("process_time", &TimingInfo::process_time)
         .def_readwrite("transfer_time", &TimingInfo::transfer_time);
+    py::class_<RocalHostMemoryStats>(m, "RocalHostMemoryStats")
+        .def_readonly("mapped_bytes", &RocalHostMemoryStats::mapped_bytes)
+        .def_readonly("huge_page_bytes", &RocalHostMemoryStats::huge_page_bytes)
+        .def_readonly("pinned_bytes", &RocalHostMemoryStats::pinned_bytes)
+        .def_readonly("in_use_bytes", &RocalHostMemoryStats::in_use_bytes)
+        .def_readonly("peak_in_use_bytes", &RocalHostMemoryStats::peak_in_use_bytes)
+        .def_readonly("allocation_count", &RocalHostMemoryStats::allocation_count)
+        .def_readonly("reuse_count", &RocalHostMemoryStats::reuse_count);
+    py::class_<RocalFrameCacheStats>(m, "RocalFrameCacheStats")
+        .def_readonly("hits", &RocalFrameCacheStats::hits)
+        .def_readonly("misses", &RocalFrameCacheStats::misses);
+    py::class_<RocalRecordCheckStats>(m, "RocalRecordCheckStats")
+        .def_readonly("shard_id", &RocalRecordCheckStats::shard_id)
+        .def_readonly("checked_records", &RocalRecordCheckStats::checked_records)
+        .def_readonly("corrupted_records", &RocalRecordCheckStats::corrupted_records);
     py::class_<rocalTensor>(m, "rocalTensor")
 #if ENABLE_DLPACK
             .def(
@@ -562,6 +607,26 @@ PYBIND11_MODULE(rocal_pybind, m) {
             R"code(
                 Copies the ring buffer data to python buffer pointers given a ROI with dimensions in x and y direction.
                 )code")
+        .def(
+            "packed_data_size", [](rocalTensor &output_tensor) {
+                return output_tensor.packed_data_size();
+            },
+            R"code(
+                Returns the number of bytes needed by copy_data_packed.
+                )code")
+        .def(
+            "copy_data_packed", [](rocalTensor &output_tensor, py::array array) {
+                auto buf = array.request();
+                if (static_cast<size_t>(buf.size * buf.itemsize) < output_tensor.packed_data_size())
+                    throw std::runtime_error("The array is smaller than the packed data size of the tensor");
+                std::vector<size_t> sample_offsets;
+                output_tensor.copy_data_packed(static_cast<void *>(buf.ptr), sample_offsets);
+                return sample_offsets;
+            },
+            R"code(
+                Copies only the valid region of every sample back to back to the numpy array, the padding is skipped.
+                Returns the byte offset of every sample in the array followed by the total number of bytes copied.
+                )code")
         .def(
             "at", [](rocalTensor &output_tensor, uint idx) {
                 std::vector<size_t> stride_per_sample(output_tensor.strides());
@@ -758,6 +823,26 @@ py::class_<rocalListOfTensorList>(m, "rocalListOfTensorList")
         .value("MISSING_COMPONENT_SKIP", ROCAL_MISSING_COMPONENT_SKIP)
         .value("MISSING_COMPONENT_EMPTY", ROCAL_MISSING_COMPONENT_EMPTY)
         .export_values();
+    py::enum_<RocalHugePageMode>(types_m, "RocalHugePageMode", "Rocal Huge Page Mode")
+        .value("HUGE_PAGES_NONE", ROCAL_HUGE_PAGES_NONE)
+        .value("HUGE_PAGES_TRANSPARENT", ROCAL_HUGE_PAGES_TRANSPARENT)
+        .value("HUGE_PAGES_EXPLICIT", ROCAL_HUGE_PAGES_EXPLICIT)
+        .export_values();
+    py::enum_<RocalRecordCheckPolicy>(types_m, "RocalRecordCheckPolicy", "Rocal Record Check Policy")
+        .value("RECORD_CHECK_OFF", ROCAL_RECORD_CHECK_OFF)
+        .value("RECORD_CHECK_SKIP", ROCAL_RECORD_CHECK_SKIP)
+        .value("RECORD_CHECK_SUBSTITUTE", ROCAL_RECORD_CHECK_SUBSTITUTE)
+        .value("RECORD_CHECK_FAIL", ROCAL_RECORD_CHECK_FAIL)
+        .export_values();
+    py::enum_<RocalLabelType>(types_m, "RocalLabelType", "Rocal Label Type")
+        .value("LABEL_INT32", ROCAL_LABEL_INT32)
+        .value("LABEL_INT64", ROCAL_LABEL_INT64)
+        .value("LABEL_FP32", ROCAL_LABEL_FP32)
+        .export_values();
+    py::enum_<RocalMaskType>(types_m, "RocalMaskType", "Rocal Mask Type")
+        .value("INSTANCE_MASKS", ROCAL_INSTANCE_MASKS)
+        .value("SEMANTIC_MASKS", ROCAL_SEMANTIC_MASKS)
+        .export_values();
     py::class_<ROIxywh>(m, "ROIxywh")
         .def(py::init<>())
         .def_readwrite("x", &ROIxywh::x)
@@ -813,11 +898,44 @@ py::class_<rocalListOfTensorList>(m, "rocalListOfTensorList")
     m.def("getTimingInfo", &rocalGetTimingInfo);
     m.def("labelReader", &rocalCreateLabelReader, py::return_value_policy::reference);
     m.def("cocoReader", &rocalCreateCOCOReader, py::return_value_policy::reference);
+    m.def("cocoReaderKeyPoints", &rocalCreateCOCOReaderKeyPoints, py::return_value_policy::reference);
     m.def("getLastBatchPaddedSize", &rocalGetLastBatchPaddedSize, py::return_value_policy::reference);
+    m.def("getPeakMemorySize", &rocalGetPeakMemorySize);
+    m.def("getHostMemoryStats", &rocalGetHostMemoryStats);
+    m.def("getFrameCacheStats", &rocalGetFrameCacheStats);
+    m.def("getBatchEpoch", &rocalGetBatchEpoch);
+    m.def("isLastBatchOfEpoch", &rocalIsLastBatchOfEpoch);
+    m.def("getQuarantinedSamples", [](RocalContext context) {
+        size_t count = rocalGetQuarantinedSampleCount(context);
+        std::vector<int> name_lengths(count);
+        size_t total_length = rocalGetQuarantinedSampleNamesLen(context, name_lengths.data(), count);
+        std::string names(total_length, '\0');
+        rocalGetQuarantinedSampleNames(context, names.data(), count);
+        py::list samples;
+        size_t offset = 0;
+        for (auto length : name_lengths) {
+            samples.append(py::str(names.substr(offset, length)));
+            offset += length;
+        }
+        return samples;
+    });
+    m.def("getRecordCheckStats", [](RocalContext context) {
+        std::vector<RocalRecordCheckStats> stats(rocalGetRecordCheckShardCount(context));
+        rocalGetRecordCheckStats(context, stats.data(), stats.size());
+        return stats;
+    });
     // rocal_api_meta_data.h
     m.def("randomBBoxCrop", &rocalRandomBBoxCrop);
     m.def("boxEncoder", &rocalBoxEncoder);
     m.def("boxIouMatcher", &rocalBoxIouMatcher);
+    m.def("polygonMaskRasterizer", [](RocalContext context, unsigned mask_width, unsigned mask_height, RocalMaskType mask_type, unsigned max_instances) {
+        if (rocalPolygonMaskRasterizer(context, mask_width, mask_height, mask_type, max_instances) != ROCAL_OK)
+            throw std::runtime_error(rocalGetErrorMessage(context));
+    });
+    m.def("keypointHeatmaps", [](RocalContext context, unsigned heatmap_width, unsigned heatmap_height, float sigma) {
+        if (rocalKeypointHeatmaps(context, heatmap_width, heatmap_height, sigma) != ROCAL_OK)
+            throw std::runtime_error(rocalGetErrorMessage(context));
+    });
     m.def("cifar10LabelReader", &rocalCreateTextCifar10LabelReader, py::return_value_policy::reference);
     m.def("getImgSizes", [](RocalContext context, py::array_t<int> array) {
         auto buf = array.request();
@@ -858,6 +976,16 @@ py::class_<rocalListOfTensorList>(m, "rocalListOfTensorList")
             list.append(output_tensor_list->at(i));
         return list;
     });
+    m.def("acquireOutput", [](RocalContext context) {
+        rocalTensorList *output_tensor_list = rocalAcquireOutput(context);
+        if (!output_tensor_list)
+            throw std::runtime_error(rocalGetErrorMessage(context));
+        return output_tensor_list;
+    }, py::return_value_policy::reference);
+    m.def("releaseOutput", [](RocalContext context, rocalTensorList *output_tensor_list) {
+        if (rocalReleaseOutput(context, output_tensor_list) != ROCAL_OK)
+            throw std::runtime_error(rocalGetErrorMessage(context));
+    });
     m.def("getBoundingBoxCount", &rocalGetBoundingBoxCount);
     m.def("getImageLabels", [](RocalContext context) {
         rocalTensorList *labels = rocalGetImageLabels(context);
@@ -978,6 +1106,64 @@ py::class_<rocalListOfTensorList>(m, "rocalListOfTensorList")
                 {sizeof(int)}));
         },
         py::return_value_policy::reference);
+    m.def(
+        "getRasterizedMasks", [](RocalContext context) {
+            rocalTensorList *masks = rocalGetRasterizedMasks(context);
+            py::list masks_list;
+            for (unsigned i = 0; i < masks->size(); i++) {  // Views of the ring buffer, valid until the next batch is run
+                auto dims = masks->at(i)->dims();
+                std::vector<ssize_t> shape(dims.begin(), dims.end());
+                std::vector<ssize_t> strides(dims.size(), sizeof(uint8_t));
+                for (int d = static_cast<int>(dims.size()) - 2; d >= 0; d--)
+                    strides[d] = strides[d + 1] * dims[d + 1];
+                masks_list.append(py::array(py::buffer_info(
+                    static_cast<uint8_t *>(masks->at(i)->buffer()),
+                    sizeof(uint8_t),
+                    py::format_descriptor<uint8_t>::format(),
+                    dims.size(),
+                    shape,
+                    strides)));
+            }
+            return masks_list;
+        },
+        py::return_value_policy::reference);
+    m.def(
+        "getKeypointHeatmaps", [](RocalContext context) {
+            rocalTensorList *heatmaps = rocalGetKeypointHeatmaps(context);
+            if (rocalGetStatus(context) != ROCAL_OK)
+                throw std::runtime_error(rocalGetErrorMessage(context));
+            py::list heatmaps_list;
+            for (unsigned i = 0; i < heatmaps->size(); i++) {  // Views of the ring buffer, valid until the next batch is run
+                auto dims = heatmaps->at(i)->dims();
+                heatmaps_list.append(py::array(py::buffer_info(
+                    static_cast<float *>(heatmaps->at(i)->buffer()),
+                    sizeof(float),
+                    py::format_descriptor<float>::format(),
+                    3,
+                    {dims[0], dims[1], dims[2]},
+                    {sizeof(float) * dims[1] * dims[2], sizeof(float) * dims[2], sizeof(float)})));
+            }
+            return heatmaps_list;
+        },
+        py::return_value_policy::reference);
+    m.def(
+        "getKeypointTargetWeights", [](RocalContext context) {
+            rocalTensorList *weights = rocalGetKeypointTargetWeights(context);
+            if (rocalGetStatus(context) != ROCAL_OK)
+                throw std::runtime_error(rocalGetErrorMessage(context));
+            py::list weights_list;
+            for (unsigned i = 0; i < weights->size(); i++) {
+                weights_list.append(py::array(py::buffer_info(
+                    static_cast<float *>(weights->at(i)->buffer()),
+                    sizeof(float),
+                    py::format_descriptor<float>::format(),
+                    1,
+                    {weights->at(i)->dims().at(0)},
+                    {sizeof(float)})));
+            }
+            return weights_list;
+        },
+        py::return_value_policy::reference);
     m.def("rocalGetEncodedBoxesAndLables", [](RocalContext context, uint batch_size, uint num_anchors) {
         auto vec_pair_labels_boxes = rocalGetEncodedBoxesAndLables(context, batch_size * num_anchors);
         auto labels_buf_ptr = static_cast<int *>(vec_pair_labels_boxes->at(0)->at(0)->buffer());
@@ -1001,6 +1187,22 @@ py::class_<rocalListOfTensorList>(m, "rocalListOfTensorList")
         return std::make_pair(labels_array, bboxes_array);
     });
     m.def("getOneHotEncodedLabels", &wrapper_one_hot_label_copy, py::return_value_policy::reference);
+    m.def("copyImageLabels", [](RocalContext context, py::array array) {
+        if (rocalCopyImageLabels(context, array.mutable_data(), label_type_of(array), ROCAL_MEMCPY_HOST) != ROCAL_OK)
+            throw std::runtime_error(rocalGetErrorMessage(context));
+    });
+    m.def("copyImageLabels", [](RocalContext context, size_t array_ptr, RocalLabelType label_type, RocalOutputMemType dest_mem_type) {
+        if (rocalCopyImageLabels(context, reinterpret_cast<void *>(array_ptr), label_type, dest_mem_type) != ROCAL_OK)
+            throw std::runtime_error(rocalGetErrorMessage(context));
+    });
+    m.def("copyOneHotLabels", [](RocalContext context, py::array array, unsigned num_of_classes, float label_smoothing) {
+        if (rocalCopyOneHotImageLabels(context, array.mutable_data(), num_of_classes, label_type_of(array), label_smoothing, ROCAL_MEMCPY_HOST) != ROCAL_OK)
+            throw std::runtime_error(rocalGetErrorMessage(context));
+    });
+    m.def("copyOneHotLabels", [](RocalContext context, size_t array_ptr, unsigned num_of_classes, RocalLabelType label_type, float label_smoothing, RocalOutputMemType dest_mem_type) {
+        if (rocalCopyOneHotImageLabels(context, reinterpret_cast<void *>(array_ptr), num_of_classes, label_type, label_smoothing, dest_mem_type) != ROCAL_OK)
+            throw std::runtime_error(rocalGetErrorMessage(context));
+    });
     // rocal_api_data_loaders.h
     m.def("cocoImageDecoderSlice", &rocalJpegCOCOFileSourcePartial, "Reads file from the source given and decodes it according to the policy",
           py::return_value_policy::reference);
@@ -1077,6 +1279,8 @@ py::class_<rocalListOfTensorList>(m, "rocalListOfTensorList")
           py::return_value_policy::reference);
     m.def("nop", &rocalNop,
           py::return_value_policy::reference);
+    m.def("multiView", &rocalMultiView,
+          py::return_value_policy::reference);
     m.def("colorTwist", &rocalColorTwist,
           py::return_value_policy::reference);
     m.def("colorTwistFixed", &rocalColorTwistFixed,
@@ -24,6 +24,7 @@ THE SOFTWARE.
 
 #include <unistd.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cstdio>
 #include <cstdlib>
@@ -55,6 +56,7 @@ using namespace cv;
 
 #define DISPLAY 0
 #define RANDOMBBOXCROP
+#define NUMBER_OF_JOINTS 17  // Joints of a COCO person
 
 using namespace std::chrono;
 
@@ -368,6 +370,12 @@ int test(int test_case, int reader_type, const char *path, const char *outName,
             std::string json_path = rocal_data_path + "/rocal_data/coco/coco_10_img_keypoints/annotations/person_keypoints_val2017.json";
             float sigma = 3.0;
             rocalCreateCOCOReaderKeyPoints(handle, json_path.c_str(), true, sigma, (unsigned)width, (unsigned)height);
+            // HRNet heatmaps are a quarter of the input size
+            if (rocalKeypointHeatmaps(handle, (unsigned)width / 4, (unsigned)height / 4) != ROCAL_OK) {
+                std::cout << "Could not enable the key point heatmaps: " << rocalGetErrorMessage(handle) << std::endl;
+                rocalRelease(handle);
+                return -1;
+            }
             if (decode_max_height <= 0 || decode_max_width <= 0)
                 decoded_output = rocalJpegCOCOFileSource(handle, path, json_path.c_str(), color_format, num_threads, false, true, false);
             else
@@ -996,10 +1004,47 @@ int test(int test_case, int reader_type, const char *path, const char *outName,
                     std::cout << "Score: " << joints_data->score_batch[i] << std::endl;
                     std::cout << "Rotation: " << joints_data->rotation_batch[i] << std::endl;
 
-                    for (int k = 0; k < 17; k++) {
+                    for (int k = 0; k < NUMBER_OF_JOINTS; k++) {
                         std::cout << "x : " << joints_data->joints_batch[i][k][0] << " , y : " << joints_data->joints_batch[i][k][1] << " , v : " << joints_data->joints_visibility_batch[i][k][0] << std::endl;
                     }
                 }
+
+                // Each visible joint has a Gaussian peaking at 1 on the heatmap cell of its rounded location, its target weight is its visibility
+                RocalTensorList heatmaps = rocalGetKeypointHeatmaps(handle);
+                RocalTensorList target_weights = rocalGetKeypointTargetWeights(handle);
+                if (rocalGetStatus(handle) != ROCAL_OK) {
+                    std::cout << "Could not get the key point heatmaps: " << rocalGetErrorMessage(handle) << std::endl;
+                    rocalRelease(handle);
+                    return -1;
+                }
+                for (int i = 0; i < size; i++) {
+                    auto heatmap_dims = heatmaps->at(i)->dims();
+                    int heatmap_height = heatmap_dims[1], heatmap_width = heatmap_dims[2];
+                    size_t plane_size = heatmap_height * heatmap_width;
+                    float stride_x = static_cast<float>(width) / heatmap_width, stride_y = static_cast<float>(height) / heatmap_height;
+                    float *heatmap = static_cast<float *>(heatmaps->at(i)->buffer());
+                    float *target_weight = static_cast<float *>(target_weights->at(i)->buffer());
+                    for (int k = 0; k < NUMBER_OF_JOINTS; k++) {
+                        float visibility = joints_data->joints_visibility_batch[i][k][0];
+                        int mu_x = static_cast<int>(joints_data->joints_batch[i][k][0] / stride_x + 0.5f);
+                        int mu_y = static_cast<int>(joints_data->joints_batch[i][k][1] / stride_y + 0.5f);
+                        // A joint whose cell is off the heatmap has no peak to check
+                        if (mu_x < 0 || mu_y < 0 || mu_x >= heatmap_width || mu_y >= heatmap_height)
+                            continue;
+                        float *plane = heatmap + k * plane_size;
+                        float peak = *std::max_element(plane, plane + plane_size);
+                        if (target_weight[k] != visibility) {
+                            std::cout << "Sample " << i << " joint " << k << " has target weight " << target_weight[k] << " instead of its visibility " << visibility << std::endl;
+                            rocalRelease(handle);
+                            return -1;
+                        }
+                        if (visibility > 0.5f ? (peak != 1.0f || plane[mu_y * heatmap_width + mu_x] != 1.0f) : peak != 0.0f) {
+                            std::cout << "Sample " << i << " joint " << k << " of visibility " << visibility << " does not peak at (" << mu_x << ", " << mu_y << ")" << std::endl;
+                            rocalRelease(handle);
+                            return -1;
+                        }
+                    }
+                }
             } break;
             case 4: {   // webdataset pipeline
                 int img_size = rocalGetImageNameLen(handle, image_name_length);
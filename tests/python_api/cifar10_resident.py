@@ -0,0 +1,111 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import os
+import tempfile
+import time
+import numpy as np
+from parse_config import parse_args
+
+BATCH_SIZE = 8
+CHECK_RECORDS = 64  # Records in the file read for the layout checks
+THROUGHPUT_RECORDS = 10000  # Records in the file read for the throughput, the size of a CIFAR10 batch file
+PLANE = 32 * 32
+
+
+def planes(idx):
+    # The red, green and blue planes of a record, every pixel differs in each channel so a misplaced byte is caught
+    pixel = np.arange(PLANE, dtype=np.int64)
+    red = (idx + pixel) % 256
+    green = (3 * idx + 7 * pixel) % 256
+    blue = (255 - idx - 5 * pixel) % 256
+    return np.stack([red, green, blue]).astype(np.uint8)
+
+
+def write_batch_file(root, records):
+    # A CIFAR10 binary batch file, each record is a label byte followed by the red, green and blue planes
+    with open(os.path.join(root, "data_batch_1.bin"), "wb") as batch_file:
+        for idx in range(records):
+            batch_file.write(bytes([idx % 10]) + planes(idx).tobytes())
+
+
+def expected(idx, image_type):
+    record = planes(idx).reshape(3, 32, 32)
+    if image_type == types.RGB_PLANAR:
+        return record
+    if image_type == types.BGR:
+        record = record[::-1]
+    return record.transpose(1, 2, 0)
+
+
+def run_pipeline(args, root, image_type, memory_resident, check):
+    # Returns the epoch time, the samples are compared with the records they were read from if check is set
+    pipeline = Pipeline(batch_size=BATCH_SIZE, num_threads=args.num_threads, device_id=args.local_rank, seed=args.seed, rocal_cpu=True)
+    with pipeline:
+        images = fn.readers.cifar10(file_root=root, image_type=image_type, memory_resident=memory_resident)
+        pipeline.set_outputs(images)
+    pipeline.build()
+    sample_idx = 0
+    start = time.perf_counter()
+    while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+        tensor = pipeline.get_output_tensors()[0]
+        if check:
+            output = np.empty(tensor.dimensions(), dtype=tensor.dtype())
+            tensor.copy_data(output)
+            for sample in output:
+                if not np.array_equal(sample, expected(sample_idx, image_type)):
+                    raise RuntimeError("Sample %d of the %s output does not match its record with memory_resident=%s" %
+                                       (sample_idx, image_type, memory_resident))
+                sample_idx += 1
+    elapsed = time.perf_counter() - start
+    pipeline.rocal_release()
+    if check and sample_idx != CHECK_RECORDS:
+        raise RuntimeError("Read %d samples out of %d records" % (sample_idx, CHECK_RECORDS))
+    return elapsed
+
+
+def main():
+    args = parse_args()
+    if args.rocal_gpu:
+        print("The records are copied on the host, running on the cpu backend")
+    with tempfile.TemporaryDirectory() as root:
+        write_batch_file(root, CHECK_RECORDS)
+        for image_type, name in [(types.RGB_PLANAR, "planar"), (types.RGB, "rgb"), (types.BGR, "bgr")]:
+            for memory_resident in [False, True]:
+                run_pipeline(args, root, image_type, memory_resident, check=True)
+                print("%-7s %-9s %d samples match their records" % (name, "resident" if memory_resident else "file", CHECK_RECORDS))
+    with tempfile.TemporaryDirectory() as root:
+        write_batch_file(root, THROUGHPUT_RECORDS)
+        for image_type, name in [(types.RGB_PLANAR, "planar"), (types.RGB, "rgb")]:
+            best = {}
+            for memory_resident in [False, True] * max(args.num_epochs, 1):
+                elapsed = run_pipeline(args, root, image_type, memory_resident, check=False)
+                best[memory_resident] = min(best.get(memory_resident, elapsed), elapsed)
+            print("%-7s file %.0f samples/s, resident %.0f samples/s" %
+                  (name, THROUGHPUT_RECORDS / best[False], THROUGHPUT_RECORDS / best[True]))
+    print("##############################  CIFAR10 RESIDENT SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
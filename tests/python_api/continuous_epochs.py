@@ -0,0 +1,76 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import cv2
+import os
+import tempfile
+import numpy as np
+from parse_config import parse_args
+
+BATCH_SIZE = 4
+IMAGE_COUNT = 12
+EPOCHS = 3
+
+
+def write_images(root):
+    folder = os.path.join(root, "images")
+    os.makedirs(folder)
+    for idx in range(IMAGE_COUNT):
+        cv2.imwrite(os.path.join(folder, "image_%02d.jpg" % idx), np.full((16, 16, 3), 10 + 20 * idx, dtype=np.uint8))
+
+
+def main():
+    args = parse_args()
+    if args.rocal_gpu:
+        print("The outputs are compared on the host, running on the cpu backend")
+    with tempfile.TemporaryDirectory() as root:
+        write_images(root)
+        pipeline = Pipeline(batch_size=BATCH_SIZE, num_threads=args.num_threads, device_id=args.local_rank, seed=args.seed, rocal_cpu=True)
+        pipeline.set_continuous_epochs(True)
+        with pipeline:
+            jpegs, _ = fn.readers.file(file_root=root)
+            images = fn.decoders.image(jpegs, file_root=root, output_type=types.RGB, random_shuffle=True)
+            pipeline.set_outputs(images)
+        pipeline.build()
+        if pipeline.get_remaining_images() != IMAGE_COUNT:
+            raise RuntimeError("The pipeline starts with %d images instead of %d" % (pipeline.get_remaining_images(), IMAGE_COUNT))
+        batches_per_epoch = IMAGE_COUNT // BATCH_SIZE
+        # The epochs run back to back, the remaining count runs down each one and starts over after its last batch
+        for epoch in range(EPOCHS):
+            for idx in range(batches_per_epoch):
+                if pipeline.rocal_run() != 0:
+                    raise RuntimeError("Epoch %d: the pipeline ran out of data at batch %d" % (epoch, idx))
+                last_batch = (idx == batches_per_epoch - 1)
+                if pipeline.get_batch_epoch() != epoch or pipeline.is_last_batch_of_epoch() != last_batch:
+                    raise RuntimeError("Epoch %d batch %d is reported in epoch %d, last batch %s" % (epoch, idx, pipeline.get_batch_epoch(), pipeline.is_last_batch_of_epoch()))
+                expected = IMAGE_COUNT if last_batch else IMAGE_COUNT - (idx + 1) * BATCH_SIZE
+                if pipeline.get_remaining_images() != expected:
+                    raise RuntimeError("Epoch %d batch %d leaves %d remaining images instead of %d" % (epoch, idx, pipeline.get_remaining_images(), expected))
+        pipeline.rocal_release()
+        print("The remaining images count down %d epochs and start over at each epoch" % EPOCHS)
+    print("##############################  CONTINUOUS EPOCHS SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,96 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import cv2
+import os
+import tempfile
+import numpy as np
+from parse_config import parse_args
+
+BATCH_SIZE = 2
+IMAGE_COUNT = 8  # More batches than the loader prefetches, so the batches loaded later are checked too
+RESIZE = 32      # An eighth of the images, the TurboJPEG decoder can decode them at 1/8 scale
+
+
+def write_images(root):
+    folder = os.path.join(root, "images")
+    os.makedirs(folder)
+    rng = np.random.default_rng(7)
+    for idx in range(IMAGE_COUNT):
+        # Noise makes a scaled decode differ from a full decode followed by a resize
+        cv2.imwrite(os.path.join(folder, "image_%d.jpg" % idx), rng.integers(0, 256, (8 * RESIZE, 8 * RESIZE, 3), dtype=np.uint8))
+
+
+def create_pipeline(args, root, hinted):
+    pipeline = Pipeline(batch_size=BATCH_SIZE, num_threads=args.num_threads, device_id=args.local_rank, seed=args.seed, rocal_cpu=True)
+    # Without the optimizer the unused branch is kept and the decoded images are not only resized, the loader decodes them in full
+    pipeline.set_graph_optimization(hinted)
+    with pipeline:
+        jpegs, _ = fn.readers.file(file_root=root)
+        images = fn.decoders.image(jpegs, file_root=root, output_type=types.RGB, random_shuffle=False)
+        resized = fn.resize(images, resize_width=RESIZE, resize_height=RESIZE)
+        if not hinted:
+            fn.brightness(images, brightness=1.5)
+        pipeline.set_outputs(resized)
+    pipeline.build()
+    return pipeline
+
+
+def run_epoch(pipeline):
+    batches = []
+    while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+        tensor = pipeline.get_output_tensors()[0]
+        output = np.empty(tensor.dimensions(), dtype=tensor.dtype())
+        tensor.copy_data(output)
+        batches.append(output)
+    pipeline.rocal_reset_loaders()
+    return batches
+
+
+def main():
+    args = parse_args()
+    if args.rocal_gpu:
+        print("The outputs are compared on the host, running on the cpu backend")
+    with tempfile.TemporaryDirectory() as root:
+        write_images(root)
+        pipeline = create_pipeline(args, root, hinted=False)
+        full_decode = run_epoch(pipeline)
+        pipeline.rocal_release()
+        pipeline = create_pipeline(args, root, hinted=True)
+        # The loader starts prefetching once build() has passed the hint to it, the first batches are decoded with it too
+        epochs = [run_epoch(pipeline), run_epoch(pipeline)]
+        pipeline.rocal_release()
+        if len(full_decode) != IMAGE_COUNT // BATCH_SIZE or any(len(epoch) != len(full_decode) for epoch in epochs):
+            raise RuntimeError("The epochs ran %s batches instead of %d" % ([len(full_decode)] + [len(epoch) for epoch in epochs], IMAGE_COUNT // BATCH_SIZE))
+        for idx, (first, second, full) in enumerate(zip(epochs[0], epochs[1], full_decode)):
+            if not np.array_equal(first, second):
+                raise RuntimeError("Batch %d differs between the epochs, it was decoded before the hint was applied" % idx)
+            if np.array_equal(first, full):
+                raise RuntimeError("Batch %d matches the full decode, the decode hint was not applied" % idx)
+        print("Every batch of both epochs is decoded with the hint, including the first prefetched ones")
+    print("##############################  DECODE HINT SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
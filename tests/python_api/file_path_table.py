@@ -0,0 +1,94 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import cv2
+import os
+import tempfile
+import numpy as np
+from parse_config import parse_args
+
+BATCH_SIZE = 3
+# Class folders and file names of different lengths, so that the packed names of the table are not all the same size.
+# The labels are looked up by file name, so the names do not repeat across the folders
+CLASSES = ["a", "class with spaces", "long_" + "x" * 120]
+FILE_NAMES = ["%d.jpg", "image name %d.jpg", "sample_%d_" + "y" * 90 + ".jpg"]
+
+
+def write_dataset(root):
+    # Returns (file name, label, color) of every file in the order the reader lists them
+    files = []
+    color = 10
+    for label, class_name in enumerate(CLASSES):
+        folder = os.path.join(root, class_name)
+        os.makedirs(folder)
+        names = sorted(name % label for name in FILE_NAMES)
+        for name in names:
+            cv2.imwrite(os.path.join(folder, name), np.full((16, 16, 3), color, dtype=np.uint8))
+            files.append((name, label, color))
+            color += 25
+    return files
+
+
+def main():
+    args = parse_args()
+    if args.rocal_gpu:
+        print("The outputs are compared on the host, running on the cpu backend")
+    with tempfile.TemporaryDirectory() as root:
+        files = write_dataset(root)
+        pipeline = Pipeline(batch_size=BATCH_SIZE, num_threads=args.num_threads, device_id=args.local_rank, seed=args.seed, rocal_cpu=True)
+        with pipeline:
+            jpegs, _ = fn.readers.file(file_root=root)
+            images = fn.decoders.image(jpegs, file_root=root, output_type=types.RGB, random_shuffle=False)
+            pipeline.set_outputs(images)
+        pipeline.build()
+        read = []
+        while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+            tensor = pipeline.get_output_tensors()[0]
+            output = np.empty(tensor.dimensions(), dtype=tensor.dtype())
+            tensor.copy_data(output)
+            # The names of the batch are packed back to back, their lengths tell them apart
+            lengths = np.zeros(BATCH_SIZE, dtype=np.int32)
+            total_length = pipeline.get_image_name_length(lengths)
+            packed = pipeline.get_image_name(total_length)[:total_length].decode()
+            offsets = np.concatenate(([0], np.cumsum(lengths)))
+            names = [packed[offsets[i]:offsets[i + 1]] for i in range(BATCH_SIZE)]
+            for name, label, image in zip(names, pipeline.get_image_labels(), output):
+                read.append((name, int(label), int(round(float(image.mean())))))
+        pipeline.rocal_release()
+        if len(read) != len(files):
+            raise RuntimeError("Read %d images, the dataset has %d" % (len(read), len(files)))
+        for (name, label, color), (expected_name, expected_label, expected_color) in zip(read, files):
+            if name != expected_name:
+                raise RuntimeError("The reader named the file %s as %s" % (expected_name, name))
+            if label != expected_label:
+                raise RuntimeError("The file %s has the label %d, not the label %d of its folder" % (name, label, expected_label))
+            # The image is decoded from the path rebuilt by the table, its color tells which file was opened
+            if abs(color - expected_color) > 3:
+                raise RuntimeError("The file %s decoded to the color %d of another file, not %d" % (name, color, expected_color))
+        print("%d files in %d class folders kept their names, labels and contents" % (len(files), len(CLASSES)))
+    print("##############################  FILE PATH TABLE SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
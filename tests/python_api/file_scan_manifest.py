@@ -0,0 +1,111 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import cv2
+import os
+import tempfile
+import numpy as np
+from parse_config import parse_args
+
+BATCH_SIZE = 2
+CLASSES = ["cat", "dog"]
+IMAGES_PER_CLASS = 4
+
+
+def write_image(path):
+    cv2.imwrite(path, np.full((16, 16, 3), 128, dtype=np.uint8))
+
+
+def write_dataset(root):
+    for class_name in CLASSES:
+        os.makedirs(os.path.join(root, class_name))
+        for idx in range(IMAGES_PER_CLASS):
+            write_image(os.path.join(root, class_name, "%s_%d.jpg" % (class_name, idx)))
+
+
+def read_count(args, root, manifest_dir, file_list=""):
+    # Returns the number of images the reader listed, after reading them all
+    pipeline = Pipeline(batch_size=BATCH_SIZE, num_threads=args.num_threads, device_id=args.local_rank, seed=args.seed, rocal_cpu=True)
+    pipeline.set_file_scan_options(manifest_dir=manifest_dir)
+    with pipeline:
+        jpegs, _ = fn.readers.file(file_root=root, file_list=file_list)
+        images = fn.decoders.image(jpegs, file_root=root, output_type=types.RGB, random_shuffle=False)
+        pipeline.set_outputs(images)
+    pipeline.build()
+    count = pipeline.get_remaining_images()
+    while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+        pass
+    pipeline.rocal_release()
+    return count
+
+
+def main():
+    args = parse_args()
+    if args.rocal_gpu:
+        print("The outputs are compared on the host, running on the cpu backend")
+    with tempfile.TemporaryDirectory() as root_dir:
+        root = os.path.join(root_dir, "dataset")
+        manifest_dir = os.path.join(root_dir, "manifests")
+        write_dataset(root)
+        dataset_size = len(CLASSES) * IMAGES_PER_CLASS
+
+        count = read_count(args, root, manifest_dir)
+        if count != dataset_size or len(os.listdir(manifest_dir)) != 1:
+            raise RuntimeError("The first scan listed %d of %d images and wrote %d manifests" % (count, dataset_size, len(os.listdir(manifest_dir))))
+
+        # A file added without changing the folder modification time is not seen, the listing comes from the manifest
+        folder = os.path.join(root, CLASSES[0])
+        folder_stat = os.stat(folder)
+        write_image(os.path.join(folder, "%s_%d.jpg" % (CLASSES[0], IMAGES_PER_CLASS)))
+        os.utime(folder, ns=(folder_stat.st_atime_ns, folder_stat.st_mtime_ns))
+        count = read_count(args, root, manifest_dir)
+        if count != dataset_size:
+            raise RuntimeError("The folders were listed again although unmodified, %d images instead of %d" % (count, dataset_size))
+
+        # Once the folder modification time changes the manifest is stale and the folders are listed again
+        os.utime(folder, ns=(folder_stat.st_atime_ns, folder_stat.st_mtime_ns + 1000000000))
+        dataset_size += 1
+        count = read_count(args, root, manifest_dir)
+        if count != dataset_size:
+            raise RuntimeError("The stale manifest was used, %d images instead of %d" % (count, dataset_size))
+
+        # The files of a file list are checked on every scan, a deleted file does not change the file list
+        file_list = os.path.join(root_dir, "file_list.txt")
+        with open(file_list, "w") as f:
+            for label, class_name in enumerate(CLASSES):
+                for idx in range(IMAGES_PER_CLASS):
+                    f.write("%s/%s_%d.jpg %d\n" % (class_name, class_name, idx, label))
+        count = read_count(args, root, manifest_dir, file_list)
+        if count != len(CLASSES) * IMAGES_PER_CLASS:
+            raise RuntimeError("The file list gave %d images instead of %d" % (count, len(CLASSES) * IMAGES_PER_CLASS))
+        os.remove(os.path.join(root, CLASSES[1], "%s_0.jpg" % CLASSES[1]))
+        count = read_count(args, root, manifest_dir, file_list)
+        if count != len(CLASSES) * IMAGES_PER_CLASS - 1:
+            raise RuntimeError("The deleted file was still listed, %d images instead of %d" % (count, len(CLASSES) * IMAGES_PER_CLASS - 1))
+        print("The manifest was reused while the folders were unmodified and the deleted file was dropped from the file list")
+    print("##############################  FILE SCAN MANIFEST SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
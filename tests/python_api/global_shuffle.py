@@ -0,0 +1,99 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import cv2
+import os
+import tempfile
+import numpy as np
+from parse_config import parse_args
+
+BATCH_SIZE = 4
+IMAGE_COUNT = 16
+NUM_SHARDS = 2
+EPOCHS = 3
+
+
+def color_of(idx):
+    return 10 + 15 * idx
+
+
+def write_images(root):
+    folder = os.path.join(root, "images")
+    os.makedirs(folder)
+    for idx in range(IMAGE_COUNT):
+        cv2.imwrite(os.path.join(folder, "image_%02d.jpg" % idx), np.full((16, 16, 3), color_of(idx), dtype=np.uint8))
+
+
+def create_pipeline(args, root, shard_id):
+    # Every shard pipeline has the same seed, so they slice the same global permutation
+    pipeline = Pipeline(batch_size=BATCH_SIZE, num_threads=args.num_threads, device_id=args.local_rank, seed=args.seed, rocal_cpu=True)
+    with pipeline:
+        jpegs, _ = fn.readers.file(file_root=root)
+        images = fn.decoders.image(jpegs, file_root=root, output_type=types.RGB, shard_id=shard_id, num_shards=NUM_SHARDS, random_shuffle=True)
+        pipeline.set_outputs(images)
+    pipeline.build()
+    return pipeline
+
+
+def run_epoch(pipeline):
+    # Images of the epoch in their order, told apart by their flat color
+    images = []
+    while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+        tensor = pipeline.get_output_tensors()[0]
+        output = np.empty(tensor.dimensions(), dtype=tensor.dtype())
+        tensor.copy_data(output)
+        for image in output:
+            images.append(int(np.argmin([abs(float(image.mean()) - color_of(idx)) for idx in range(IMAGE_COUNT)])))
+    pipeline.rocal_reset_loaders()
+    return images
+
+
+def main():
+    args = parse_args()
+    if args.rocal_gpu:
+        print("The outputs are compared on the host, running on the cpu backend")
+    with tempfile.TemporaryDirectory() as root:
+        write_images(root)
+        pipelines = [create_pipeline(args, root, shard_id) for shard_id in range(NUM_SHARDS)]
+        epochs = []
+        for epoch in range(EPOCHS):
+            shards = [run_epoch(pipeline) for pipeline in pipelines]
+            # The shards split one permutation of the whole dataset, each image is read once per epoch
+            if sorted(shards[0] + shards[1]) != list(range(IMAGE_COUNT)):
+                raise RuntimeError("Epoch %d: the shards read %s and %s, not every image once" % (epoch, shards[0], shards[1]))
+            epochs.append(shards[0] + shards[1])
+        for pipeline in pipelines:
+            pipeline.rocal_release()
+        # The permutation is global, the first shard does not keep its contiguous slice of the file list
+        if sorted(epochs[0][:IMAGE_COUNT // NUM_SHARDS]) == list(range(IMAGE_COUNT // NUM_SHARDS)):
+            raise RuntimeError("The first shard read the first half of the files %s" % epochs[0][:IMAGE_COUNT // NUM_SHARDS])
+        # Every epoch draws a new permutation
+        if len(set(tuple(order) for order in epochs)) != EPOCHS:
+            raise RuntimeError("The epochs repeat their order %s" % epochs)
+        print("%d shards read a new permutation of the whole dataset in each of %d epochs" % (NUM_SHARDS, EPOCHS))
+    print("##############################  GLOBAL SHUFFLE SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,98 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import cv2
+import os
+import tempfile
+import numpy as np
+from parse_config import parse_args
+
+BATCH_SIZE = 4
+IMAGES_PER_CLASS = 6
+
+
+def write_images(root):
+    # Gradients with a different offset per image, so that any change of the crop, resize or flip shows in the output
+    ramp = np.linspace(20, 220, 64, dtype=np.float32)
+    for label in range(2):
+        folder = os.path.join(root, "class_%d" % label)
+        os.makedirs(folder)
+        for idx in range(IMAGES_PER_CLASS):
+            image = np.stack([np.tile(ramp, (48, 1)), np.tile(ramp[:48, None], (1, 64)), np.full((48, 64), 10 * idx + 100 * label)], axis=-1)
+            cv2.imwrite(os.path.join(folder, "image_%d.jpg" % idx), image.astype(np.uint8))
+
+
+def create_pipeline(args, root, optimize):
+    # Every rewrite of the optimizer is exercised: a Copy is dropped, Crop -> Flip and Resize -> Flip are fused and an unused branch is removed
+    pipeline = Pipeline(batch_size=BATCH_SIZE, num_threads=args.num_threads, device_id=args.local_rank, seed=args.seed, rocal_cpu=True)
+    pipeline.set_graph_optimization(optimize)
+    with pipeline:
+        jpegs, _ = fn.readers.file(file_root=root)
+        images = fn.decoders.image(jpegs, file_root=root, output_type=types.RGB)
+        cropped = fn.flip(fn.crop(images, crop=[32, 40], crop_pos_x=0.25, crop_pos_y=0.75), horizontal=1)
+        resized = fn.flip(fn.copy(fn.resize(images, resize_width=40, resize_height=30)), horizontal=1)
+        fn.brightness(images, brightness=1.5)
+        pipeline.set_outputs(cropped, resized)
+    pipeline.build()
+    return pipeline
+
+
+def run(pipeline):
+    batches = []
+    while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+        outputs = []
+        for tensor in pipeline.get_output_tensors():
+            output = np.empty(tensor.dimensions(), dtype=tensor.dtype())
+            tensor.copy_data(output)
+            outputs.append(output)
+        batches.append((outputs, np.array(pipeline.get_image_labels())))
+    return batches
+
+
+def main():
+    args = parse_args()
+    if args.rocal_gpu:
+        print("The outputs are compared on the host, running on the cpu backend")
+    with tempfile.TemporaryDirectory() as root:
+        write_images(root)
+        results = []
+        for optimize in (False, True):
+            pipeline = create_pipeline(args, root, optimize)
+            results.append(run(pipeline))
+            pipeline.rocal_release()
+        reference, optimized = results
+        if len(reference) == 0 or len(optimized) != len(reference):
+            raise RuntimeError("The optimized pipeline ran %d batches, the reference one %d" % (len(optimized), len(reference)))
+        for idx, ((outputs, labels), (expected, expected_labels)) in enumerate(zip(optimized, reference)):
+            if not np.array_equal(labels, expected_labels):
+                raise RuntimeError("Batch %d: the labels differ with the graph optimized" % idx)
+            for name, output, reference_output in zip(("Crop -> Flip", "Resize -> Copy -> Flip"), outputs, expected):
+                if output.shape != reference_output.shape or not np.array_equal(output, reference_output):
+                    raise RuntimeError("Batch %d: the %s output differs with the graph optimized" % (idx, name))
+        print("%d batches match with and without the graph optimizer" % len(reference))
+    print("##############################  GRAPH OPTIMIZER SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
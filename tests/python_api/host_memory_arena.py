@@ -0,0 +1,99 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import cv2
+import os
+import tempfile
+import numpy as np
+from parse_config import parse_args
+
+BATCH_SIZE = 2
+MB = 1024 * 1024
+# Bytes of each file, read in this order into the two compressed buffers of 1 MB. The first one grows to 1.8 MB and
+# then to 2.5 MB, releasing its blocks to the arena, and the second one grows into the 1.8 MB block released before
+FILE_SIZES = [int(1.8 * MB), 0, int(2.5 * MB), int(1.5 * MB)]
+
+
+def write_images(root):
+    folder = os.path.join(root, "images")
+    os.makedirs(folder)
+    for idx, size in enumerate(FILE_SIZES):
+        _, jpeg = cv2.imencode(".jpg", np.full((32, 32, 3), 40 + 50 * idx, dtype=np.uint8))
+        data = jpeg.tobytes()
+        # The decoder stops at the end of image marker, the padding only makes the file larger
+        with open(os.path.join(folder, "image_%d.jpg" % idx), "wb") as f:
+            f.write(data + bytes(max(size - len(data), 0)))
+
+
+def run(args, root, use_arena):
+    pipeline = Pipeline(batch_size=BATCH_SIZE, num_threads=args.num_threads, device_id=args.local_rank, seed=args.seed, rocal_cpu=not args.rocal_gpu)
+    if use_arena:
+        pipeline.set_host_memory_options()
+    with pipeline:
+        jpegs, _ = fn.readers.file(file_root=root)
+        images = fn.decoders.image(jpegs, file_root=root, output_type=types.RGB, random_shuffle=False)
+        pipeline.set_outputs(images)
+    pipeline.build()
+    batches = []
+    while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+        tensor = pipeline.get_output_tensors()[0]
+        output = np.empty(tensor.dimensions(), dtype=tensor.dtype())
+        tensor.copy_data(output)
+        batches.append(output)
+    stats = pipeline.get_host_memory_stats()
+    pipeline.rocal_release()
+    return batches, stats
+
+
+def main():
+    args = parse_args()
+    with tempfile.TemporaryDirectory() as root:
+        write_images(root)
+        reference, stats = run(args, root, use_arena=False)
+        # The default pipeline keeps allocating its host buffers from the heap
+        if stats.mapped_bytes or stats.allocation_count:
+            raise RuntimeError("The pipeline mapped %d bytes in %d allocations without the host memory options" % (stats.mapped_bytes, stats.allocation_count))
+        batches, stats = run(args, root, use_arena=True)
+        if len(reference) != len(FILE_SIZES) // BATCH_SIZE or len(batches) != len(reference):
+            raise RuntimeError("The pipelines ran %d and %d batches instead of %d" % (len(reference), len(batches), len(FILE_SIZES) // BATCH_SIZE))
+        for idx, (output, expected) in enumerate(zip(batches, reference)):
+            if not np.array_equal(output, expected):
+                raise RuntimeError("Batch %d differs when the host buffers come from the arena" % idx)
+        if stats.mapped_bytes == 0 or stats.allocation_count == 0 or stats.huge_page_bytes != 0:
+            raise RuntimeError("The arena mapped %d bytes, %d of them huge pages, in %d allocations" % (stats.mapped_bytes, stats.huge_page_bytes, stats.allocation_count))
+        # The compressed buffers released their blocks while growing, one of them was handed out again
+        if stats.reuse_count == 0 or not stats.in_use_bytes < stats.peak_in_use_bytes <= stats.mapped_bytes:
+            raise RuntimeError("The arena reused %d blocks, %d bytes are in use, %d at the peak and %d mapped" %
+                               (stats.reuse_count, stats.in_use_bytes, stats.peak_in_use_bytes, stats.mapped_bytes))
+        # The device backend registers the circular buffer slots it uploads from with hipHostRegister
+        if args.rocal_gpu and not 0 < stats.pinned_bytes <= stats.mapped_bytes:
+            raise RuntimeError("The arena pinned %d of %d mapped bytes on the device backend" % (stats.pinned_bytes, stats.mapped_bytes))
+        if not args.rocal_gpu and stats.pinned_bytes != 0:
+            raise RuntimeError("The arena pinned %d bytes on the cpu backend" % stats.pinned_bytes)
+        print("The host buffers come from the arena only when it is enabled, %d of %d allocations reused a released block" % (stats.reuse_count, stats.allocation_count))
+    print("##############################  HOST MEMORY ARENA SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
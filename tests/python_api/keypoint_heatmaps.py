@@ -0,0 +1,118 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import cv2
+import json
+import os
+import tempfile
+import numpy as np
+from parse_config import parse_args
+
+NUMBER_OF_JOINTS = 17  # Joints of a COCO person
+IMAGE_WIDTH, IMAGE_HEIGHT = 64, 48
+HEATMAP_WIDTH, HEATMAP_HEIGHT = IMAGE_WIDTH // 4, IMAGE_HEIGHT // 4
+SIGMA = 2.0
+IMAGE_COUNT = 4
+
+
+def joints_of(image_id):
+    # Joints spread over the image, the last ones are not labelled (v = 0), occluded (v = 1) and out of the heatmap
+    joints = []
+    for k in range(NUMBER_OF_JOINTS):
+        x, y, v = 3 + (7 * k + 5 * image_id) % (IMAGE_WIDTH - 6), 2 + (11 * k + 3 * image_id) % (IMAGE_HEIGHT - 4), 2
+        if k == NUMBER_OF_JOINTS - 3:
+            v = 0
+        elif k == NUMBER_OF_JOINTS - 2:
+            v = 1
+        elif k == NUMBER_OF_JOINTS - 1:
+            x, y = IMAGE_WIDTH + 40, IMAGE_HEIGHT + 40
+        joints.append((float(x), float(y), v))
+    return joints
+
+
+def write_dataset(root):
+    images, annotations = [], []
+    for image_id in range(1, IMAGE_COUNT + 1):
+        file_name = "%012d.jpg" % image_id
+        cv2.imwrite(os.path.join(root, file_name), np.full((IMAGE_HEIGHT, IMAGE_WIDTH, 3), 40 * image_id, dtype=np.uint8))
+        images.append({"id": image_id, "file_name": file_name, "width": IMAGE_WIDTH, "height": IMAGE_HEIGHT})
+        keypoints = [value for joint in joints_of(image_id) for value in joint]
+        annotations.append({"id": image_id, "image_id": image_id, "category_id": 1, "iscrowd": 0, "num_keypoints": NUMBER_OF_JOINTS,
+                            "bbox": [2, 2, IMAGE_WIDTH - 4, IMAGE_HEIGHT - 4], "area": 1, "keypoints": keypoints})
+    annotation_path = os.path.join(root, "person_keypoints.json")
+    with open(annotation_path, "w") as f:
+        json.dump({"images": images, "annotations": annotations, "categories": [{"id": 1, "name": "person"}]}, f)
+    return annotation_path
+
+
+def check_heatmaps(heatmaps, weights, image_id):
+    if heatmaps.shape != (NUMBER_OF_JOINTS, HEATMAP_HEIGHT, HEATMAP_WIDTH):
+        raise RuntimeError("Image %d has heatmaps of shape %s" % (image_id, heatmaps.shape))
+    stride_x, stride_y = IMAGE_WIDTH / HEATMAP_WIDTH, IMAGE_HEIGHT / HEATMAP_HEIGHT
+    for k, (x, y, v) in enumerate(joints_of(image_id)):
+        visibility = min(float(v), 1.0)
+        mu_x, mu_y = int(x / stride_x + 0.5), int(y / stride_y + 0.5)
+        if mu_x >= HEATMAP_WIDTH or mu_y >= HEATMAP_HEIGHT:
+            # The window of the joint misses the heatmap, it gets no Gaussian and no weight
+            if weights[k] != 0 or heatmaps[k].max() != 0:
+                raise RuntimeError("Image %d: joint %d is off the heatmap but has weight %f and peak %f" % (image_id, k, weights[k], heatmaps[k].max()))
+            continue
+        if weights[k] != visibility:
+            raise RuntimeError("Image %d: joint %d has target weight %f instead of its visibility %f" % (image_id, k, weights[k], visibility))
+        if visibility > 0.5:
+            if heatmaps[k].max() != 1.0 or heatmaps[k][mu_y, mu_x] != 1.0:
+                raise RuntimeError("Image %d: joint %d does not peak at (%d, %d)" % (image_id, k, mu_x, mu_y))
+        elif heatmaps[k].max() != 0:
+            raise RuntimeError("Image %d: joint %d of visibility %f has a Gaussian" % (image_id, k, visibility))
+
+
+def main():
+    args = parse_args()
+    if args.rocal_gpu:
+        print("The heatmaps are generated from the host meta data, running on the cpu backend")
+    with tempfile.TemporaryDirectory() as root:
+        annotation_path = write_dataset(root)
+        pipeline = Pipeline(batch_size=2, num_threads=args.num_threads, device_id=args.local_rank, seed=args.seed, rocal_cpu=True)
+        with pipeline:
+            jpegs, joints = fn.readers.coco_keypoints(annotations_file=annotation_path, sigma=SIGMA, output_width=IMAGE_WIDTH, output_height=IMAGE_HEIGHT)
+            images = fn.decoders.image(jpegs, file_root=root, annotations_file=annotation_path, output_type=types.RGB, shard_id=0, num_shards=1, random_shuffle=False)
+            fn.keypoint_heatmaps(joints, heatmap_width=HEATMAP_WIDTH, heatmap_height=HEATMAP_HEIGHT)
+            pipeline.set_outputs(images)
+        pipeline.build()
+        checked = 0
+        while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+            image_ids = np.zeros(2, dtype=np.int32)
+            pipeline.get_image_id(image_ids)
+            for heatmaps, weights, image_id in zip(pipeline.get_keypoint_heatmaps(), pipeline.get_keypoint_target_weights(), image_ids):
+                check_heatmaps(heatmaps, weights, int(image_id))
+                checked += 1
+        pipeline.rocal_release()
+        if checked != IMAGE_COUNT:
+            raise RuntimeError("Checked the heatmaps of %d images instead of %d" % (checked, IMAGE_COUNT))
+        print("Checked the heatmaps of %d images" % checked)
+    print("##############################  KEYPOINT HEATMAPS SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
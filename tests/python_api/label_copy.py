@@ -0,0 +1,110 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import cv2
+import os
+import tempfile
+import numpy as np
+from parse_config import parse_args
+
+BATCH_SIZE = 4
+CLASSES = ["bird", "cat", "dog"]
+IMAGES_PER_CLASS = 4
+LABEL_SMOOTHING = 0.1
+# The one hot labels of a batch of this many classes reach 1MB, they are split over the copy threads
+LARGE_NUM_CLASSES = 70000
+
+
+def write_dataset(root):
+    for class_name in CLASSES:
+        os.makedirs(os.path.join(root, class_name))
+        for idx in range(IMAGES_PER_CLASS):
+            cv2.imwrite(os.path.join(root, class_name, "%s_%d.jpg" % (class_name, idx)), np.full((16, 16, 3), 128, dtype=np.uint8))
+
+
+def check_labels(args, root, num_classes):
+    pipeline = Pipeline(batch_size=BATCH_SIZE, num_threads=args.num_threads, device_id=args.local_rank, seed=args.seed, rocal_cpu=True)
+    with pipeline:
+        jpegs, labels = fn.readers.file(file_root=root)
+        images = fn.decoders.image(jpegs, file_root=root, output_type=types.RGB, random_shuffle=True)
+        fn.one_hot(labels, num_classes=num_classes)
+        pipeline.set_outputs(images)
+    pipeline.build()
+    seen = set()
+    while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+        labels = np.array(pipeline.get_image_labels())
+        seen.update(labels.tolist())
+        # Typed labels
+        for dtype in (np.int32, np.int64, np.float32):
+            typed = np.full(BATCH_SIZE, -1, dtype=dtype)
+            pipeline.copy_image_labels(typed)
+            if not np.array_equal(typed, labels.astype(dtype)):
+                raise RuntimeError("The %s labels %s differ from %s" % (np.dtype(dtype).name, typed, labels))
+        # One hot labels, of every type and written through an address
+        one_hot = np.eye(num_classes, dtype=np.float32)[labels]
+        for dtype in (np.int32, np.int64, np.float32):
+            encoded = np.full((BATCH_SIZE, num_classes), -1, dtype=dtype)
+            pipeline.copy_one_hot_labels(encoded)
+            if not np.array_equal(encoded, one_hot.astype(dtype)):
+                raise RuntimeError("The %s one hot labels of %s are wrong" % (np.dtype(dtype).name, labels))
+        encoded = np.full((BATCH_SIZE, num_classes), -1, dtype=np.int64)
+        pipeline.copy_one_hot_labels(encoded.ctypes.data, label_type=types.LABEL_INT64, dest_device_type=types.HOST_MEMORY)
+        if not np.array_equal(encoded, one_hot.astype(np.int64)):
+            raise RuntimeError("The one hot labels of %s written through an address are wrong" % labels)
+        # The previous one hot call gives the same int32 labels
+        encoded = np.full((BATCH_SIZE, num_classes), -1, dtype=np.int32)
+        pipeline.get_one_hot_encoded_labels(encoded.ctypes.data, types.HOST_MEMORY)
+        if not np.array_equal(encoded, one_hot.astype(np.int32)):
+            raise RuntimeError("get_one_hot_encoded_labels() gave wrong labels for %s" % labels)
+        # Label smoothing moves LABEL_SMOOTHING of the probability evenly over all the classes
+        smoothed = np.zeros((BATCH_SIZE, num_classes), dtype=np.float32)
+        pipeline.copy_one_hot_labels(smoothed, label_smoothing=LABEL_SMOOTHING)
+        expected = one_hot * (1.0 - LABEL_SMOOTHING) + LABEL_SMOOTHING / num_classes
+        if not np.allclose(smoothed, expected, atol=1e-6) or not np.allclose(smoothed.sum(axis=1), 1.0, atol=1e-3):
+            raise RuntimeError("The smoothed one hot labels of %s are wrong" % labels)
+        try:
+            pipeline.copy_one_hot_labels(np.zeros((BATCH_SIZE, num_classes), dtype=np.int32), label_smoothing=LABEL_SMOOTHING)
+        except RuntimeError:
+            pass
+        else:
+            raise RuntimeError("Label smoothing was accepted for int32 labels")
+    pipeline.rocal_release()
+    if seen != set(range(len(CLASSES))):
+        raise RuntimeError("Read the labels %s instead of every class" % sorted(seen))
+
+
+def main():
+    args = parse_args()
+    if args.rocal_gpu:
+        print("The outputs are compared on the host, running on the cpu backend")
+    with tempfile.TemporaryDirectory() as root:
+        write_dataset(root)
+        check_labels(args, root, len(CLASSES))
+        check_labels(args, root, LARGE_NUM_CLASSES)
+        print("The typed and one hot labels match the labels of every batch, for %d and %d classes" % (len(CLASSES), LARGE_NUM_CLASSES))
+    print("##############################  LABEL COPY SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
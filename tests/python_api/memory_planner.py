@@ -0,0 +1,101 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import cv2
+import os
+import tempfile
+import numpy as np
+from parse_config import parse_args
+
+BATCH_SIZE = 2
+IMAGE_COUNT = 4
+WIDTH, HEIGHT = 64, 48
+TENSOR_SIZE = BATCH_SIZE * WIDTH * HEIGHT * 3  # Bytes of one intermediate tensor
+
+
+def write_images(root):
+    folder = os.path.join(root, "images")
+    os.makedirs(folder)
+    ramp = np.linspace(0, 255, WIDTH, dtype=np.float32)
+    for idx in range(IMAGE_COUNT):
+        image = np.stack([np.tile(ramp, (HEIGHT, 1)), np.tile(ramp[::-1], (HEIGHT, 1)), np.full((HEIGHT, WIDTH), 40 * idx)], axis=-1)
+        cv2.imwrite(os.path.join(folder, "image_%d.jpg" % idx), image.astype(np.uint8))
+
+
+def run(args, root, chain_length):
+    # The first flip is read again by a branch added after the chain, its memory must not be reused by the chain
+    pipeline = Pipeline(batch_size=BATCH_SIZE, num_threads=args.num_threads, device_id=args.local_rank, seed=args.seed, rocal_cpu=True)
+    pipeline.set_graph_optimization(False)
+    with pipeline:
+        jpegs, _ = fn.readers.file(file_root=root)
+        images = fn.decoders.image(jpegs, file_root=root, output_type=types.RGB, random_shuffle=False)
+        first = fn.flip(images, horizontal=1)
+        chain = first
+        for _ in range(chain_length):
+            chain = fn.flip(chain, horizontal=1)
+        branch = fn.flip(first, horizontal=1)
+        pipeline.set_outputs(images, chain, branch)
+    pipeline.build()
+    peak_memory = pipeline.get_peak_memory_size()
+    batches = []
+    while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+        outputs = []
+        for tensor in pipeline.get_output_tensors():
+            output = np.empty(tensor.dimensions(), dtype=tensor.dtype())
+            tensor.copy_data(output)
+            outputs.append(output)
+        batches.append(outputs)
+    pipeline.rocal_release()
+    return batches, peak_memory
+
+
+def main():
+    args = parse_args()
+    if args.rocal_gpu:
+        print("The outputs are compared on the host, running on the cpu backend")
+    with tempfile.TemporaryDirectory() as root:
+        write_images(root)
+        peak_memory = []
+        for chain_length in (2, 8):
+            batches, peak = run(args, root, chain_length)
+            peak_memory.append(peak)
+            if len(batches) != IMAGE_COUNT // BATCH_SIZE:
+                raise RuntimeError("The pipeline ran %d batches instead of %d" % (len(batches), IMAGE_COUNT // BATCH_SIZE))
+            for idx, (images, chain, branch) in enumerate(batches):
+                # An even number of flips after the first one leaves the images flipped once
+                if not np.array_equal(chain, images[:, :, ::-1]):
+                    raise RuntimeError("Batch %d: the chain of %d flips was overwritten" % (idx, chain_length + 1))
+                if not np.array_equal(branch, images):
+                    raise RuntimeError("Batch %d: the branch read the first flip after its memory was reused" % idx)
+        if min(peak_memory) == 0:
+            raise RuntimeError("The peak memory size is not reported")
+        # The intermediates of a chain alternate between two arenas, six more flips do not add a tensor
+        if peak_memory[1] - peak_memory[0] >= TENSOR_SIZE:
+            raise RuntimeError("Six more flips grew the peak memory from %d to %d bytes" % tuple(peak_memory))
+        print("The flip chains are correct and hold %d and %d bytes" % tuple(peak_memory))
+    print("##############################  MEMORY PLANNER SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
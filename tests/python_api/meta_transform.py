@@ -0,0 +1,144 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import cv2
+import json
+import os
+import tempfile
+import numpy as np
+from parse_config import parse_args
+
+NUMBER_OF_JOINTS = 17  # Joints of a COCO person
+IMAGE_WIDTH, IMAGE_HEIGHT = 64, 48
+IMAGE_COUNT = 4
+BATCH_SIZE = 2
+BOX = [16, 14, 40, 34]                   # ltrb, inside the crop window of every variant
+POLYGON = [16, 14, 40, 14, 28, 34]       # Triangle spanning the box
+
+
+def joints_of(image_id):
+    # Integer joints inside the crop window, so every variant keeps them on the heatmap
+    return [(float(10 + (5 * k + 3 * image_id) % 29), float(14 + (7 * k + image_id) % 21), 2) for k in range(NUMBER_OF_JOINTS)]
+
+
+# Each variant: augmentation applied to the decoded images, output size and where it moves a point (x, y) to
+VARIANTS = [
+    ("Flip", lambda images: fn.flip(images, horizontal=1), IMAGE_WIDTH, IMAGE_HEIGHT, lambda x, y: (IMAGE_WIDTH - x, y)),
+    ("Crop", lambda images: fn.crop(images, crop=[24, 32], crop_pos_x=0.25, crop_pos_y=0.5), 32, 24, lambda x, y: (x - 8, y - 12)),
+    ("Resize", lambda images: fn.resize(images, resize_width=32, resize_height=24), 32, 24, lambda x, y: (x / 2, y / 2)),
+    ("Resize -> Flip", lambda images: fn.flip(fn.resize(images, resize_width=32, resize_height=24), horizontal=1), 32, 24, lambda x, y: (32 - x / 2, y / 2)),
+]
+
+
+def write_dataset(root):
+    images, annotations = [], []
+    for image_id in range(1, IMAGE_COUNT + 1):
+        file_name = "%012d.jpg" % image_id
+        cv2.imwrite(os.path.join(root, file_name), np.full((IMAGE_HEIGHT, IMAGE_WIDTH, 3), 40 * image_id, dtype=np.uint8))
+        images.append({"id": image_id, "file_name": file_name, "width": IMAGE_WIDTH, "height": IMAGE_HEIGHT})
+        keypoints = [value for joint in joints_of(image_id) for value in joint]
+        annotations.append({"id": image_id, "image_id": image_id, "category_id": 1, "iscrowd": 0, "num_keypoints": NUMBER_OF_JOINTS,
+                            "bbox": [BOX[0], BOX[1], BOX[2] - BOX[0], BOX[3] - BOX[1]], "area": 1, "segmentation": [POLYGON], "keypoints": keypoints})
+    annotation_path = os.path.join(root, "annotations.json")
+    with open(annotation_path, "w") as f:
+        json.dump({"images": images, "annotations": annotations, "categories": [{"id": 1, "name": "person"}]}, f)
+    return annotation_path
+
+
+def move(points, transform):
+    moved = []
+    for x, y in zip(points[0::2], points[1::2]):
+        moved.extend(transform(x, y))
+    return np.array(moved, dtype=np.float32)
+
+
+def check_masks(args, root, annotation_path, name, augment, transform):
+    pipeline = Pipeline(batch_size=BATCH_SIZE, num_threads=args.num_threads, device_id=args.local_rank, seed=args.seed, rocal_cpu=True)
+    with pipeline:
+        jpegs, _, _ = fn.readers.coco(annotations_file=annotation_path, masks=True)
+        images = fn.decoders.image(jpegs, file_root=root, annotations_file=annotation_path, output_type=types.RGB, shard_id=0, num_shards=1, random_shuffle=False)
+        pipeline.set_outputs(augment(images))
+    pipeline.build()
+    corners = move(BOX, transform)
+    expected_box = np.array([min(corners[0], corners[2]), min(corners[1], corners[3]), max(corners[0], corners[2]), max(corners[1], corners[3])])
+    expected_polygon = move(POLYGON, transform)
+    checked = 0
+    while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+        for boxes in pipeline.get_bounding_box_cords():
+            if not np.allclose(boxes, expected_box, atol=1e-3):
+                raise RuntimeError("%s: the box moved to %s instead of %s" % (name, boxes, expected_box))
+        mask_count = np.zeros(pipeline.get_bounding_box_count(), dtype=np.int32)
+        polygon_size = np.zeros(pipeline.get_mask_count(mask_count), dtype=np.int32)
+        for objects in pipeline.get_mask_coordinates(polygon_size, mask_count):
+            polygon = np.array(objects[0][0], dtype=np.float32)
+            if len(objects) != 1 or not np.allclose(polygon, expected_polygon, atol=1e-3):
+                raise RuntimeError("%s: the mask moved to %s instead of %s" % (name, polygon, expected_polygon))
+            checked += 1
+    pipeline.rocal_release()
+    if checked != IMAGE_COUNT:
+        raise RuntimeError("%s: checked the masks of %d images instead of %d" % (name, checked, IMAGE_COUNT))
+
+
+def check_keypoints(args, root, annotation_path, name, augment, width, height, transform):
+    # Heatmaps as large as the output put the peak of every joint on its rounded position
+    pipeline = Pipeline(batch_size=BATCH_SIZE, num_threads=args.num_threads, device_id=args.local_rank, seed=args.seed, rocal_cpu=True)
+    with pipeline:
+        jpegs, joints = fn.readers.coco_keypoints(annotations_file=annotation_path, sigma=1.0, output_width=width, output_height=height)
+        images = fn.decoders.image(jpegs, file_root=root, annotations_file=annotation_path, output_type=types.RGB, shard_id=0, num_shards=1, random_shuffle=False)
+        output = augment(images)
+        fn.keypoint_heatmaps(joints, heatmap_width=width, heatmap_height=height)
+        pipeline.set_outputs(output)
+    pipeline.build()
+    checked = 0
+    while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+        image_ids = np.zeros(BATCH_SIZE, dtype=np.int32)
+        pipeline.get_image_id(image_ids)
+        for heatmaps, image_id in zip(pipeline.get_keypoint_heatmaps(), image_ids):
+            for k, (x, y, _) in enumerate(joints_of(int(image_id))):
+                moved_x, moved_y = transform(x, y)
+                expected = (int(moved_y + 0.5), int(moved_x + 0.5))
+                peak = np.unravel_index(np.argmax(heatmaps[k]), heatmaps[k].shape)
+                if heatmaps[k].max() != 1.0 or tuple(int(v) for v in peak) != expected:
+                    raise RuntimeError("%s: joint %d of image %d peaks at %s instead of %s" % (name, k, image_id, peak, expected))
+            checked += 1
+    pipeline.rocal_release()
+    if checked != IMAGE_COUNT:
+        raise RuntimeError("%s: checked the key points of %d images instead of %d" % (name, checked, IMAGE_COUNT))
+
+
+def main():
+    args = parse_args()
+    if args.rocal_gpu:
+        print("The meta data is checked on the host, running on the cpu backend")
+    with tempfile.TemporaryDirectory() as root:
+        annotation_path = write_dataset(root)
+        for name, augment, width, height, transform in VARIANTS:
+            check_masks(args, root, annotation_path, name, augment, transform)
+            check_keypoints(args, root, annotation_path, name, augment, width, height, transform)
+            print("%s moves the boxes, masks and key points" % name)
+    print("##############################  META TRANSFORM SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
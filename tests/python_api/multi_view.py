@@ -0,0 +1,90 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import cv2
+import os
+import tempfile
+import numpy as np
+from parse_config import parse_args
+
+BATCH_SIZE = 4
+NUM_VIEWS = 3
+CLASS_COLORS = [30, 100, 170, 240]  # Flat color of the images of each class folder
+IMAGES_PER_CLASS = 3
+
+
+def write_images(root):
+    # The file reader labels the folders in sorted order, the color of an image tells its label
+    for label, color in enumerate(CLASS_COLORS):
+        folder = os.path.join(root, "class_%d" % label)
+        os.makedirs(folder)
+        for idx in range(IMAGES_PER_CLASS):
+            cv2.imwrite(os.path.join(folder, "image_%d.jpg" % idx), np.full((32, 32, 3), color, dtype=np.uint8))
+
+
+def label_of(view):
+    return int(np.argmin([abs(float(view.mean()) - color) for color in CLASS_COLORS]))
+
+
+def main():
+    args = parse_args()
+    if args.rocal_gpu:
+        print("The outputs are compared on the host, running on the cpu backend")
+    with tempfile.TemporaryDirectory() as root:
+        write_images(root)
+        pipeline = Pipeline(batch_size=BATCH_SIZE, num_threads=args.num_threads, device_id=args.local_rank, seed=args.seed, rocal_cpu=True)
+        with pipeline:
+            jpegs, _ = fn.readers.file(file_root=root)
+            images = fn.decoders.image(jpegs, file_root=root, output_type=types.RGB, random_shuffle=True)
+            views = fn.multi_view(images, num_views=NUM_VIEWS)
+            pipeline.set_outputs(views)
+        pipeline.build()
+
+        batches = 0
+        while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+            tensor = pipeline.get_output_tensors()[0]
+            output = np.empty(tensor.dimensions(), dtype=tensor.dtype())
+            tensor.copy_data(output)
+            if output.shape[:2] != (BATCH_SIZE, NUM_VIEWS):
+                raise RuntimeError("Expected %d views of %d samples, got an output of shape %s" % (NUM_VIEWS, BATCH_SIZE, output.shape))
+            labels = pipeline.get_image_labels()
+            if len(labels) != BATCH_SIZE * NUM_VIEWS:
+                raise RuntimeError("Expected a label per view, got %d labels for %d views" % (len(labels), BATCH_SIZE * NUM_VIEWS))
+            # The views of a sample are contiguous in the output and in the labels
+            for sample in range(BATCH_SIZE):
+                for view in range(NUM_VIEWS):
+                    label = int(labels[sample * NUM_VIEWS + view])
+                    if label != label_of(output[sample, view]):
+                        raise RuntimeError("Batch %d: view %d of sample %d has label %d but the image of class %d" %
+                                           (batches, view, sample, label, label_of(output[sample, view])))
+            batches += 1
+        pipeline.rocal_release()
+        if batches == 0:
+            raise RuntimeError("The pipeline produced no batch")
+        print("%d batches of %d views each have the labels of their samples" % (batches, NUM_VIEWS))
+    print("##############################  MULTI VIEW SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,88 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import os
+import tempfile
+import numpy as np
+from parse_config import parse_args
+
+BATCH_SIZE = 2
+SHAPE = (6, 5, 3)
+
+
+def write_arrays(root):
+    # Each array is saved in C order and in Fortran order, both have the same logical shape and values
+    files, arrays = [], []
+    for idx in range(2):
+        array = (np.arange(np.prod(SHAPE), dtype=np.float32) + 100 * idx).reshape(SHAPE)
+        for order, saved in (("c", np.ascontiguousarray(array)), ("fortran", np.asfortranarray(array))):
+            name = "%s_%d.npy" % (order, idx)
+            np.save(os.path.join(root, name), saved)
+            files.append(name)
+            arrays.append(array)
+    if not np.load(os.path.join(root, files[1])).flags.f_contiguous:
+        raise RuntimeError("numpy did not save the array in Fortran order")
+    return files, arrays
+
+
+def read_arrays(args, root, files, roi_start=[], roi_shape=[]):
+    pipeline = Pipeline(batch_size=BATCH_SIZE, num_threads=args.num_threads, device_id=args.local_rank, seed=args.seed, rocal_cpu=True)
+    with pipeline:
+        arrays = fn.readers.numpy(file_root=root, files=files, output_layout=types.NHWC, roi_start=roi_start, roi_shape=roi_shape)
+        pipeline.set_outputs(arrays)
+    pipeline.build()
+    outputs = []
+    while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+        tensor = pipeline.get_output_tensors()[0]
+        output = np.empty(tensor.dimensions(), dtype=tensor.dtype())
+        tensor.copy_data(output)
+        outputs.extend(output)
+    pipeline.rocal_release()
+    return outputs
+
+
+def check(name, outputs, expected_arrays, files):
+    if len(outputs) != len(expected_arrays):
+        raise RuntimeError("%s: read %d arrays instead of %d" % (name, len(outputs), len(expected_arrays)))
+    for output, expected, path in zip(outputs, expected_arrays, files):
+        if output.shape != expected.shape or not np.array_equal(output, expected):
+            raise RuntimeError("%s: %s was read with shape %s instead of %s or with other values" % (name, path, output.shape, expected.shape))
+
+
+def main():
+    args = parse_args()
+    if args.rocal_gpu:
+        print("The arrays are compared on the host, running on the cpu backend")
+    with tempfile.TemporaryDirectory() as root:
+        files, arrays = write_arrays(root)
+        # Fortran ordered arrays come out in their logical shape, not with the shape reversed
+        check("Whole arrays", read_arrays(args, root, files), arrays, files)
+        # The region is taken in the logical dimensions of either order
+        check("Region", read_arrays(args, root, files, roi_start=[1, 2, 0], roi_shape=[3, 2, -1]), [array[1:4, 2:4, :] for array in arrays], files)
+        print("The Fortran ordered arrays and their regions are read in their logical shape")
+    print("##############################  NUMPY FORTRAN ORDER SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,86 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import numpy as np
+from parse_config import parse_args
+
+
+def snapshot(output, batch_size):
+    # Copies the leased samples, the views returned by at() read the leased buffers directly
+    return [np.array(output[0].at(idx)) for idx in range(batch_size)]
+
+
+def check_leases(leases, batch_size):
+    for batch, output, expected in leases:
+        for idx in range(batch_size):
+            if not np.array_equal(output[0].at(idx), expected[idx]):
+                raise RuntimeError("Leased batch " + str(batch) + " sample " + str(idx) + " changed while it was leased")
+
+
+def main():
+    args = parse_args()
+    # Args
+    data_path = args.image_dataset_path
+    batch_size = args.batch_size
+    num_threads = args.num_threads
+    random_seed = args.seed
+    local_rank = args.local_rank
+    num_leases = 3
+    if args.rocal_gpu:
+        print("Output leases are only supported for host outputs, running on the cpu backend")
+
+    # A shallow prefetch queue makes the pipeline reuse its output slots right away, leased slots must be skipped
+    pipeline = Pipeline(batch_size=batch_size, num_threads=num_threads, device_id=local_rank, seed=random_seed,
+                        rocal_cpu=True, prefetch_queue_depth=2)
+
+    with pipeline:
+        jpegs, _ = fn.readers.file(file_root=data_path)
+        images = fn.decoders.image(jpegs, file_root=data_path, output_type=types.RGB, shard_id=local_rank, num_shards=1, random_shuffle=True)
+        output = fn.resize(images, resize_width=224, resize_height=224)
+        pipeline.set_outputs(output)
+
+    pipeline.build()
+
+    leases = []
+    batch = 0
+    for epoch in range(args.num_epochs):
+        print("epoch:: ", epoch)
+        while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+            output = pipeline.acquire_output()
+            leases.append((batch, output, snapshot(output, batch_size)))
+            check_leases(leases, batch_size)
+            if len(leases) > num_leases:
+                pipeline.release_output(leases.pop(0)[1])
+            batch += 1
+        check_leases(leases, batch_size)
+        pipeline.rocal_reset_loaders()
+    check_leases(leases, batch_size)
+    for _, output, _ in leases:
+        pipeline.release_output(output)
+    print("Checked " + str(batch) + " batches with up to " + str(num_leases + 1) + " of them leased")
+    print("##############################  OUTPUT LEASE SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
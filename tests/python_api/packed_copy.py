@@ -0,0 +1,101 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import numpy as np
+from parse_config import parse_args
+from timeit import default_timer as timer
+
+
+def check_packed_copy(tensor, batch):
+    # The padded copy is the reference, every packed sample must match the ROI of its padded sample
+    dims = tensor.dimensions()
+    padded = np.empty(dims, dtype=tensor.dtype())
+    start = timer()
+    tensor.copy_data(padded)
+    padded_time = timer() - start
+    packed = np.empty(tensor.packed_data_size(), dtype=np.uint8)
+    start = timer()
+    offsets = tensor.copy_data_packed(packed)
+    packed_time = timer() - start
+    rois = np.zeros(dims[0] * 4, dtype=np.int32)
+    tensor.copy_roi(rois)
+    rois = rois.reshape(dims[0], 4)
+    if len(offsets) != dims[0] + 1 or offsets[-1] != packed.size:
+        raise RuntimeError("Batch " + str(batch) + " packed offsets do not cover the packed buffer")
+    for idx, (x, y, w, h) in enumerate(rois):
+        if tensor.layout() == "NCHW":
+            expected = padded[idx, :, y:y + h, x:x + w]
+        else:
+            expected = padded[idx, y:y + h, x:x + w, :]
+        sample = packed[offsets[idx]:offsets[idx + 1]].view(padded.dtype).reshape(expected.shape)
+        if not np.array_equal(sample, expected):
+            raise RuntimeError("Batch " + str(batch) + " sample " + str(idx) + " of the " + tensor.layout() + " output differs from the padded copy")
+    return padded.nbytes, packed.nbytes, padded_time, packed_time
+
+
+def main():
+    args = parse_args()
+    # Args
+    data_path = args.image_dataset_path
+    batch_size = args.batch_size
+    num_threads = args.num_threads
+    random_seed = args.seed
+    local_rank = args.local_rank
+    if args.rocal_gpu:
+        print("Packed copies are only supported for host outputs, running on the cpu backend")
+
+    pipeline = Pipeline(batch_size=batch_size, num_threads=num_threads, device_id=local_rank, seed=random_seed, rocal_cpu=True)
+
+    with pipeline:
+        jpegs, _ = fn.readers.file(file_root=data_path)
+        # The decoded images keep their own sizes in the max sized buffer, the normalized crops fill their buffer
+        images = fn.decoders.image(jpegs, file_root=data_path, output_type=types.RGB, shard_id=local_rank, num_shards=1, random_shuffle=True,
+                                   max_decoded_width=args.max_width, max_decoded_height=args.max_height)
+        resized = fn.resize(images, resize_shorter=256)
+        normalized = fn.crop_mirror_normalize(resized, crop=(224, 224), mean=[0.485 * 255, 0.456 * 255, 0.406 * 255],
+                                              std=[0.229 * 255, 0.224 * 255, 0.225 * 255], output_layout=types.NCHW, output_dtype=types.FLOAT)
+        pipeline.set_outputs(images, resized, normalized)
+
+    pipeline.build()
+
+    padded_bytes = packed_bytes = padded_time = packed_time = 0
+    batch = 0
+    for epoch in range(args.num_epochs):
+        print("epoch:: ", epoch)
+        while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+            for tensor in pipeline.get_output_tensors():
+                stats = check_packed_copy(tensor, batch)
+                padded_bytes += stats[0]
+                packed_bytes += stats[1]
+                padded_time += stats[2]
+                packed_time += stats[3]
+            batch += 1
+        pipeline.rocal_reset_loaders()
+    print("Checked " + str(batch) + " batches, packed " + str(packed_bytes) + " of " + str(padded_bytes) + " padded bytes")
+    print("Padded copy: " + str(padded_time) + " s, packed copy: " + str(packed_time) + " s")
+    print("##############################  PACKED COPY SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
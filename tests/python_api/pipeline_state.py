@@ -0,0 +1,112 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import cv2
+import os
+import tempfile
+import numpy as np
+from parse_config import parse_args
+
+BATCH_SIZE = 4
+IMAGE_COUNT = 32
+SAVED_BATCH = 2  # Batches run before the state is saved
+RESUMED_BATCHES = 3  # Batches compared after the state is restored
+
+
+def write_images(root):
+    # Gradients of a different color per image, so that the brightness and contrast changes show in every pixel
+    os.makedirs(os.path.join(root, "images"))
+    ramp = np.linspace(40, 200, 32, dtype=np.float32)
+    for idx in range(IMAGE_COUNT):
+        image = np.stack([np.tile(ramp, (32, 1)), np.tile(ramp[:, None], (1, 32)), np.full((32, 32), 5 * idx)], axis=-1)
+        cv2.imwrite(os.path.join(root, "images", "image_%02d.jpg" % idx), image.astype(np.uint8))
+
+
+def create_pipeline(args, root):
+    # Random brightness and contrast on shuffled images, both pipelines of the process are defined the same way
+    pipeline = Pipeline(batch_size=BATCH_SIZE, num_threads=args.num_threads, device_id=args.local_rank, seed=args.seed, rocal_cpu=True)
+    with pipeline:
+        jpegs, _ = fn.readers.file(file_root=root)
+        images = fn.decoders.image(jpegs, file_root=root, output_type=types.RGB, random_shuffle=True)
+        images = fn.brightness(images)
+        images = fn.contrast(images)
+        pipeline.set_outputs(images)
+    pipeline.build()
+    return pipeline
+
+
+def run(pipeline, batches):
+    outputs = []
+    for _ in range(batches):
+        if pipeline.get_remaining_images() <= 0 or pipeline.rocal_run() != 0:
+            raise RuntimeError("Pipeline ran out of data")
+        tensor = pipeline.get_output_tensors()[0]
+        output = np.empty(tensor.dimensions(), dtype=tensor.dtype())
+        tensor.copy_data(output)
+        outputs.append(output)
+    return outputs
+
+
+def check(name, outputs, expected):
+    for idx, (output, reference) in enumerate(zip(outputs, expected)):
+        if not np.array_equal(output, reference):
+            raise RuntimeError("%s: batch %d differs by up to %d" % (name, idx, int(np.abs(output.astype(np.int32) - reference).max())))
+
+
+def main():
+    args = parse_args()
+    if args.rocal_gpu:
+        print("The outputs are compared on the host, running on the cpu backend")
+    with tempfile.TemporaryDirectory() as root:
+        write_images(root)
+        # Two pipelines in one process, the first one saves its state, runs on and is restored while the second one runs in between
+        first = create_pipeline(args, root)
+        second = create_pipeline(args, root)
+        run(first, SAVED_BATCH)
+        state = first.get_state()
+        first_outputs = run(first, RESUMED_BATCHES)
+        second_outputs = run(second, 2)
+        first.set_state(state)
+        check("first pipeline after set_state", run(first, RESUMED_BATCHES), first_outputs)
+        second_outputs += run(second, 2)
+        first.rocal_release()
+        second.rocal_release()
+
+        # The state of the first pipeline holds none of the parameters of the second one, restoring it does not rewind them
+        first = create_pipeline(args, root)
+        second = create_pipeline(args, root)
+        run(first, SAVED_BATCH + RESUMED_BATCHES)
+        check("second pipeline", run(second, 4), second_outputs)
+        third = create_pipeline(args, root)
+        if len(third.get_state()) != len(state):
+            raise RuntimeError("The state of a pipeline depends on the other pipelines of the process")
+        first.rocal_release()
+        second.rocal_release()
+        third.rocal_release()
+        print("%d batches match after restoring the state saved at batch %d" % (RESUMED_BATCHES, SAVED_BATCH))
+    print("##############################  PIPELINE STATE SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
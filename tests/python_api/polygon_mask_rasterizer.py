@@ -0,0 +1,150 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import cv2
+import json
+import os
+import tempfile
+import numpy as np
+from parse_config import parse_args
+
+IMAGE_WIDTH, IMAGE_HEIGHT = 64, 48
+SCALE = 2
+MASK_WIDTH, MASK_HEIGHT = IMAGE_WIDTH * SCALE, IMAGE_HEIGHT * SCALE
+
+# Hand written objects of each image id: (category id, polygons)
+OBJECTS = {
+    1: [(1, [[4, 4, 30, 8, 12, 40]]),                                      # triangle
+        (2, [[20, 10, 60, 10, 60, 30, 20, 30]])],                          # rectangle drawn over the triangle
+    2: [(3, [[5, 5, 40, 5, 40, 15, 15, 15, 15, 44, 5, 44]]),               # concave L shape
+        (1, [[45, 2, 62, 2, 62, 12, 45, 12], [50, 30, 60, 46, 42, 46]])],  # one object made of two polygons
+}
+
+
+def write_dataset(root):
+    images, annotations = [], []
+    for image_id, objects in OBJECTS.items():
+        file_name = "%012d.jpg" % image_id
+        cv2.imwrite(os.path.join(root, file_name), np.full((IMAGE_HEIGHT, IMAGE_WIDTH, 3), 50 * image_id, dtype=np.uint8))
+        images.append({"id": image_id, "file_name": file_name, "width": IMAGE_WIDTH, "height": IMAGE_HEIGHT})
+        for category_id, polygons in objects:
+            xs = [x for polygon in polygons for x in polygon[0::2]]
+            ys = [y for polygon in polygons for y in polygon[1::2]]
+            annotations.append({"id": len(annotations) + 1, "image_id": image_id, "category_id": category_id, "iscrowd": 0,
+                                "bbox": [min(xs), min(ys), max(xs) - min(xs), max(ys) - min(ys)], "area": 1, "segmentation": polygons})
+    categories = [{"id": category_id, "name": str(category_id)} for category_id in (1, 2, 3)]
+    annotation_path = os.path.join(root, "annotations.json")
+    with open(annotation_path, "w") as f:
+        json.dump({"images": images, "annotations": annotations, "categories": categories}, f)
+    return annotation_path
+
+
+def inside(polygon, px, py):
+    # Even-odd rule, an edge counts when the point is in its half open vertical span
+    result = np.zeros(px.shape, dtype=bool)
+    xs, ys = polygon[0::2], polygon[1::2]
+    for i in range(len(xs)):
+        x0, y0, x1, y1 = xs[i - 1], ys[i - 1], xs[i], ys[i]
+        if y0 == y1:
+            continue
+        crosses = (y0 <= py) != (y1 <= py)
+        result ^= crosses & (px >= x0 + (py - y0) * (x1 - x0) / (y1 - y0))
+    return result
+
+
+def reference_mask(polygons, flip):
+    # Pixels covered by the augmented polygons, and the pixels whose centers are too close to an edge to compare
+    py, px = np.mgrid[0:MASK_HEIGHT, 0:MASK_WIDTH] + 0.5
+    covered = np.zeros(px.shape, dtype=bool)
+    ambiguous = np.zeros(px.shape, dtype=bool)
+    for polygon in polygons:
+        augmented = np.array(polygon, dtype=np.float64) * SCALE
+        if flip:
+            augmented[0::2] = MASK_WIDTH - augmented[0::2]
+        center = inside(augmented, px, py)
+        for dx, dy in ((1e-3, 0), (-1e-3, 0), (0, 1e-3), (0, -1e-3)):
+            ambiguous |= inside(augmented, px + dx, py + dy) != center
+        covered |= center
+    return covered, ambiguous
+
+
+def check_masks(masks, image_ids, mask_type, flip):
+    for mask, image_id in zip(masks, image_ids):
+        objects = OBJECTS[image_id]
+        if mask_type == types.INSTANCE_MASKS:
+            if mask.shape != (len(objects), MASK_HEIGHT, MASK_WIDTH):
+                raise RuntimeError("Image " + str(image_id) + " has instance masks of shape " + str(mask.shape))
+            for instance, (_, polygons) in enumerate(objects):
+                covered, ambiguous = reference_mask(polygons, flip)
+                if not np.array_equal(mask[instance][~ambiguous], covered[~ambiguous].astype(np.uint8)):
+                    raise RuntimeError("Instance " + str(instance) + " of image " + str(image_id) + " differs from the reference mask")
+        else:
+            expected = np.zeros((MASK_HEIGHT, MASK_WIDTH), dtype=np.uint8)
+            strict = np.ones((MASK_HEIGHT, MASK_WIDTH), dtype=bool)
+            for category_id, polygons in objects:  # Later objects are drawn over earlier ones
+                covered, ambiguous = reference_mask(polygons, flip)
+                expected[covered] = category_id
+                strict &= ~ambiguous
+            if not np.array_equal(mask[strict], expected[strict]):
+                raise RuntimeError("Semantic mask of image " + str(image_id) + " differs from the reference mask")
+
+
+def run_pipeline(args, root, annotation_path, mask_type, flip):
+    batch_size = len(OBJECTS)
+    pipeline = Pipeline(batch_size=batch_size, num_threads=args.num_threads, device_id=args.local_rank, seed=args.seed, rocal_cpu=True)
+    with pipeline:
+        jpegs, _, _ = fn.readers.coco(annotations_file=annotation_path, masks=True, avoid_class_remapping=True)
+        images = fn.decoders.image(jpegs, file_root=root, annotations_file=annotation_path, output_type=types.RGB, shard_id=0, num_shards=1, random_shuffle=False)
+        images = fn.resize(images, resize_width=MASK_WIDTH, resize_height=MASK_HEIGHT)
+        if flip:
+            images = fn.flip(images, horizontal=1)
+        fn.polygon_mask_rasterizer(mask_width=MASK_WIDTH, mask_height=MASK_HEIGHT, mask_type=mask_type, max_instances=4)
+        pipeline.set_outputs(images)
+    pipeline.build()
+    batches = 0
+    for epoch in range(args.num_epochs):
+        while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+            image_ids = np.zeros(batch_size, dtype=np.int32)
+            pipeline.get_image_id(image_ids)
+            check_masks(pipeline.get_rasterized_masks(), image_ids, mask_type, flip)
+            batches += 1
+        pipeline.rocal_reset_loaders()
+    pipeline.rocal_release()
+    return batches
+
+
+def main():
+    args = parse_args()
+    if args.rocal_gpu:
+        print("The mask rasterizer runs on the host meta data, running on the cpu backend")
+    with tempfile.TemporaryDirectory() as root:
+        annotation_path = write_dataset(root)
+        for mask_type, flip in ((types.INSTANCE_MASKS, False), (types.INSTANCE_MASKS, True), (types.SEMANTIC_MASKS, False), (types.SEMANTIC_MASKS, True)):
+            batches = run_pipeline(args, root, annotation_path, mask_type, flip)
+            print("Checked " + str(batches) + " batches of " + types._known_types[mask_type][0] + (" with" if flip else " without") + " flip")
+    print("##############################  POLYGON MASK RASTERIZER SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,88 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import cv2
+import os
+import tempfile
+import numpy as np
+from parse_config import parse_args
+
+BATCH_SIZE = 4
+IMAGE_COUNT = 8
+GRAY = 100
+
+
+def write_images(root):
+    folder = os.path.join(root, "images")
+    os.makedirs(folder)
+    for idx in range(IMAGE_COUNT):
+        cv2.imwrite(os.path.join(folder, "image_%d.jpg" % idx), np.full((16, 16, 3), GRAY, dtype=np.uint8))
+
+
+def draw_factors(args, root, seed):
+    # Two Brightness nodes with their own uniform parameter, the factor of every image is read back from its gray level
+    pipeline = Pipeline(batch_size=BATCH_SIZE, num_threads=args.num_threads, device_id=args.local_rank, seed=seed, rocal_cpu=True)
+    with pipeline:
+        jpegs, _ = fn.readers.file(file_root=root)
+        images = fn.decoders.image(jpegs, file_root=root, output_type=types.RGB, random_shuffle=False)
+        first = fn.brightness(images, brightness=fn.uniform(range=[0.5, 1.5]), brightness_shift=0.0)
+        second = fn.brightness(images, brightness=fn.uniform(range=[0.5, 1.5]), brightness_shift=0.0)
+        pipeline.set_outputs(first, second)
+    pipeline.build()
+    factors = [[], []]
+    while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+        for idx, tensor in enumerate(pipeline.get_output_tensors()):
+            output = np.empty(tensor.dimensions(), dtype=tensor.dtype())
+            tensor.copy_data(output)
+            factors[idx].extend(float(image.mean()) / GRAY for image in output)
+    pipeline.rocal_release()
+    return np.array(factors)
+
+
+def main():
+    args = parse_args()
+    if args.rocal_gpu:
+        print("The outputs are compared on the host, running on the cpu backend")
+    with tempfile.TemporaryDirectory() as root:
+        write_images(root)
+        factors = draw_factors(args, root, seed=1)
+        if factors.shape != (2, IMAGE_COUNT) or factors.min() < 0.49 or factors.max() > 1.51:
+            raise RuntimeError("The brightness factors %s are not drawn from [0.5, 1.5]" % factors)
+        # Every image of a batch and every batch gets its own draw
+        if len(np.unique(np.round(factors[0], 2))) < IMAGE_COUNT // 2:
+            raise RuntimeError("The images share their brightness factors %s" % factors[0])
+        # Each parameter has its own stream, two parameters with the same range no longer draw the same values
+        if np.allclose(factors[0], factors[1]):
+            raise RuntimeError("The two uniform parameters drew the same factors %s" % factors[0])
+        # The draws only depend on the seed, the parameter and the renewal, a new pipeline repeats them
+        if not np.array_equal(draw_factors(args, root, seed=1), factors):
+            raise RuntimeError("A pipeline with the same seed drew other factors")
+        if np.allclose(draw_factors(args, root, seed=2), factors):
+            raise RuntimeError("A pipeline with another seed drew the same factors")
+        print("The random parameters draw per image, per parameter and per seed, and repeat with the same seed")
+    print("##############################  RANDOM PARAMETERS SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
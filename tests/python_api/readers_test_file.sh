@@ -103,6 +103,31 @@ tf_detection_reader=1
 video_pipeline=1
 web_dataset_reader=1
 numpy_reader=1
+output_lease=1
+packed_copy=1
+polygon_mask_rasterizer=1
+ssd_random_crop=1
+sequence_frame_cache=1
+record_check=1
+cifar10_resident=1
+text_label_reader=1
+shared_data_service=1
+pipeline_state=1
+multi_view=1
+graph_optimizer=1
+keypoint_heatmaps=1
+sample_quarantine=1
+decode_hint=1
+continuous_epochs=1
+host_memory_arena=1
+random_parameters=1
+memory_planner=1
+meta_transform=1
+numpy_fortran_order=1
+global_shuffle=1
+file_path_table=1
+file_scan_manifest=1
+label_copy=1
 ####################################################################################################################################
 
 
@@ -390,4 +415,295 @@ if [[ numpy_reader -eq 1 ]]; then
         --num-threads 1 \
         --num-epochs 2 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
 fi
-####################################################################################################################################
\ No newline at end of file
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ output_lease -eq 1 ]]; then
+
+    # Mention dataset_path
+    data_dir=$ROCAL_DATA_PATH/rocal_data/images_jpg/labels_folder/
+    # output_lease.py
+    # Keeps several batches leased while the pipeline keeps producing, only supports the cpu backend
+    python"$ver" output_lease.py \
+        --image-dataset-path $data_dir \
+        --batch-size $batch_size \
+        --local-rank 0 \
+        --num-threads 1 \
+        --num-epochs 2 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ packed_copy -eq 1 ]]; then
+
+    # Mention dataset_path
+    data_dir=$ROCAL_DATA_PATH/rocal_data/images_jpg/labels_folder/
+    # packed_copy.py
+    # Compares the packed copy of the outputs with their padded copy, only supports the cpu backend
+    python"$ver" packed_copy.py \
+        --image-dataset-path $data_dir \
+        --batch-size $batch_size \
+        --local-rank 0 \
+        --num-threads 1 \
+        --num-epochs 2 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ polygon_mask_rasterizer -eq 1 ]]; then
+
+    # polygon_mask_rasterizer.py
+    # Writes a small COCO dataset of hand written polygons and compares the rasterized masks with reference masks, only supports the cpu backend
+    python"$ver" polygon_mask_rasterizer.py \
+        --local-rank 0 \
+        --num-threads 1 \
+        --num-epochs 2 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ ssd_random_crop -eq 1 ]]; then
+
+    # ssd_random_crop.py
+    # Writes a small COCO dataset of gradient images, checks that the SSD crops repeat for a seed and that the IoU thresholds are selected as often as in the SSD sampling, only supports the cpu backend
+    python"$ver" ssd_random_crop.py \
+        --local-rank 0 \
+        --num-threads 1 \
+        --seed 1 \
+        --num-epochs 100 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ sequence_frame_cache -eq 1 ]]; then
+
+    # sequence_frame_cache.py
+    # Writes folders of flat color frames, reads them with the sequence reader at several step and stride settings and checks the frames and the frame cache counters, only supports the cpu backend
+    python"$ver" sequence_frame_cache.py \
+        --local-rank 0 \
+        --num-threads 1 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ record_check -eq 1 ]]; then
+
+    # record_check.py
+    # Writes TFRecords with bit flips injected into some records, checks that the skip and substitute policies leave the corrupted records out and count them, that the fail policy stops the pipeline, and compares the throughput with and without the check, only supports the cpu backend
+    python"$ver" record_check.py \
+        --local-rank 0 \
+        --num-threads 1 \
+        --num-epochs 3 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ cifar10_resident -eq 1 ]]; then
+
+    # cifar10_resident.py
+    # Writes a synthetic CIFAR10 batch file, checks the planar and interleaved outputs of the file and memory resident modes against the records and compares their throughput, only supports the cpu backend
+    python"$ver" cifar10_resident.py \
+        --local-rank 0 \
+        --num-threads 1 \
+        --num-epochs 3 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ text_label_reader -eq 1 ]]; then
+
+    # text_label_reader.py
+    # Writes flat color images and a file list of their labels in several line layouts, checks the labels read with fn.readers.file and reports the pipeline startup time with a million line file list, only supports the cpu backend
+    python"$ver" text_label_reader.py \
+        --local-rank 0 \
+        --num-threads 1 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ shared_data_service -eq 1 ]]; then
+
+    # shared_data_service.py
+    # Writes flat color images, reads them through two pipelines sharing one data service at different rates with a reset in the middle of a pass and checks that each pipeline reads the same passes as a pipeline reading on its own, only supports the cpu backend
+    python"$ver" shared_data_service.py \
+        --local-rank 0 \
+        --num-threads 1 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ pipeline_state -eq 1 ]]; then
+
+    # pipeline_state.py
+    # Writes gradient images, saves the state of one of two pipelines with random brightness and contrast, restores it after running on and checks that the batches repeat and that the other pipeline is not rewound, only supports the cpu backend
+    python"$ver" pipeline_state.py \
+        --local-rank 0 \
+        --num-threads 1 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ multi_view -eq 1 ]]; then
+
+    # multi_view.py
+    # Writes flat color images in one folder per class, makes three views of every decoded image with fn.multi_view and checks that the output holds every view and that each view gets the label of its sample, only supports the cpu backend
+    python"$ver" multi_view.py \
+        --local-rank 0 \
+        --num-threads 1 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ graph_optimizer -eq 1 ]]; then
+
+    # graph_optimizer.py
+    # Writes gradient images, runs a pipeline whose graph has a copy to drop, a crop and a resize followed by a flip and an unused branch, with and without the graph optimizer, and checks that the outputs and labels match, only supports the cpu backend
+    python"$ver" graph_optimizer.py \
+        --local-rank 0 \
+        --num-threads 1 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ keypoint_heatmaps -eq 1 ]]; then
+
+    # keypoint_heatmaps.py
+    # Writes images and a COCO person key points file, generates the heatmaps of the joints with fn.keypoint_heatmaps and checks that each visible joint peaks at its rounded location with a target weight equal to its visibility, only supports the cpu backend
+    python"$ver" keypoint_heatmaps.py \
+        --local-rank 0 \
+        --num-threads 1 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ sample_quarantine -eq 1 ]]; then
+
+    # sample_quarantine.py
+    # Writes images with a corrupt JPEG, checks that it is quarantined, written to the quarantine file once, taken off the remaining images and skipped in the next epochs and runs, only supports the cpu backend
+    python"$ver" sample_quarantine.py \
+        --local-rank 0 \
+        --num-threads 1 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ decode_hint -eq 1 ]]; then
+
+    # decode_hint.py
+    # Writes noise images, resizes them to an eighth and checks that the batches prefetched before the build are decoded with the hint like the later ones and differ from a full decode, only supports the cpu backend
+    python"$ver" decode_hint.py \
+        --local-rank 0 \
+        --num-threads 1 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ continuous_epochs -eq 1 ]]; then
+
+    # continuous_epochs.py
+    # Runs three epochs back to back with continuous epochs and checks the epoch of every batch and that the remaining images count down each epoch and start over after its last batch, only supports the cpu backend
+    python"$ver" continuous_epochs.py \
+        --local-rank 0 \
+        --num-threads 1 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ host_memory_arena -eq 1 ]]; then
+
+    # host_memory_arena.py
+    # Writes JPEGs padded to grow the compressed buffers, checks that the host buffers come from the arena only once it is enabled, that released blocks are reused and that the outputs match the default allocation, the gpu backend also checks the pinned slots
+    python"$ver" host_memory_arena.py \
+        --$backend_arg \
+        --local-rank 0 \
+        --num-threads 1 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ random_parameters -eq 1 ]]; then
+
+    # random_parameters.py
+    # Draws brightness factors from two uniform parameters and checks that every image, batch and parameter gets its own draw and that the same seed repeats them, only supports the cpu backend
+    python"$ver" random_parameters.py \
+        --local-rank 0 \
+        --num-threads 1 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ memory_planner -eq 1 ]]; then
+
+    # memory_planner.py
+    # Runs chains of flips with a branch reading the first flip, checks the outputs and that a longer chain does not grow the peak memory, only supports the cpu backend
+    python"$ver" memory_planner.py \
+        --local-rank 0 \
+        --num-threads 1 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ meta_transform -eq 1 ]]; then
+
+    # meta_transform.py
+    # Writes a COCO file with a box, a polygon mask and key points per image and checks that flip, crop, resize and resize followed by flip move all of them, only supports the cpu backend
+    python"$ver" meta_transform.py \
+        --local-rank 0 \
+        --num-threads 1 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ numpy_fortran_order -eq 1 ]]; then
+
+    # numpy_fortran_order.py
+    # Saves arrays in C and Fortran order and checks that both are read, whole and as a region, in their logical shape and values, only supports the cpu backend
+    python"$ver" numpy_fortran_order.py \
+        --local-rank 0 \
+        --num-threads 1 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ global_shuffle -eq 1 ]]; then
+
+    # global_shuffle.py
+    # Reads flat colored images from two shuffled shards over three epochs and checks that the shards split a new permutation of the whole dataset every epoch, only supports the cpu backend
+    python"$ver" global_shuffle.py \
+        --local-rank 0 \
+        --num-threads 1 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ file_path_table -eq 1 ]]; then
+
+    # file_path_table.py
+    # Checks the file names, labels and contents of a dataset of class folders with long names and spaces
+    python"$ver" file_path_table.py \
+        --local-rank 0 \
+        --num-threads 1 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ file_scan_manifest -eq 1 ]]; then
+
+    # file_scan_manifest.py
+    # Checks that the file listing is cached in a manifest while the folders are unmodified and that deleted files of a file list are dropped
+    python"$ver" file_scan_manifest.py \
+        --local-rank 0 \
+        --num-threads 1 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
+
+####################################################################################################################################
+if [[ label_copy -eq 1 ]]; then
+
+    # label_copy.py
+    # Checks the typed and one hot labels copied into numpy arrays against the labels of every batch
+    python"$ver" label_copy.py \
+        --local-rank 0 \
+        --num-threads 1 2>&1 | tee -a run.log.rocAL_api_log.${CURRENTDATE}.txt
+fi
+####################################################################################################################################
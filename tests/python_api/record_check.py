@@ -0,0 +1,203 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import cv2
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+import numpy as np
+from parse_config import parse_args
+
+WIDTH, HEIGHT = 64, 48
+BATCH_SIZE = 4
+RECORD_FILES = [20, 20]  # Records in each synthetic TFRecord file
+PAYLOAD_FLIPS = [3, 9, 24, 30]  # Records with a bit flipped in the middle of the image
+CRC_FLIPS = [17]  # Records with a bit flipped in the stored data CRC
+FEATURE_KEY_MAP = {
+    'image/encoded': 'image/encoded',
+    'image/class/label': 'image/class/label',
+    'image/filename': 'image/filename'
+}
+
+
+def crc32c_table():
+    table = []
+    for byte in range(256):
+        crc = byte
+        for _ in range(8):
+            crc = (crc >> 1) ^ (0x82f63b78 if crc & 1 else 0)
+        table.append(crc)
+    return table
+
+
+CRC32C_TABLE = crc32c_table()
+
+
+def masked_crc32c(data):
+    crc = 0xffffffff
+    for byte in data:
+        crc = (crc >> 8) ^ CRC32C_TABLE[(crc ^ byte) & 0xff]
+    crc ^= 0xffffffff
+    return (((crc >> 15) | (crc << 17)) + 0xa282ead8) & 0xffffffff
+
+
+def varint(value):
+    out = bytearray()
+    while value > 0x7f:
+        out.append((value & 0x7f) | 0x80)
+        value >>= 7
+    out.append(value)
+    return bytes(out)
+
+
+def field(number, payload):
+    return varint(number << 3 | 2) + varint(len(payload)) + payload
+
+
+def example(jpeg, name, label):
+    # tensorflow.Example: features { feature { key: value } ... }, written by hand so the test needs no tensorflow
+    features = {
+        'image/encoded': field(1, field(1, jpeg)),                # BytesList
+        'image/filename': field(1, field(1, name.encode())),      # BytesList
+        'image/class/label': field(3, field(1, varint(label))),  # Int64List, packed
+    }
+    entries = b''.join(field(1, field(1, key.encode()) + field(2, value)) for key, value in features.items())
+    return field(1, entries)
+
+
+def image(idx, noise=False):
+    # Each image is a flat color whose red channel names the record, or noise for the throughput records
+    if noise:
+        return np.random.default_rng(idx).integers(0, 256, (HEIGHT * 4, WIDTH * 4, 3), dtype=np.uint8)
+    return np.full((HEIGHT, WIDTH, 3), (64, 128, 5 * idx), dtype=np.uint8)  # BGR
+
+
+def write_records(root, flip, noise=False):
+    # Returns the ids of the corrupted records
+    corrupted = set()
+    idx = 0
+    for file_idx, count in enumerate(RECORD_FILES):
+        with open(os.path.join(root, "train-%05d.tfrecord" % file_idx), "wb") as record_file:
+            for _ in range(count):
+                jpeg = cv2.imencode(".jpg", image(idx, noise), [cv2.IMWRITE_JPEG_QUALITY, 100])[1].tobytes()
+                data = bytearray(example(jpeg, "image_%03d.jpg" % idx, idx % 10))
+                length = struct.pack("<Q", len(data))
+                data_crc = bytearray(struct.pack("<I", masked_crc32c(data)))
+                if flip and idx in PAYLOAD_FLIPS:
+                    data[bytes(data).find(jpeg) + len(jpeg) // 2] ^= 0x10
+                    corrupted.add(idx)
+                if flip and idx in CRC_FLIPS:
+                    data_crc[1] ^= 0x01
+                    corrupted.add(idx)
+                record_file.write(length + struct.pack("<I", masked_crc32c(length)) + data + data_crc)
+                idx += 1
+    return corrupted
+
+
+def run_pipeline(args, root, policy):
+    # Returns the records decoded in one epoch, named by the red channel of their first pixel, the record check counters and the epoch time
+    pipeline = Pipeline(batch_size=BATCH_SIZE, num_threads=args.num_threads, device_id=args.local_rank, seed=args.seed, rocal_cpu=True)
+    pipeline.set_record_check_policy(policy)
+    with pipeline:
+        inputs = fn.readers.tfrecord(path=root, reader_type=0, user_feature_key_map=FEATURE_KEY_MAP,
+                                     features={key: None for key in FEATURE_KEY_MAP})
+        images = fn.decoders.image(inputs["image/encoded"], user_feature_key_map=FEATURE_KEY_MAP, output_type=types.RGB, path=root)
+        pipeline.set_outputs(images)
+    pipeline.build()
+    records = []
+    start = time.perf_counter()
+    while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+        tensor = pipeline.get_output_tensors()[0]
+        output = np.empty(tensor.dimensions(), dtype=tensor.dtype())
+        tensor.copy_data(output)
+        for sample in output.reshape(BATCH_SIZE, -1, 3):
+            records.append(int(round(float(sample[0, 0]) / 5)))
+    elapsed = time.perf_counter() - start
+    stats = [(shard.shard_id, shard.checked_records, shard.corrupted_records) for shard in pipeline.get_record_check_stats()]
+    pipeline.rocal_release()
+    return records, stats, elapsed
+
+
+def check_policy(args, root, corrupted, policy, name):
+    records, stats, _ = run_pipeline(args, root, policy)
+    intact = set(range(sum(RECORD_FILES))) - corrupted
+    if set(records) & corrupted:
+        raise RuntimeError("With the " + name + " policy the corrupted records " + str(sorted(set(records) & corrupted)) + " were decoded")
+    if set(records) != intact:
+        raise RuntimeError("With the " + name + " policy the intact records " + str(sorted(intact - set(records))) + " were not decoded")
+    if len(stats) != 1 or stats[0][2] != len(corrupted) or stats[0][1] < sum(RECORD_FILES):
+        raise RuntimeError("With the " + name + " policy the record check counted " + str(stats) + " for " + str(len(corrupted)) +
+                           " corrupted records out of " + str(sum(RECORD_FILES)))
+    print("%-12s %3d samples, shard %d: %d records checked, %d corrupted" % (name, len(records), *stats[0]))
+
+
+def check_fail_policy(root):
+    # A corrupted record under the FAIL policy ends the loading, the pipeline runs in a child process
+    child = subprocess.run([sys.executable, "-c", "import record_check, sys; record_check.run_fail(sys.argv[1])", root],
+                           cwd=os.path.dirname(os.path.abspath(__file__)), capture_output=True, text=True, timeout=600)
+    if child.returncode == 0 or "is corrupted" not in child.stdout + child.stderr:
+        raise RuntimeError("The FAIL policy did not stop the pipeline on a corrupted record")
+    print("%-12s stopped the pipeline on the first corrupted record" % "fail")
+
+
+def run_fail(root):
+    sys.argv = sys.argv[:1]
+    run_pipeline(parse_args(), root, types.RECORD_CHECK_FAIL)
+
+
+def check_throughput(args, root, epochs):
+    # The records are checked on the loader threads as they are read, which has to cost little next to decoding
+    best = {}
+    for policy in [types.RECORD_CHECK_OFF, types.RECORD_CHECK_SKIP] * epochs:
+        _, _, elapsed = run_pipeline(args, root, policy)
+        best[policy] = min(best.get(policy, elapsed), elapsed)
+    overhead = best[types.RECORD_CHECK_SKIP] / best[types.RECORD_CHECK_OFF] - 1
+    records = sum(RECORD_FILES)
+    print("unchecked %.0f records/s, checked %.0f records/s, overhead %.1f%%" %
+          (records / best[types.RECORD_CHECK_OFF], records / best[types.RECORD_CHECK_SKIP], 100 * overhead))
+    if overhead > 0.5:
+        raise RuntimeError("Checking the records slowed the pipeline down by %.0f%%" % (100 * overhead))
+
+
+def main():
+    args = parse_args()
+    if args.rocal_gpu:
+        print("The records are checked on the host, running on the cpu backend")
+    with tempfile.TemporaryDirectory() as root:
+        corrupted = write_records(root, flip=True)
+        check_policy(args, root, corrupted, types.RECORD_CHECK_SKIP, "skip")
+        check_policy(args, root, corrupted, types.RECORD_CHECK_SUBSTITUTE, "substitute")
+        check_fail_policy(root)
+    with tempfile.TemporaryDirectory() as root:
+        write_records(root, flip=False, noise=True)
+        check_throughput(args, root, max(args.num_epochs, 1))
+    print("##############################  RECORD CHECK SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
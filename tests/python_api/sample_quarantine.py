@@ -0,0 +1,138 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import cv2
+import os
+import tempfile
+import numpy as np
+from parse_config import parse_args
+
+BATCH_SIZE = 4
+IMAGE_COUNT = 12
+CORRUPT_IMAGE = 5  # Read in the second batch, its slot is refilled with the first image of the third batch
+
+
+def color_of(idx):
+    return 10 + 20 * idx
+
+
+def corrupt_jpeg(failure):
+    if failure == "header decode failed":
+        return b"\xff\xd8\xff\xe0" + bytes(range(256)) * 4
+    # The headers are kept up to the start of scan, the entropy coded data ends after two bytes
+    data = cv2.imencode(".jpg", np.random.default_rng(0).integers(0, 256, (16, 16, 3), dtype=np.uint8))[1].tobytes()
+    start_of_scan = data.index(b"\xff\xda")
+    scan_header_end = start_of_scan + 2 + int.from_bytes(data[start_of_scan + 2:start_of_scan + 4], "big")
+    return data[:scan_header_end + 2] + b"\xff\xd9"
+
+
+def write_images(root, failure):
+    folder = os.path.join(root, "images")
+    os.makedirs(folder)
+    for idx in range(IMAGE_COUNT):
+        path = os.path.join(folder, "image_%02d.jpg" % idx)
+        if idx == CORRUPT_IMAGE:
+            with open(path, "wb") as f:
+                f.write(corrupt_jpeg(failure))
+        else:
+            cv2.imwrite(path, np.full((16, 16, 3), color_of(idx), dtype=np.uint8))
+    return os.path.join(folder, "image_%02d.jpg" % CORRUPT_IMAGE)
+
+
+def run_epoch(pipeline):
+    # Images of the epoch, told apart by their flat color
+    images = []
+    while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+        tensor = pipeline.get_output_tensors()[0]
+        output = np.empty(tensor.dimensions(), dtype=tensor.dtype())
+        tensor.copy_data(output)
+        for image in output:
+            images.append(int(np.argmin([abs(float(image.mean()) - color_of(idx)) for idx in range(IMAGE_COUNT)])))
+    return images
+
+
+def create_pipeline(args, root, quarantine_path):
+    pipeline = Pipeline(batch_size=BATCH_SIZE, num_threads=args.num_threads, device_id=args.local_rank, seed=args.seed, rocal_cpu=True)
+    pipeline.set_quarantine_file(quarantine_path)
+    with pipeline:
+        jpegs, _ = fn.readers.file(file_root=root)
+        images = fn.decoders.image(jpegs, file_root=root, output_type=types.RGB, random_shuffle=False)
+        pipeline.set_outputs(images)
+    pipeline.build()
+    return pipeline
+
+
+def quarantine_lines(quarantine_path):
+    with open(quarantine_path) as f:
+        return [line.split("\t") for line in f.read().splitlines()]
+
+
+def check_quarantine(args, failure):
+    with tempfile.TemporaryDirectory() as root:
+        corrupt_path = write_images(root, failure)
+        quarantine_path = os.path.join(root, "quarantine.txt")
+        pipeline = create_pipeline(args, root, quarantine_path)
+        if pipeline.get_remaining_images() != IMAGE_COUNT:
+            raise RuntimeError("The pipeline starts with %d images instead of %d" % (pipeline.get_remaining_images(), IMAGE_COUNT))
+        # The corrupt image and the image refilling its slot leave the epoch one image short, the last three images do not make a batch
+        expected = [idx for idx in range(2 * BATCH_SIZE + 1) if idx != CORRUPT_IMAGE]
+        for epoch in range(2):
+            images = run_epoch(pipeline)
+            if images != expected:
+                raise RuntimeError("Epoch %d output the images %s instead of %s" % (epoch, images, expected))
+            if pipeline.get_remaining_images() != IMAGE_COUNT - len(expected) - 1:
+                raise RuntimeError("Epoch %d ended with %d remaining images, the corrupt image is not accounted for" % (epoch, pipeline.get_remaining_images()))
+            pipeline.rocal_reset_loaders()
+        if [os.path.realpath(path) for path in pipeline.get_quarantined_samples()] != [os.path.realpath(corrupt_path)]:
+            raise RuntimeError("Quarantined samples are %s" % pipeline.get_quarantined_samples())
+        pipeline.rocal_release()
+        # The second epoch skips the quarantined image before decoding it, it is written to the file only once
+        if [(os.path.realpath(line[0]), line[1]) for line in quarantine_lines(quarantine_path)] != [(os.path.realpath(corrupt_path), failure)]:
+            raise RuntimeError("The quarantine file lists %s" % quarantine_lines(quarantine_path))
+
+        # A new run loads the quarantine file and leaves the corrupt image out of the dataset
+        pipeline = create_pipeline(args, root, quarantine_path)
+        if pipeline.get_remaining_images() != IMAGE_COUNT - 1:
+            raise RuntimeError("The run after the quarantine starts with %d images instead of %d" % (pipeline.get_remaining_images(), IMAGE_COUNT - 1))
+        images = run_epoch(pipeline)
+        pipeline.rocal_release()
+        if not images or CORRUPT_IMAGE in images or images[:2 * BATCH_SIZE] != [idx for idx in range(2 * BATCH_SIZE + 1) if idx != CORRUPT_IMAGE]:
+            raise RuntimeError("The run after the quarantine output the images %s" % images)
+        if len(quarantine_lines(quarantine_path)) != 1:
+            raise RuntimeError("The quarantine file grew to %d lines" % len(quarantine_lines(quarantine_path)))
+        print("The image failing the %s is quarantined, written to the quarantine file and skipped in the next epochs and runs" % failure.replace(" failed", ""))
+
+
+def main():
+    args = parse_args()
+    if args.rocal_gpu:
+        print("The outputs are compared on the host, running on the cpu backend")
+    # The header of the first corrupt image does not decode, the second has a valid header and corrupt entropy coded data
+    for failure in ("header decode failed", "content decode failed"):
+        check_quarantine(args, failure)
+    print("##############################  SAMPLE QUARANTINE SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
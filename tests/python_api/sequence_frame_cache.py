@@ -0,0 +1,111 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import cv2
+import os
+import tempfile
+import numpy as np
+from parse_config import parse_args
+
+WIDTH, HEIGHT = 32, 24
+BATCH_SIZE = 2
+FOLDER_FRAMES = [20, 13]  # Frames in each synthetic folder
+# (sequence length, step, stride) of each run, every run but the last shares frames between the sequences
+SETTINGS = [(3, 1, 1), (4, 2, 1), (3, 1, 2), (5, 1, 1), (3, 3, 1)]
+
+
+def write_frames(root):
+    # Each frame is a flat color, red holds the frame index and green the folder, so a decoded frame names itself
+    for folder, count in enumerate(FOLDER_FRAMES):
+        os.makedirs(os.path.join(root, "stream_%d" % folder))
+        for idx in range(count):
+            frame = np.full((HEIGHT, WIDTH, 3), (128, 80 * folder, 10 * idx), dtype=np.uint8)  # BGR
+            cv2.imwrite(os.path.join(root, "stream_%d" % folder, "frame_%03d.jpg" % idx), frame, [cv2.IMWRITE_JPEG_QUALITY, 100])
+
+
+def expected_sequences(sequence_length, step, stride):
+    # The sequences of the reader in order, the last one repeated to fill the last batch
+    sequences = []
+    for folder, count in enumerate(FOLDER_FRAMES):
+        for start in range(0, count - stride * (sequence_length - 1), step):
+            sequences.append([(folder, start + i * stride) for i in range(sequence_length)])
+    while len(sequences) % BATCH_SIZE:
+        sequences.append(sequences[-1])
+    return sequences
+
+
+def frame_id(frame):
+    red, green = float(frame[..., 0].mean()), float(frame[..., 1].mean())
+    return int(round(green / 80)), int(round(red / 10))
+
+
+def run_pipeline(args, root, sequence_length, step, stride, shuffle):
+    pipeline = Pipeline(batch_size=BATCH_SIZE, num_threads=args.num_threads, device_id=args.local_rank, seed=args.seed, rocal_cpu=True)
+    with pipeline:
+        frames = fn.readers.sequence_reader(file_root=root, sequence_length=sequence_length, random_shuffle=shuffle, step=step, stride=stride)
+        pipeline.set_outputs(frames)
+    pipeline.build()
+    sequences = []
+    while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+        tensor = pipeline.get_output_tensors()[0]
+        output = np.empty(tensor.dimensions(), dtype=tensor.dtype())
+        tensor.copy_data(output)
+        for sequence in output.reshape(BATCH_SIZE, sequence_length, HEIGHT, WIDTH, 3):
+            sequences.append([frame_id(frame) for frame in sequence])
+    stats = pipeline.get_frame_cache_stats()
+    pipeline.rocal_release()
+    return sequences, stats.hits, stats.misses
+
+
+def check_setting(args, root, sequence_length, step, stride, shuffle):
+    setting = "sequence length " + str(sequence_length) + ", step " + str(step) + ", stride " + str(stride) + (" shuffled" if shuffle else "")
+    expected = expected_sequences(sequence_length, step, stride)
+    sequences, hits, misses = run_pipeline(args, root, sequence_length, step, stride, shuffle)
+    # Shuffling reorders whole sequences, the frames inside each sequence are unchanged
+    if (sorted(sequences) if shuffle else sequences) != (sorted(expected) if shuffle else expected):
+        raise RuntimeError("The sequences read with " + setting + " are not the sequences of the frame folders")
+    frames = sum(len(sequence) for sequence in sequences)
+    if hits + misses != frames:
+        raise RuntimeError("With " + setting + " the frame cache counted " + str(hits + misses) + " frames for " + str(frames) + " frames read")
+    # In order, a frame is read again within the batch worth of frames kept decoded, so it is decoded only once
+    unique = len(set(frame for sequence in sequences for frame in sequence))
+    if not shuffle and misses != unique:
+        raise RuntimeError("With " + setting + " " + str(misses) + " frames were decoded for " + str(unique) + " distinct frames")
+    print("%-50s %4d frames %4d decoded, hit rate %.2f" % (setting, frames, misses, hits / frames))
+
+
+def main():
+    args = parse_args()
+    if args.rocal_gpu:
+        print("The frames are decoded on the host, running on the cpu backend")
+    with tempfile.TemporaryDirectory() as root:
+        write_frames(root)
+        for sequence_length, step, stride in SETTINGS:
+            check_setting(args, root, sequence_length, step, stride, False)
+        check_setting(args, root, 3, 1, 1, True)
+    print("##############################  SEQUENCE FRAME CACHE SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
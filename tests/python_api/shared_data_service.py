@@ -0,0 +1,138 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import cv2
+import os
+import tempfile
+import numpy as np
+from parse_config import parse_args
+
+BATCH_SIZE = 4
+IMAGE_COUNT = 32
+SERVICE_NAME = "shared_data_service_test"
+
+
+def write_images(root):
+    # Each image is a flat color whose red channel names it, the odd ones go to the second class
+    os.makedirs(os.path.join(root, "class_a"))
+    os.makedirs(os.path.join(root, "class_b"))
+    for idx in range(IMAGE_COUNT):
+        folder = "class_b" if idx % 2 else "class_a"
+        cv2.imwrite(os.path.join(root, folder, "image_%02d.jpg" % idx), np.full((16, 16, 3), (0, 0, 7 * idx), dtype=np.uint8))
+
+
+def create_pipeline(args, root, shared):
+    pipeline = Pipeline(batch_size=BATCH_SIZE, num_threads=args.num_threads, device_id=args.local_rank, seed=args.seed, rocal_cpu=True)
+    if shared:
+        pipeline.set_shared_data_service(SERVICE_NAME, 2)
+    with pipeline:
+        jpegs, _ = fn.readers.file(file_root=root)
+        images = fn.decoders.image(jpegs, file_root=root, output_type=types.RGB, random_shuffle=True)
+        pipeline.set_outputs(images)
+    pipeline.build()
+    return pipeline
+
+
+def read_batch(pipeline):
+    # Returns the images of the next batch by the red channel of their first pixel, checking each one against its label
+    if pipeline.rocal_run() != 0:
+        raise RuntimeError("Pipeline run failed")
+    tensor = pipeline.get_output_tensors()[0]
+    output = np.empty(tensor.dimensions(), dtype=tensor.dtype())
+    tensor.copy_data(output)
+    images = []
+    for sample, label in zip(output.reshape(BATCH_SIZE, -1, 3), pipeline.get_image_labels()):
+        idx = int(round(float(sample[0, 0]) / 7))
+        if int(label) != idx % 2:
+            raise RuntimeError("Image %d came with the label %d" % (idx, int(label)))
+        images.append(idx)
+    return images
+
+
+def check(name, images, expected):
+    if images != expected:
+        raise RuntimeError("%s read %s, expected %s" % (name, str(images), str(expected)))
+
+
+def main():
+    args = parse_args()
+    if args.rocal_gpu:
+        print("The shared batches are checked on the host, running on the cpu backend")
+    with tempfile.TemporaryDirectory() as root:
+        write_images(root)
+        # The order of the images in the first three passes of a pipeline reading on its own
+        reference = create_pipeline(args, root, shared=False)
+        passes = []
+        for _ in range(3):
+            images = []
+            while reference.get_remaining_images() > 0:
+                images += read_batch(reference)
+            passes.append(images)
+            reference.rocal_reset_loaders()
+        reference.rocal_release()
+
+        fast = create_pipeline(args, root, shared=True)
+        slow = create_pipeline(args, root, shared=True)
+        # First pass: the fast pipeline reads two batches for each batch of the slow one
+        fast_images, slow_images = [], []
+        while fast.get_remaining_images() > 0 or slow.get_remaining_images() > 0:
+            for _ in range(2):
+                if fast.get_remaining_images() > 0:
+                    fast_images += read_batch(fast)
+            if slow.get_remaining_images() > 0:
+                slow_images += read_batch(slow)
+        check("fast pipeline, first pass", fast_images, passes[0])
+        check("slow pipeline, first pass", slow_images, passes[0])
+
+        # Second pass: the fast pipeline resets after three batches and reads the third pass before the slow one is done with the second
+        fast.rocal_reset_loaders()
+        slow.rocal_reset_loaders()
+        fast_images, slow_images = [], []
+        for _ in range(3):
+            fast_images += read_batch(fast)
+            slow_images += read_batch(slow)
+        check("fast pipeline, second pass", fast_images, passes[1][:3 * BATCH_SIZE])
+        fast.rocal_reset_loaders()
+        fast_images = []
+        while fast.get_remaining_images() > 0:
+            fast_images += read_batch(fast)
+        check("fast pipeline, third pass", fast_images, passes[2])
+        while slow.get_remaining_images() > 0:
+            slow_images += read_batch(slow)
+        check("slow pipeline, second pass", slow_images, passes[1])
+
+        # The slow pipeline catches up with the third pass after its own reset
+        slow.rocal_reset_loaders()
+        slow_images = []
+        while slow.get_remaining_images() > 0:
+            slow_images += read_batch(slow)
+        check("slow pipeline, third pass", slow_images, passes[2])
+        fast.rocal_release()
+        slow.rocal_release()
+        print("two pipelines read %d passes at different rates with a reset in the middle of a pass" % len(passes))
+    print("##############################  SHARED DATA SERVICE SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,203 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import cv2
+import json
+import math
+import os
+import random
+import tempfile
+import numpy as np
+from parse_config import parse_args
+
+SIZE = 256
+BATCH_SIZE = 8
+NUM_ATTEMPTS = 20
+# The box of every image, ltrb in pixels
+BOX = (64, 80, 160, 160)
+IOU_OPTIONS = [(0.0, 1.0), (0.1, 1.0), (0.3, 1.0), (0.5, 1.0), (0.45, 1.0), (0.35, 1.0), (0.0, 1.0)]
+# Crops are bucketed by the IoU thresholds they meet, the whole image is a bucket of its own
+IOU_EDGES = [0.1, 0.3, 0.35, 0.45, 0.5]
+BUCKETS = ["whole image"] + ["IoU below 0.1"] + ["IoU from " + str(IOU_EDGES[i]) + (" to " + str(IOU_EDGES[i + 1]) if i + 1 < len(IOU_EDGES) else " up") for i in range(len(IOU_EDGES))]
+
+
+def write_dataset(root):
+    # The red and green values of a pixel are its x and y, so a crop can be located from its top left pixel
+    x, y = np.meshgrid(np.arange(SIZE, dtype=np.uint8), np.arange(SIZE, dtype=np.uint8))
+    gradient = np.stack([np.zeros_like(x), y, x], axis=-1)  # BGR
+    images, annotations = [], []
+    for image_id in range(1, BATCH_SIZE + 1):
+        file_name = "%012d.jpg" % image_id
+        cv2.imwrite(os.path.join(root, file_name), gradient, [cv2.IMWRITE_JPEG_QUALITY, 100])
+        images.append({"id": image_id, "file_name": file_name, "width": SIZE, "height": SIZE})
+        annotations.append({"id": image_id, "image_id": image_id, "category_id": 1, "iscrowd": 0,
+                            "bbox": [BOX[0], BOX[1], BOX[2] - BOX[0], BOX[3] - BOX[1]], "area": 1})
+    annotation_path = os.path.join(root, "annotations.json")
+    with open(annotation_path, "w") as f:
+        json.dump({"images": images, "annotations": annotations, "categories": [{"id": 1, "name": "1"}]}, f)
+    return annotation_path
+
+
+def bucket(x, y, w, h):
+    if w == SIZE and h == SIZE:
+        return 0
+    iw = max(0, min(x + w, BOX[2]) - max(x, BOX[0]))
+    ih = max(0, min(y + h, BOX[3]) - max(y, BOX[1]))
+    intersection = iw * ih
+    iou = intersection / ((BOX[2] - BOX[0]) * (BOX[3] - BOX[1]) + w * h - intersection)
+    return 1 + sum(iou >= edge for edge in IOU_EDGES)
+
+
+def reference_distribution(count):
+    # Unbounded SSD sampling loop, with the crop rounded to pixels the way the augmentation does
+    l, t, r, b = (v / SIZE for v in BOX)
+    hits = [0] * len(BUCKETS)
+    for _ in range(count):
+        while True:
+            option = random.randrange(len(IOU_OPTIONS))
+            if option == 0:
+                crop = (0.0, 0.0, 1.0, 1.0)
+                break
+            min_iou, max_iou = IOU_OPTIONS[option]
+            crop = None
+            for _ in range(NUM_ATTEMPTS):
+                w, h = random.uniform(0.3, 1.0), random.uniform(0.3, 1.0)
+                if w / h < 0.5 or w / h > 2.0:
+                    continue
+                cl, ct = random.uniform(0.0, 1.0 - w), random.uniform(0.0, 1.0 - h)
+                iw = max(0.0, min(r, cl + w) - max(l, cl))
+                ih = max(0.0, min(b, ct + h) - max(t, ct))
+                iou = iw * ih / ((r - l) * (b - t) + w * h - iw * ih)
+                cx, cy = (l + r) / 2, (t + b) / 2
+                if min_iou <= iou <= max_iou and cl <= cx <= cl + w and ct <= cy <= ct + h:
+                    crop = (cl, ct, w, h)
+                    break
+            if crop:
+                break
+        x, y = int(crop[0] * SIZE), int(crop[1] * SIZE)
+        hits[bucket(x, y, max(1, int(crop[2] * SIZE)), max(1, int(crop[3] * SIZE)))] += 1
+    return [hit / count for hit in hits]
+
+
+def run_pipeline(args, root, annotation_path, seed, epochs):
+    # Returns the output images, the output ROIs, the crop of every sample and the labels and boxes left in it
+    pipeline = Pipeline(batch_size=BATCH_SIZE, num_threads=args.num_threads, device_id=args.local_rank, seed=seed, rocal_cpu=True)
+    with pipeline:
+        jpegs, _, _ = fn.readers.coco(annotations_file=annotation_path, ltrb=True)
+        images = fn.decoders.image(jpegs, file_root=root, annotations_file=annotation_path, output_type=types.RGB, shard_id=0, num_shards=1, random_shuffle=False)
+        images = fn.ssd_random_crop(images, num_attempts=NUM_ATTEMPTS)
+        pipeline.set_outputs(images)
+    pipeline.build()
+    outputs, rois, crops, boxes = [], [], [], []
+    for epoch in range(epochs):
+        while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+            tensor = pipeline.get_output_tensors()[0]
+            output = np.empty(tensor.dimensions(), dtype=tensor.dtype())
+            tensor.copy_data(output)
+            roi = np.zeros(BATCH_SIZE * 4, dtype=np.int32)
+            tensor.copy_roi(roi)
+            roi = roi.reshape(BATCH_SIZE, 4)
+            outputs.append(output)
+            rois.append(roi)
+            for idx in range(BATCH_SIZE):
+                # The gradient survives the jpeg round trip to within a couple of levels
+                x, y = int(round(float(output[idx, 0, 0, 0]))), int(round(float(output[idx, 0, 0, 1])))
+                crops.append((x, y, int(roi[idx, 2]), int(roi[idx, 3])))
+            for labels, cords in zip(pipeline.get_bounding_box_labels(), pipeline.get_bounding_box_cords()):
+                boxes.append((np.array(labels).tolist(), np.array(cords).reshape(-1, 4)))
+        pipeline.rocal_reset_loaders()
+    pipeline.rocal_release()
+    return outputs, rois, crops, boxes
+
+
+def check_reproducibility(args, root, annotation_path):
+    first = run_pipeline(args, root, annotation_path, args.seed, 3)
+    second = run_pipeline(args, root, annotation_path, args.seed, 3)
+    for name, a, b in (("images", first[0], second[0]), ("ROIs", first[1], second[1])):
+        if len(a) != len(b) or any(not np.array_equal(x, y) for x, y in zip(a, b)):
+            raise RuntimeError("Two pipelines seeded with " + str(args.seed) + " cropped different " + name)
+    other = run_pipeline(args, root, annotation_path, args.seed + 1, 3)
+    if all(np.array_equal(x, y) for x, y in zip(first[1], other[1])):
+        raise RuntimeError("Pipelines seeded with " + str(args.seed) + " and " + str(args.seed + 1) + " cropped the same windows")
+    print("Crops are reproducible for seed " + str(args.seed))
+
+
+def check_distribution(args, root, annotation_path, epochs):
+    _, _, crops, _ = run_pipeline(args, root, annotation_path, args.seed, epochs)
+    count = len(crops)
+    hits = [0] * len(BUCKETS)
+    for x, y, w, h in crops:
+        # Up to 2 levels of jpeg error on the position move a few crops across a bucket edge, which the tolerance below absorbs
+        hits[bucket(x, y, w, h)] += 1
+    random.seed(args.seed)
+    expected = reference_distribution(20000)
+    for name, hit, p in zip(BUCKETS, hits, expected):
+        observed = hit / count
+        tolerance = 4 * math.sqrt(p * (1 - p) / count) + 0.02
+        print("%-20s observed %.3f expected %.3f" % (name, observed, p))
+        if abs(observed - p) > tolerance:
+            raise RuntimeError("Crops with " + name + " are selected " + str(observed) + " of the time, the SSD sampling selects them " + str(p) + " of the time")
+
+
+def check_boxes(args, root, annotation_path, epochs):
+    # The box is kept when its center falls in the crop, clipped to the crop and normalized to it, with the label of its category
+    _, _, crops, boxes = run_pipeline(args, root, annotation_path, args.seed, epochs)
+    if len(boxes) != len(crops):
+        raise RuntimeError("Got the boxes of " + str(len(boxes)) + " samples for " + str(len(crops)) + " crops")
+    center_x, center_y = (BOX[0] + BOX[2]) / 2, (BOX[1] + BOX[3]) / 2
+    tolerance = 3  # Pixels of jpeg error on the crop position read from the gradient
+    checked = 0
+    for (x, y, w, h), (labels, cords) in zip(crops, boxes):
+        inside_x, inside_y = x <= center_x <= x + w, y <= center_y <= y + h
+        if min(abs(center_x - x), abs(center_x - x - w), abs(center_y - y), abs(center_y - y - h)) <= tolerance:
+            continue  # Too close to an edge of the crop to tell from the gradient
+        checked += 1
+        if not (inside_x and inside_y):
+            if labels or len(cords):
+                raise RuntimeError("The crop " + str((x, y, w, h)) + " leaves the box center out but kept " + str(labels))
+            continue
+        if labels != [1] or len(cords) != 1:
+            raise RuntimeError("The crop " + str((x, y, w, h)) + " holds the box center but returned the labels " + str(labels))
+        expected = np.array([(max(BOX[0], x) - x) / w, (max(BOX[1], y) - y) / h, (min(BOX[2], x + w) - x) / w, (min(BOX[3], y + h) - y) / h])
+        if np.abs(cords[0] - expected).max() > tolerance / min(w, h) + 0.01:
+            raise RuntimeError("The crop " + str((x, y, w, h)) + " returned the box " + str(cords[0]) + " instead of " + str(expected))
+    if checked < len(crops) // 2:
+        raise RuntimeError("Only " + str(checked) + " of " + str(len(crops)) + " crops were far enough from the box center to be checked")
+    print("Boxes and labels follow the crops of %d samples" % checked)
+
+
+def main():
+    args = parse_args()
+    if args.rocal_gpu:
+        print("The crop windows are sampled on the host, running on the cpu backend")
+    with tempfile.TemporaryDirectory() as root:
+        annotation_path = write_dataset(root)
+        check_reproducibility(args, root, annotation_path)
+        check_boxes(args, root, annotation_path, 10)
+        check_distribution(args, root, annotation_path, max(args.num_epochs, 100))
+    print("##############################  SSD RANDOM CROP SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()
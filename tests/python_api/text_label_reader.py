@@ -0,0 +1,104 @@
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+from amd.rocal.pipeline import Pipeline
+import amd.rocal.fn as fn
+import amd.rocal.types as types
+
+import cv2
+import os
+import tempfile
+import time
+import numpy as np
+from parse_config import parse_args
+
+BATCH_SIZE = 4
+IMAGE_COUNT = 16
+STARTUP_LINES = 1000000  # Lines of the file list timed at startup, naming files that do not exist past the images
+
+
+def write_images(root):
+    # Each image is a flat color whose red channel names it, the labels are written in the file list in several layouts
+    os.makedirs(os.path.join(root, "class_a"))
+    os.makedirs(os.path.join(root, "class_b"))
+    labels = {}
+    lines = []
+    for idx in range(IMAGE_COUNT):
+        folder = "class_a" if idx % 2 else "class_b"
+        name = "image_%02d.jpg" % idx
+        cv2.imwrite(os.path.join(root, folder, name), np.full((16, 16, 3), (0, 0, 10 * idx), dtype=np.uint8))
+        labels[idx] = 3 * idx - 7
+        separator = ["\t", "   ", " \t "][idx % 3]
+        ending = "\r\n" if idx % 4 == 1 else "\n"
+        lines.append("%s%s/%s%s%d%s" % (" " if idx % 5 == 0 else "", folder, name, separator, labels[idx], ending))
+        if idx % 6 == 0:
+            lines.append("%s/%s %d\n" % (folder, name, 1000 + idx))  # A repeated name keeps its first label
+        if idx % 7 == 0:
+            lines.append("\n%s/missing_label.jpg\nnot_a_label.jpg x\n" % folder)  # Lines without a label are left out
+    return labels, lines
+
+
+def run_pipeline(args, root, file_list):
+    # Returns the label of every image of one epoch, by the red channel of its first pixel
+    pipeline = Pipeline(batch_size=BATCH_SIZE, num_threads=args.num_threads, device_id=args.local_rank, seed=args.seed, rocal_cpu=True)
+    with pipeline:
+        jpegs, _ = fn.readers.file(file_root=root, file_list=file_list)
+        images = fn.decoders.image(jpegs, file_root=root, output_type=types.RGB)
+        pipeline.set_outputs(images)
+    start = time.perf_counter()
+    pipeline.build()
+    startup = time.perf_counter() - start
+    labels = {}
+    while pipeline.get_remaining_images() > 0 and pipeline.rocal_run() == 0:
+        tensor = pipeline.get_output_tensors()[0]
+        output = np.empty(tensor.dimensions(), dtype=tensor.dtype())
+        tensor.copy_data(output)
+        for sample, label in zip(output.reshape(BATCH_SIZE, -1, 3), pipeline.get_image_labels()):
+            labels[int(round(float(sample[0, 0]) / 10))] = int(label)
+    pipeline.rocal_release()
+    return labels, startup
+
+
+def main():
+    args = parse_args()
+    if args.rocal_gpu:
+        print("The file list is parsed on the host, running on the cpu backend")
+    with tempfile.TemporaryDirectory() as root:
+        expected, lines = write_images(root)
+        file_list = os.path.join(root, "file_list.txt")
+        with open(file_list, "w", newline="") as list_file:
+            list_file.write("".join(lines))
+        labels, _ = run_pipeline(args, root, file_list)
+        if labels != expected:
+            raise RuntimeError("The labels read from the file list " + str(labels) + " do not match the labels written " + str(expected))
+        print("%d images read with the labels of their first line" % len(labels))
+
+        with open(file_list, "w", newline="") as list_file:
+            list_file.write("".join(lines))
+            list_file.writelines("class_c/n%07d.JPEG %d\n" % (idx, idx % 1000) for idx in range(STARTUP_LINES))
+        labels, startup = run_pipeline(args, root, file_list)
+        if labels != expected:
+            raise RuntimeError("The labels read from the long file list do not match the labels written")
+        print("pipeline build with a %d line file list took %.2f s" % (len(lines) + STARTUP_LINES, startup))
+    print("##############################  TEXT LABEL READER SUCCESS  ############################")
+
+
+if __name__ == '__main__':
+    main()